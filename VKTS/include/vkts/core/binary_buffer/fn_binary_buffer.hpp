@@ -74,6 +74,13 @@ VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY binaryBufferCreate(const uint64_t* da
  */
 VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY binaryBufferCreate(const float* data, const uint32_t size);
 
+/**
+ * Creates a read only view on a range of the given buffer. No data is copied.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY binaryBufferCreate(const IBinaryBufferSP& buffer, const uint32_t offset, const uint32_t size);
+
 }
 
 #endif /* VKTS_BINARY_BUFFER_HPP_ */
@@ -53,6 +53,14 @@ VKTS_APICALL const char* VKTS_APIENTRY fileGetBaseDirectory();
  */
 VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY fileLoadBinary(const char* filename);
 
+/**
+ * Maps the file into memory without copying it. The returned buffer is read only.
+ * If the file can not be mapped, it is loaded.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY fileMapBinary(const char* filename);
+
 /**
  *
  * @ThreadSafe
@@ -0,0 +1,110 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONBUILDER_HPP_
+#define VKTS_JSONBUILDER_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+class JsonArena;
+
+/**
+ * Builds JSON values out of the streaming parser events. All values are allocated from an arena,
+ * which is owned by the value returned by getValue(). Child values are only valid as long as this value exists.
+ */
+class JsonBuilder : public JsonSaxHandler
+{
+
+private:
+
+	typedef struct JsonBuilderLevel_ {
+		JSONobject* jsonObject;
+		JSONarray* jsonArray;
+		std::string key;
+	} JsonBuilderLevel;
+
+	std::shared_ptr<JsonArena> arena;
+
+	std::vector<JsonBuilderLevel> allLevels;
+
+	JSONvalue* root;
+
+	VkBool32 addValue(const JSONvalueSP& value);
+
+public:
+
+	JsonBuilder();
+	JsonBuilder(const JsonBuilder& other) = delete;
+	JsonBuilder(JsonBuilder&& other) = delete;
+	virtual ~JsonBuilder();
+
+	JsonBuilder& operator =(const JsonBuilder& other) = delete;
+	JsonBuilder& operator =(JsonBuilder && other) = delete;
+
+	/**
+	 * Releases the arena, so a new value can be built.
+	 */
+	void reset();
+
+	/**
+	 * Returns the value, as soon as it is complete.
+	 */
+	JSONvalueSP getValue() const;
+
+	//
+	// JsonSaxHandler
+	//
+
+	virtual VkBool32 beginObject() override;
+
+	virtual VkBool32 key(const std::string& key) override;
+
+	virtual VkBool32 endObject() override;
+
+	virtual VkBool32 beginArray() override;
+
+	virtual VkBool32 endArray() override;
+
+	virtual VkBool32 valueNull() override;
+
+	virtual VkBool32 valueFalse() override;
+
+	virtual VkBool32 valueTrue() override;
+
+	virtual VkBool32 valueFloat(const float value) override;
+
+	virtual VkBool32 valueInteger(const int32_t value) override;
+
+	virtual VkBool32 valueString(const std::string& value) override;
+
+};
+
+}
+
+#endif /* VKTS_JSONBUILDER_HPP_ */
@@ -0,0 +1,111 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONSAXHANDLER_HPP_
+#define VKTS_JSONSAXHANDLER_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Receives the events of the streaming JSON parser.
+ * Returning VK_FALSE stops the parser.
+ */
+class JsonSaxHandler
+{
+
+public:
+
+	JsonSaxHandler()
+	{
+	}
+
+	virtual ~JsonSaxHandler()
+	{
+	}
+
+	virtual VkBool32 beginObject()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 key(const std::string& key)
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 endObject()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 beginArray()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 endArray()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 valueNull()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 valueFalse()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 valueTrue()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 valueFloat(const float value)
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 valueInteger(const int32_t value)
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 valueString(const std::string& value)
+	{
+		return VK_TRUE;
+	}
+
+};
+
+}
+
+#endif /* VKTS_JSONSAXHANDLER_HPP_ */
@@ -38,6 +38,36 @@ namespace vkts
  */
 VKTS_APICALL JSONvalueSP VKTS_APIENTRY jsonDecode(const std::string& jsonText);
 
+/**
+ * Decodes in one pass and allocates all values from an arena, owned by the returned value.
+ * Child values are only valid as long as the returned value exists.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL JSONvalueSP VKTS_APIENTRY jsonDecodeFast(const char* jsonText, const uint32_t length);
+
+/**
+ * Decodes in one pass and allocates all values from an arena, owned by the returned value.
+ * Child values are only valid as long as the returned value exists.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL JSONvalueSP VKTS_APIENTRY jsonDecodeFast(const std::string& jsonText);
+
+/**
+ * Parses in one pass and passes all values as events to the handler, without building any values.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY jsonParse(const char* jsonText, const uint32_t length, JsonSaxHandler& handler);
+
+/**
+ * Gathers the byte range of every value of the root object, so each value can be parsed separately later.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY jsonIndexObject(const char* jsonText, const uint32_t length, Map<std::string, VkTsJsonRange>& allRanges);
+
 /**
  *
  * @ThreadSafe
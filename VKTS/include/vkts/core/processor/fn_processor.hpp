@@ -29,6 +29,10 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#define VKTS_PROCESSOR_FEATURE_SSE2 0x00000001
+#define VKTS_PROCESSOR_FEATURE_AVX 0x00000002
+#define VKTS_PROCESSOR_FEATURE_NEON 0x00000004
+
 namespace vkts
 {
 
@@ -44,6 +48,14 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY processorInit();
  */
 VKTS_APICALL uint32_t VKTS_APIENTRY processorGetNumber();
 
+/**
+ * Instruction set extensions, which can be used on this processor, as VKTS_PROCESSOR_FEATURE flags.
+ * AVX is only reported, if the operating system also saves the AVX registers.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint32_t VKTS_APIENTRY processorGetFeatures();
+
 /**
  * Not thread Safe.
  */
@@ -44,6 +44,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -130,6 +131,12 @@ typedef struct VkTsDynamicOffset_
     uint32_t stride;
 } VkTsDynamicOffset;
 
+typedef struct VkTsJsonRange_
+{
+    uint32_t offset;
+    uint32_t length;
+} VkTsJsonRange;
+
 /**
  * Interface.
  */
@@ -236,6 +243,9 @@ typedef struct VkTsDynamicOffset_
 #include <vkts/core/json/JSONfloat.hpp>
 #include <vkts/core/json/JSONinteger.hpp>
 
+#include <vkts/core/json/JsonSaxHandler.hpp>
+#include <vkts/core/json/JsonBuilder.hpp>
+
 #include <vkts/core/json/fn_json.hpp>
 
 #endif /* VKTS_VKTS_CORE_HPP_ */
@@ -54,6 +54,88 @@ VKTS_APICALL IImageDataSP VKTS_APIENTRY cacheLoadImageData(const char* filename)
  */
 VKTS_APICALL IImageDataSP VKTS_APIENTRY cacheLoadRawImageData(const char* filename, const uint32_t width, const uint32_t height, const VkFormat format);
 
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY cacheGetMaxSize();
+
+/**
+ * Sets the maximum size in bytes of all keyed cache entries. Least recently used entries are evicted, if exceeded. Zero disables the limit.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY cacheSetMaxSize(const uint64_t maxSize);
+
+/**
+ * Fast, non cryptographic 64 bit hash.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY cacheHash(const void* data, const size_t size, const uint64_t seed = 0);
+
+/**
+ * Hashes the content of the given file. Returns zero, if the file could not be read.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY cacheHashFile(const char* filename);
+
+/**
+ * Hashes the pixel data, extent and format of the given image data.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY cacheHashImageData(const IImageDataSP& imageData);
+
+/**
+ * Creates a cache key out of the hash of the source and all parameters used to generate the cached data. Returns an empty key, if the source hash is zero.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL std::string VKTS_APIENTRY cacheCreateKey(const uint64_t sourceHash, const std::string& parameters);
+
+/**
+ * Stores the image data under the given key. The file extension selects the file format.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY cacheSaveImageDataByKey(const std::string& key, const IImageDataSP& imageData, const std::string& extension);
+
+/**
+ * If a name is given, the loaded image data is named accordingly.
+ * A hit only updates the least recently used order in memory, which is saved on the next store or by cacheTerminate().
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IImageDataSP VKTS_APIENTRY cacheLoadImageDataByKey(const std::string& key, const std::string& name = "");
+
+/**
+ * Removes all keyed cache entries.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY cacheClear();
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY cacheGetStatistics(VkTsCacheStatistics& statistics);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY cacheResetStatistics();
+
+/**
+ * Saves the manifest, if cache hits changed the least recently used order.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY cacheTerminate();
+
 }
 
 #endif /* VKTS_FN_CACHE_HPP_ */
@@ -99,6 +99,12 @@ public:
 
     virtual glm::vec4 getTexel(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const = 0;
 
+    /**
+     * Stateless view on the texels of the given mip level and array layer.
+     * Returned view is invalid for block compressed and sRGB formats.
+     */
+    virtual ImageDataView getView(const uint32_t mipLevel, const uint32_t arrayLayer) const = 0;
+
     virtual glm::vec4 getSample(const float x, const VkFilter filterX, const VkSamplerAddressMode addressModeX, const float y, const VkFilter filterY, const VkSamplerAddressMode addressModeY, const float z, const VkFilter filterZ, const VkSamplerAddressMode addressModeZ, const uint32_t mipLevel, const uint32_t arrayLayer) const = 0;
 
     virtual glm::vec4 getSampleCubeMap(const float x, const float y, const float z, const VkFilter filter, const uint32_t mipLevel) const = 0;
@@ -0,0 +1,483 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IMAGEDATAVIEW_HPP_
+#define VKTS_IMAGEDATAVIEW_HPP_
+
+#include <vkts/image/vkts_image.hpp>
+
+namespace vkts
+{
+
+/**
+ * Decodes and encodes one texel. Format is resolved at compile time.
+ * SWIZZLE exchanges red and blue, as used by the BGR formats.
+ */
+template<typename T, uint32_t CHANNELS, VkBool32 SWIZZLE>
+class ImageDataTexel
+{
+};
+
+template<uint32_t CHANNELS, VkBool32 SWIZZLE>
+class ImageDataTexel<uint8_t, CHANNELS, SWIZZLE>
+{
+
+public:
+
+    static const uint32_t BYTES = CHANNELS;
+
+    static uint32_t getChannel(const uint32_t channelIndex)
+    {
+        if (SWIZZLE && (channelIndex == 0 || channelIndex == 2))
+        {
+            return 2 - channelIndex;
+        }
+
+        return channelIndex;
+    }
+
+    static glm::vec4 decode(const uint8_t* texel)
+    {
+        glm::vec4 result(0.0f, 0.0f, 0.0f, 1.0f);
+
+        for (uint32_t channelIndex = 0; channelIndex < CHANNELS; channelIndex++)
+        {
+            result[getChannel(channelIndex)] = (float)(texel[channelIndex]) / 255.0f;
+        }
+
+        return result;
+    }
+
+    static void encode(uint8_t* texel, const glm::vec4& rgba)
+    {
+        for (uint32_t channelIndex = 0; channelIndex < CHANNELS; channelIndex++)
+        {
+            texel[getChannel(channelIndex)] = (uint8_t)(rgba[channelIndex] * 255.0f);
+        }
+    }
+
+};
+
+template<uint32_t CHANNELS, VkBool32 SWIZZLE>
+class ImageDataTexel<float, CHANNELS, SWIZZLE>
+{
+
+public:
+
+    static const uint32_t BYTES = CHANNELS * sizeof(float);
+
+    static glm::vec4 decode(const uint8_t* texel)
+    {
+        float channels[CHANNELS];
+
+        memcpy(channels, texel, BYTES);
+
+        glm::vec4 result(0.0f, 0.0f, 0.0f, 1.0f);
+
+        for (uint32_t channelIndex = 0; channelIndex < CHANNELS; channelIndex++)
+        {
+            result[channelIndex] = channels[channelIndex];
+        }
+
+        return result;
+    }
+
+    static void encode(uint8_t* texel, const glm::vec4& rgba)
+    {
+        float channels[CHANNELS];
+
+        for (uint32_t channelIndex = 0; channelIndex < CHANNELS; channelIndex++)
+        {
+            channels[channelIndex] = rgba[channelIndex];
+        }
+
+        memcpy(texel, channels, BYTES);
+    }
+
+};
+
+typedef ImageDataTexel<uint8_t, 1, VK_FALSE> ImageDataTexelR8;
+typedef ImageDataTexel<uint8_t, 2, VK_FALSE> ImageDataTexelR8G8;
+typedef ImageDataTexel<uint8_t, 3, VK_FALSE> ImageDataTexelR8G8B8;
+typedef ImageDataTexel<uint8_t, 4, VK_FALSE> ImageDataTexelR8G8B8A8;
+typedef ImageDataTexel<uint8_t, 3, VK_TRUE> ImageDataTexelB8G8R8;
+typedef ImageDataTexel<uint8_t, 4, VK_TRUE> ImageDataTexelB8G8R8A8;
+typedef ImageDataTexel<float, 1, VK_FALSE> ImageDataTexelR32;
+typedef ImageDataTexel<float, 2, VK_FALSE> ImageDataTexelR32G32;
+typedef ImageDataTexel<float, 3, VK_FALSE> ImageDataTexelR32G32B32;
+typedef ImageDataTexel<float, 4, VK_FALSE> ImageDataTexelR32G32B32A32;
+
+/**
+ * View on the texels of one mip level and array layer.
+ *
+ * The view does not own the memory and has no cursor, so several threads can
+ * read and write through views as long as they access different texels.
+ * The typed functions do not check any bounds.
+ * Views on read only memory, e.g. a mapped file, reject all writes with an error.
+ */
+class ImageDataView
+{
+
+private:
+
+    uint8_t* data;
+
+    VkExtent3D extent;
+
+    uint32_t bytesPerTexel;
+    uint32_t rowPitch;
+    uint32_t depthPitch;
+
+    uint32_t numberChannels;
+    VkBool32 SFLOAT;
+    VkBool32 SWIZZLE;
+    VkBool32 READONLY;
+
+    template<class TEXEL>
+    void decodeTexels(glm::vec4* rgba, const uint8_t* texel, const uint32_t count) const
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            rgba[i] = TEXEL::decode(texel);
+
+            texel += TEXEL::BYTES;
+        }
+    }
+
+    template<class TEXEL>
+    void encodeTexels(uint8_t* texel, const glm::vec4* rgba, const uint32_t count) const
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            TEXEL::encode(texel, rgba[i]);
+
+            texel += TEXEL::BYTES;
+        }
+    }
+
+public:
+
+    ImageDataView() :
+        data(nullptr), extent{0, 0, 0}, bytesPerTexel(0), rowPitch(0), depthPitch(0), numberChannels(0), SFLOAT(VK_FALSE), SWIZZLE(VK_FALSE), READONLY(VK_FALSE)
+    {
+    }
+
+    ImageDataView(uint8_t* data, const VkExtent3D& extent, const uint32_t rowPitch, const uint32_t depthPitch, const uint32_t numberChannels, const VkBool32 SFLOAT, const VkBool32 SWIZZLE, const VkBool32 READONLY = VK_FALSE) :
+        data(data), extent(extent), bytesPerTexel(numberChannels * (SFLOAT ? (uint32_t)sizeof(float) : 1)), rowPitch(rowPitch), depthPitch(depthPitch), numberChannels(numberChannels), SFLOAT(SFLOAT), SWIZZLE(SWIZZLE), READONLY(READONLY)
+    {
+        if (!data || numberChannels == 0 || numberChannels > 4 || (SWIZZLE && (SFLOAT || numberChannels < 3)))
+        {
+            this->data = nullptr;
+            this->extent = VkExtent3D{0, 0, 0};
+        }
+    }
+
+    VkBool32 isValid() const
+    {
+        return data != nullptr;
+    }
+
+    VkBool32 isReadOnly() const
+    {
+        return READONLY;
+    }
+
+    const VkExtent3D& getExtent3D() const
+    {
+        return extent;
+    }
+
+    uint32_t getWidth() const
+    {
+        return extent.width;
+    }
+
+    uint32_t getHeight() const
+    {
+        return extent.height;
+    }
+
+    uint32_t getDepth() const
+    {
+        return extent.depth;
+    }
+
+    uint32_t getBytesPerTexel() const
+    {
+        return bytesPerTexel;
+    }
+
+    uint32_t getRowPitch() const
+    {
+        return rowPitch;
+    }
+
+    uint32_t getDepthPitch() const
+    {
+        return depthPitch;
+    }
+
+    uint8_t* getRow(const uint32_t y, const uint32_t z) const
+    {
+        return data + (size_t)z * (size_t)depthPitch + (size_t)y * (size_t)rowPitch;
+    }
+
+    uint8_t* getTexelData(const uint32_t x, const uint32_t y, const uint32_t z) const
+    {
+        return getRow(y, z) + (size_t)x * (size_t)bytesPerTexel;
+    }
+
+    /**
+     * Sub view starting at the given texel. Extent is clamped to this view.
+     */
+    ImageDataView getTile(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t width, const uint32_t height, const uint32_t depth) const
+    {
+        if (x >= extent.width || y >= extent.height || z >= extent.depth)
+        {
+            return ImageDataView();
+        }
+
+        VkExtent3D tileExtent{glm::min(width, extent.width - x), glm::min(height, extent.height - y), glm::min(depth, extent.depth - z)};
+
+        if (tileExtent.width == 0 || tileExtent.height == 0 || tileExtent.depth == 0)
+        {
+            return ImageDataView();
+        }
+
+        ImageDataView tile(*this);
+
+        tile.data = getTexelData(x, y, z);
+        tile.extent = tileExtent;
+
+        return tile;
+    }
+
+    template<class TEXEL>
+    glm::vec4 getTexel(const uint32_t x, const uint32_t y, const uint32_t z) const
+    {
+        return TEXEL::decode(getTexelData(x, y, z));
+    }
+
+    template<class TEXEL>
+    void setTexel(const glm::vec4& rgba, const uint32_t x, const uint32_t y, const uint32_t z) const
+    {
+        if (READONLY)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Image data view is read only");
+
+            return;
+        }
+
+        TEXEL::encode(getTexelData(x, y, z), rgba);
+    }
+
+    template<class TEXEL>
+    void decodeRow(glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count) const
+    {
+        decodeTexels<TEXEL>(rgba, getTexelData(x, y, z), count);
+    }
+
+    template<class TEXEL>
+    void encodeRow(const glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count) const
+    {
+        if (READONLY)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Image data view is read only");
+
+            return;
+        }
+
+        encodeTexels<TEXEL>(getTexelData(x, y, z), rgba, count);
+    }
+
+    /**
+     * Decodes count texels of a row. Format is resolved once per call.
+     */
+    VkBool32 decodeRow(glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count) const
+    {
+        if (!rgba || !data || y >= extent.height || z >= extent.depth || x > extent.width || count > extent.width - x)
+        {
+            return VK_FALSE;
+        }
+
+        const uint8_t* texel = getTexelData(x, y, z);
+
+        if (SFLOAT)
+        {
+            switch (numberChannels)
+            {
+                case 1:
+                    decodeTexels<ImageDataTexelR32>(rgba, texel, count);
+                    break;
+                case 2:
+                    decodeTexels<ImageDataTexelR32G32>(rgba, texel, count);
+                    break;
+                case 3:
+                    decodeTexels<ImageDataTexelR32G32B32>(rgba, texel, count);
+                    break;
+                case 4:
+                    decodeTexels<ImageDataTexelR32G32B32A32>(rgba, texel, count);
+                    break;
+            }
+        }
+        else if (SWIZZLE)
+        {
+            switch (numberChannels)
+            {
+                case 3:
+                    decodeTexels<ImageDataTexelB8G8R8>(rgba, texel, count);
+                    break;
+                case 4:
+                    decodeTexels<ImageDataTexelB8G8R8A8>(rgba, texel, count);
+                    break;
+            }
+        }
+        else
+        {
+            switch (numberChannels)
+            {
+                case 1:
+                    decodeTexels<ImageDataTexelR8>(rgba, texel, count);
+                    break;
+                case 2:
+                    decodeTexels<ImageDataTexelR8G8>(rgba, texel, count);
+                    break;
+                case 3:
+                    decodeTexels<ImageDataTexelR8G8B8>(rgba, texel, count);
+                    break;
+                case 4:
+                    decodeTexels<ImageDataTexelR8G8B8A8>(rgba, texel, count);
+                    break;
+            }
+        }
+
+        return VK_TRUE;
+    }
+
+    /**
+     * Encodes count texels of a row. Format is resolved once per call.
+     */
+    VkBool32 encodeRow(const glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count) const
+    {
+        if (READONLY)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Image data view is read only");
+
+            return VK_FALSE;
+        }
+
+        if (!rgba || !data || y >= extent.height || z >= extent.depth || x > extent.width || count > extent.width - x)
+        {
+            return VK_FALSE;
+        }
+
+        uint8_t* texel = getTexelData(x, y, z);
+
+        if (SFLOAT)
+        {
+            switch (numberChannels)
+            {
+                case 1:
+                    encodeTexels<ImageDataTexelR32>(texel, rgba, count);
+                    break;
+                case 2:
+                    encodeTexels<ImageDataTexelR32G32>(texel, rgba, count);
+                    break;
+                case 3:
+                    encodeTexels<ImageDataTexelR32G32B32>(texel, rgba, count);
+                    break;
+                case 4:
+                    encodeTexels<ImageDataTexelR32G32B32A32>(texel, rgba, count);
+                    break;
+            }
+        }
+        else if (SWIZZLE)
+        {
+            switch (numberChannels)
+            {
+                case 3:
+                    encodeTexels<ImageDataTexelB8G8R8>(texel, rgba, count);
+                    break;
+                case 4:
+                    encodeTexels<ImageDataTexelB8G8R8A8>(texel, rgba, count);
+                    break;
+            }
+        }
+        else
+        {
+            switch (numberChannels)
+            {
+                case 1:
+                    encodeTexels<ImageDataTexelR8>(texel, rgba, count);
+                    break;
+                case 2:
+                    encodeTexels<ImageDataTexelR8G8>(texel, rgba, count);
+                    break;
+                case 3:
+                    encodeTexels<ImageDataTexelR8G8B8>(texel, rgba, count);
+                    break;
+                case 4:
+                    encodeTexels<ImageDataTexelR8G8B8A8>(texel, rgba, count);
+                    break;
+            }
+        }
+
+        return VK_TRUE;
+    }
+
+    /**
+     * Bounds checked texel access. Returns NAN outside of the view.
+     */
+    glm::vec4 getTexel(const uint32_t x, const uint32_t y, const uint32_t z) const
+    {
+        glm::vec4 result;
+
+        if (x >= extent.width || !decodeRow(&result, x, y, z, 1))
+        {
+            return glm::vec4(NAN, NAN, NAN, NAN);
+        }
+
+        return result;
+    }
+
+    /**
+     * Bounds checked texel access. Writes outside of the view are ignored.
+     */
+    void setTexel(const glm::vec4& rgba, const uint32_t x, const uint32_t y, const uint32_t z) const
+    {
+        if (x >= extent.width)
+        {
+            return;
+        }
+
+        encodeRow(&rgba, x, y, z, 1);
+    }
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_IMAGEDATAVIEW_HPP_ */
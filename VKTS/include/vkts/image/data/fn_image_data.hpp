@@ -105,6 +105,7 @@ VKTS_APICALL void VKTS_APIENTRY imageDataSetLoadFunction(const PFN_imageDataLoad
 VKTS_APICALL void VKTS_APIENTRY imageDataSetSaveFunction(const PFN_imageDataSaveFunction saveFunction, const VkBool32 fallback = VK_TRUE);
 
 /**
+ * Packed '.vkti' images are used out of the mapped file without decoding.
  *
  * @ThreadSafe
  */
@@ -117,6 +118,7 @@ VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataLoad(const char* filename);
 VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataLoadRaw(const char* filename, const uint32_t width, const uint32_t height, const VkFormat format);
 
 /**
+ * Packed '.vkti' images always store all mip levels and array layers.
  *
  * @ThreadSafe
  */
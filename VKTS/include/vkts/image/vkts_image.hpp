@@ -49,10 +49,26 @@ enum VkTsImageDataChannels {VKTS_SOURCE_0_RED, VKTS_SOURCE_0_GREEN, VKTS_SOURCE_
 
 enum VkTsEnvironmentType {VKTS_ENVIRONMENT_PANORAMA, VKTS_ENVIRONMENT_MIRROR_SPHERE, VKTS_ENVIRONMENT_MIRROR_DOME};
 
+#define VKTS_CACHE_DEFAULT_MAX_SIZE (1024ull * 1024ull * 1024ull)
+
+#define VKTS_CACHE_PACKED_EXTENSION ".vkti"
+
+typedef struct VkTsCacheStatistics_
+{
+    uint32_t hitCount;
+    uint32_t missCount;
+    uint32_t storeCount;
+    uint32_t evictionCount;
+    uint32_t entryCount;
+    uint64_t totalSize;
+} VkTsCacheStatistics;
+
 /**
  * Image data.
  */
 
+#include <vkts/image/data/ImageDataView.hpp>
+
 #include <vkts/image/data/IImageData.hpp>
 
 #include <vkts/image/data/fn_image_data.hpp>
@@ -29,6 +29,8 @@
 
 #include <vkts/math/vkts_math.hpp>
 
+#define VKTS_FRUSTUM_PLANE_MASK_ALL 0x3F
+
 namespace vkts
 {
 
@@ -41,6 +43,17 @@ private:
 
 	Plane sidesWorld[6];
 
+	// Planes as structure of arrays, padded to eight planes, which always contain the volume.
+
+	float planesX[8];
+	float planesY[8];
+	float planesZ[8];
+	float planesD[8];
+
+	uint32_t testPlanes(const float centerX, const float centerY, const float centerZ, const float extentX, const float extentY, const float extentZ, const float radius, uint32_t& planeMask) const;
+
+	uint32_t cullVolumes(const float* allX[2], const float* allY[2], const float* allZ[2], const float* allRadius, const uint32_t count, uint32_t* visibilityMask) const;
+
 public:
 
 	Frustum() = delete;
@@ -57,6 +70,32 @@ public:
 
     VkBool32 isVisible(const Obb& obbWorld) const;
 
+    /**
+     * Only the planes set in the plane mask are tested. Planes, which completely contain the sphere, are removed from the mask.
+     * Passing the resulting mask to the children of a hierarchy avoids testing planes again, which already contain the parent.
+     * If the mask is zero, the sphere is completely inside the frustum.
+     */
+    VkBool32 isVisible(const Sphere& sphereWorld, uint32_t& planeMask) const;
+
+    /**
+     * Same as above for an axis aligned bounding box. The box is tested by its center and extent, so only one distance per plane is calculated.
+     */
+    VkBool32 isVisible(const glm::vec3& minimumWorld, const glm::vec3& maximumWorld, uint32_t& planeMask) const;
+
+    VkBool32 isVisible(const Aabb& aabbWorld, uint32_t& planeMask) const;
+
+    /**
+     * Tests many spheres at once, given as structure of arrays. Bit i % 32 of the visibility mask entry i / 32 is set, if sphere i is visible.
+     * The visibility mask needs (count + 31) / 32 entries. Returns the number of visible spheres.
+     * The plane, which culled the last volumes, is tested first, as neighbouring volumes are mostly culled by the same plane.
+     */
+    uint32_t cullSpheres(const float* centerX, const float* centerY, const float* centerZ, const float* radius, const uint32_t count, uint32_t* visibilityMask) const;
+
+    /**
+     * Same as above for axis aligned bounding boxes. Per plane, only the corner farthest along the plane normal is tested.
+     */
+    uint32_t cullAabbs(const float* minimumX, const float* minimumY, const float* minimumZ, const float* maximumX, const float* maximumY, const float* maximumZ, const uint32_t count, uint32_t* visibilityMask) const;
+
 };
 
 } /* namespace vkts */
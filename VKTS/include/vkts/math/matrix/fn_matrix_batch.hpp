@@ -0,0 +1,54 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FN_MATRIX_BATCH_HPP_
+#define VKTS_FN_MATRIX_BATCH_HPP_
+
+#include <vkts/math/vkts_math.hpp>
+
+namespace vkts
+{
+
+/**
+ * Composes translate * rotate * scale of many transforms into matrices, without building and multiplying three matrices per transform.
+ * Translations, rotations as unit quaternions and scales are given as structure of arrays.
+ * Same values as translateMat4() * Quat::mat4() * scaleMat4(). Uses AVX, if the processor supports it, otherwise SSE2 or NEON.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY composeMat4Batch(const float* translateX, const float* translateY, const float* translateZ, const float* rotateX, const float* rotateY, const float* rotateZ, const float* rotateW, const float* scaleX, const float* scaleY, const float* scaleZ, const uint32_t count, glm::mat4* matrices);
+
+/**
+ * Calculates the normal matrices, the transposed inverse of the upper 3x3 matrices, by cofactors.
+ * Same values as glm::transpose(glm::inverse(glm::mat3(matrix))). Uses AVX, if the processor supports it, otherwise SSE2 or NEON.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY normalMat3Batch(const glm::mat4* matrices, const uint32_t count, glm::mat3* normalMatrices);
+
+}
+
+#endif /* VKTS_FN_MATRIX_BATCH_HPP_ */
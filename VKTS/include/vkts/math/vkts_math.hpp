@@ -59,6 +59,7 @@
 
 #include <vkts/math/matrix/fn_matrix.hpp>
 #include <vkts/math/matrix/fn_matrix_viewprojection.hpp>
+#include <vkts/math/matrix/fn_matrix_batch.hpp>
 
 /**
  * Quaternion.
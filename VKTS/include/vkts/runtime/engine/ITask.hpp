@@ -36,6 +36,7 @@ class ITask
 {
 
     friend class TaskExecutor;
+    friend class TaskGraphTask;
 
 private:
 
@@ -60,6 +61,14 @@ protected:
 
     virtual VkBool32 execute() = 0;
 
+    /**
+     * Detached tasks are not added to the executed task queue.
+     */
+    virtual VkBool32 isDetached() const
+    {
+        return VK_FALSE;
+    }
+
 public:
 
     ITask(const uint64_t id) :
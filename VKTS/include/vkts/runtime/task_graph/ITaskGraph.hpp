@@ -0,0 +1,115 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_ITASKGRAPH_HPP_
+#define VKTS_ITASKGRAPH_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+/**
+ * Function executed for the index range [begin, end) of a parallel for.
+ */
+typedef std::function<VkBool32(const uint32_t begin, const uint32_t end)> TaskGraphRangeFunction;
+
+class ITaskGraph
+{
+
+public:
+
+    ITaskGraph()
+    {
+    }
+
+    virtual ~ITaskGraph()
+    {
+    }
+
+    /**
+     * Adds a task to the graph and returns its handle.
+     *
+     * Not thread Safe.
+     */
+    virtual uint32_t addTask(const ITaskSP& task) = 0;
+
+    /**
+     * Adds a parallel for over the index range [begin, end), split into chunks of grainSize indices, and returns its handle.
+     *
+     * Not thread Safe.
+     */
+    virtual uint32_t addParallelFor(const uint32_t begin, const uint32_t end, const uint32_t grainSize, const TaskGraphRangeFunction& function) = 0;
+
+    /**
+     * The successor is only started, after the predecessor has been executed.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 addDependency(const uint32_t predecessor, const uint32_t successor) = 0;
+
+    /**
+     * Sends all tasks without predecessors to the task executors. The graph can be run again, after it has been waited for.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 run() = 0;
+
+    /**
+     * Blocks, until the task with the given handle has been executed.
+     *
+     * @ThreadSafe
+     */
+    virtual VkBool32 wait(const uint32_t handle) const = 0;
+
+    /**
+     * Blocks, until all tasks have been executed. Returns VK_FALSE, if one of the tasks failed.
+     *
+     * @ThreadSafe
+     */
+    virtual VkBool32 wait() const = 0;
+
+    /**
+     * @ThreadSafe
+     */
+    virtual VkBool32 isDone() const = 0;
+
+    /**
+     * Removes all tasks and dependencies.
+     *
+     * Not thread Safe.
+     */
+    virtual void reset() = 0;
+
+    virtual uint32_t getTaskCount() const = 0;
+
+};
+
+typedef std::shared_ptr<ITaskGraph> ITaskGraphSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_ITASKGRAPH_HPP_ */
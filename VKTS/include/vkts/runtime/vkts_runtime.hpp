@@ -68,4 +68,12 @@
 
 #include <vkts/runtime/engine/fn_engine.hpp>
 
+/**
+ * Task graph.
+ */
+
+#include <vkts/runtime/task_graph/ITaskGraph.hpp>
+
+#include <vkts/runtime/task_graph/fn_task_graph.hpp>
+
 #endif /* VKTS_RUNTIME_HPP_ */
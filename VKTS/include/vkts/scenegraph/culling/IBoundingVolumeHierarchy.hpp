@@ -0,0 +1,103 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IBOUNDINGVOLUMEHIERARCHY_HPP_
+#define VKTS_IBOUNDINGVOLUMEHIERARCHY_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+/**
+ * Hierarchy of world space boxes over the sub meshes of all objects of a scene.
+ * Sub meshes having bones are not culled, as their box does not cover the animated vertices.
+ */
+class IBoundingVolumeHierarchy
+{
+
+public:
+
+    IBoundingVolumeHierarchy()
+    {
+    }
+
+    virtual ~IBoundingVolumeHierarchy()
+    {
+    }
+
+    virtual const ISceneSP& getScene() const = 0;
+
+    /**
+     * Gathers the sub meshes and builds the hierarchy again. Has to be called, after objects, nodes or meshes have been added or removed.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 rebuild() = 0;
+
+    /**
+     * Updates the boxes of all sub meshes, whose node transform did change, and refits the hierarchy bottom up.
+     * The structure of the hierarchy is kept, so rebuild() should be called, if many nodes did move far.
+     *
+     * Not thread Safe.
+     */
+    virtual void refit() = 0;
+
+    virtual uint32_t getNumberVolumes() const = 0;
+
+    virtual uint32_t getNumberSubMeshes() const = 0;
+
+    /**
+     * Tests the hierarchy against the frustum. Planes, which contain a volume, are not tested again for its children.
+     *
+     * Not thread Safe.
+     */
+    virtual void cull(const Frustum& frustum) = 0;
+
+    virtual VkBool32 isSubMeshVisible(const uint32_t index) const = 0;
+
+    /**
+     * Returns VK_TRUE, if a sub mesh of the node or of one of its child nodes is visible.
+     * Nodes not being part of the hierarchy are always visible.
+     */
+    virtual VkBool32 isNodeVisible(const INode& node) const = 0;
+
+    virtual const VkTsCullStatistics& getStatistics() const = 0;
+
+    /**
+     * Same result as IScene::collectRecursive, but only the visible sub meshes are added to the render queue.
+     *
+     * Not thread Safe.
+     */
+    virtual void collect(IRenderQueue& renderQueue, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr, const uint32_t objectOffset = 0, const uint32_t objectStep = 1, const uint32_t objectLimit = UINT32_MAX) = 0;
+
+};
+
+typedef std::shared_ptr<IBoundingVolumeHierarchy> IBoundingVolumeHierarchySP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IBOUNDINGVOLUMEHIERARCHY_HPP_ */
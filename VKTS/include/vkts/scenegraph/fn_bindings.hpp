@@ -33,6 +33,10 @@
 
 #define VKTS_MAX_JOINTS_BUFFERSIZE (VKTS_MAX_JOINTS * sizeof(float) * ((16 + 1) + (12 + 1)))
 
+// Vertex buffer bindings. The instance buffer contains one transform matrix per instance.
+
+#define VKTS_BINDING_VERTEX_BUFFER_INSTANCE 						1
+
 // Shader bindings.
 
 #define VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION 					0
@@ -0,0 +1,98 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_ITRANSFORMHIERARCHY_HPP_
+#define VKTS_ITRANSFORMHIERARCHY_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+/**
+ * Flattened node trees of all objects of a scene. The nodes are sorted by their depth,
+ * so that all nodes of one level can be updated in parallel by the task executors.
+ */
+class ITransformHierarchy
+{
+
+public:
+
+    ITransformHierarchy()
+    {
+    }
+
+    virtual ~ITransformHierarchy()
+    {
+    }
+
+    virtual const ISceneSP& getScene() const = 0;
+
+    /**
+     * Flattens the node trees again. Has to be called, after objects or nodes have been added or removed.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 rebuild() = 0;
+
+    virtual uint32_t getNumberNodes() const = 0;
+
+    virtual uint32_t getNumberLevels() const = 0;
+
+    virtual const INodeSP& getNode(const uint32_t index) const = 0;
+
+    /**
+     * Returns -1, if the node is a root node.
+     */
+    virtual int32_t getParentIndex(const uint32_t index) const = 0;
+
+    virtual const glm::mat4& getTransformMatrix(const uint32_t index) const = 0;
+
+    virtual const IUniformUploadBatchSP& getUploadBatch() const = 0;
+
+    /**
+     * The transform and joint uniform buffers of all nodes are added to the upload batch, which is flushed at the end of each update.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 setUploadBatch(const IUniformUploadBatchSP& uploadBatch) = 0;
+
+    /**
+     * Same result as IScene::updateTransformRecursive, but the levels are processed one after the other by the task executors.
+     * The local and normal matrices of a level are calculated by composeMat4Batch() and normalMat3Batch(), like the recursive update does per node.
+     * Nodes of the same armature are uploaded by one task.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const OverwriteUpdate* updateOverwrite = nullptr) = 0;
+
+};
+
+typedef std::shared_ptr<ITransformHierarchy> ITransformHierarchySP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_ITRANSFORMHIERARCHY_HPP_ */
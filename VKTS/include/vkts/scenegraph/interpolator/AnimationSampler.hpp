@@ -0,0 +1,189 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_ANIMATIONSAMPLER_HPP_
+#define VKTS_ANIMATIONSAMPLER_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+enum AnimationTrackEncoding {AnimationTrackKeys, AnimationTrackConstant, AnimationTrackQuantized8, AnimationTrackQuantized16};
+
+/**
+ * Samples all channels of an animation. The channels are packed into tracks, stored as structure of arrays.
+ * Each track remembers its last found entry, so the entry for coherent keys is found in constant time.
+ * Otherwise, the entry is searched binary. The keys of a channel have to be ascending.
+ *
+ * Optionally, the tracks are compressed: A track is resampled uniformly and the samples are quantized to 8 or 16 bit.
+ * Tracks staying inside the error are stored as one value. Tracks, which would exceed the error or not get smaller, keep their keys.
+ * Rotation tracks are only resampled together, as the quaternion components are interpolated with one t.
+ * If requested, the channels of compressed tracks release their entries and the sampler owns the data. Savers and clones read the entries back with restoreEntries().
+ * Before the tracks are reset or rebuilt, released channels get their entries back, unless entries have been added in the meantime.
+ */
+class AnimationSampler
+{
+
+private:
+
+	// Entries of a track are located from its offset to the offset of the next track.
+
+	std::vector<float> allKeys;
+	std::vector<float> allValues;
+	std::vector<glm::vec4> allHandles;
+	std::vector<VkTsInterpolator> allInterpolators;
+
+	std::vector<uint32_t> allOffsets;
+
+	std::vector<VkTsTargetTransform> allTargetTransforms;
+	std::vector<VkTsTargetTransformElement> allTargetTransformElements;
+
+	// Last found entry per track, relative to the track offset.
+
+	std::vector<uint32_t> allCursors;
+
+	// Compressed tracks. Value is minimum + scale * sample, the sample position is (key - start) * rate.
+
+	struct CompressedTrack
+	{
+		enum AnimationTrackEncoding encoding;
+		float minimum;
+		float scale;
+		float start;
+		float rate;
+		uint32_t offset;
+		uint32_t numberSamples;
+	};
+
+	std::vector<CompressedTrack> allCompressedTracks;
+
+	std::vector<uint8_t> allSamples8;
+	std::vector<uint16_t> allSamples16;
+
+	// Number of entries of the channels, also for compressed tracks.
+
+	std::vector<uint32_t> allNumberEntries;
+
+	// Modification counters of the channels at build time, after releasing the entries.
+
+	std::vector<uint64_t> allModificationCounters;
+
+	// Channels, which released their entries to the track. Empty otherwise.
+
+	std::vector<IChannelSP> allReleasedChannels;
+
+	float sampleTime;
+	float maxError;
+
+	uint32_t findEntry(const uint32_t track, const float key);
+
+	VkBool32 compressTrack(CompressedTrack& compressedTrack, const IChannelSP& channel);
+
+	float decodeSample(const CompressedTrack& compressedTrack, const uint32_t index) const;
+
+	float decode(const CompressedTrack& compressedTrack, const float key) const;
+
+	void decodeSegment(const CompressedTrack& compressedTrack, const float key, float& before, float& after, float& t) const;
+
+public:
+
+	AnimationSampler();
+	AnimationSampler(const AnimationSampler& other) = delete;
+	AnimationSampler(AnimationSampler&& other) = delete;
+    virtual ~AnimationSampler();
+
+    AnimationSampler& operator =(const AnimationSampler& other) = delete;
+    AnimationSampler& operator =(AnimationSampler && other) = delete;
+
+    /**
+     * Checks, if the tracks still match the channels and none of them has been modified since the build.
+     */
+    VkBool32 isUpToDate(const SmartPointerVector<IChannelSP>& allChannels) const;
+
+    /**
+     * Packs the channels into tracks. If a sample time is set, the tracks are compressed.
+     * Optionally, the channels of compressed tracks release their entries.
+     */
+    void build(const SmartPointerVector<IChannelSP>& allChannels, const VkBool32 releaseEntries = VK_FALSE);
+
+    /**
+     * Gives released entries back to the channels, which are still empty, and removes all tracks.
+     */
+    void reset();
+
+    /**
+     * Sets the time between the resampled values and the maximum absolute error of a compressed track.
+     * A sample time of zero disables the compression. Takes effect with the next build.
+     */
+    void setCompression(const float sampleTime, const float maxError);
+
+    float getSampleTime() const;
+
+    float getMaxError() const;
+
+    enum AnimationTrackEncoding getTrackEncoding(const uint32_t track) const;
+
+    /**
+     * Bytes used by the tracks. The entries of the channels are not included.
+     */
+    uint64_t getMemorySize() const;
+
+    uint32_t getNumberTracks() const;
+
+    /**
+     * Number of entries of the channel at build time, also if the track is compressed.
+     */
+    uint32_t getNumberEntries(const uint32_t track) const;
+
+    VkTsTargetTransform getTargetTransform(const uint32_t track) const;
+
+    VkTsTargetTransformElement getTargetTransformElement(const uint32_t track) const;
+
+    /**
+     * Same result as interpolate() for the channel of the track. A compressed track is within the maximum error.
+     */
+    float sample(const uint32_t track, const float key);
+
+    /**
+     * Gathers the values before and after the key, e.g. to interpolate quaternions as a whole.
+     * Outside of the keys, both values are the first or last value and t is not written.
+     * For a compressed track, the values are the samples before and after the key. All resampled rotation tracks share the sample positions.
+     * Returns VK_FALSE, if the track has no entries.
+     */
+    VkBool32 sampleSegment(const uint32_t track, const float key, float& before, float& after, float& t);
+
+    /**
+     * Adds the entries of the track to the channel, e.g. to save or clone a channel, which released its entries.
+     * The samples of a compressed track are added as linear interpolated entries, so the channel interpolates like the track.
+     */
+    VkBool32 restoreEntries(const uint32_t track, const IChannelSP& channel) const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_ANIMATIONSAMPLER_HPP_ */
@@ -32,6 +32,14 @@
 namespace vkts
 {
 
+VKTS_APICALL VkBool32 VKTS_APIENTRY interpolateGetCompression();
+
+/**
+ * Compresses the animations created afterwards with VKTS_COMPRESS_SAMPLING and VKTS_COMPRESS_ERROR.
+ * The channels of compressed tracks release their entries to the animation sampler.
+ */
+VKTS_APICALL void VKTS_APIENTRY interpolateSetCompression(const VkBool32 compression);
+
 /**
  *
  * @ThreadSafe
@@ -111,6 +111,45 @@ public:
     {
     	return VK_TRUE;
     }
+
+    //
+    // Used, when draw packets are collected for a render queue. By default, the above visits are called without a command buffer.
+    //
+
+    virtual VkBool32 visit(const IScene& scene, VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const uint32_t objectOffset, const uint32_t objectStep, const uint32_t objectLimit) const
+    {
+    	return visit(scene, ICommandBuffersSP(), allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, objectOffset, objectStep, objectLimit);
+    }
+
+    virtual VkBool32 visit(const IObject& object, VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	return visit(object, ICommandBuffersSP(), allGraphicsPipelines, currentBuffer, dynamicOffsetMappings);
+    }
+
+    virtual VkBool32 visit(const INode& node, VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	return visit(node, ICommandBuffersSP(), allGraphicsPipelines, currentBuffer, dynamicOffsetMappings);
+    }
+
+    virtual VkBool32 visit(const IMesh& mesh, VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	return visit(mesh, ICommandBuffersSP(), allGraphicsPipelines, currentBuffer, dynamicOffsetMappings);
+    }
+
+    virtual VkBool32 visit(const ISubMesh& subMesh, VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	return visit(subMesh, ICommandBuffersSP(), allGraphicsPipelines, currentBuffer, dynamicOffsetMappings);
+    }
+
+    virtual VkBool32 visit(const IPhongMaterial& material, VkTsDrawPacket& drawPacket, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	return visit(material, ICommandBuffersSP(), graphicsPipeline, currentBuffer, dynamicOffsetMappings);
+    }
+
+    virtual VkBool32 visit(const IBSDFMaterial& material, VkTsDrawPacket& drawPacket, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	return visit(material, ICommandBuffersSP(), graphicsPipeline, currentBuffer, dynamicOffsetMappings);
+    }
 };
 
 } /* namespace vkts */
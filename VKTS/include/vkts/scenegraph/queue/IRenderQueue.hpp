@@ -0,0 +1,103 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IRENDERQUEUE_HPP_
+#define VKTS_IRENDERQUEUE_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+/**
+ * Draw packets are collected by traversing the scene, sorted by a 64 bit key and recorded
+ * with redundant pipeline, descriptor set and buffer binds left out.
+ *
+ * Each recording task should use its own render queue.
+ */
+class IRenderQueue
+{
+
+public:
+
+    IRenderQueue()
+    {
+    }
+
+    virtual ~IRenderQueue()
+    {
+    }
+
+    virtual VkTsRenderQueueSort getSortMode() const = 0;
+
+    virtual void setSortMode(const VkTsRenderQueueSort sortMode) = 0;
+
+    virtual const glm::mat4& getViewMatrix() const = 0;
+
+    /**
+     * Used to calculate the depth of the collected nodes.
+     */
+    virtual void setViewMatrix(const glm::mat4& viewMatrix) = 0;
+
+    virtual uint32_t getNumberPackets() const = 0;
+
+    /**
+     * After sorting, the packets are returned in recording order.
+     */
+    virtual const VkTsDrawPacket& getPacket(const uint32_t index) const = 0;
+
+    /**
+     * Removes all packets. The allocated memory is kept.
+     */
+    virtual void reset() = 0;
+
+    virtual void addPacket(const VkTsDrawPacket& drawPacket) = 0;
+
+    virtual void sort() = 0;
+
+    /**
+     * Merges neighbouring sorted packets with the same instance key and state into instanced draws. The transforms of the instances
+     * are uploaded to the host visible buffer at the given offset and bound at VKTS_BINDING_VERTEX_BUFFER_INSTANCE while recording.
+     * Packets not fitting into the buffer are drawn one by one. Each frame in flight needs its own buffer or offset.
+     *
+     * Has to be called after sort().
+     */
+    virtual VkBool32 instance(const IBufferObjectSP& instanceBuffer, const VkDeviceSize instanceBufferOffset = 0) = 0;
+
+    /**
+     * Records the given range of the sorted packets. The counters are added to the statistics.
+     *
+     * @ThreadSafe
+     */
+    virtual void record(const ICommandBuffersSP& cmdBuffer, VkTsRenderQueueStatistics& statistics, const uint32_t packetOffset = 0, const uint32_t packetCount = UINT32_MAX) const = 0;
+
+};
+
+typedef std::shared_ptr<IRenderQueue> IRenderQueueSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IRENDERQUEUE_HPP_ */
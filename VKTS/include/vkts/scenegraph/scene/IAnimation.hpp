@@ -80,8 +80,16 @@ public:
 
     virtual uint32_t getNumberChannels() const = 0;
 
+    /**
+     * Channels of compressed tracks have no entries, as the sampler owns them. Read them with AnimationSampler::restoreEntries().
+     */
     virtual const SmartPointerVector<IChannelSP>& getChannels() const = 0;
 
+    /**
+     * Sampler over all channels. Rebuilt, if channels or their entries changed.
+     */
+    virtual AnimationSampler& getSampler() = 0;
+
 };
 
 typedef std::shared_ptr<IAnimation> IAnimationSP;
@@ -114,6 +114,11 @@ public:
 
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName) = 0;
 
+    /**
+     * Fills the descriptor set and dynamic offsets of the draw packet. Returns VK_FALSE, if the sub mesh should not be drawn.
+     */
+    virtual VkBool32 collectRecursive(VkTsDrawPacket& drawPacket, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName) = 0;
+
 };
 
 typedef std::shared_ptr<IBSDFMaterial> IBSDFMaterialSP;
@@ -72,6 +72,11 @@ public:
 
     virtual const std::vector<VkTsInterpolator>& getInterpolators() const = 0;
 
+    /**
+     * Changes with every modification of the target or the entries.
+     */
+    virtual uint64_t getModificationCounter() const = 0;
+
 };
 
 typedef std::shared_ptr<IChannel> IChannelSP;
@@ -149,11 +149,33 @@ public:
 
     virtual IBufferObjectSP getTransformUniformBuffer() const = 0;
 
-    virtual void setTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer) = 0;
+    virtual VkDeviceSize getTransformUniformBufferOffset() const = 0;
+
+    virtual VkDeviceSize getTransformUniformBufferRange() const = 0;
+
+    /**
+     * The node uses range bytes at offset of each buffer. Several nodes can share one uniform buffer.
+     */
+    virtual void setTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range) = 0;
+
+    /**
+     * Takes one slot of the pool. The slot is returned, when the node is destroyed or gets another buffer.
+     * Clones of the node take their slot from the same pool.
+     */
+    virtual VkBool32 allocateTransformUniformBuffer(const IUniformBufferPoolSP& transformUniformBufferPool) = 0;
 
     virtual IBufferObjectSP getJointsUniformBuffer() const = 0;
 
-    virtual void setJointsUniformBuffer(const int32_t joints, const IBufferObjectSP& jointsUniformBuffer) = 0;
+    virtual VkDeviceSize getJointsUniformBufferOffset() const = 0;
+
+    virtual VkDeviceSize getJointsUniformBufferRange() const = 0;
+
+    /**
+     * The armature uses range bytes at offset of each buffer. Several armatures can share one uniform buffer.
+     */
+    virtual void setJointsUniformBuffer(const int32_t joints, const IBufferObjectSP& jointsUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range) = 0;
+
+    virtual VkBool32 allocateJointsUniformBuffer(const int32_t joints, const IUniformBufferPoolSP& jointsUniformBufferPool) = 0;
 
     virtual const Aabb& getAABB() const = 0;
 
@@ -171,6 +193,12 @@ public:
 
     virtual const glm::mat4& getTransformMatrix() const = 0;
 
+    /**
+     * Stores the given transform matrix without uploading it, e.g. if a skeleton batch uploads the joints.
+     * The dirty flag of the current buffer is reset.
+     */
+    virtual void setTransformMatrix(const uint32_t currentBuffer, const glm::mat4& transformMatrix) = 0;
+
 	virtual std::shared_ptr<INode> findNodeRecursive(const std::string& searchName) = 0;
 
 	virtual std::shared_ptr<INode> findNodeRecursiveFromRoot(const std::string& searchName) = 0;
@@ -181,8 +209,25 @@ public:
 
     virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const std::shared_ptr<INode>& armatureNode, const OverwriteUpdate* updateOverwrite = nullptr) = 0;
 
+    /**
+     * Evaluates the current animation into the final translate, rotate and scale. Children are not visited.
+     * Returns, if the transform matrix of the current buffer has to be updated.
+     */
+    virtual VkBool32 updateLocalTransform(const double deltaTime, const uint32_t currentBuffer, const VkBool32 parentTransformMatrixDirty) = 0;
+
+    /**
+     * Stores the given transform matrix and uploads it to the node or armature uniform buffer. Children are not visited.
+     * On success, the dirty flag of the current buffer is reset.
+     * If given, the normal matrix of the meshes is not calculated again, e.g. if it has been calculated by normalMat3Batch().
+     *
+     * Nodes sharing the same armature must not be updated in parallel, as joints are uploaded to the armature uniform buffer.
+     */
+    virtual VkBool32 updateTransform(const uint32_t currentBuffer, const glm::mat4& transformMatrix, const std::shared_ptr<INode>& armatureNode, const glm::mat3* transformNormalMatrix = nullptr) = 0;
+
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) = 0;
 
+    virtual void collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) = 0;
+
 
     virtual VkBool32 isNode() const = 0;
 
@@ -58,7 +58,11 @@ public:
 
     virtual void setRootNode(const INodeSP& rootNode) = 0;
 
-    virtual void setDirty() = 0;
+    virtual const glm::mat4& getTransformMatrix() const = 0;
+
+    virtual VkBool32 getDirty() const = 0;
+
+    virtual void setDirty(const VkBool32 dirty = VK_TRUE) = 0;
 
     virtual void updateParameterRecursive(Parameter* parameter) = 0;
 
@@ -66,8 +70,16 @@ public:
 
     virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const OverwriteUpdate* updateOverwrite = nullptr) = 0;
 
+    /**
+     * Updates the object transform matrix without visiting the root node.
+     * Returns VK_FALSE, if the object was skipped by an overwrite or could not be updated.
+     */
+    virtual VkBool32 updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const OverwriteUpdate* updateOverwrite = nullptr) = 0;
+
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) = 0;
 
+    virtual void collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) = 0;
+
 };
 
 typedef std::shared_ptr<IObject> IObjectSP;
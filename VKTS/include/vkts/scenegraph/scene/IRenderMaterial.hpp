@@ -49,9 +49,12 @@ public:
     virtual std::shared_ptr<IRenderMaterial> create(const VkBool32 createData = VK_TRUE) const = 0;
 
 
-    virtual IDescriptorPoolSP getDescriptorPool() const = 0;
+    virtual IDescriptorSetAllocatorSP getDescriptorSetAllocator() const = 0;
 
-    virtual void setDescriptorPool(const IDescriptorPoolSP& descriptorPool) = 0;
+    /**
+     * Descriptor sets of further nodes are allocated from the allocator using the given layout.
+     */
+    virtual void setDescriptorSetAllocator(const IDescriptorSetAllocatorSP& descriptorSetAllocator, const IDescriptorSetLayoutSP& descriptorSetLayout) = 0;
 
     virtual IDescriptorSetsSP getDescriptorSets() const = 0;
 
@@ -64,6 +67,8 @@ public:
 
     virtual void draw(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) = 0;
 
+    virtual VkBool32 collect(VkTsDrawPacket& drawPacket, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) const = 0;
+
 };
 
 typedef std::shared_ptr<IRenderMaterial> IRenderMaterialSP;
@@ -51,9 +51,9 @@ public:
 
     virtual void reset() = 0;
 
-    virtual void updateTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer) = 0;
+    virtual void updateTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range) = 0;
 
-    virtual void updateJointsUniformBuffer(const IBufferObjectSP& jointsUniformBuffer) = 0;
+    virtual void updateJointsUniformBuffer(const IBufferObjectSP& jointsUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range) = 0;
 
     virtual void updateDescriptorSets(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets) = 0;
 
@@ -49,6 +49,8 @@ public:
 
     virtual void draw(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const std::string& nodeName) = 0;
 
+    virtual void collect(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const std::string& nodeName) = 0;
+
 };
 
 typedef std::shared_ptr<IRenderSubMesh> IRenderSubMeshSP;
@@ -100,6 +100,13 @@ public:
 
     virtual void setGraphicsPipeline(const IGraphicsPipelineSP& graphicsPipeline) = 0;
 
+    /**
+     * Same as the graphics pipeline, but reading the transform matrix per instance. Can be empty.
+     */
+    virtual const IGraphicsPipelineSP& getInstanceGraphicsPipeline() const = 0;
+
+    virtual void setInstanceGraphicsPipeline(const IGraphicsPipelineSP& instanceGraphicsPipeline) = 0;
+
     virtual const IPhongMaterialSP& getPhongMaterial() const = 0;
 
     virtual void setPhongMaterial(const IPhongMaterialSP& phongMaterial) = 0;
@@ -171,6 +178,8 @@ public:
 
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName) = 0;
 
+    virtual void collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName) = 0;
+
 };
 
 typedef std::shared_ptr<ISubMesh> ISubMeshSP;
@@ -0,0 +1,106 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_ISKELETONBATCH_HPP_
+#define VKTS_ISKELETONBATCH_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+/**
+ * Joints of all armatures of a scene, flattened per skeleton with parent indices.
+ * The skeletons are evaluated in parallel by the task executors into one contiguous palette,
+ * which has the layout of the joints uniform buffer for each skeleton.
+ */
+class ISkeletonBatch
+{
+
+public:
+
+    ISkeletonBatch()
+    {
+    }
+
+    virtual ~ISkeletonBatch()
+    {
+    }
+
+    virtual const ISceneSP& getScene() const = 0;
+
+    /**
+     * Flattens the skeletons again. Has to be called, after objects, nodes or joints have been added or removed.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 rebuild() = 0;
+
+    virtual uint32_t getNumberSkeletons() const = 0;
+
+    virtual const INodeSP& getArmatureNode(const uint32_t skeleton) const = 0;
+
+    /**
+     * The joints of a skeleton are located from its offset to the offset of the next skeleton.
+     */
+    virtual uint32_t getJointOffset(const uint32_t skeleton) const = 0;
+
+    virtual uint32_t getNumberJoints() const = 0;
+
+    virtual const INodeSP& getJointNode(const uint32_t joint) const = 0;
+
+    /**
+     * Returns -1, if the parent is the armature.
+     */
+    virtual int32_t getParentIndex(const uint32_t joint) const = 0;
+
+    /**
+     * Size in bytes of the palette of one skeleton.
+     */
+    virtual uint32_t getPaletteStride() const = 0;
+
+    virtual const float* getPalette() const = 0;
+
+    /**
+     * Has to be chained into the scene update, so the joints are skipped there and only evaluated by this batch.
+     */
+    virtual OverwriteUpdate& getUpdateOverwrite() = 0;
+
+    /**
+     * Has to be called after the scene update. Evaluates all skeletons, uploads the palettes of changed skeletons
+     * and updates nodes attached to joints. Skeletons in adjacent slots of one joints uniform buffer are uploaded with one upload.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const OverwriteUpdate* updateOverwrite = nullptr) = 0;
+
+};
+
+typedef std::shared_ptr<ISkeletonBatch> ISkeletonBatchSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_ISKELETONBATCH_HPP_ */
@@ -29,7 +29,7 @@
 
 /**
  *
- * Depends on VKTS entity and Vulkan object.
+ * Depends on VKTS entity, runtime and Vulkan object.
  *
  */
 
@@ -37,6 +37,7 @@
 
 #include <vkts/scenegraph/fn_bindings.hpp>
 #include <vkts/entity/vkts_entity.hpp>
+#include <vkts/runtime/vkts_runtime.hpp>
 
 #define VKTS_BSDF_LENGTH 512
 #define VKTS_BSDF_SAMPLES 256
@@ -46,9 +47,16 @@
 #define VKTS_CONVERT_BEZIER VK_TRUE
 #define VKTS_CONVERT_SAMPLING (1.0f/60.0f)
 
+#define VKTS_COMPRESS_SAMPLING (1.0f/30.0f)
+#define VKTS_COMPRESS_ERROR 0.0005f
+
 #define VKTS_SHADER_DIRECTORY "shader/SPIR/V/"
 #define VKTS_TEXTURE_DIRECTORY "texture/"
 
+#define VKTS_MAX_DRAW_DYNAMIC_OFFSETS 8
+#define VKTS_MAX_DRAW_PUSH_CONSTANT_RANGES 4
+#define VKTS_MAX_DRAW_PUSH_CONSTANT_SIZE 128
+
 /**
  * Types.
  */
@@ -85,6 +93,64 @@ typedef enum VkTsInterpolator_
 	VKTS_INTERPOLATOR_CUBICSPLINE = 4
 } VkTsInterpolator;
 
+typedef enum VkTsRenderQueueSort_
+{
+    VKTS_RENDER_QUEUE_SORT_STATE = 0,
+    VKTS_RENDER_QUEUE_SORT_BACK_TO_FRONT = 1
+} VkTsRenderQueueSort;
+
+/**
+ * Everything needed to record one draw of a sub mesh. The key is set by the render queue.
+ */
+typedef struct VkTsDrawPacket_
+{
+    uint64_t key;
+    VkPipeline pipeline;
+    VkPipelineLayout layout;
+    VkDescriptorSet descriptorSet;
+    uint32_t dynamicOffsetCount;
+    uint32_t dynamicOffsets[VKTS_MAX_DRAW_DYNAMIC_OFFSETS];
+    VkBuffer vertexBuffer;
+    VkBuffer indexBuffer;
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    // View space distance of the node.
+    float depth;
+    uint32_t pushConstantRangeCount;
+    VkPushConstantRange pushConstantRanges[VKTS_MAX_DRAW_PUSH_CONSTANT_RANGES];
+    // Data of the ranges, located at the range offsets.
+    uint8_t pushConstants[VKTS_MAX_DRAW_PUSH_CONSTANT_SIZE];
+    // Packets with the same instance key and state can be drawn instanced, using the instance pipeline.
+    uint64_t instanceKey;
+    VkPipeline instancePipeline;
+    // World transform of the node, streamed per instance.
+    glm::mat4 transformMatrix;
+} VkTsDrawPacket;
+
+typedef struct VkTsRenderQueueStatistics_
+{
+    uint32_t drawCount;
+    uint32_t pipelineBindCount;
+    uint32_t pipelineBindsAvoided;
+    uint32_t descriptorSetBindCount;
+    uint32_t descriptorSetBindsAvoided;
+    uint32_t vertexBufferBindCount;
+    uint32_t vertexBufferBindsAvoided;
+    uint32_t indexBufferBindCount;
+    uint32_t indexBufferBindsAvoided;
+    uint32_t instancedDrawCount;
+    uint32_t instanceCount;
+} VkTsRenderQueueStatistics;
+
+typedef struct VkTsCullStatistics_
+{
+    uint32_t volumeTestCount;
+    uint32_t subMeshVisibleCount;
+    uint32_t subMeshCulledCount;
+    uint32_t nodeVisibleCount;
+    uint32_t nodeCulledCount;
+} VkTsCullStatistics;
+
 /**
  * Parameter set.
  */
@@ -98,12 +164,22 @@ typedef enum VkTsInterpolator_
 #include <vkts/scenegraph/overwrite/OverwriteDraw.hpp>
 #include <vkts/scenegraph/overwrite/OverwriteUpdate.hpp>
 
+/**
+ * Render queue.
+ */
+
+#include <vkts/scenegraph/queue/IRenderQueue.hpp>
+
+#include <vkts/scenegraph/queue/fn_draw_packet.hpp>
+
 /**
  * Scene.
  */
 
 #include <vkts/scenegraph/scene/IChannel.hpp>
 
+#include <vkts/scenegraph/interpolator/AnimationSampler.hpp>
+
 #include <vkts/scenegraph/scene/IRenderMaterial.hpp>
 #include <vkts/scenegraph/scene/IBSDFMaterial.hpp>
 #include <vkts/scenegraph/scene/IPhongMaterial.hpp>
@@ -126,6 +202,30 @@ typedef enum VkTsInterpolator_
 
 #include <vkts/scenegraph/scene/IScene.hpp>
 
+/**
+ * Transform hierarchy.
+ */
+
+#include <vkts/scenegraph/hierarchy/ITransformHierarchy.hpp>
+
+#include <vkts/scenegraph/hierarchy/fn_transform_hierarchy.hpp>
+
+/**
+ * Culling.
+ */
+
+#include <vkts/scenegraph/culling/IBoundingVolumeHierarchy.hpp>
+
+#include <vkts/scenegraph/culling/fn_bounding_volume_hierarchy.hpp>
+
+/**
+ * Skeleton.
+ */
+
+#include <vkts/scenegraph/skeleton/ISkeletonBatch.hpp>
+
+#include <vkts/scenegraph/skeleton/fn_skeleton_batch.hpp>
+
 /**
  * Shader.
  */
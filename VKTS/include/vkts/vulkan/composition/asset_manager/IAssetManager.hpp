@@ -52,6 +52,13 @@ public:
 
     virtual VkBool32 isReplace() const = 0;
 
+    /**
+     * If set, image data of created image and texture objects is uploaded through this batch and not the command object.
+     */
+    virtual const IImageUploadBatchSP& getImageUploadBatch() const = 0;
+
+    virtual void setImageUploadBatch(const IImageUploadBatchSP& imageUploadBatch) = 0;
+
     //
 
     virtual ITextureObjectSP useTextureObject(const std::string& name) const = 0;
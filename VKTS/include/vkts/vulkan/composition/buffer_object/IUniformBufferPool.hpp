@@ -0,0 +1,80 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IUNIFORMBUFFERPOOL_HPP_
+#define VKTS_IUNIFORMBUFFERPOOL_HPP_
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+namespace vkts
+{
+
+/**
+ * Hands out equally sized slots of shared uniform buffers.
+ * Each buffer is frame major: the slot of frame i is at the slot offset plus i times the frame size of the buffer.
+ */
+class IUniformBufferPool: public IDestroyable
+{
+
+public:
+
+    IUniformBufferPool() :
+        IDestroyable()
+    {
+    }
+
+    virtual ~IUniformBufferPool()
+    {
+    }
+
+    /**
+     * Takes a free slot or creates a new buffer, if all slots are used.
+     * The buffers are mapped persistent, so slots of one buffer can be uploaded from several threads.
+     *
+     * @ThreadSafe
+     */
+    virtual VkBool32 allocate(IBufferObjectSP& uniformBuffer, VkDeviceSize& offset) = 0;
+
+    /**
+     * Returns the slot for reuse.
+     *
+     * @ThreadSafe
+     */
+    virtual void free(const IBufferObjectSP& uniformBuffer, const VkDeviceSize offset) = 0;
+
+    virtual VkDeviceSize getSlotSize() const = 0;
+
+    virtual uint32_t getSlotsPerBuffer() const = 0;
+
+    virtual VkDeviceSize getBufferCount() const = 0;
+
+};
+
+typedef std::shared_ptr<IUniformBufferPool> IUniformBufferPoolSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IUNIFORMBUFFERPOOL_HPP_ */
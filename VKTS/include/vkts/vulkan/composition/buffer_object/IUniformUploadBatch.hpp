@@ -0,0 +1,91 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IUNIFORMUPLOADBATCH_HPP_
+#define VKTS_IUNIFORMUPLOADBATCH_HPP_
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+namespace vkts
+{
+
+/**
+ * Keeps the memory of the added buffer objects persistent mapped, so uploads to them only copy the data.
+ * Not host coherent memory is flushed once per frame.
+ */
+class IUniformUploadBatch: public IDestroyable
+{
+
+public:
+
+    IUniformUploadBatch() :
+        IDestroyable()
+    {
+    }
+
+    virtual ~IUniformUploadBatch()
+    {
+    }
+
+    /**
+     * Maps the memory of the buffer object. Buffer objects sharing the same memory are only added once.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 addBufferObject(const IBufferObjectSP& bufferObject) = 0;
+
+    virtual uint32_t getNumberDeviceMemories() const = 0;
+
+    /**
+     * Has to be called once per frame, after all uploads and before the command buffers are submitted.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 flush() = 0;
+
+    /**
+     * Counters since creation or the last reset.
+     */
+    virtual uint64_t getUploadCount() const = 0;
+
+    virtual uint64_t getUploadBytes() const = 0;
+
+    virtual uint64_t getFlushCount() const = 0;
+
+    /**
+     * Map, unmap and flush calls, which would have been done without persistent mapping.
+     */
+    virtual uint64_t getSavedCallCount() const = 0;
+
+    virtual void resetCounters() = 0;
+
+};
+
+typedef std::shared_ptr<IUniformUploadBatch> IUniformUploadBatchSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IUNIFORMUPLOADBATCH_HPP_ */
@@ -56,6 +56,38 @@ public:
 
     virtual const IQueueSP& getQueue() const = 0;
 
+    /**
+     * Buffer and image objects sub allocate their memory from this allocator.
+     */
+    virtual const IDeviceMemoryAllocatorSP& getDeviceMemoryAllocator() const = 0;
+
+    /**
+     * Materials and fonts allocate their descriptor sets from this allocator.
+     */
+    virtual const IDescriptorSetAllocatorSP& getDescriptorSetAllocator() const = 0;
+
+    /**
+     * Cache loaded from disk, when the context object was created.
+     * It is saved, before the device is destroyed.
+     */
+    virtual const IPipelineCacheSP& getPipelineCache() const = 0;
+
+    /**
+     * Creates a cache e.g. for a loading thread, so threads do not contend for one cache.
+     * The cache is seeded with the content of the pipeline cache.
+     * The cache is merged into the pipeline cache, when it is saved.
+     *
+     * @ThreadSafe
+     */
+    virtual IPipelineCacheSP createPipelineCache() = 0;
+
+    /**
+     * Merges all created caches into the pipeline cache and writes it to disk.
+     *
+     * @ThreadSafe
+     */
+    virtual VkBool32 savePipelineCache() = 0;
+
     virtual void destroyDevice() = 0;
 
 };
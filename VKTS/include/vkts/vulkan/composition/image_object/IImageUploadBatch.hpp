@@ -0,0 +1,116 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IIMAGEUPLOADBATCH_HPP_
+#define VKTS_IIMAGEUPLOADBATCH_HPP_
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+namespace vkts
+{
+
+/**
+ * Uploads image data through one persistent mapped staging ring.
+ * Copy commands of many images are recorded into few command buffers, which are submitted on demand or when the ring is full.
+ * If the transfer queue is of another family than the context queue, the ownership of the images is transferred to the context queue.
+ */
+class IImageUploadBatch: public IDestroyable
+{
+
+public:
+
+    IImageUploadBatch() :
+        IDestroyable()
+    {
+    }
+
+    virtual ~IImageUploadBatch()
+    {
+    }
+
+    virtual const IContextObjectSP& getContextObject() const = 0;
+
+    virtual const IQueueSP& getTransferQueue() const = 0;
+
+    virtual VkDeviceSize getRingSize() const = 0;
+
+    /**
+     * Copies the image data into the staging ring and records the copy commands. The image is in the given layout, after the batch has been executed.
+     * If the ring is full, the pending commands are submitted and the oldest submit is waited for.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 addImage(const IImageSP& image, const IImageDataSP& imageData, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange) = 0;
+
+    /**
+     * Submits the recorded commands. Returns the fence of this submit, or an empty fence, if nothing was recorded.
+     *
+     * Not thread Safe.
+     */
+    virtual IFenceSP submit() = 0;
+
+    /**
+     * Fence of the last submit. Can be polled, so loading overlaps rendering.
+     */
+    virtual const IFenceSP& getFence() const = 0;
+
+    /**
+     * Returns VK_TRUE, if all submits have been executed. Staging memory of executed submits is reused.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 isComplete() = 0;
+
+    /**
+     * Submits pending commands and waits for all submits.
+     *
+     * Not thread Safe.
+     */
+    virtual VkBool32 waitIdle() = 0;
+
+    /**
+     * Counters since creation or the last reset.
+     */
+    virtual uint64_t getImageCount() const = 0;
+
+    virtual uint64_t getUploadBytes() const = 0;
+
+    virtual uint64_t getSubmitCount() const = 0;
+
+    /**
+     * Uploaded megabytes per second, measured from the first added image until the last submit has been executed.
+     */
+    virtual double getThroughput() const = 0;
+
+    virtual void resetCounters() = 0;
+
+};
+
+typedef std::shared_ptr<IImageUploadBatch> IImageUploadBatchSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IIMAGEUPLOADBATCH_HPP_ */
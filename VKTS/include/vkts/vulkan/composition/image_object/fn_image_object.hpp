@@ -38,6 +38,13 @@ namespace vkts
  */
 VKTS_APICALL IImageObjectSP VKTS_APIENTRY imageObjectCreate(IImageSP& stageImage, IBufferSP& stageBuffer, IDeviceMemorySP& stageDeviceMemory, const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const std::string& name, const IImageDataSP& imageData, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags);
 
+/**
+ * The image data is copied by the image upload batch. The image object can be used, after the batch has been executed.
+ *
+ * Not thread Safe, as the batch is not.
+ */
+VKTS_APICALL IImageObjectSP VKTS_APIENTRY imageObjectCreate(const IImageUploadBatchSP& imageUploadBatch, const std::string& name, const IImageDataSP& imageData, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags);
+
 /**
  *
  * @ThreadSafe
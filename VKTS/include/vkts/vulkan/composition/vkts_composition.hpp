@@ -37,6 +37,13 @@
 
 #include <vkts/image/vkts_image.hpp>
 
+/**
+ * Defines.
+ */
+
+#define VKTS_IMAGE_UPLOAD_RING_SIZE     (32 * 1024 * 1024)
+#define VKTS_IMAGE_UPLOAD_SUBMITS       3
+
 #include <vkts/vulkan/composition/command_object/ICommandObject.hpp>
 #include <vkts/vulkan/composition/command_object/fn_command_object.hpp>
 
@@ -46,6 +53,15 @@
 #include <vkts/vulkan/composition/buffer_object/IBufferObject.hpp>
 #include <vkts/vulkan/composition/buffer_object/fn_buffer_object.hpp>
 
+#include <vkts/vulkan/composition/buffer_object/IUniformUploadBatch.hpp>
+#include <vkts/vulkan/composition/buffer_object/fn_uniform_upload_batch.hpp>
+
+#include <vkts/vulkan/composition/buffer_object/IUniformBufferPool.hpp>
+#include <vkts/vulkan/composition/buffer_object/fn_uniform_buffer_pool.hpp>
+
+#include <vkts/vulkan/composition/image_object/IImageUploadBatch.hpp>
+#include <vkts/vulkan/composition/image_object/fn_image_upload_batch.hpp>
+
 #include <vkts/vulkan/composition/image_object/IImageObject.hpp>
 #include <vkts/vulkan/composition/image_object/fn_image_object.hpp>
 
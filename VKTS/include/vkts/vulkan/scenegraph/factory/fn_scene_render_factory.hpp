@@ -33,10 +33,12 @@ namespace vkts
 {
 
 /**
+ * If nodesPerUniformBuffer is greater than zero, the transforms of that many nodes share one uniform buffer.
+ * The dynamic offset stride of the transform and joints binding is then the size of one shared buffer.
  *
  * @ThreadSafe
  */
-VKTS_APICALL ISceneRenderFactorySP VKTS_APIENTRY sceneRenderFactoryCreate(const IDescriptorSetLayoutSP& descriptorSetLayout, const IRenderPassSP& renderPass, const IPipelineCacheSP& pipelineCache, const VkDeviceSize bufferCount = 1);
+VKTS_APICALL ISceneRenderFactorySP VKTS_APIENTRY sceneRenderFactoryCreate(const IDescriptorSetLayoutSP& descriptorSetLayout, const IRenderPassSP& renderPass, const IPipelineCacheSP& pipelineCache, const VkDeviceSize bufferCount = 1, const uint32_t nodesPerUniformBuffer = 0);
 
 }
 
@@ -73,6 +73,13 @@ public:
 
     	return VK_TRUE;
     }
+
+    virtual VkBool32 visit(const IMesh& mesh, VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings) const
+    {
+    	const auto& displace = mesh.getDisplace();
+
+    	return drawPacketAddPushConstants(drawPacket, VK_SHADER_STAGE_GEOMETRY_BIT, 0, sizeof(float) * 2, glm::value_ptr(displace));
+    }
 };
 
 } /* namespace vkts */
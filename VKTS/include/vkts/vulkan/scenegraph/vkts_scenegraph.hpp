@@ -48,6 +48,14 @@
 
 #include <vkts/vulkan/scenegraph/factory/fn_scene_render_factory.hpp>
 
+/**
+ *
+ * Render queue.
+ *
+ */
+
+#include <vkts/vulkan/scenegraph/queue/fn_render_queue.hpp>
+
 /**
  *
  * Overwrite draw.
@@ -56,6 +64,7 @@
 
 #include <vkts/vulkan/scenegraph/overwrite/Blend.hpp>
 #include <vkts/vulkan/scenegraph/overwrite/Cull.hpp>
+#include <vkts/vulkan/scenegraph/overwrite/CullHierarchy.hpp>
 #include <vkts/vulkan/scenegraph/overwrite/Displace.hpp>
 
 #endif /* VKTS_VKTS_SCENEGRAPH_HPP_ */
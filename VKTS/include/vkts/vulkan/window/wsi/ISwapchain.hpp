@@ -92,7 +92,10 @@ public:
 
     virtual VkResult acquireNextImage(const uint64_t timeout, const VkSemaphore semaphore, const VkFence fence, uint32_t& pImageIndex) const = 0;
 
-    virtual VkResult queuePresent(const VkQueue queue, const uint32_t waitSemaphoreCount, const VkSemaphore* waitSemaphores, const uint32_t swapchainCount, const VkSwapchainKHR* swapchains, const uint32_t* imageIndices, VkResult* results) const = 0;
+    /**
+     * Presents through the serialized queue, as loading tasks may submit to the same queue.
+     */
+    virtual VkResult queuePresent(const IQueueSP& queue, const uint32_t waitSemaphoreCount, const VkSemaphore* waitSemaphores, const uint32_t swapchainCount, const VkSwapchainKHR* swapchains, const uint32_t* imageIndices, VkResult* results) const = 0;
 
 };
 
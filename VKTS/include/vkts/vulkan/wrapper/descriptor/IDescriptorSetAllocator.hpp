@@ -0,0 +1,93 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IDESCRIPTORSETALLOCATOR_HPP_
+#define VKTS_IDESCRIPTORSETALLOCATOR_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+namespace vkts
+{
+
+class IDescriptorSetAllocator: public IDestroyable
+{
+
+public:
+
+    IDescriptorSetAllocator() :
+        IDestroyable()
+    {
+    }
+
+    virtual ~IDescriptorSetAllocator()
+    {
+    }
+
+    virtual const VkDevice getDevice() const = 0;
+
+    virtual uint32_t getSetsPerPool() const = 0;
+
+    /**
+     * Allocates one descriptor set from a pool page sized for the layout.
+     * Destroying the returned sets puts the descriptor set back to a free list of the page.
+     *
+     * @ThreadSafe
+     */
+    virtual IDescriptorSetsSP allocate(const IDescriptorSetLayoutSP& descriptorSetLayout) = 0;
+
+    /**
+     * Allocates one descriptor set, which is valid until the given frame is reset.
+     *
+     * @ThreadSafe
+     */
+    virtual IDescriptorSetsSP allocateTransient(const IDescriptorSetLayoutSP& descriptorSetLayout, const uint32_t frameIndex) = 0;
+
+    /**
+     * Resets all pools of the given frame. The GPU must not use the transient descriptor sets anymore.
+     *
+     * @ThreadSafe
+     */
+    virtual VkBool32 resetTransient(const uint32_t frameIndex) = 0;
+
+    /**
+     * @ThreadSafe
+     */
+    virtual void getStatistics(VkTsDescriptorSetStatistics& statistics) const = 0;
+
+    /**
+     * Destroys all pools without any used descriptor set.
+     *
+     * @ThreadSafe
+     */
+    virtual void freeUnusedPools() = 0;
+
+};
+
+typedef std::shared_ptr<IDescriptorSetAllocator> IDescriptorSetAllocatorSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IDESCRIPTORSETALLOCATOR_HPP_ */
@@ -50,6 +50,13 @@ VKTS_APICALL IDescriptorPoolSP VKTS_APIENTRY descriptorPoolCreate(const VkDevice
  */
 VKTS_APICALL IDescriptorSetsSP VKTS_APIENTRY descriptorSetsCreate(const VkDevice device, const VkDescriptorPool descriptorPool, const uint32_t descriptorSetCount, const VkDescriptorSetLayout* setLayouts);
 
+/**
+ * Each pool page holds setsPerPool descriptor sets of one layout.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IDescriptorSetAllocatorSP VKTS_APIENTRY descriptorSetAllocatorCreate(const VkDevice device, const uint32_t setsPerPool);
+
 }
 
 #endif /* VKTS_FN_DESCRIPTOR_HPP_ */
@@ -64,6 +64,12 @@ public:
 
     virtual const VkDeviceMemory getDeviceMemory() const = 0;
 
+    /**
+     * Offset inside the device memory, where the buffer or image has to be bound.
+     * Only sub allocated memory has an offset other than zero.
+     */
+    virtual VkDeviceSize getOffset() const = 0;
+
     virtual VkResult mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags) = 0;
 
     virtual void* getMemory() = 0;
@@ -76,6 +82,29 @@ public:
 
     virtual VkResult upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize) = 0;
 
+    /**
+     * Maps the whole memory, until unmapMemory is called.
+     * In the meantime, uploads only copy the data and do not map, unmap or flush the memory.
+     */
+    virtual VkResult mapMemoryPersistent(const VkMemoryMapFlags flags) = 0;
+
+    virtual VkBool32 isMappedPersistent() const = 0;
+
+    /**
+     * Flushes all uploads since the last call, if the memory is persistent mapped and not host coherent.
+     *
+     * @ThreadSafe
+     */
+    virtual VkResult flushUploads() = 0;
+
+    virtual uint64_t getUploadCount() const = 0;
+
+    virtual uint64_t getUploadBytes() const = 0;
+
+    virtual uint64_t getMapCount() const = 0;
+
+    virtual uint64_t getFlushCount() const = 0;
+
 };
 
 typedef std::shared_ptr<IDeviceMemory> IDeviceMemorySP;
@@ -0,0 +1,90 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IDEVICEMEMORYALLOCATOR_HPP_
+#define VKTS_IDEVICEMEMORYALLOCATOR_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+namespace vkts
+{
+
+/**
+ * Creates device memory of the given memory type bits and property flags.
+ */
+typedef std::function<IDeviceMemorySP(const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags)> DeviceMemoryCreateFunction;
+
+class IDeviceMemoryAllocator: public IDestroyable
+{
+
+public:
+
+    IDeviceMemoryAllocator() :
+        IDestroyable()
+    {
+    }
+
+    virtual ~IDeviceMemoryAllocator()
+    {
+    }
+
+    /**
+     * Sub allocates the memory from a block of the matching memory type.
+     * Requests larger than half of a block get their own device memory.
+     * Linear is VK_TRUE for buffers and linear tiled images.
+     *
+     * @ThreadSafe
+     */
+    virtual IDeviceMemorySP allocate(const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags, const VkBool32 linear) = 0;
+
+    /**
+     * @ThreadSafe
+     */
+    virtual VkBool32 getStatistics(VkTsDeviceMemoryStatistics& statistics, const uint32_t memoryTypeIndex) const = 0;
+
+    /**
+     * Statistics summed up over all memory types.
+     *
+     * @ThreadSafe
+     */
+    virtual void getStatistics(VkTsDeviceMemoryStatistics& statistics) const = 0;
+
+    virtual VkDeviceSize getBlockSize(const uint32_t memoryTypeIndex) const = 0;
+
+    /**
+     * Frees the device memory of all blocks without any allocation.
+     *
+     * @ThreadSafe
+     */
+    virtual void freeUnusedBlocks() = 0;
+
+};
+
+typedef std::shared_ptr<IDeviceMemoryAllocator> IDeviceMemoryAllocatorSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IDEVICEMEMORYALLOCATOR_HPP_ */
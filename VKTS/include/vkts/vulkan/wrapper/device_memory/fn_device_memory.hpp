@@ -44,6 +44,20 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY deviceGetMemoryTypeIndex(const uint32_t memo
  */
 VKTS_APICALL IDeviceMemorySP VKTS_APIENTRY deviceMemoryCreate(const VkDevice device, const VkMemoryRequirements& memoryRequirements, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags propertyFlags);
 
+/**
+ * Block size is reduced for small heaps, so a heap is not exhausted by a few blocks.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IDeviceMemoryAllocatorSP VKTS_APIENTRY deviceMemoryAllocatorCreate(const VkDevice device, const VkPhysicalDeviceMemoryProperties& physicalDeviceMemoryProperties, const VkPhysicalDeviceLimits& physicalDeviceLimits, const VkDeviceSize blockSize);
+
+/**
+ * Blocks and dedicated memory are created by the given function, e.g. to run the allocator without a device.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IDeviceMemoryAllocatorSP VKTS_APIENTRY deviceMemoryAllocatorCreate(const DeviceMemoryCreateFunction& createFunction, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkDeviceSize bufferImageGranularity, const VkDeviceSize nonCoherentAtomSize, const VkDeviceSize blockSize);
+
 }
 
 #endif /* VKTS_FN_DEVICE_MEMORY_HPP_ */
@@ -58,6 +58,16 @@ public:
 
     virtual const VkPipelineCache getPipelineCache() const = 0;
 
+    /**
+     * Returns the current content of the cache, including the header.
+     */
+    virtual IBinaryBufferSP getData() const = 0;
+
+    /**
+     * Adds the content of the source caches, e.g. caches used by other threads.
+     */
+    virtual VkResult mergePipelineCaches(const uint32_t srcCacheCount, const VkPipelineCache* srcCaches) = 0;
+
 };
 
 typedef std::shared_ptr<IPipelineCache> IPipelineCacheSP;
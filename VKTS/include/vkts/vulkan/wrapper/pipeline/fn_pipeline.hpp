@@ -38,6 +38,33 @@ namespace vkts
  */
 VKTS_APICALL IPipelineCacheSP VKTS_APIENTRY pipelineCreateCache(const VkDevice device, const VkPipelineCacheCreateFlags flags, const uint32_t initialSize = 0, const void* initialData = nullptr);
 
+/**
+ * Checks the header of the cache data. Data created by another device or driver is not valid.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY pipelineCacheIsDataValid(const VkPhysicalDeviceProperties& physicalDeviceProperties, const size_t dataSize, const void* data);
+
+/**
+ * Filename contains vendor, device, driver version and cache UUID, so each driver has its own file.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL std::string VKTS_APIENTRY pipelineCacheGetFilename(const VkPhysicalDeviceProperties& physicalDeviceProperties);
+
+/**
+ * Creates an empty cache, if the file does not exist or its data is not valid.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IPipelineCacheSP VKTS_APIENTRY pipelineCacheLoad(const VkDevice device, const VkPhysicalDeviceProperties& physicalDeviceProperties, const char* filename);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY pipelineCacheSave(const char* filename, const IPipelineCacheSP& pipelineCache);
+
 /**
  *
  * @ThreadSafe
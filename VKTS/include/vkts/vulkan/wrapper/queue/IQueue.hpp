@@ -45,12 +45,30 @@ public:
     {
     }
 
+    /**
+     * Access to the Vulkan queue is serialized, so several threads can submit to the same queue.
+     *
+     * @ThreadSafe
+     */
     virtual VkResult submit(const uint32_t submitCount, const VkSubmitInfo* submits, const VkFence fence) const = 0;
 
+    /**
+     * @ThreadSafe
+     */
     virtual VkResult waitIdle() const = 0;
 
+    /**
+     * @ThreadSafe
+     */
     virtual VkResult bindSparse(const uint32_t bindInfoCount, const VkBindSparseInfo* bindInfo, const VkFence fence) const = 0;
 
+    /**
+     * Presenting uses the queue as well, so it has to be serialized with the submits.
+     *
+     * @ThreadSafe
+     */
+    virtual VkResult present(const VkPresentInfoKHR& presentInfo) const = 0;
+
     virtual const VkDevice getDevice() const = 0;
 
     virtual uint32_t getQueueFamilyIndex() const = 0;
@@ -51,6 +51,10 @@
 #define VKTS_ENGINE_PATCH           49
 #define VKTS_ENGINE_REVISION        0
 
+#define VKTS_DEVICE_MEMORY_BLOCK_SIZE   (64 * 1024 * 1024)
+
+#define VKTS_DESCRIPTOR_SETS_PER_POOL   64
+
 /**
  * Types.
  */
@@ -69,6 +73,9 @@ typedef enum VkTsVertexBufferTypeBits_
     VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS1 = 0x00000200,
     VKTS_VERTEX_BUFFER_TYPE_BONE_NUMBERS = 0x00000400,
 
+    // Not part of the vertex buffer. Shaders and pipelines with this bit read the transform matrix per instance.
+    VKTS_VERTEX_BUFFER_TYPE_INSTANCE_TRANSFORM = 0x00000800,
+
     VKTS_VERTEX_BUFFER_TYPE_TANGENTS = VKTS_VERTEX_BUFFER_TYPE_NORMAL | VKTS_VERTEX_BUFFER_TYPE_BITANGENT | VKTS_VERTEX_BUFFER_TYPE_TANGENT,
 
     VKTS_VERTEX_BUFFER_TYPE_BONES = VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES0 | VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES1 | VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS0 | VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS1 | VKTS_VERTEX_BUFFER_TYPE_BONE_NUMBERS
@@ -113,6 +120,32 @@ typedef struct VkTsStructureTypeHeader_
     const void* pNext;
 } VkTsStructureTypeHeader;
 
+typedef struct VkTsDeviceMemoryStatistics_
+{
+    uint32_t blockCount;
+    VkDeviceSize blockBytes;
+    uint32_t dedicatedCount;
+    VkDeviceSize dedicatedBytes;
+    uint32_t allocationCount;
+    VkDeviceSize usedBytes;
+    uint32_t freeRangeCount;
+    VkDeviceSize largestFreeRange;
+    // One minus largest free range divided by all free bytes in blocks.
+    float fragmentation;
+} VkTsDeviceMemoryStatistics;
+
+typedef struct VkTsDescriptorSetStatistics_
+{
+    uint32_t poolCount;
+    uint32_t transientPoolCount;
+    // Sets in use and freed sets kept for reuse.
+    uint32_t usedSetCount;
+    uint32_t cachedSetCount;
+    uint64_t allocationCount;
+    uint64_t reuseCount;
+    uint64_t transientAllocationCount;
+} VkTsDescriptorSetStatistics;
+
 /**
  * Alignment.
  */
@@ -247,6 +280,7 @@ typedef struct VkTsStructureTypeHeader_
  */
 
 #include <vkts/vulkan/wrapper/device_memory/IDeviceMemory.hpp>
+#include <vkts/vulkan/wrapper/device_memory/IDeviceMemoryAllocator.hpp>
 
 #include <vkts/vulkan/wrapper/device_memory/fn_device_memory.hpp>
 
@@ -257,6 +291,7 @@ typedef struct VkTsStructureTypeHeader_
 #include <vkts/vulkan/wrapper/descriptor/IDescriptorSetLayout.hpp>
 #include <vkts/vulkan/wrapper/descriptor/IDescriptorPool.hpp>
 #include <vkts/vulkan/wrapper/descriptor/IDescriptorSets.hpp>
+#include <vkts/vulkan/wrapper/descriptor/IDescriptorSetAllocator.hpp>
 
 #include <vkts/vulkan/wrapper/descriptor/fn_descriptor.hpp>
 
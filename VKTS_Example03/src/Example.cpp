@@ -1255,7 +1255,7 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
         VkSwapchainKHR swapchains = swapchain->getSwapchain();
 
-        result = swapchain->queuePresent(queue->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
+        result = swapchain->queuePresent(queue, 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
 
 		if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
 		{
@@ -197,7 +197,7 @@ VkBool32 Example::updateDescriptorSets()
 
 VkBool32 Example::buildScene(const vkts::ICommandObjectSP& commandObject)
 {
-	renderFactory = vkts::sceneRenderFactoryCreate(descriptorSetLayout, vkts::IRenderPassSP(), vkts::IPipelineCacheSP(), VKTS_MAX_NUMBER_BUFFERS);
+	renderFactory = vkts::sceneRenderFactoryCreate(descriptorSetLayout, vkts::IRenderPassSP(), contextObject->getPipelineCache(), VKTS_MAX_NUMBER_BUFFERS);
 	VKTS_VALIDATE_INSTANCE(renderFactory, "Could not create data factory.");
 
 	//
@@ -492,7 +492,7 @@ VkBool32 Example::buildPipeline()
 	graphicsPipelineCreateInfo.basePipelineHandle  = VK_NULL_HANDLE;
 	graphicsPipelineCreateInfo.basePipelineIndex   = 0;
 
-	auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 	VKTS_VALIDATE_INSTANCE(pipeline, "Could not create graphics pipeline.");
 
 	allGraphicsPipelines.append(pipeline);
@@ -1038,7 +1038,7 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
 		VkSwapchainKHR swapchains = swapchain->getSwapchain();
 
-		result = swapchain->queuePresent(contextObject->getQueue()->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
+		result = swapchain->queuePresent(contextObject->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
 
 		if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
 		{
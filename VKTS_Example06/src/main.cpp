@@ -85,6 +85,10 @@ static void terminateApp()
 
 	//
 
+	vkts::cacheTerminate();
+
+	//
+
 	vkts::engineTerminate();
 }
 
@@ -82,9 +82,19 @@ VkBool32 BuildCommandTask::execute()
 
     vkCmdSetScissor(cmdBuffer[usedBuffer]->getCommandBuffer(), 0, 1, &scissor);
 
-    if (scene.get())
+    // Collect, sort and record the draws of this task, so that redundant binds are left out.
+
+    memset(&renderQueueStatistics, 0, sizeof(VkTsRenderQueueStatistics));
+
+    if (scene.get() && renderQueue.get())
     {
-        scene->drawRecursive(cmdBuffer[usedBuffer], allGraphicsPipelines, usedBuffer, dynamicOffsets, overwrite, objectOffset, objectStep);
+    	renderQueue->reset();
+
+        scene->collectRecursive(*renderQueue, allGraphicsPipelines, usedBuffer, dynamicOffsets, overwrite, objectOffset, objectStep);
+
+        renderQueue->sort();
+
+        renderQueue->record(cmdBuffer[usedBuffer], renderQueueStatistics);
     }
 
     vkEndCommandBuffer(cmdBuffer[usedBuffer]->getCommandBuffer());
@@ -99,8 +109,17 @@ VkBool32 BuildCommandTask::execute()
 }
 
 BuildCommandTask::BuildCommandTask(const uint64_t id, const vkts::IUpdateThreadContext& updateContext, const vkts::IContextObjectSP& contextObject, const vkts::SmartPointerVector<vkts::IGraphicsPipelineSP>& allGraphicsPipelines, const vkts::ISceneSP& scene, const uint32_t buffers, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsets, const uint32_t& objectOffset, const uint32_t& objectStep) :
-	ITask(id), updateContext(updateContext), contextObject(contextObject), allGraphicsPipelines(allGraphicsPipelines), scene(scene), dynamicOffsets(dynamicOffsets), objectOffset(objectOffset), objectStep(objectStep), commandBufferInheritanceInfo(nullptr), extent{0, 0}, usedBuffer(0), commandPool(nullptr), cmdBuffer()
+	ITask(id), updateContext(updateContext), contextObject(contextObject), allGraphicsPipelines(allGraphicsPipelines), scene(scene), dynamicOffsets(dynamicOffsets), objectOffset(objectOffset), objectStep(objectStep), commandBufferInheritanceInfo(nullptr), extent{0, 0}, usedBuffer(0), commandPool(nullptr), cmdBuffer(), renderQueue(nullptr), renderQueueStatistics{}
 {
+	renderQueue = vkts::renderQueueCreate();
+
+	if (!renderQueue.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create render queue.");
+	}
+
+	//
+
 	// This pool will contain secondary command buffers, which will be reset.
 	commandPool = vkts::commandPoolCreate(contextObject->getDevice()->getDevice(), VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, contextObject->getQueue()->getQueueFamilyIndex());
 
@@ -161,6 +180,19 @@ void BuildCommandTask::setUsedBuffer(const uint32_t usedBuffer)
 	this->usedBuffer = usedBuffer;
 }
 
+void BuildCommandTask::setViewMatrix(const glm::mat4& viewMatrix)
+{
+	if (renderQueue.get())
+	{
+		renderQueue->setViewMatrix(viewMatrix);
+	}
+}
+
+const VkTsRenderQueueStatistics& BuildCommandTask::getRenderQueueStatistics() const
+{
+	return renderQueueStatistics;
+}
+
 VkCommandBuffer BuildCommandTask::getCommandBuffer() const
 {
 	if (usedBuffer >= (uint32_t)cmdBuffer.size())
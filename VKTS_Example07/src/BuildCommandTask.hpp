@@ -63,6 +63,10 @@ private:
 
 	vkts::SmartPointerVector<vkts::ICommandBuffersSP> cmdBuffer;
 
+	vkts::IRenderQueueSP renderQueue;
+
+	VkTsRenderQueueStatistics renderQueueStatistics;
+
 protected:
 
 	virtual VkBool32 execute() override;
@@ -80,6 +84,10 @@ public:
 
     void setUsedBuffer(const uint32_t usedBuffer);
 
+    void setViewMatrix(const glm::mat4& viewMatrix);
+
+    const VkTsRenderQueueStatistics& getRenderQueueStatistics() const;
+
     VkCommandBuffer getCommandBuffer() const;
 
 };
@@ -871,7 +871,7 @@ VkBool32 Example::buildPipeline()
 
 	//
 
-	auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -917,7 +917,7 @@ VkBool32 Example::buildPipeline()
 	graphicsPipelineCreateInfo.pColorBlendState = nullptr;
 	graphicsPipelineCreateInfo.renderPass = shadowRenderPass->getRenderPass();
 
-	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -951,7 +951,7 @@ VkBool32 Example::buildPipeline()
 	// Same as above with blending.
 	pipelineColorBlendAttachmentState.blendEnable = VK_TRUE;
 
-	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -967,7 +967,7 @@ VkBool32 Example::buildPipeline()
 	// Same as above with clockwise as front face.
 	pipelineRasterizationStateCreateInfo.frontFace = VK_FRONT_FACE_CLOCKWISE;
 
-	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -1007,7 +1007,7 @@ VkBool32 Example::buildPipeline()
 	pipelineColorBlendAttachmentState.blendEnable = VK_FALSE;
 
 
-	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -1039,7 +1039,7 @@ VkBool32 Example::buildPipeline()
 	graphicsPipelineCreateInfo.pColorBlendState = nullptr;
 	graphicsPipelineCreateInfo.renderPass = shadowRenderPass->getRenderPass();
 
-	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -2151,7 +2151,7 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
 			VkSwapchainKHR swapchains = swapchain->getSwapchain();
 
-			result = swapchain->queuePresent(contextObject->getQueue()->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
+			result = swapchain->queuePresent(contextObject->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
 
 			if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
 			{
@@ -71,7 +71,19 @@ VkBool32 LoadTask::execute()
 
 	//
 
-	renderFactory = vkts::sceneRenderFactoryCreate(descriptorSetLayout, vkts::IRenderPassSP(), vkts::IPipelineCacheSP(), VKTS_MAX_NUMBER_BUFFERS);
+	// Pipelines are created in this thread, so it does not share the cache with the main thread.
+	auto pipelineCache = contextObject->createPipelineCache();
+
+	if (!pipelineCache.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create pipeline cache.");
+
+		return VK_FALSE;
+	}
+
+	//
+
+	renderFactory = vkts::sceneRenderFactoryCreate(descriptorSetLayout, vkts::IRenderPassSP(), pipelineCache, VKTS_MAX_NUMBER_BUFFERS, VKTS_NODES_PER_UNIFORM_BUFFER);
 
 	if (!renderFactory.get())
 	{
@@ -104,6 +116,20 @@ VkBool32 LoadTask::execute()
 
 	//
 
+	// Textures are uploaded in few submits, which are executed while the scene is still loading.
+	imageUploadBatch = vkts::imageUploadBatchCreate(contextObject, vkts::IQueueSP(), VKTS_IMAGE_UPLOAD_RING_SIZE);
+
+	if (!imageUploadBatch.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create image upload batch.");
+
+		return VK_FALSE;
+	}
+
+	sceneManager->getAssetManager()->setImageUploadBatch(imageUploadBatch);
+
+	//
+
 	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Loading '%s'", VKTS_SCENE_NAME);
 
 	//
@@ -128,18 +154,35 @@ VkBool32 LoadTask::execute()
 		return VK_FALSE;
 	}
 
+	// Only this thread waits, the update thread continues rendering.
+	if (!imageUploadBatch->waitIdle())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not upload images.");
+
+		return VK_FALSE;
+	}
+
+	sceneManager->getAssetManager()->setImageUploadBatch(vkts::IImageUploadBatchSP());
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Uploaded %llu images with %.1f MB/s in %llu submits.", (unsigned long long)imageUploadBatch->getImageCount(), imageUploadBatch->getThroughput(), (unsigned long long)imageUploadBatch->getSubmitCount());
+
 	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Number objects: %d", scene->getNumberObjects());
 
 	return VK_TRUE;
 }
 
 LoadTask::LoadTask(const vkts::IContextObjectSP& contextObject, const vkts::IDescriptorSetLayoutSP& descriptorSetLayout, vkts::ISceneRenderFactorySP& renderFactory, vkts::ISceneManagerSP& sceneManager, vkts::ISceneFactorySP& sceneFactory, vkts::ISceneSP& scene) :
-	ITask(0), contextObject(contextObject), descriptorSetLayout(descriptorSetLayout), renderFactory(renderFactory), sceneManager(sceneManager), sceneFactory(sceneFactory), scene(scene), commandPool(), cmdBuffer(), commandObject()
+	ITask(0), contextObject(contextObject), descriptorSetLayout(descriptorSetLayout), renderFactory(renderFactory), sceneManager(sceneManager), sceneFactory(sceneFactory), scene(scene), commandPool(), cmdBuffer(), commandObject(), imageUploadBatch()
 {
 }
 
 LoadTask::~LoadTask()
 {
+	if (imageUploadBatch.get())
+	{
+		imageUploadBatch->destroy();
+	}
+
 	if (commandObject.get())
 	{
 		commandObject->destroy();
@@ -34,6 +34,8 @@
 #define VKTS_NUMBER_DYNAMIC_UNIFORM_BUFFERS 5
 #define VKTS_MAX_NUMBER_BUFFERS 3
 
+#define VKTS_NODES_PER_UNIFORM_BUFFER 256
+
 class LoadTask : public vkts::ITask
 {
 
@@ -52,6 +54,8 @@ private:
 	vkts::ICommandBuffersSP cmdBuffer;
 	vkts::ICommandObjectSP commandObject;
 
+	vkts::IImageUploadBatchSP imageUploadBatch;
+
 protected:
 
 	virtual VkBool32 execute() override;
@@ -901,7 +901,7 @@ VkBool32 Example::buildPipeline()
     gp.getGraphicsPipelineCreateInfo().renderPass = renderPass->getRenderPass();
 
 
-    auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, gp.getGraphicsPipelineCreateInfo(), vertexBufferType);
+    auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), pipelineCache->getPipelineCache(), gp.getGraphicsPipelineCreateInfo(), vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -971,7 +971,7 @@ VkBool32 Example::buildPipeline()
 	resolveGP.getGraphicsPipelineCreateInfo().renderPass = renderPass->getRenderPass();
 
 
-	resolveGraphicsPipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, resolveGP.getGraphicsPipelineCreateInfo(), vertexBufferType);
+	resolveGraphicsPipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), pipelineCache->getPipelineCache(), resolveGP.getGraphicsPipelineCreateInfo(), vertexBufferType);
 
 	if (!resolveGraphicsPipeline.get())
 	{
@@ -1809,6 +1809,9 @@ void Example::terminateResources(const vkts::IUpdateThreadContext& updateContext
 //
 VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 {
+	// Measures cold and warm start, depending on an existing pipeline cache.
+	const double startupTime = vkts::timeGetRaw();
+
 	if (!visualContext->isWindowAttached(windowIndex))
 	{
 		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get window.");
@@ -1853,11 +1856,12 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 
 	//
 
-	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0);
+	// Cache is loaded and saved by the context object.
+	pipelineCache = contextObject->getPipelineCache();
 
 	if (!pipelineCache.get())
 	{
-		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create pipeline cache.");
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get pipeline cache.");
 
 		return VK_FALSE;
 	}
@@ -1933,6 +1937,8 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 		return VK_FALSE;
 	}
 
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Startup took %.1f ms with %s pipeline cache.", (vkts::timeGetRaw() - startupTime) * 1000.0, pipelineCache->getInitialDataSize() > 0 ? "warm" : "cold");
+
 	return VK_TRUE;
 }
 
@@ -2193,7 +2199,7 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
         VkSwapchainKHR swapchains = swapchain->getSwapchain();
 
-        result = swapchain->queuePresent(contextObject->getQueue()->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
+        result = swapchain->queuePresent(contextObject->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
 
 		if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
 		{
@@ -2425,10 +2431,7 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 	            imageAcquiredSemaphore->destroy();
 	        }
 
-			if (pipelineCache.get())
-			{
-				pipelineCache->destroy();
-			}
+			pipelineCache.reset();
 
 			if (commandPool.get())
 			{
@@ -1043,7 +1043,7 @@ VkBool32 Example::buildPipeline()
 
 	//
 
-	auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -1091,7 +1091,7 @@ VkBool32 Example::buildPipeline()
 	graphicsPipelineCreateInfo.pColorBlendState = nullptr;
 	graphicsPipelineCreateInfo.renderPass = shadowRenderPass->getRenderPass();
 
-	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -1125,7 +1125,7 @@ VkBool32 Example::buildPipeline()
 	// Same as above with blending.
 	pipelineColorBlendAttachmentState.blendEnable = VK_TRUE;
 
-	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -1141,7 +1141,7 @@ VkBool32 Example::buildPipeline()
 	// Same as above with clockwise as front face.
 	pipelineRasterizationStateCreateInfo.frontFace = VK_FRONT_FACE_CLOCKWISE;
 
-	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, graphicsPipelineCreateInfo, vertexBufferType);
+	pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), graphicsPipelineCreateInfo, vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -1230,7 +1230,7 @@ VkBool32 Example::buildPipeline()
     gp.getGraphicsPipelineCreateInfo().renderPass = voxelRenderPass->getRenderPass();
 
 
-    pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, gp.getGraphicsPipelineCreateInfo(), vertexBufferType);
+    pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), contextObject->getPipelineCache()->getPipelineCache(), gp.getGraphicsPipelineCreateInfo(), vertexBufferType);
 
     if (!pipeline.get())
     {
@@ -2455,7 +2455,7 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
 			VkSwapchainKHR swapchains = swapchain->getSwapchain();
 
-			result = swapchain->queuePresent(contextObject->getQueue()->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
+			result = swapchain->queuePresent(contextObject->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
 
 			if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
 			{
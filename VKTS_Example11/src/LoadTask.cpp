@@ -73,7 +73,19 @@ VkBool32 LoadTask::execute()
 
 	//
 
-	renderFactory = vkts::sceneRenderFactoryCreate(descriptorSetLayout, vkts::IRenderPassSP(), vkts::IPipelineCacheSP(), VKTS_MAX_NUMBER_BUFFERS);
+	// Pipelines are created in this thread, so it does not share the cache with the main thread.
+	auto pipelineCache = contextObject->createPipelineCache();
+
+	if (!pipelineCache.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create pipeline cache.");
+
+		return VK_FALSE;
+	}
+
+	//
+
+	renderFactory = vkts::sceneRenderFactoryCreate(descriptorSetLayout, vkts::IRenderPassSP(), pipelineCache, VKTS_MAX_NUMBER_BUFFERS);
 
 	if (!renderFactory.get())
 	{
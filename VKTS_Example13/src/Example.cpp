@@ -657,7 +657,7 @@ VkBool32 Example::buildPipeline()
     gp.getGraphicsPipelineCreateInfo().renderPass = renderPass->getRenderPass();
 
 
-    auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), VK_NULL_HANDLE, gp.getGraphicsPipelineCreateInfo(), vertexBufferType);
+    auto pipeline = vkts::pipelineCreateGraphics(contextObject->getDevice()->getDevice(), pipelineCache->getPipelineCache(), gp.getGraphicsPipelineCreateInfo(), vertexBufferType);
 
 	if (!pipeline.get())
 	{
@@ -1441,11 +1441,12 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 
 	//
 
-	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0);
+	// Cache is loaded and saved by the context object.
+	pipelineCache = contextObject->getPipelineCache();
 
 	if (!pipelineCache.get())
 	{
-		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create pipeline cache.");
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get pipeline cache.");
 
 		return VK_FALSE;
 	}
@@ -1842,7 +1843,7 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
 			VkSwapchainKHR swapchains = swapchain->getSwapchain();
 
-			result = swapchain->queuePresent(contextObject->getQueue()->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
+			result = swapchain->queuePresent(contextObject->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
 
 			if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
 			{
@@ -2225,10 +2226,7 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 	            imageAcquiredSemaphore->destroy();
 	        }
 
-			if (pipelineCache.get())
-			{
-				pipelineCache->destroy();
-			}
+			pipelineCache.reset();
 
 			if (commandPool.get())
 			{
@@ -73,7 +73,19 @@ VkBool32 LoadTask::execute()
 
 	//
 
-	renderFactory = vkts::sceneRenderFactoryCreate(vkts::IDescriptorSetLayoutSP(), renderPass, vkts::IPipelineCacheSP(), VKTS_MAX_NUMBER_BUFFERS);
+	// Pipelines are created in this thread, so it does not share the cache with the main thread.
+	auto pipelineCache = contextObject->createPipelineCache();
+
+	if (!pipelineCache.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create pipeline cache.");
+
+		return VK_FALSE;
+	}
+
+	//
+
+	renderFactory = vkts::sceneRenderFactoryCreate(vkts::IDescriptorSetLayoutSP(), renderPass, pipelineCache, VKTS_MAX_NUMBER_BUFFERS);
 
 	if (!renderFactory.get())
 	{
@@ -141,7 +153,7 @@ VkBool32 LoadTask::execute()
 	//
 	//
 
-	environmentRenderFactory = vkts::sceneRenderFactoryCreate(vkts::IDescriptorSetLayoutSP(), renderPass, vkts::IPipelineCacheSP(), VKTS_MAX_NUMBER_BUFFERS);
+	environmentRenderFactory = vkts::sceneRenderFactoryCreate(vkts::IDescriptorSetLayoutSP(), renderPass, pipelineCache, VKTS_MAX_NUMBER_BUFFERS);
 
 	if (!environmentRenderFactory.get())
 	{
@@ -197,7 +209,7 @@ VkBool32 LoadTask::execute()
 	//
 	//
 
-	sphereRenderFactory = vkts::sceneRenderFactoryCreate(environmentDescriptorSetLayout, vkts::IRenderPassSP(), vkts::IPipelineCacheSP(), VKTS_MAX_NUMBER_BUFFERS);
+	sphereRenderFactory = vkts::sceneRenderFactoryCreate(environmentDescriptorSetLayout, vkts::IRenderPassSP(), pipelineCache, VKTS_MAX_NUMBER_BUFFERS);
 
 	if (!sphereRenderFactory.get())
 	{
@@ -89,6 +89,10 @@ static void terminateApp()
 
 	//
 
+	vkts::cacheTerminate();
+
+	//
+
 	vkts::engineTerminate();
 }
 
@@ -50,6 +50,11 @@ BinaryBuffer::BinaryBuffer(const std::vector<uint8_t>& data) :
 {
 }
 
+BinaryBuffer::BinaryBuffer(std::vector<uint8_t>&& data) :
+	IBinaryBuffer(), data(std::move(data)), pos(0)
+{
+}
+
 BinaryBuffer::~BinaryBuffer()
 {
     reset();
@@ -47,6 +47,7 @@ public:
     explicit BinaryBuffer(const uint32_t size);
     BinaryBuffer(const uint8_t* data, const uint32_t size);
     explicit BinaryBuffer(const std::vector<uint8_t>& data);
+    explicit BinaryBuffer(std::vector<uint8_t>&& data);
     BinaryBuffer(const BinaryBuffer& other) = delete;
     BinaryBuffer(BinaryBuffer&& other) = delete;
     virtual ~BinaryBuffer();
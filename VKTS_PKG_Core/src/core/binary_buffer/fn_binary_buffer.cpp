@@ -27,6 +27,7 @@
 #include <vkts/core/vkts_core.hpp>
 
 #include "BinaryBuffer.hpp"
+#include "BinaryBufferView.hpp"
 
 namespace vkts
 {
@@ -102,4 +103,21 @@ IBinaryBufferSP VKTS_APIENTRY binaryBufferCreate(const float* data, const uint32
 	return binaryBufferCreate((const void*)data, size);
 }
 
+IBinaryBufferSP VKTS_APIENTRY binaryBufferCreate(const IBinaryBufferSP& buffer, const uint32_t offset, const uint32_t size)
+{
+    if (!buffer.get() || !buffer->getData() || size == 0)
+    {
+        return IBinaryBufferSP();
+    }
+
+    auto result = IBinaryBufferSP(new BinaryBufferView(buffer, offset, size));
+
+	if (result.get() && result->getSize() != size)
+	{
+		return IBinaryBufferSP();
+	}
+
+    return result;
+}
+
 }
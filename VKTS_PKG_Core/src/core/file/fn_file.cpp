@@ -121,9 +121,24 @@ IBinaryBufferSP VKTS_APIENTRY fileLoadBinary(const char* filename)
 	return _fileLoadBinary(filename);
 }
 
+IBinaryBufferSP VKTS_APIENTRY fileMapBinary(const char* filename)
+{
+	std::lock_guard<std::mutex> fileLockGuard(g_fileMutex);
+
+	auto buffer = _fileMapBinary(filename);
+
+	if (buffer.get())
+	{
+		return buffer;
+	}
+
+	return _fileLoadBinary(filename);
+}
+
 ITextBufferSP VKTS_APIENTRY fileLoadText(const char* filename)
 {
-    auto buffer = fileLoadBinary(filename);
+    // Text is copied once, so the file is only mapped.
+    auto buffer = fileMapBinary(filename);
 
     if (!buffer.get())
     {
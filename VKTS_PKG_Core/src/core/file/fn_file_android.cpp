@@ -28,6 +28,8 @@
 
 #include "../binary_buffer/BinaryBuffer.hpp"
 
+#include "MappedBinaryBuffer.hpp"
+
 #include "fn_file_internal.hpp"
 
 #include <sys/stat.h>
@@ -101,6 +103,74 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
 	return buffer;
 }
 
+IBinaryBufferSP VKTS_APIENTRY _fileMapBinary(const char* filename)
+{
+    if (!filename)
+    {
+        return IBinaryBufferSP();
+    }
+
+    //
+
+    if (!::g_app)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No android application.");
+
+		return IBinaryBufferSP();
+	}
+
+	AAssetManager* assetManager = ::g_app->activity->assetManager;
+
+    if (!assetManager)
+    {
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No asset manager.");
+
+		return IBinaryBufferSP();
+    }
+
+    AAsset* sourceAsset = AAssetManager_open(assetManager, filename, AASSET_MODE_BUFFER);
+
+    if (!sourceAsset)
+    {
+		return IBinaryBufferSP();
+    }
+
+    // Buffer is valid, as long as the asset is open.
+    const uint8_t* data = (const uint8_t*)AAsset_getBuffer(sourceAsset);
+
+	const uint32_t size = (uint32_t)AAsset_getLength(sourceAsset);
+
+	if (!data || size == 0)
+	{
+		AAsset_close(sourceAsset);
+
+	    return IBinaryBufferSP();
+	}
+
+	//
+
+    auto buffer = IBinaryBufferSP(new MappedBinaryBuffer(data, size, sourceAsset));
+
+	if (!buffer.get())
+	{
+		AAsset_close(sourceAsset);
+
+	    return IBinaryBufferSP();
+	}
+
+	return buffer;
+}
+
+void VKTS_APIENTRY _fileUnmapBinary(const uint8_t* data, const uint32_t size, void* handle)
+{
+	if (!handle)
+	{
+		return;
+	}
+
+	AAsset_close(static_cast<AAsset*>(handle));
+}
+
 VkBool32 VKTS_APIENTRY _filePrepareSaveBinary(const char* filename)
 {
 	if (!::g_app)
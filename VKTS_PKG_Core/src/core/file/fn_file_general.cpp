@@ -123,8 +123,6 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
 
     std::vector<uint8_t> data(size);
 
-    memset(&data[0], 0, size);
-
     rewind(file);
 
     auto elementsRead = fread(&data[0], 1, size, file);
@@ -138,7 +136,8 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
         return IBinaryBufferSP();
     }
 
-    auto buffer = IBinaryBufferSP(new BinaryBuffer(data));
+    // Data is moved.
+    auto buffer = IBinaryBufferSP(new BinaryBuffer(std::move(data)));
 
     //
 
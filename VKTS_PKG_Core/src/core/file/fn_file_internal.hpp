@@ -36,6 +36,10 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY _fileInit();
 
 VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename);
 
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY _fileMapBinary(const char* filename);
+
+VKTS_APICALL void VKTS_APIENTRY _fileUnmapBinary(const uint8_t* data, const uint32_t size, void* handle);
+
 VKTS_APICALL VkBool32 VKTS_APIENTRY _filePrepareSaveBinary(const char* filename);
 
 VKTS_APICALL VkBool32 VKTS_APIENTRY _fileCreateDirectory(const char* directory);
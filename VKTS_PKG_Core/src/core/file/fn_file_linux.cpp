@@ -26,13 +26,89 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "MappedBinaryBuffer.hpp"
+
 #include "fn_file_internal.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace vkts
 {
 
+IBinaryBufferSP VKTS_APIENTRY _fileMapBinary(const char* filename)
+{
+    if (!filename)
+    {
+        return IBinaryBufferSP();
+    }
+
+    //
+
+    std::string loadFilename = std::string(filename);
+
+    if (!fileIsAbsolutePath(filename))
+    {
+    	loadFilename = fileGetBaseDirectory() + loadFilename;
+    }
+
+    //
+
+    int file = open(loadFilename.c_str(), O_RDONLY);
+
+    if (file < 0)
+    {
+        return IBinaryBufferSP();
+    }
+
+    struct stat sb;
+
+    if (fstat(file, &sb) != 0 || !S_ISREG(sb.st_mode) || sb.st_size <= 0 || (uint64_t)sb.st_size > (uint64_t)UINT32_MAX)
+    {
+        close(file);
+
+        return IBinaryBufferSP();
+    }
+
+    uint32_t size = static_cast<uint32_t>(sb.st_size);
+
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+    // Mapping stays valid after closing the file.
+    close(file);
+
+    if (data == MAP_FAILED)
+    {
+        return IBinaryBufferSP();
+    }
+
+    // Loaders usually parse the file from the beginning to the end.
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    auto buffer = IBinaryBufferSP(new MappedBinaryBuffer(static_cast<const uint8_t*>(data), size, nullptr));
+
+	if (!buffer.get())
+	{
+		munmap(data, size);
+
+	    return IBinaryBufferSP();
+	}
+
+    return buffer;
+}
+
+void VKTS_APIENTRY _fileUnmapBinary(const uint8_t* data, const uint32_t size, void* handle)
+{
+	if (!data)
+	{
+		return;
+	}
+
+	munmap(const_cast<uint8_t*>(data), size);
+}
+
 VkBool32 VKTS_APIENTRY _fileCreateDirectory(const char* directory)
 {
 	if (!directory)
@@ -26,11 +26,97 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "MappedBinaryBuffer.hpp"
+
 #include "fn_file_internal.hpp"
 
 namespace vkts
 {
 
+IBinaryBufferSP VKTS_APIENTRY _fileMapBinary(const char* filename)
+{
+    if (!filename)
+    {
+        return IBinaryBufferSP();
+    }
+
+    //
+
+    std::string loadFilename = std::string(filename);
+
+    if (!fileIsAbsolutePath(filename))
+    {
+    	loadFilename = fileGetBaseDirectory() + loadFilename;
+    }
+
+    //
+
+    HANDLE file = CreateFile(loadFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return IBinaryBufferSP();
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0 || (uint64_t)fileSize.QuadPart > (uint64_t)UINT32_MAX)
+    {
+        CloseHandle(file);
+
+        return IBinaryBufferSP();
+    }
+
+    uint32_t size = static_cast<uint32_t>(fileSize.QuadPart);
+
+    HANDLE fileMapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    // Mapping keeps a reference to the file.
+    CloseHandle(file);
+
+    if (!fileMapping)
+    {
+        return IBinaryBufferSP();
+    }
+
+    void* data = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (!data)
+    {
+        CloseHandle(fileMapping);
+
+        return IBinaryBufferSP();
+    }
+
+    auto buffer = IBinaryBufferSP(new MappedBinaryBuffer(static_cast<const uint8_t*>(data), size, fileMapping));
+
+	if (!buffer.get())
+	{
+		UnmapViewOfFile(data);
+
+		CloseHandle(fileMapping);
+
+	    return IBinaryBufferSP();
+	}
+
+    return buffer;
+}
+
+void VKTS_APIENTRY _fileUnmapBinary(const uint8_t* data, const uint32_t size, void* handle)
+{
+	if (!data)
+	{
+		return;
+	}
+
+	UnmapViewOfFile(data);
+
+	if (handle)
+	{
+		CloseHandle(static_cast<HANDLE>(handle));
+	}
+}
+
 VkBool32 VKTS_APIENTRY _fileCreateDirectory(const char* directory)
 {
 	if (!directory)
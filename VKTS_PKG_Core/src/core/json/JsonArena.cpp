@@ -0,0 +1,87 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "JsonArena.hpp"
+
+namespace vkts
+{
+
+JsonArena::JsonArena() :
+	allBlocks(), blockOffset(VKTS_JSON_ARENA_BLOCK_SIZE), allDestructors()
+{
+}
+
+JsonArena::~JsonArena()
+{
+	// Values do not own each other, so the order does not matter.
+	for (auto walker = allDestructors.rbegin(); walker != allDestructors.rend(); walker++)
+	{
+		walker->first(walker->second);
+	}
+	allDestructors.clear();
+
+	for (size_t i = 0; i < allBlocks.size(); i++)
+	{
+		delete[] allBlocks[i];
+	}
+	allBlocks.clear();
+}
+
+void* JsonArena::allocate(const size_t size, const size_t alignment)
+{
+	if (size == 0 || size > VKTS_JSON_ARENA_BLOCK_SIZE || alignment == 0 || alignment > alignof(std::max_align_t))
+	{
+		return nullptr;
+	}
+
+	size_t offset = (blockOffset + alignment - 1) & ~(alignment - 1);
+
+	if (offset + size > VKTS_JSON_ARENA_BLOCK_SIZE)
+	{
+		// Blocks from new[] are aligned for any fundamental type.
+		uint8_t* block = new uint8_t[VKTS_JSON_ARENA_BLOCK_SIZE];
+
+		if (!block)
+		{
+			return nullptr;
+		}
+
+		allBlocks.push_back(block);
+
+		offset = 0;
+	}
+
+	blockOffset = (uint32_t)(offset + size);
+
+	return static_cast<void*>(allBlocks.back() + offset);
+}
+
+size_t JsonArena::getAllocatedBytes() const
+{
+	return allBlocks.size() * VKTS_JSON_ARENA_BLOCK_SIZE;
+}
+
+} /* namespace vkts */
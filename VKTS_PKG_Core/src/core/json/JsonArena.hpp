@@ -0,0 +1,94 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONARENA_HPP_
+#define VKTS_JSONARENA_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+#define VKTS_JSON_ARENA_BLOCK_SIZE 65536
+
+namespace vkts
+{
+
+/**
+ * Allocates JSON values from large blocks. All values are destroyed together with the arena.
+ */
+class JsonArena
+{
+
+private:
+
+	std::vector<uint8_t*> allBlocks;
+
+	uint32_t blockOffset;
+
+	std::vector<std::pair<void (*)(void*), void*>> allDestructors;
+
+	void* allocate(const size_t size, const size_t alignment);
+
+	template<class T>
+	static void destruct(void* object)
+	{
+		static_cast<T*>(object)->~T();
+	}
+
+public:
+
+	JsonArena();
+	JsonArena(const JsonArena& other) = delete;
+	JsonArena(JsonArena&& other) = delete;
+	~JsonArena();
+
+	JsonArena& operator =(const JsonArena& other) = delete;
+	JsonArena& operator =(JsonArena && other) = delete;
+
+	template<class T, class... Args>
+	T* create(Args&&... args)
+	{
+		void* memory = allocate(sizeof(T), alignof(T));
+
+		if (!memory)
+		{
+			return nullptr;
+		}
+
+		T* object = new (memory) T(std::forward<Args>(args)...);
+
+		allDestructors.push_back(std::make_pair(&JsonArena::destruct<T>, static_cast<void*>(object)));
+
+		return object;
+	}
+
+	size_t getAllocatedBytes() const;
+
+};
+
+typedef std::shared_ptr<JsonArena> JsonArenaSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_JSONARENA_HPP_ */
@@ -0,0 +1,204 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "JsonArena.hpp"
+
+namespace vkts
+{
+
+template<class T, class... Args>
+static std::shared_ptr<T> jsonBuilderCreate(JsonArena& arena, Args&&... args)
+{
+	T* value = arena.create<T>(std::forward<Args>(args)...);
+
+	// Aliasing an empty shared pointer: No control block is allocated.
+	return std::shared_ptr<T>(std::shared_ptr<T>(), value);
+}
+
+JsonBuilder::JsonBuilder() :
+	JsonSaxHandler(), arena(), allLevels(), root(nullptr)
+{
+	reset();
+}
+
+JsonBuilder::~JsonBuilder()
+{
+}
+
+VkBool32 JsonBuilder::addValue(const JSONvalueSP& value)
+{
+	if (!value.get())
+	{
+		return VK_FALSE;
+	}
+
+	if (allLevels.size() == 0)
+	{
+		// Only one root value is allowed.
+		if (root)
+		{
+			return VK_FALSE;
+		}
+
+		root = value.get();
+
+		return VK_TRUE;
+	}
+
+	auto& level = allLevels.back();
+
+	if (level.jsonObject)
+	{
+		level.jsonObject->addKeyValue(level.key, value);
+	}
+	else
+	{
+		level.jsonArray->addValue(value);
+	}
+
+	return VK_TRUE;
+}
+
+void JsonBuilder::reset()
+{
+	// Values, which were already returned, keep the previous arena alive.
+	arena = JsonArenaSP(new JsonArena());
+
+	allLevels.clear();
+
+	root = nullptr;
+}
+
+JSONvalueSP JsonBuilder::getValue() const
+{
+	if (!root || allLevels.size() > 0)
+	{
+		return JSONvalueSP();
+	}
+
+	// Returned value owns the arena.
+	return JSONvalueSP(arena, root);
+}
+
+//
+
+VkBool32 JsonBuilder::beginObject()
+{
+	auto jsonObject = jsonBuilderCreate<JSONobject>(*arena);
+
+	if (!addValue(jsonObject))
+	{
+		return VK_FALSE;
+	}
+
+	allLevels.push_back(JsonBuilderLevel{jsonObject.get(), nullptr, std::string()});
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::key(const std::string& key)
+{
+	if (allLevels.size() == 0 || !allLevels.back().jsonObject)
+	{
+		return VK_FALSE;
+	}
+
+	allLevels.back().key = key;
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::endObject()
+{
+	if (allLevels.size() == 0 || !allLevels.back().jsonObject)
+	{
+		return VK_FALSE;
+	}
+
+	allLevels.pop_back();
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::beginArray()
+{
+	auto jsonArray = jsonBuilderCreate<JSONarray>(*arena);
+
+	if (!addValue(jsonArray))
+	{
+		return VK_FALSE;
+	}
+
+	allLevels.push_back(JsonBuilderLevel{nullptr, jsonArray.get(), std::string()});
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::endArray()
+{
+	if (allLevels.size() == 0 || !allLevels.back().jsonArray)
+	{
+		return VK_FALSE;
+	}
+
+	allLevels.pop_back();
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::valueNull()
+{
+	return addValue(jsonBuilderCreate<JSONnull>(*arena));
+}
+
+VkBool32 JsonBuilder::valueFalse()
+{
+	return addValue(jsonBuilderCreate<JSONfalse>(*arena));
+}
+
+VkBool32 JsonBuilder::valueTrue()
+{
+	return addValue(jsonBuilderCreate<JSONtrue>(*arena));
+}
+
+VkBool32 JsonBuilder::valueFloat(const float value)
+{
+	return addValue(jsonBuilderCreate<JSONfloat>(*arena, value));
+}
+
+VkBool32 JsonBuilder::valueInteger(const int32_t value)
+{
+	return addValue(jsonBuilderCreate<JSONinteger>(*arena, value));
+}
+
+VkBool32 JsonBuilder::valueString(const std::string& value)
+{
+	return addValue(jsonBuilderCreate<JSONstring>(*arena, value));
+}
+
+}
@@ -0,0 +1,863 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "JsonSaxParser.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_JSON_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace vkts
+{
+
+// Powers of ten, which are exactly representable as double.
+static const double g_powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static inline VkBool32 jsonIsWhitespace(const char c)
+{
+	return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline VkBool32 jsonIsDigit(const char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+#ifdef VKTS_JSON_SSE2
+
+static inline uint32_t jsonCountTrailingZeros(const uint32_t value)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+
+	_BitScanForward(&index, value);
+
+	return (uint32_t)index;
+#else
+	return (uint32_t)__builtin_ctz(value);
+#endif
+}
+
+#endif
+
+JsonSaxParser::JsonSaxParser() :
+	end(nullptr), handler(nullptr), depth(0), characters()
+{
+}
+
+JsonSaxParser::~JsonSaxParser()
+{
+}
+
+//
+
+void JsonSaxParser::parseWhitespace(const char*& current) const
+{
+	// Most values are not preceded by whitespace.
+	if (current == end || !jsonIsWhitespace(*current))
+	{
+		return;
+	}
+
+	current++;
+
+#ifdef VKTS_JSON_SSE2
+	const __m128i space = _mm_set1_epi8(' ');
+	const __m128i lineFeed = _mm_set1_epi8('\n');
+	const __m128i carriageReturn = _mm_set1_epi8('\r');
+	const __m128i tabulation = _mm_set1_epi8('\t');
+
+	while (end - current >= 16)
+	{
+		const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+
+		const __m128i whitespace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, space), _mm_cmpeq_epi8(block, lineFeed)), _mm_or_si128(_mm_cmpeq_epi8(block, carriageReturn), _mm_cmpeq_epi8(block, tabulation)));
+
+		const uint32_t mask = (uint32_t)_mm_movemask_epi8(whitespace);
+
+		if (mask != 0xFFFF)
+		{
+			current += jsonCountTrailingZeros(~mask);
+
+			return;
+		}
+
+		current += 16;
+	}
+#endif
+
+	while (current < end && jsonIsWhitespace(*current))
+	{
+		current++;
+	}
+}
+
+VkBool32 JsonSaxParser::parseLiteral(const char*& current, const char* literal, const uint32_t length) const
+{
+	if ((uint32_t)(end - current) < length || memcmp(current, literal, length) != 0)
+	{
+		return VK_FALSE;
+	}
+
+	current += length;
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonSaxParser::parseHexadecimalNumber(const char*& current, uint32_t& value) const
+{
+	if (end - current < 4)
+	{
+		return VK_FALSE;
+	}
+
+	value = 0;
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		const char c = current[i];
+
+		uint32_t digit;
+
+		if (c >= '0' && c <= '9')
+		{
+			digit = (uint32_t)(c - '0');
+		}
+		else if (c >= 'A' && c <= 'F')
+		{
+			digit = (uint32_t)(c - 'A') + 10;
+		}
+		else if (c >= 'a' && c <= 'f')
+		{
+			digit = (uint32_t)(c - 'a') + 10;
+		}
+		else
+		{
+			return VK_FALSE;
+		}
+
+		value = value * 16 + digit;
+	}
+
+	current += 4;
+
+	return VK_TRUE;
+}
+
+//
+
+VkBool32 JsonSaxParser::parseObject(const char*& current)
+{
+	// Left curly bracket already matched.
+	current++;
+
+	if (!handler->beginObject())
+	{
+		return VK_FALSE;
+	}
+
+	parseWhitespace(current);
+
+	if (current < end && *current == '}')
+	{
+		current++;
+
+		return handler->endObject();
+	}
+
+	std::string key;
+
+	while (VK_TRUE)
+	{
+		parseWhitespace(current);
+
+		if (!parseString(current, key))
+		{
+			return VK_FALSE;
+		}
+
+		if (!handler->key(key))
+		{
+			return VK_FALSE;
+		}
+
+		parseWhitespace(current);
+
+		if (current == end || *current != ':')
+		{
+			return VK_FALSE;
+		}
+		current++;
+
+		if (!parseValue(current))
+		{
+			return VK_FALSE;
+		}
+
+		parseWhitespace(current);
+
+		if (current == end)
+		{
+			return VK_FALSE;
+		}
+
+		if (*current == ',')
+		{
+			current++;
+
+			continue;
+		}
+
+		if (*current == '}')
+		{
+			current++;
+
+			break;
+		}
+
+		return VK_FALSE;
+	}
+
+	return handler->endObject();
+}
+
+VkBool32 JsonSaxParser::parseArray(const char*& current)
+{
+	// Left square bracket already matched.
+	current++;
+
+	if (!handler->beginArray())
+	{
+		return VK_FALSE;
+	}
+
+	parseWhitespace(current);
+
+	if (current < end && *current == ']')
+	{
+		current++;
+
+		return handler->endArray();
+	}
+
+	while (VK_TRUE)
+	{
+		if (!parseValue(current))
+		{
+			return VK_FALSE;
+		}
+
+		parseWhitespace(current);
+
+		if (current == end)
+		{
+			return VK_FALSE;
+		}
+
+		if (*current == ',')
+		{
+			current++;
+
+			continue;
+		}
+
+		if (*current == ']')
+		{
+			current++;
+
+			break;
+		}
+
+		return VK_FALSE;
+	}
+
+	return handler->endArray();
+}
+
+VkBool32 JsonSaxParser::parseNumber(const char*& current)
+{
+	const char* start = current;
+
+	VkBool32 negative = VK_FALSE;
+	VkBool32 isFloat = VK_FALSE;
+
+	// Up to 19 significant digits do fit into 64 bit.
+	uint64_t mantissa = 0;
+	uint32_t digits = 0;
+	int32_t exponent = 0;
+
+	if (*current == '-')
+	{
+		negative = VK_TRUE;
+
+		current++;
+	}
+
+	if (current == end || !jsonIsDigit(*current))
+	{
+		return VK_FALSE;
+	}
+
+	if (*current == '0')
+	{
+		current++;
+	}
+	else
+	{
+		while (current < end && jsonIsDigit(*current))
+		{
+			if (digits < 19)
+			{
+				mantissa = mantissa * 10 + (uint64_t)(*current - '0');
+			}
+			else
+			{
+				exponent++;
+			}
+
+			digits++;
+			current++;
+		}
+	}
+
+	if (current < end && *current == '.')
+	{
+		isFloat = VK_TRUE;
+
+		current++;
+
+		if (current == end || !jsonIsDigit(*current))
+		{
+			return VK_FALSE;
+		}
+
+		while (current < end && jsonIsDigit(*current))
+		{
+			// Leading zeros are not significant.
+			if (digits < 19 && (mantissa != 0 || *current != '0'))
+			{
+				mantissa = mantissa * 10 + (uint64_t)(*current - '0');
+
+				digits++;
+			}
+			else if (mantissa != 0 || *current != '0')
+			{
+				digits++;
+			}
+
+			if (digits <= 19)
+			{
+				exponent--;
+			}
+
+			current++;
+		}
+	}
+
+	if (current < end && (*current == 'e' || *current == 'E'))
+	{
+		isFloat = VK_TRUE;
+
+		current++;
+
+		VkBool32 negativeExponent = VK_FALSE;
+
+		if (current < end && (*current == '+' || *current == '-'))
+		{
+			negativeExponent = (*current == '-');
+
+			current++;
+		}
+
+		if (current == end || !jsonIsDigit(*current))
+		{
+			return VK_FALSE;
+		}
+
+		int32_t explicitExponent = 0;
+
+		while (current < end && jsonIsDigit(*current))
+		{
+			if (explicitExponent < 100000)
+			{
+				explicitExponent = explicitExponent * 10 + (int32_t)(*current - '0');
+			}
+
+			current++;
+		}
+
+		exponent += negativeExponent ? -explicitExponent : explicitExponent;
+	}
+
+	//
+
+	if (isFloat)
+	{
+		double value;
+
+		// Exact mantissa and power of ten give a correctly rounded result, same as atof.
+		if (digits <= 19 && mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22)
+		{
+			value = (double)mantissa;
+
+			if (exponent < 0)
+			{
+				value /= g_powersOfTen[-exponent];
+			}
+			else
+			{
+				value *= g_powersOfTen[exponent];
+			}
+
+			if (negative)
+			{
+				value = -value;
+			}
+		}
+		else
+		{
+			characters.assign(start, current - start);
+
+			value = atof(characters.c_str());
+		}
+
+		return handler->valueFloat(static_cast<float>(value));
+	}
+	else
+	{
+		int32_t value;
+
+		if (digits <= 18)
+		{
+			value = (int32_t)(negative ? -(int64_t)mantissa : (int64_t)mantissa);
+		}
+		else
+		{
+			characters.assign(start, current - start);
+
+			value = atoi(characters.c_str());
+		}
+
+		return handler->valueInteger(value);
+	}
+}
+
+VkBool32 JsonSaxParser::parseString(const char*& current, std::string& value)
+{
+	if (current == end || *current != '"')
+	{
+		return VK_FALSE;
+	}
+
+	current++;
+
+	const char* start = current;
+
+	// Search for the end of the string or the first escape sequence.
+
+#ifdef VKTS_JSON_SSE2
+	const __m128i quotationMark = _mm_set1_epi8('"');
+	const __m128i reverseSolidus = _mm_set1_epi8('\\');
+
+	while (end - current >= 16)
+	{
+		const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+
+		const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, quotationMark), _mm_cmpeq_epi8(block, reverseSolidus)));
+
+		if (mask != 0)
+		{
+			current += jsonCountTrailingZeros(mask);
+
+			break;
+		}
+
+		current += 16;
+	}
+#endif
+
+	while (current < end && *current != '"' && *current != '\\')
+	{
+		current++;
+	}
+
+	if (current == end)
+	{
+		return VK_FALSE;
+	}
+
+	value.assign(start, current - start);
+
+	if (*current == '"')
+	{
+		current++;
+
+		return VK_TRUE;
+	}
+
+	// Slow path for strings containing escape sequences.
+
+	while (current < end)
+	{
+		const char c = *current;
+
+		current++;
+
+		if (c == '"')
+		{
+			return VK_TRUE;
+		}
+
+		if (c != '\\')
+		{
+			value += c;
+
+			continue;
+		}
+
+		if (current == end)
+		{
+			return VK_FALSE;
+		}
+
+		const char escape = *current;
+
+		current++;
+
+		switch (escape)
+		{
+			case '"':
+				value += '"';
+				break;
+			case '\\':
+				value += '\\';
+				break;
+			case '/':
+				value += '/';
+				break;
+			case 'b':
+				value += '\b';
+				break;
+			case 'f':
+				value += '\f';
+				break;
+			case 'n':
+				value += '\n';
+				break;
+			case 'r':
+				value += '\r';
+				break;
+			case 't':
+				value += '\t';
+				break;
+			case 'u':
+			{
+				uint32_t codePoint;
+
+				if (!parseHexadecimalNumber(current, codePoint))
+				{
+					return VK_FALSE;
+				}
+
+				// Surrogate pair.
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF && end - current >= 6 && current[0] == '\\' && current[1] == 'u')
+				{
+					const char* lowCurrent = current + 2;
+
+					uint32_t lowSurrogate;
+
+					if (parseHexadecimalNumber(lowCurrent, lowSurrogate) && lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF)
+					{
+						codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+
+						current = lowCurrent;
+					}
+				}
+
+				// Encode as UTF-8.
+				if (codePoint < 0x80)
+				{
+					value += static_cast<char>(codePoint);
+				}
+				else if (codePoint < 0x800)
+				{
+					value += static_cast<char>(0xC0 | (codePoint >> 6));
+					value += static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+				else if (codePoint < 0x10000)
+				{
+					value += static_cast<char>(0xE0 | (codePoint >> 12));
+					value += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+					value += static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+				else
+				{
+					value += static_cast<char>(0xF0 | (codePoint >> 18));
+					value += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+					value += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+					value += static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+			}
+			break;
+			default:
+				return VK_FALSE;
+		}
+	}
+
+	return VK_FALSE;
+}
+
+//
+
+VkBool32 JsonSaxParser::parseValue(const char*& current)
+{
+	parseWhitespace(current);
+
+	if (current == end)
+	{
+		return VK_FALSE;
+	}
+
+	VkBool32 result = VK_FALSE;
+
+	switch (*current)
+	{
+		case '{':
+		case '[':
+		{
+			if (depth >= VKTS_JSON_MAX_DEPTH)
+			{
+				return VK_FALSE;
+			}
+
+			depth++;
+
+			result = (*current == '{') ? parseObject(current) : parseArray(current);
+
+			depth--;
+		}
+		break;
+		case '"':
+		{
+			if (parseString(current, characters))
+			{
+				result = handler->valueString(characters);
+			}
+		}
+		break;
+		case 't':
+		{
+			if (parseLiteral(current, "true", 4))
+			{
+				result = handler->valueTrue();
+			}
+		}
+		break;
+		case 'f':
+		{
+			if (parseLiteral(current, "false", 5))
+			{
+				result = handler->valueFalse();
+			}
+		}
+		break;
+		case 'n':
+		{
+			if (parseLiteral(current, "null", 4))
+			{
+				result = handler->valueNull();
+			}
+		}
+		break;
+		default:
+		{
+			result = parseNumber(current);
+		}
+		break;
+	}
+
+	return result;
+}
+
+//
+
+VkBool32 JsonSaxParser::parse(const char* jsonText, const uint32_t length, JsonSaxHandler& handler)
+{
+	if (!jsonText || length == 0)
+	{
+		return VK_FALSE;
+	}
+
+	this->end = jsonText + length;
+
+	this->handler = &handler;
+
+	this->depth = 0;
+
+	const char* current = jsonText;
+
+	VkBool32 result = parseValue(current);
+
+	// Only whitespace may follow the root value.
+
+	if (result)
+	{
+		parseWhitespace(current);
+
+		result = (current == end);
+	}
+
+	this->handler = nullptr;
+
+	return result;
+}
+
+VkBool32 JsonSaxParser::index(const char* jsonText, const uint32_t length, Map<std::string, VkTsJsonRange>& allRanges)
+{
+	if (!jsonText || length == 0)
+	{
+		return VK_FALSE;
+	}
+
+	this->end = jsonText + length;
+
+	// Values are only skipped, so no events are needed.
+	JsonSaxHandler skipHandler;
+
+	this->handler = &skipHandler;
+
+	this->depth = 1;
+
+	allRanges.clear();
+
+	const char* current = jsonText;
+
+	parseWhitespace(current);
+
+	if (current == end || *current != '{')
+	{
+		this->handler = nullptr;
+
+		return VK_FALSE;
+	}
+	current++;
+
+	parseWhitespace(current);
+
+	VkBool32 result = VK_TRUE;
+
+	if (current < end && *current == '}')
+	{
+		current++;
+
+		parseWhitespace(current);
+
+		this->handler = nullptr;
+
+		return current == end;
+	}
+
+	std::string key;
+
+	VkTsJsonRange range;
+
+	while (VK_TRUE)
+	{
+		parseWhitespace(current);
+
+		if (!parseString(current, key))
+		{
+			result = VK_FALSE;
+
+			break;
+		}
+
+		parseWhitespace(current);
+
+		if (current == end || *current != ':')
+		{
+			result = VK_FALSE;
+
+			break;
+		}
+		current++;
+
+		parseWhitespace(current);
+
+		range.offset = (uint32_t)(current - jsonText);
+
+		if (!parseValue(current))
+		{
+			result = VK_FALSE;
+
+			break;
+		}
+
+		range.length = (uint32_t)(current - jsonText) - range.offset;
+
+		allRanges.set(key, range);
+
+		parseWhitespace(current);
+
+		if (current == end)
+		{
+			result = VK_FALSE;
+
+			break;
+		}
+
+		if (*current == ',')
+		{
+			current++;
+
+			continue;
+		}
+
+		if (*current == '}')
+		{
+			current++;
+
+			parseWhitespace(current);
+
+			result = (current == end);
+
+			break;
+		}
+
+		result = VK_FALSE;
+
+		break;
+	}
+
+	this->handler = nullptr;
+
+	return result;
+}
+
+}
@@ -0,0 +1,95 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONSAXPARSER_HPP_
+#define VKTS_JSONSAXPARSER_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+#define VKTS_JSON_MAX_DEPTH 512
+
+// see http://www.ecma-international.org/publications/files/ECMA-ST/ECMA-404.pdf
+
+namespace vkts
+{
+
+/**
+ * Parses the JSON text in one pass and passes the values as events to a handler. Numbers are parsed in place.
+ */
+class JsonSaxParser
+{
+
+private:
+
+	const char* end;
+
+	JsonSaxHandler* handler;
+
+	uint32_t depth;
+
+	std::string characters;
+
+	//
+
+	void parseWhitespace(const char*& current) const;
+
+	VkBool32 parseLiteral(const char*& current, const char* literal, const uint32_t length) const;
+
+	VkBool32 parseHexadecimalNumber(const char*& current, uint32_t& value) const;
+
+	//
+
+	VkBool32 parseObject(const char*& current);
+	VkBool32 parseArray(const char*& current);
+	VkBool32 parseNumber(const char*& current);
+	VkBool32 parseString(const char*& current, std::string& value);
+
+	//
+
+	VkBool32 parseValue(const char*& current);
+
+public:
+
+	JsonSaxParser();
+	JsonSaxParser(const JsonSaxParser& other) = delete;
+	JsonSaxParser(JsonSaxParser&& other) = delete;
+	~JsonSaxParser();
+
+	JsonSaxParser& operator =(const JsonSaxParser& other) = delete;
+	JsonSaxParser& operator =(JsonSaxParser && other) = delete;
+
+	VkBool32 parse(const char* jsonText, const uint32_t length, JsonSaxHandler& handler);
+
+	/**
+	 * Records the byte range of every value of the root object. The values are only validated, not decoded.
+	 */
+	VkBool32 index(const char* jsonText, const uint32_t length, Map<std::string, VkTsJsonRange>& allRanges);
+
+};
+
+}
+
+#endif /* VKTS_JSONSAXPARSER_HPP_ */
@@ -27,6 +27,7 @@
 #include <vkts/core/vkts_core.hpp>
 
 #include "JsonDecoder.hpp"
+#include "JsonSaxParser.hpp"
 
 namespace vkts
 {
@@ -38,6 +39,39 @@ JSONvalueSP VKTS_APIENTRY jsonDecode(const std::string& jsonText)
 	return decoder.decode(jsonText);
 }
 
+JSONvalueSP VKTS_APIENTRY jsonDecodeFast(const char* jsonText, const uint32_t length)
+{
+	JsonSaxParser parser;
+
+	JsonBuilder builder;
+
+	if (!parser.parse(jsonText, length, builder))
+	{
+		return JSONvalueSP();
+	}
+
+	return builder.getValue();
+}
+
+JSONvalueSP VKTS_APIENTRY jsonDecodeFast(const std::string& jsonText)
+{
+	return jsonDecodeFast(jsonText.c_str(), (uint32_t)jsonText.length());
+}
+
+VkBool32 VKTS_APIENTRY jsonParse(const char* jsonText, const uint32_t length, JsonSaxHandler& handler)
+{
+	JsonSaxParser parser;
+
+	return parser.parse(jsonText, length, handler);
+}
+
+VkBool32 VKTS_APIENTRY jsonIndexObject(const char* jsonText, const uint32_t length, Map<std::string, VkTsJsonRange>& allRanges)
+{
+	JsonSaxParser parser;
+
+	return parser.index(jsonText, length, allRanges);
+}
+
 std::string VKTS_APIENTRY jsonEncode(const JSONvalueSP& value)
 {
 	if (!value.get())
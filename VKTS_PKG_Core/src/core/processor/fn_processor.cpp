@@ -28,9 +28,57 @@
 
 #include "fn_processor_internal.hpp"
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define VKTS_PROCESSOR_X86
+#include <intrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VKTS_PROCESSOR_X86
+#endif
+
 namespace vkts
 {
 
+static uint32_t processorDetectFeatures()
+{
+    uint32_t features = 0;
+
+#if defined(VKTS_PROCESSOR_X86)
+#if defined(_MSC_VER)
+    int info[4];
+
+    __cpuid(info, 1);
+
+    if (info[3] & (1 << 26))
+    {
+        features |= VKTS_PROCESSOR_FEATURE_SSE2;
+    }
+
+    // AVX and OSXSAVE, plus the XMM and YMM state enabled by the operating system.
+
+    if ((info[2] & (1 << 28)) && (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6)
+    {
+        features |= VKTS_PROCESSOR_FEATURE_AVX;
+    }
+#else
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("sse2"))
+    {
+        features |= VKTS_PROCESSOR_FEATURE_SSE2;
+    }
+
+    if (__builtin_cpu_supports("avx"))
+    {
+        features |= VKTS_PROCESSOR_FEATURE_AVX;
+    }
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    features |= VKTS_PROCESSOR_FEATURE_NEON;
+#endif
+
+    return features;
+}
+
 VkBool32 VKTS_APIENTRY processorInit()
 {
     return _processorInit();
@@ -41,6 +89,13 @@ uint32_t VKTS_APIENTRY processorGetNumber()
     return _processorGetNumber();
 }
 
+uint32_t VKTS_APIENTRY processorGetFeatures()
+{
+    static const uint32_t features = processorDetectFeatures();
+
+    return features;
+}
+
 void VKTS_APIENTRY processorTerminate()
 {
     _processorTerminate();
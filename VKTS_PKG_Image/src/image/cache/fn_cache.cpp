@@ -26,13 +26,47 @@
 
 #include <vkts/image/vkts_image.hpp>
 
+#include "../data/fn_image_data_internal.hpp"
+
 #define VKTS_CACHE_DIRECTORY "cache"
 
+#define VKTS_CACHE_MANIFEST "manifest.txt"
+
+#define VKTS_CACHE_PRIME_0 11400714785074694791ull
+#define VKTS_CACHE_PRIME_1 14029467366897019727ull
+#define VKTS_CACHE_PRIME_2 1609587929392839161ull
+#define VKTS_CACHE_PRIME_3 9650029242287828579ull
+#define VKTS_CACHE_PRIME_4 2870177450012600261ull
+
 namespace vkts
 {
 
+typedef struct CacheEntry_
+{
+	std::string filename;
+	uint64_t size;
+	uint64_t tick;
+} CacheEntry;
+
 static VkBool32 g_cacheEnabled = VK_TRUE;
 
+static std::mutex g_cacheMutex;
+
+static VkBool32 g_cacheManifestLoaded = VK_FALSE;
+
+// Cache hits only update the least recently used order in memory.
+static VkBool32 g_cacheManifestDirty = VK_FALSE;
+
+static std::map<std::string, CacheEntry> g_cacheManifest;
+
+static uint64_t g_cacheTick = 0;
+
+static uint64_t g_cacheTemporaryCounter = 0;
+
+static uint64_t g_cacheMaxSize = VKTS_CACHE_DEFAULT_MAX_SIZE;
+
+static VkTsCacheStatistics g_cacheStatistics = {0, 0, 0, 0, 0, 0};
+
 static std::string VKTS_APIENTRY cacheGetRelativeFilename(const char* filename)
 {
 	if (!filename)
@@ -156,4 +190,611 @@ IImageDataSP VKTS_APIENTRY cacheLoadRawImageData(const char* filename, const uin
 	return imageDataLoadRaw(cacheFilename.c_str(), width, height, format);
 }
 
+//
+
+static inline uint64_t cacheRotateLeft(const uint64_t value, const uint32_t bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t cacheRead64(const uint8_t* data)
+{
+	uint64_t value;
+
+	memcpy(&value, data, sizeof(uint64_t));
+
+	return value;
+}
+
+static inline uint32_t cacheRead32(const uint8_t* data)
+{
+	uint32_t value;
+
+	memcpy(&value, data, sizeof(uint32_t));
+
+	return value;
+}
+
+static inline uint64_t cacheRound(uint64_t accumulator, const uint64_t input)
+{
+	accumulator += input * VKTS_CACHE_PRIME_1;
+	accumulator = cacheRotateLeft(accumulator, 31);
+
+	return accumulator * VKTS_CACHE_PRIME_0;
+}
+
+static inline uint64_t cacheMergeRound(uint64_t accumulator, const uint64_t value)
+{
+	accumulator ^= cacheRound(0, value);
+
+	return accumulator * VKTS_CACHE_PRIME_0 + VKTS_CACHE_PRIME_3;
+}
+
+static std::string cacheGetEntryFilename(const std::string& filename)
+{
+	return std::string(VKTS_CACHE_DIRECTORY) + "/" + filename;
+}
+
+static std::string cacheGetFullFilename(const std::string& filename)
+{
+	if (fileIsAbsolutePath(filename.c_str()))
+	{
+		return filename;
+	}
+
+	return std::string(fileGetBaseDirectory()) + filename;
+}
+
+static uint64_t cacheGetFileSize(const std::string& filename)
+{
+	auto file = fopen(cacheGetFullFilename(filename).c_str(), "rb");
+
+	if (!file)
+	{
+		return 0;
+	}
+
+	if (fseek(file, 0, SEEK_END))
+	{
+		fclose(file);
+
+		return 0;
+	}
+
+	int64_t length = ftell(file);
+
+	fclose(file);
+
+	return length > 0 ? (uint64_t)length : 0;
+}
+
+static VkBool32 cacheRenameFile(const std::string& sourceFilename, const std::string& targetFilename)
+{
+	auto fullSourceFilename = cacheGetFullFilename(sourceFilename);
+	auto fullTargetFilename = cacheGetFullFilename(targetFilename);
+
+	if (rename(fullSourceFilename.c_str(), fullTargetFilename.c_str()) == 0)
+	{
+		return VK_TRUE;
+	}
+
+	// Some platforms do not replace an existing file.
+	remove(fullTargetFilename.c_str());
+
+	if (rename(fullSourceFilename.c_str(), fullTargetFilename.c_str()) == 0)
+	{
+		return VK_TRUE;
+	}
+
+	remove(fullSourceFilename.c_str());
+
+	return VK_FALSE;
+}
+
+static void cacheRemoveFile(const std::string& filename)
+{
+	remove(cacheGetFullFilename(filename).c_str());
+}
+
+// Has to be called with locked mutex.
+static void cacheLoadManifest()
+{
+	if (g_cacheManifestLoaded)
+	{
+		return;
+	}
+
+	g_cacheManifestLoaded = VK_TRUE;
+
+	g_cacheManifest.clear();
+	g_cacheTick = 0;
+	g_cacheStatistics.entryCount = 0;
+	g_cacheStatistics.totalSize = 0;
+
+	auto textBuffer = fileLoadText(cacheGetEntryFilename(VKTS_CACHE_MANIFEST).c_str());
+
+	if (!textBuffer.get())
+	{
+		return;
+	}
+
+	char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+
+	char key[VKTS_MAX_TOKEN_CHARS + 1];
+	char filename[VKTS_MAX_TOKEN_CHARS + 1];
+	uint64_t size;
+	uint64_t tick;
+
+	while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+	{
+		if (sscanf(buffer, "entry %256s %256s %" SCNu64 " %" SCNu64, key, filename, &size, &tick) != 4)
+		{
+			continue;
+		}
+
+		g_cacheManifest[key] = CacheEntry{filename, size, tick};
+
+		g_cacheTick = glm::max(g_cacheTick, tick);
+
+		g_cacheStatistics.entryCount++;
+		g_cacheStatistics.totalSize += size;
+	}
+}
+
+// Has to be called with locked mutex.
+static VkBool32 cacheSaveManifest()
+{
+	if (!fileCreateDirectory(VKTS_CACHE_DIRECTORY))
+	{
+		return VK_FALSE;
+	}
+
+	std::string manifest = "";
+
+	char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+
+	for (const auto& entry : g_cacheManifest)
+	{
+		snprintf(buffer, VKTS_MAX_BUFFER_CHARS, "entry %s %s %" PRIu64 " %" PRIu64 "\n", entry.first.c_str(), entry.second.filename.c_str(), entry.second.size, entry.second.tick);
+
+		manifest += buffer;
+	}
+
+	auto manifestFilename = cacheGetEntryFilename(VKTS_CACHE_MANIFEST);
+
+	if (manifest.size() == 0)
+	{
+		cacheRemoveFile(manifestFilename);
+
+		g_cacheManifestDirty = VK_FALSE;
+
+		return VK_TRUE;
+	}
+
+	auto temporaryFilename = manifestFilename + ".tmp";
+
+	if (!fileSaveBinaryData(temporaryFilename.c_str(), manifest.c_str(), (uint32_t)manifest.size()))
+	{
+		return VK_FALSE;
+	}
+
+	if (!cacheRenameFile(temporaryFilename, manifestFilename))
+	{
+		return VK_FALSE;
+	}
+
+	g_cacheManifestDirty = VK_FALSE;
+
+	return VK_TRUE;
+}
+
+// Has to be called with locked mutex.
+static void cacheRemoveEntry(const std::map<std::string, CacheEntry>::iterator& walker)
+{
+	cacheRemoveFile(cacheGetEntryFilename(walker->second.filename));
+
+	g_cacheStatistics.entryCount--;
+	g_cacheStatistics.totalSize -= walker->second.size;
+
+	g_cacheManifest.erase(walker);
+}
+
+// Has to be called with locked mutex.
+static void cacheEvict(const std::string& keepKey)
+{
+	if (g_cacheMaxSize == 0)
+	{
+		return;
+	}
+
+	while (g_cacheStatistics.totalSize > g_cacheMaxSize)
+	{
+		auto leastRecentlyUsed = g_cacheManifest.end();
+
+		for (auto walker = g_cacheManifest.begin(); walker != g_cacheManifest.end(); walker++)
+		{
+			if (walker->first == keepKey)
+			{
+				continue;
+			}
+
+			if (leastRecentlyUsed == g_cacheManifest.end() || walker->second.tick < leastRecentlyUsed->second.tick)
+			{
+				leastRecentlyUsed = walker;
+			}
+		}
+
+		if (leastRecentlyUsed == g_cacheManifest.end())
+		{
+			return;
+		}
+
+		cacheRemoveEntry(leastRecentlyUsed);
+
+		g_cacheStatistics.evictionCount++;
+	}
+}
+
+uint64_t VKTS_APIENTRY cacheGetMaxSize()
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	return g_cacheMaxSize;
+}
+
+void VKTS_APIENTRY cacheSetMaxSize(const uint64_t maxSize)
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	g_cacheMaxSize = maxSize;
+
+	cacheLoadManifest();
+
+	auto evictionCount = g_cacheStatistics.evictionCount;
+
+	cacheEvict("");
+
+	if (evictionCount != g_cacheStatistics.evictionCount)
+	{
+		cacheSaveManifest();
+	}
+}
+
+uint64_t VKTS_APIENTRY cacheHash(const void* data, const size_t size, const uint64_t seed)
+{
+	if (!data && size > 0)
+	{
+		return 0;
+	}
+
+	const uint8_t* current = (const uint8_t*)data;
+	const uint8_t* end = current + size;
+
+	uint64_t hash;
+
+	if (size >= 32)
+	{
+		// Four independent lanes, so the multiplications can be pipelined.
+
+		uint64_t lane0 = seed + VKTS_CACHE_PRIME_0 + VKTS_CACHE_PRIME_1;
+		uint64_t lane1 = seed + VKTS_CACHE_PRIME_1;
+		uint64_t lane2 = seed;
+		uint64_t lane3 = seed - VKTS_CACHE_PRIME_0;
+
+		const uint8_t* limit = end - 32;
+
+		do
+		{
+			lane0 = cacheRound(lane0, cacheRead64(current));
+			lane1 = cacheRound(lane1, cacheRead64(current + 8));
+			lane2 = cacheRound(lane2, cacheRead64(current + 16));
+			lane3 = cacheRound(lane3, cacheRead64(current + 24));
+
+			current += 32;
+		} while (current <= limit);
+
+		hash = cacheRotateLeft(lane0, 1) + cacheRotateLeft(lane1, 7) + cacheRotateLeft(lane2, 12) + cacheRotateLeft(lane3, 18);
+
+		hash = cacheMergeRound(hash, lane0);
+		hash = cacheMergeRound(hash, lane1);
+		hash = cacheMergeRound(hash, lane2);
+		hash = cacheMergeRound(hash, lane3);
+	}
+	else
+	{
+		hash = seed + VKTS_CACHE_PRIME_4;
+	}
+
+	hash += (uint64_t)size;
+
+	while (current + 8 <= end)
+	{
+		hash ^= cacheRound(0, cacheRead64(current));
+		hash = cacheRotateLeft(hash, 27) * VKTS_CACHE_PRIME_0 + VKTS_CACHE_PRIME_3;
+
+		current += 8;
+	}
+
+	if (current + 4 <= end)
+	{
+		hash ^= (uint64_t)cacheRead32(current) * VKTS_CACHE_PRIME_0;
+		hash = cacheRotateLeft(hash, 23) * VKTS_CACHE_PRIME_1 + VKTS_CACHE_PRIME_2;
+
+		current += 4;
+	}
+
+	while (current < end)
+	{
+		hash ^= (uint64_t)(*current) * VKTS_CACHE_PRIME_4;
+		hash = cacheRotateLeft(hash, 11) * VKTS_CACHE_PRIME_0;
+
+		current++;
+	}
+
+	hash ^= hash >> 33;
+	hash *= VKTS_CACHE_PRIME_1;
+	hash ^= hash >> 29;
+	hash *= VKTS_CACHE_PRIME_2;
+	hash ^= hash >> 32;
+
+	return hash;
+}
+
+uint64_t VKTS_APIENTRY cacheHashFile(const char* filename)
+{
+	if (!filename)
+	{
+		return 0;
+	}
+
+	auto buffer = fileMapBinary(filename);
+
+	if (!buffer.get() || !buffer->getData() || buffer->getSize() == 0)
+	{
+		return 0;
+	}
+
+	return cacheHash(buffer->getData(), (size_t)buffer->getSize());
+}
+
+uint64_t VKTS_APIENTRY cacheHashImageData(const IImageDataSP& imageData)
+{
+	if (!imageData.get() || !imageData->getData())
+	{
+		return 0;
+	}
+
+	uint32_t description[6] = {imageData->getWidth(), imageData->getHeight(), imageData->getDepth(), imageData->getMipLevels(), imageData->getArrayLayers(), (uint32_t)imageData->getFormat()};
+
+	return cacheHash(imageData->getData(), (size_t)imageData->getSize(), cacheHash(description, sizeof(description)));
+}
+
+std::string VKTS_APIENTRY cacheCreateKey(const uint64_t sourceHash, const std::string& parameters)
+{
+	// No valid source, so nothing can be cached.
+	if (sourceHash == 0)
+	{
+		return "";
+	}
+
+	char buffer[17];
+
+	snprintf(buffer, 17, "%016" PRIx64, cacheHash(parameters.c_str(), parameters.size(), sourceHash));
+
+	return std::string(buffer);
+}
+
+VkBool32 VKTS_APIENTRY cacheSaveImageDataByKey(const std::string& key, const IImageDataSP& imageData, const std::string& extension)
+{
+	if (key.size() == 0 || !imageData.get() || extension.size() == 0)
+	{
+		return VK_FALSE;
+	}
+
+	std::string filename = key + extension;
+
+	std::string temporaryFilename;
+
+	{
+		std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+		temporaryFilename = key + "_" + std::to_string(g_cacheTemporaryCounter++) + "_tmp" + extension;
+	}
+
+	if (!fileCreateDirectory(VKTS_CACHE_DIRECTORY))
+	{
+		return VK_FALSE;
+	}
+
+	// Write to a temporary file first, so no partially written file is ever visible under the final name.
+	if (!imageDataSave(cacheGetEntryFilename(temporaryFilename).c_str(), imageData))
+	{
+		cacheRemoveFile(cacheGetEntryFilename(temporaryFilename));
+
+		return VK_FALSE;
+	}
+
+	//
+
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	cacheLoadManifest();
+
+	auto walker = g_cacheManifest.find(key);
+
+	if (walker != g_cacheManifest.end())
+	{
+		if (walker->second.filename != filename)
+		{
+			cacheRemoveEntry(walker);
+		}
+		else
+		{
+			g_cacheStatistics.entryCount--;
+			g_cacheStatistics.totalSize -= walker->second.size;
+
+			g_cacheManifest.erase(walker);
+		}
+	}
+
+	if (!cacheRenameFile(cacheGetEntryFilename(temporaryFilename), cacheGetEntryFilename(filename)))
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not store cache entry '%s'", filename.c_str());
+
+		cacheSaveManifest();
+
+		return VK_FALSE;
+	}
+
+	auto size = cacheGetFileSize(cacheGetEntryFilename(filename));
+
+	g_cacheManifest[key] = CacheEntry{filename, size, ++g_cacheTick};
+
+	g_cacheStatistics.storeCount++;
+	g_cacheStatistics.entryCount++;
+	g_cacheStatistics.totalSize += size;
+
+	cacheEvict(key);
+
+	return cacheSaveManifest();
+}
+
+static IImageDataSP cacheLoadEntry(const std::string& filename, const std::string& name)
+{
+	if (name.size() == 0)
+	{
+		return imageDataLoad(cacheGetEntryFilename(filename).c_str());
+	}
+
+	auto dotIndex = filename.rfind('.');
+
+	if (dotIndex != filename.npos && filename.substr(dotIndex) == VKTS_CACHE_PACKED_EXTENSION)
+	{
+		// Packed images are used directly out of the mapped file.
+		auto buffer = fileMapBinary(cacheGetEntryFilename(filename).c_str());
+
+		if (!buffer.get())
+		{
+			return IImageDataSP();
+		}
+
+		return imageDataLoadPacked(name, buffer);
+	}
+
+	auto imageData = imageDataLoad(cacheGetEntryFilename(filename).c_str());
+
+	if (!imageData.get())
+	{
+		return IImageDataSP();
+	}
+
+	return imageDataCopy(imageData, name);
+}
+
+IImageDataSP VKTS_APIENTRY cacheLoadImageDataByKey(const std::string& key, const std::string& name)
+{
+	if (key.size() == 0)
+	{
+		return IImageDataSP();
+	}
+
+	std::string filename;
+
+	{
+		std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+		cacheLoadManifest();
+
+		auto walker = g_cacheManifest.find(key);
+
+		if (walker == g_cacheManifest.end())
+		{
+			g_cacheStatistics.missCount++;
+
+			return IImageDataSP();
+		}
+
+		filename = walker->second.filename;
+	}
+
+	auto imageData = cacheLoadEntry(filename, name);
+
+	//
+
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	auto walker = g_cacheManifest.find(key);
+
+	if (!imageData.get())
+	{
+		g_cacheStatistics.missCount++;
+
+		// Entry is broken or was removed outside of the cache.
+		if (walker != g_cacheManifest.end() && walker->second.filename == filename)
+		{
+			cacheRemoveEntry(walker);
+
+			cacheSaveManifest();
+		}
+
+		return IImageDataSP();
+	}
+
+	g_cacheStatistics.hitCount++;
+
+	if (walker != g_cacheManifest.end())
+	{
+		walker->second.tick = ++g_cacheTick;
+
+		g_cacheManifestDirty = VK_TRUE;
+	}
+
+	return imageData;
+}
+
+VkBool32 VKTS_APIENTRY cacheClear()
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	cacheLoadManifest();
+
+	while (g_cacheManifest.size() > 0)
+	{
+		cacheRemoveEntry(g_cacheManifest.begin());
+	}
+
+	return cacheSaveManifest();
+}
+
+void VKTS_APIENTRY cacheGetStatistics(VkTsCacheStatistics& statistics)
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	cacheLoadManifest();
+
+	statistics = g_cacheStatistics;
+}
+
+VkBool32 VKTS_APIENTRY cacheTerminate()
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	if (!g_cacheManifestDirty)
+	{
+		return VK_TRUE;
+	}
+
+	return cacheSaveManifest();
+}
+
+void VKTS_APIENTRY cacheResetStatistics()
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	g_cacheStatistics.hitCount = 0;
+	g_cacheStatistics.missCount = 0;
+	g_cacheStatistics.storeCount = 0;
+	g_cacheStatistics.evictionCount = 0;
+}
+
 }
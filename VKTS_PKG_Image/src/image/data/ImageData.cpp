@@ -47,6 +47,8 @@ void ImageData::reset()
         buffer->reset();
     }
 
+    readOnly = VK_FALSE;
+
     BLOCK = VK_FALSE;
     UNORM = VK_FALSE;
     SFLOAT = VK_FALSE;
@@ -202,7 +204,7 @@ int32_t ImageData::getCubeMapFace(float& s, float& t, const float x, const float
 }
 
 ImageData::ImageData(const std::string& name, const VkImageType imageType, const VkFormat& format, const VkExtent3D& extent, const uint32_t mipLevels, const uint32_t arrayLayers, const std::vector<uint32_t>& allOffsets, const uint8_t* data, const uint32_t size, const float maxLuminance) :
-    IImageData(), name(name), imageType(imageType), format(format), extent(extent), mipLevels(mipLevels), arrayLayers(arrayLayers), allOffsets(allOffsets), maxLuminance(maxLuminance)
+    IImageData(), name(name), imageType(imageType), format(format), extent(extent), mipLevels(mipLevels), arrayLayers(arrayLayers), readOnly(VK_FALSE), allOffsets(allOffsets), maxLuminance(maxLuminance)
 {
     buffer = binaryBufferCreate(data, size);
 
@@ -221,8 +223,8 @@ ImageData::ImageData(const std::string& name, const VkImageType imageType, const
     numberChannels = imageDataGetNumberChannels(format);
 }
 
-ImageData::ImageData(const std::string& name, const VkImageType imageType, const VkFormat& format, const VkExtent3D& extent, const uint32_t mipLevels, const uint32_t arrayLayers, const std::vector<uint32_t>& allOffsets, const IBinaryBufferSP& buffer, const float maxLuminance) :
-    IImageData(), name(name), imageType(imageType), format(format), extent(extent), mipLevels(mipLevels), arrayLayers(arrayLayers), buffer(buffer), allOffsets(allOffsets), maxLuminance(maxLuminance)
+ImageData::ImageData(const std::string& name, const VkImageType imageType, const VkFormat& format, const VkExtent3D& extent, const uint32_t mipLevels, const uint32_t arrayLayers, const std::vector<uint32_t>& allOffsets, const IBinaryBufferSP& buffer, const float maxLuminance, const VkBool32 readOnly) :
+    IImageData(), name(name), imageType(imageType), format(format), extent(extent), mipLevels(mipLevels), arrayLayers(arrayLayers), buffer(buffer), readOnly(readOnly), allOffsets(allOffsets), maxLuminance(maxLuminance)
 {
     if (!this->buffer.get() || !this->buffer->getData())
     {
@@ -386,6 +388,13 @@ VkBool32 ImageData::copy(void* data, const uint32_t mipLevel, const uint32_t arr
 
 VkBool32 ImageData::upload(const void* data, const uint32_t mipLevel, const uint32_t arrayLayer, const VkSubresourceLayout& subresourceLayout) const
 {
+    if (readOnly)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Image data '%s' is read only", name.c_str());
+
+        return VK_FALSE;
+    }
+
     if (!data || mipLevel >= mipLevels || arrayLayer >= arrayLayers || !getData())
     {
         return VK_FALSE;
@@ -493,62 +502,33 @@ const std::vector<uint32_t>& ImageData::getAllOffsets() const
 
 void ImageData::setTexel(const glm::vec4& rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer)
 {
-    if (x >= extent.width || y >= extent.height || z >= extent.depth || mipLevel >= mipLevels || arrayLayer >= arrayLayers || BLOCK || !getData())
+    if (!(UNORM || SFLOAT))
     {
         return;
     }
 
-	VkExtent3D currentExtent;
-	uint32_t offset;
-
-    if (!getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer))
+    // Read only texels are copied before the first write. Several threads may write, so only one takes the copy.
     {
-    	return;
-    }
+        std::lock_guard<std::mutex> writeLockGuard(writeMutex);
 
-    //
-
-    if (!buffer->seek((int64_t)offset + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)x + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)y * (int64_t)extent.width + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)z * (int64_t)extent.width * (int64_t)extent.height, VKTS_SEARCH_ABSOLUTE))
-    {
-    	return;
-    }
-
-    if (UNORM)
-    {
-        uint8_t texelStart[4];
-
-        for (uint32_t currentChannelIndex = 0; currentChannelIndex < numberChannels; currentChannelIndex++)
+        if (readOnly && buffer.get())
         {
-        	uint32_t currentTargetChannelIndex = currentChannelIndex;
+            auto writableBuffer = binaryBufferCreate(buffer->getByteData(), buffer->getSize());
 
-            if (format == VK_FORMAT_B8G8R8_UNORM || format == VK_FORMAT_B8G8R8A8_UNORM || format == VK_FORMAT_B8G8R8_SRGB || format == VK_FORMAT_B8G8R8A8_SRGB)
+            if (!writableBuffer.get() || writableBuffer->getSize() != buffer->getSize())
             {
-                if (currentChannelIndex == 0)
-                {
-                    currentTargetChannelIndex = 2;
-                }
-                else if (currentChannelIndex == 2)
-                {
-                    currentTargetChannelIndex = 0;
-                }
-            }
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not copy read only image data '%s'", name.c_str());
 
-            texelStart[currentTargetChannelIndex] = (uint8_t)(rgba[currentChannelIndex] * 255.0f);
-        }
+                return;
+            }
 
-        buffer->write(texelStart, 1, numberChannels);
-    }
-    else if (SFLOAT)
-    {
-        float texelStart[4];
+            buffer = writableBuffer;
 
-        for (uint32_t currentChannelIndex = 0; currentChannelIndex < numberChannels; currentChannelIndex++)
-        {
-            texelStart[currentChannelIndex] = rgba[currentChannelIndex];
+            readOnly = VK_FALSE;
         }
-
-        buffer->write(texelStart, sizeof(float), numberChannels);
     }
+
+    getView(mipLevel, arrayLayer).setTexel(rgba, x, y, z);
 }
 
 glm::vec4 ImageData::getTexel(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const
@@ -558,58 +538,43 @@ glm::vec4 ImageData::getTexel(const uint32_t x, const uint32_t y, const uint32_t
         return glm::vec4(NAN, NAN, NAN, NAN);
     }
 
-	VkExtent3D currentExtent{0, 0, 0};
-	uint32_t offset = 0;
-
-    getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer);
-
-    //
-
-    if (!buffer->seek((int64_t)offset + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)x + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)y * (int64_t)extent.width + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)z * (int64_t)extent.width * (int64_t)extent.height, VKTS_SEARCH_ABSOLUTE))
+    if (!(UNORM || SFLOAT))
     {
-    	 return glm::vec4(NAN, NAN, NAN, NAN);
+        return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
     }
 
-    glm::vec4 result(0.0f, 0.0f, 0.0f, 1.0f);
+    return getView(mipLevel, arrayLayer).getTexel(x, y, z);
+}
 
-    if (UNORM)
+ImageDataView ImageData::getView(const uint32_t mipLevel, const uint32_t arrayLayer) const
+{
+    if (BLOCK || !(UNORM || SFLOAT) || !getData())
     {
-        uint8_t texelStart[4];
+        return ImageDataView();
+    }
 
-        buffer->read(texelStart, 1, numberChannels);
+	VkExtent3D currentExtent;
+	uint32_t offset;
 
-        for (uint32_t currentChannelIndex = 0; currentChannelIndex < numberChannels; currentChannelIndex++)
-        {
-        	uint32_t currentTargetChannelIndex = currentChannelIndex;
+    if (!getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer))
+    {
+    	return ImageDataView();
+    }
 
-            if (format == VK_FORMAT_B8G8R8_UNORM || format == VK_FORMAT_B8G8R8A8_UNORM || format == VK_FORMAT_B8G8R8_SRGB || format == VK_FORMAT_B8G8R8A8_SRGB)
-            {
-                if (currentChannelIndex == 0)
-                {
-                    currentTargetChannelIndex = 2;
-                }
-                else if (currentChannelIndex == 2)
-                {
-                    currentTargetChannelIndex = 0;
-                }
-            }
+    const uint32_t rowPitch = numberChannels * bytesPerChannel * currentExtent.width;
+    const uint32_t depthPitch = rowPitch * currentExtent.height;
 
-            result[currentTargetChannelIndex] = (float)(texelStart[currentChannelIndex]) / 255.0f;
-        }
-    }
-    else if (SFLOAT)
+    if ((uint64_t)offset + (uint64_t)depthPitch * (uint64_t)currentExtent.depth > (uint64_t)getSize())
     {
-        float texelStart[4];
+    	return ImageDataView();
+    }
 
-        buffer->read(texelStart, sizeof(float), numberChannels);
+    const VkBool32 SWIZZLE = (format == VK_FORMAT_B8G8R8_UNORM || format == VK_FORMAT_B8G8R8A8_UNORM);
 
-        for (uint32_t currentChannelIndex = 0; currentChannelIndex < numberChannels; currentChannelIndex++)
-        {
-            result[currentChannelIndex] = texelStart[currentChannelIndex];
-        }
-    }
+    // Texels are written in place, no cursor of the buffer is used. Views on read only texels reject writes.
+    uint8_t* currentData = const_cast<uint8_t*>(getByteData()) + offset;
 
-    return result;
+    return ImageDataView(currentData, currentExtent, rowPitch, depthPitch, numberChannels, SFLOAT, SWIZZLE, readOnly);
 }
 
 glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSamplerAddressMode addressModeX, const float y, const VkFilter filterY, const VkSamplerAddressMode addressModeY, const float z, const VkFilter filterZ, const VkSamplerAddressMode addressModeZ, const uint32_t mipLevel, const uint32_t arrayLayer) const
@@ -851,6 +816,8 @@ void ImageData::freeHostMemory()
 	}
 
 	buffer = IBinaryBufferSP();
+
+	readOnly = VK_FALSE;
 }
 
 VkBool32 ImageData::updateMaxLuminance()
@@ -47,6 +47,12 @@ private:
 
     IBinaryBufferSP buffer;
 
+    // Buffer references memory, which can not be written e.g. a mapped file.
+    VkBool32 readOnly;
+
+    // Guards the copy of read only texels on the first write.
+    std::mutex writeMutex;
+
     VkBool32 BLOCK;
     VkBool32 UNORM;
     VkBool32 SFLOAT;
@@ -68,7 +74,7 @@ public:
 
     ImageData() = delete;
     ImageData(const std::string& name, const VkImageType imageType, const VkFormat& format, const VkExtent3D& extent, const uint32_t mipLevels, const uint32_t arrayLayers, const std::vector<uint32_t>& allOffsets, const uint8_t* data, const uint32_t size, const float maxLuminance);
-    ImageData(const std::string& name, const VkImageType imageType, const VkFormat& format, const VkExtent3D& extent, const uint32_t mipLevels, const uint32_t arrayLayers, const std::vector<uint32_t>& allOffsets, const IBinaryBufferSP& buffer, const float maxLuminance);
+    ImageData(const std::string& name, const VkImageType imageType, const VkFormat& format, const VkExtent3D& extent, const uint32_t mipLevels, const uint32_t arrayLayers, const std::vector<uint32_t>& allOffsets, const IBinaryBufferSP& buffer, const float maxLuminance, const VkBool32 readOnly);
     ImageData(const ImageData& other) = delete;
     ImageData(ImageData&& other) = delete;
     virtual ~ImageData();
@@ -129,6 +135,8 @@ public:
 
     virtual glm::vec4 getTexel(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const override;
 
+    virtual ImageDataView getView(const uint32_t mipLevel, const uint32_t arrayLayer) const override;
+
     virtual glm::vec4 getSample(const float x, const VkFilter filterX, const VkSamplerAddressMode addressModeX, const float y, const VkFilter filterY, const VkSamplerAddressMode addressModeY, const float z, const VkFilter filterZ, const VkSamplerAddressMode addressModeZ, const uint32_t mipLevel, const uint32_t arrayLayer) const override;
 
     virtual glm::vec4 getSampleCubeMap(const float x, const float y, const float z, const VkFilter filter, const uint32_t mipLevel) const override;
@@ -0,0 +1,551 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ImageDataPrefilter.hpp"
+
+#include "fn_image_data_internal.hpp"
+
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_PREFILTER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace vkts
+{
+
+// Same as the cube map face selection of the image data.
+static int32_t prefilterGetCubeMapFace(float& s, float& t, const float x, const float y, const float z)
+{
+	int32_t faceLayer = 0;
+
+	float sc = 0.0f;
+	float tc = 0.0f;
+	float rc = 0.0f;
+
+	float absX = fabsf(x);
+	float absY = fabsf(y);
+	float absZ = fabsf(z);
+
+	if (absX > absY && absX > absZ)
+	{
+		if (x > 0.0f)
+		{
+			faceLayer = 0;
+
+			sc = -z;
+			tc = -y;
+			rc = x;
+		}
+		else
+		{
+			faceLayer = 1;
+
+			sc = z;
+			tc = -y;
+			rc = x;
+		}
+	}
+	else if (absY >= absX && absY > absZ)
+	{
+		if (y > 0.0f)
+		{
+			faceLayer = 2;
+
+			sc = x;
+			tc = z;
+			rc = y;
+		}
+		else
+		{
+			faceLayer = 3;
+
+			sc = x;
+			tc = -z;
+			rc = y;
+		}
+	}
+	else if (absZ >= absX && absZ >= absY)
+	{
+		if (z > 0.0f)
+		{
+			faceLayer = 4;
+
+			sc = x;
+			tc = -y;
+			rc = z;
+		}
+		else
+		{
+			faceLayer = 5;
+
+			sc = -x;
+			tc = -y;
+			rc = z;
+		}
+	}
+	else
+	{
+		return -1;
+	}
+
+	s = 0.5f * sc / fabsf(rc) + 0.5f;
+	t = 0.5f * tc / fabsf(rc) + 0.5f;
+
+	return faceLayer;
+}
+
+ImageDataPrefilter::ImageDataPrefilter(const enum ImageDataPrefilterType type, const IImageDataSP& sourceImage, const uint32_t samples) :
+	type(type), sourceImage(sourceImage), samples(samples), length(0), stepTexel(0.0f), allRed(), allGreen(), allBlue(), allSamples(), allJobs(), allTiles(), nextTile(0)
+{
+	if (sourceImage.get())
+	{
+		length = sourceImage->getWidth();
+		stepTexel = 1.0f / (float)length;
+	}
+}
+
+ImageDataPrefilter::~ImageDataPrefilter()
+{
+}
+
+void ImageDataPrefilter::decode()
+{
+	const uint32_t faceSize = length * length;
+
+	allRed.resize(6 * faceSize);
+	allGreen.resize(6 * faceSize);
+	allBlue.resize(6 * faceSize);
+
+	std::vector<glm::vec4> row(length);
+
+	// Alpha is never used, so it is not decoded.
+	for (uint32_t faceLayer = 0; faceLayer < 6; faceLayer++)
+	{
+		const ImageDataView view = sourceImage->getView(0, faceLayer);
+
+		for (uint32_t y = 0; y < length; y++)
+		{
+			if (!view.decodeRow(&row[0], 0, y, 0, length))
+			{
+				for (uint32_t x = 0; x < length; x++)
+				{
+					row[x] = sourceImage->getTexel(x, y, 0, 0, faceLayer);
+				}
+			}
+
+			for (uint32_t x = 0; x < length; x++)
+			{
+				const uint32_t index = faceLayer * faceSize + y * length + x;
+
+				allRed[index] = row[x].r;
+				allGreen[index] = row[x].g;
+				allBlue[index] = row[x].b;
+			}
+		}
+	}
+}
+
+glm::vec3 ImageDataPrefilter::getTexel(const float s, const float t, const int32_t faceLayer) const
+{
+	const int32_t texelS = glm::clamp((int32_t)(s * (float)length), 0, (int32_t)length - 1);
+	const int32_t texelT = glm::clamp((int32_t)(t * (float)length), 0, (int32_t)length - 1);
+
+	const uint32_t index = (uint32_t)faceLayer * length * length + (uint32_t)texelT * length + (uint32_t)texelS;
+
+	// Accumulated on zero as by the image data, so negative zeros do result in the same sum.
+	return glm::vec3(0.0f, 0.0f, 0.0f) + glm::vec3(allRed[index], allGreen[index], allBlue[index]);
+}
+
+glm::vec3 ImageDataPrefilter::getSampleCubeMap(const float x, const float y, const float z) const
+{
+	// Vector is already normalized. Invalid vectors do not result in a face.
+
+	float s;
+	float t;
+
+	auto faceLayer = prefilterGetCubeMapFace(s, t, x, y, z);
+
+	if (faceLayer == -1)
+	{
+		return glm::vec3(NAN, NAN, NAN);
+	}
+
+	glm::vec3 result = getTexel(s, t, faceLayer);
+
+	// Get three more samples. Not seamless.
+
+	float unnormalizedS = s * (float)length;
+	float unnormalizedT = t * (float)length;
+
+	float fractionS = fabsf(unnormalizedS - floorf(unnormalizedS));
+	float fractionT = fabsf(unnormalizedT - floorf(unnormalizedT));
+
+	if (fractionS < 0.5f)
+	{
+		result += getTexel(s - stepTexel, t, faceLayer);
+
+		if (fractionT < 0.5f)
+		{
+			result += getTexel(s, t - stepTexel, faceLayer);
+			result += getTexel(s - stepTexel, t - stepTexel, faceLayer);
+		}
+		else
+		{
+			result += getTexel(s, t + stepTexel, faceLayer);
+			result += getTexel(s - stepTexel, t + stepTexel, faceLayer);
+		}
+	}
+	else
+	{
+		result += getTexel(s + stepTexel, t, faceLayer);
+
+		if (fractionT < 0.5f)
+		{
+			result += getTexel(s, t - stepTexel, faceLayer);
+			result += getTexel(s + stepTexel, t - stepTexel, faceLayer);
+		}
+		else
+		{
+			result += getTexel(s, t + stepTexel, faceLayer);
+			result += getTexel(s + stepTexel, t + stepTexel, faceLayer);
+		}
+	}
+
+	return result * 0.25f;
+}
+
+void ImageDataPrefilter::prefilterRow(const ImageDataPrefilterJob& job, const uint32_t y) const
+{
+	const ImageDataPrefilterSamples& currentSamples = allSamples[job.samplesIndex];
+
+	// Oren-Nayar terms only depending on the roughness.
+
+	float roughnessSquared = job.roughness * job.roughness;
+
+	float A = 1.0f - 0.5f * (roughnessSquared / (roughnessSquared + 0.57f));
+
+	float B = 0.45f * (roughnessSquared / (roughnessSquared + 0.09f));
+
+	//
+
+	float lightX[VKTS_PREFILTER_LANES];
+	float lightY[VKTS_PREFILTER_LANES];
+	float lightZ[VKTS_PREFILTER_LANES];
+
+	float normalizedX[VKTS_PREFILTER_LANES];
+	float normalizedY[VKTS_PREFILTER_LANES];
+	float normalizedZ[VKTS_PREFILTER_LANES];
+
+	std::vector<glm::vec4> row(job.width);
+
+	for (uint32_t x = 0; x < job.width; x++)
+	{
+		glm::vec3 scanVector = imageDataGetScanVector(x, y, job.side, job.step, job.offset);
+
+		glm::mat3 basis = renderGetBasis(scanVector);
+
+		// N = V
+		float NdotV = glm::dot(scanVector, scanVector);
+
+		float angleVN = acosf(NdotV);
+
+		//
+
+		glm::vec3 color = glm::vec3(0.0f, 0.0f, 0.0f);
+
+		float sampleDivisior = 0.0f;
+
+		for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex += VKTS_PREFILTER_LANES)
+		{
+			// Transform the sample vectors to world space, with the same operations and order as glm.
+
+#ifdef VKTS_PREFILTER_SSE2
+			const __m128 tangentX = _mm_loadu_ps(&currentSamples.x[sampleIndex]);
+			const __m128 tangentY = _mm_loadu_ps(&currentSamples.y[sampleIndex]);
+			const __m128 tangentZ = _mm_loadu_ps(&currentSamples.z[sampleIndex]);
+
+			__m128 vectorX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(basis[0][0]), tangentX), _mm_mul_ps(_mm_set1_ps(basis[1][0]), tangentY)), _mm_mul_ps(_mm_set1_ps(basis[2][0]), tangentZ));
+			__m128 vectorY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(basis[0][1]), tangentX), _mm_mul_ps(_mm_set1_ps(basis[1][1]), tangentY)), _mm_mul_ps(_mm_set1_ps(basis[2][1]), tangentZ));
+			__m128 vectorZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(basis[0][2]), tangentX), _mm_mul_ps(_mm_set1_ps(basis[1][2]), tangentY)), _mm_mul_ps(_mm_set1_ps(basis[2][2]), tangentZ));
+
+			if (type == ImageDataPrefilterType_CookTorrance)
+			{
+				// Vector is H. Reflect the incident vector -V at H.
+
+				const __m128 incidentX = _mm_set1_ps(-scanVector.x);
+				const __m128 incidentY = _mm_set1_ps(-scanVector.y);
+				const __m128 incidentZ = _mm_set1_ps(-scanVector.z);
+
+				const __m128 HdotI = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vectorX, incidentX), _mm_mul_ps(vectorY, incidentY)), _mm_mul_ps(vectorZ, incidentZ));
+
+				const __m128 two = _mm_set1_ps(2.0f);
+
+				vectorX = _mm_sub_ps(incidentX, _mm_mul_ps(_mm_mul_ps(vectorX, HdotI), two));
+				vectorY = _mm_sub_ps(incidentY, _mm_mul_ps(_mm_mul_ps(vectorY, HdotI), two));
+				vectorZ = _mm_sub_ps(incidentZ, _mm_mul_ps(_mm_mul_ps(vectorZ, HdotI), two));
+			}
+
+			_mm_storeu_ps(lightX, vectorX);
+			_mm_storeu_ps(lightY, vectorY);
+			_mm_storeu_ps(lightZ, vectorZ);
+
+			const __m128 squaredLength = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vectorX, vectorX), _mm_mul_ps(vectorY, vectorY)), _mm_mul_ps(vectorZ, vectorZ));
+
+			const __m128 inverseLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(squaredLength));
+
+			_mm_storeu_ps(normalizedX, _mm_mul_ps(vectorX, inverseLength));
+			_mm_storeu_ps(normalizedY, _mm_mul_ps(vectorY, inverseLength));
+			_mm_storeu_ps(normalizedZ, _mm_mul_ps(vectorZ, inverseLength));
+#else
+			for (uint32_t lane = 0; lane < VKTS_PREFILTER_LANES; lane++)
+			{
+				glm::vec3 L = basis * glm::vec3(currentSamples.x[sampleIndex + lane], currentSamples.y[sampleIndex + lane], currentSamples.z[sampleIndex + lane]);
+
+				if (type == ImageDataPrefilterType_CookTorrance)
+				{
+					L = glm::reflect(-scanVector, L);
+				}
+
+				glm::vec3 normalized = glm::normalize(L);
+
+				lightX[lane] = L.x;
+				lightY[lane] = L.y;
+				lightZ[lane] = L.z;
+
+				normalizedX[lane] = normalized.x;
+				normalizedY[lane] = normalized.y;
+				normalizedZ[lane] = normalized.z;
+			}
+#endif
+
+			// Sampling and accumulation in the order of the samples.
+
+			const uint32_t lanes = glm::min(samples - sampleIndex, (uint32_t)VKTS_PREFILTER_LANES);
+
+			for (uint32_t lane = 0; lane < lanes; lane++)
+			{
+				glm::vec3 currentColor = getSampleCubeMap(normalizedX[lane], normalizedY[lane], normalizedZ[lane]);
+
+				if (type == ImageDataPrefilterType_OrenNayar)
+				{
+					glm::vec3 L = glm::vec3(lightX[lane], lightY[lane], lightZ[lane]);
+
+					float NdotL = glm::dot(scanVector, L);
+
+					float angleLN = acosf(NdotL);
+
+					float alpha = glm::max(angleVN, angleLN);
+					float beta = glm::min(angleVN, angleLN);
+					float gamma = glm::dot(scanVector - scanVector * NdotV, L - scanVector * NdotL);
+
+					float C = sinf(alpha) * tanf(beta);
+
+					float Lr = glm::max(0.0f, NdotL) * (A + B * glm::max(0.0f, gamma) * C);
+
+					currentColor = currentColor * Lr;
+				}
+
+				if (!std::isnan(currentColor.x) && !std::isnan(currentColor.y) && !std::isnan(currentColor.z))
+				{
+					color += currentColor;
+
+					sampleDivisior += 1.0f;
+				}
+			}
+		}
+
+		//
+
+		if (sampleDivisior > 0.0f)
+		{
+			color = color / sampleDivisior;
+		}
+
+		row[x] = glm::vec4(color, 1.0f);
+	}
+
+	// Rows are disjoint, so all threads can write through the view.
+	job.targetView.encodeRow(&row[0], 0, y, 0, job.width);
+}
+
+void ImageDataPrefilter::prefilterTiles()
+{
+	uint32_t tileIndex;
+
+	while ((tileIndex = nextTile.fetch_add(1)) < (uint32_t)allTiles.size())
+	{
+		const ImageDataPrefilterTile& tile = allTiles[tileIndex];
+
+		for (uint32_t y = tile.rowBegin; y < tile.rowEnd; y++)
+		{
+			prefilterRow(allJobs[tile.job], y);
+		}
+	}
+}
+
+void ImageDataPrefilter::addTarget(const IImageDataSP& targetImage, const uint32_t side, const float roughness, const uint32_t scanLength)
+{
+	if (!targetImage.get() || scanLength == 0)
+	{
+		return;
+	}
+
+	// Sample vectors are shared by all targets with the same roughness. Diffuse vectors do not depend on the roughness.
+
+	uint32_t samplesIndex = 0;
+
+	while (samplesIndex < (uint32_t)allSamples.size())
+	{
+		if (type != ImageDataPrefilterType_CookTorrance || allSamples[samplesIndex].roughness == roughness || (std::isnan(roughness) && std::isnan(allSamples[samplesIndex].roughness)))
+		{
+			break;
+		}
+
+		samplesIndex++;
+	}
+
+	if (samplesIndex == (uint32_t)allSamples.size())
+	{
+		ImageDataPrefilterSamples currentSamples;
+
+		currentSamples.roughness = roughness;
+
+		const uint32_t paddedSamples = ((samples + VKTS_PREFILTER_LANES - 1) / VKTS_PREFILTER_LANES) * VKTS_PREFILTER_LANES;
+
+		currentSamples.x.resize(paddedSamples, 0.0f);
+		currentSamples.y.resize(paddedSamples, 0.0f);
+		currentSamples.z.resize(paddedSamples, 0.0f);
+
+		for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+		{
+			glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
+
+			glm::vec3 tangentSpace;
+
+			if (type == ImageDataPrefilterType_CookTorrance)
+			{
+				tangentSpace = renderGetGGXWeightedVector(randomPoint, roughness);
+			}
+			else
+			{
+				tangentSpace = renderGetCosineWeightedVector(randomPoint);
+			}
+
+			currentSamples.x[sampleIndex] = tangentSpace.x;
+			currentSamples.y[sampleIndex] = tangentSpace.y;
+			currentSamples.z[sampleIndex] = tangentSpace.z;
+		}
+
+		allSamples.push_back(currentSamples);
+	}
+
+	//
+
+	ImageDataPrefilterJob job;
+
+	job.targetImage = targetImage;
+	job.side = side;
+	job.samplesIndex = samplesIndex;
+	job.roughness = roughness;
+
+	// 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
+	job.step = 2.0f / (float)scanLength;
+	job.offset = job.step * 0.5f;
+
+	job.width = glm::min(targetImage->getWidth(), scanLength);
+	job.height = glm::min(targetImage->getHeight(), scanLength);
+
+	allJobs.push_back(job);
+}
+
+VkBool32 ImageDataPrefilter::prefilter()
+{
+	if (!sourceImage.get() || sourceImage->getArrayLayers() != 6 || samples == 0 || length == 0)
+	{
+		return VK_FALSE;
+	}
+
+	const double startTime = timeGetRaw();
+
+	decode();
+
+	//
+
+	allTiles.clear();
+
+	uint64_t texels = 0;
+
+	for (uint32_t jobIndex = 0; jobIndex < (uint32_t)allJobs.size(); jobIndex++)
+	{
+		auto& job = allJobs[jobIndex];
+
+		job.targetView = job.targetImage->getView(0, 0);
+
+		if (!job.targetView.isValid())
+		{
+			continue;
+		}
+
+		for (uint32_t rowBegin = 0; rowBegin < job.height; rowBegin += VKTS_PREFILTER_TILE_ROWS)
+		{
+			allTiles.push_back(ImageDataPrefilterTile{jobIndex, rowBegin, glm::min(rowBegin + VKTS_PREFILTER_TILE_ROWS, job.height)});
+		}
+
+		texels += (uint64_t)job.width * (uint64_t)job.height;
+	}
+
+	nextTile = 0;
+
+	// Calling thread is processing tiles as well.
+
+	const uint32_t threadCount = glm::max(glm::min(processorGetNumber(), (uint32_t)allTiles.size()), 1u);
+
+	std::vector<std::thread> allThreads;
+
+	for (uint32_t threadIndex = 1; threadIndex < threadCount; threadIndex++)
+	{
+		allThreads.push_back(std::thread(&ImageDataPrefilter::prefilterTiles, this));
+	}
+
+	prefilterTiles();
+
+	for (auto& currentThread : allThreads)
+	{
+		currentThread.join();
+	}
+
+	//
+
+	const double seconds = timeGetRaw() - startTime;
+
+	logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Prefiltered %llu texels with %u samples on %u threads in %.3f seconds: %.0f texels/second", (unsigned long long)texels, samples, threadCount, seconds, seconds > 0.0 ? (double)texels / seconds : 0.0);
+
+	return VK_TRUE;
+}
+
+}
@@ -0,0 +1,139 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IMAGEDATAPREFILTER_HPP_
+#define VKTS_IMAGEDATAPREFILTER_HPP_
+
+#include <vkts/image/vkts_image.hpp>
+
+#include <atomic>
+
+#define VKTS_PREFILTER_TILE_ROWS 4
+
+#define VKTS_PREFILTER_LANES 4
+
+namespace vkts
+{
+
+enum ImageDataPrefilterType {
+	ImageDataPrefilterType_CookTorrance,
+	ImageDataPrefilterType_OrenNayar,
+	ImageDataPrefilterType_Lambert
+};
+
+/**
+ * Prefilters a cube map on all processors. Level 0 of the source is decoded once into float planes per channel,
+ * so sampling does not go through the image data. Four samples are transformed at once.
+ * Results are identical to sampling the image data with renderCookTorrance, renderOrenNayar and renderLambert.
+ */
+class ImageDataPrefilter
+{
+
+private:
+
+    typedef struct ImageDataPrefilterSamples_ {
+        float roughness;
+        // Tangent space vectors, padded to a multiple of the lanes.
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> z;
+    } ImageDataPrefilterSamples;
+
+    typedef struct ImageDataPrefilterJob_ {
+        IImageDataSP targetImage;
+        ImageDataView targetView;
+        uint32_t side;
+        uint32_t samplesIndex;
+        float roughness;
+        float step;
+        float offset;
+        uint32_t width;
+        uint32_t height;
+    } ImageDataPrefilterJob;
+
+    typedef struct ImageDataPrefilterTile_ {
+        uint32_t job;
+        uint32_t rowBegin;
+        uint32_t rowEnd;
+    } ImageDataPrefilterTile;
+
+    enum ImageDataPrefilterType type;
+
+    IImageDataSP sourceImage;
+
+    uint32_t samples;
+
+    uint32_t length;
+    float stepTexel;
+
+    std::vector<float> allRed;
+    std::vector<float> allGreen;
+    std::vector<float> allBlue;
+
+    std::vector<ImageDataPrefilterSamples> allSamples;
+
+    std::vector<ImageDataPrefilterJob> allJobs;
+
+    std::vector<ImageDataPrefilterTile> allTiles;
+
+    std::atomic<uint32_t> nextTile;
+
+    void decode();
+
+    glm::vec3 getTexel(const float s, const float t, const int32_t faceLayer) const;
+
+    glm::vec3 getSampleCubeMap(const float x, const float y, const float z) const;
+
+    void prefilterRow(const ImageDataPrefilterJob& job, const uint32_t y) const;
+
+    void prefilterTiles();
+
+public:
+
+    ImageDataPrefilter() = delete;
+    ImageDataPrefilter(const enum ImageDataPrefilterType type, const IImageDataSP& sourceImage, const uint32_t samples);
+    ImageDataPrefilter(const ImageDataPrefilter& other) = delete;
+    ImageDataPrefilter(ImageDataPrefilter&& other) = delete;
+    ~ImageDataPrefilter();
+
+    ImageDataPrefilter& operator =(const ImageDataPrefilter& other) = delete;
+    ImageDataPrefilter& operator =(ImageDataPrefilter && other) = delete;
+
+    /**
+     * Scan vectors are calculated for a side with the given length, even if the target image is smaller.
+     */
+    void addTarget(const IImageDataSP& targetImage, const uint32_t side, const float roughness, const uint32_t scanLength);
+
+    /**
+     * Processes all targets and writes the texels. Returns VK_FALSE, if the source is not a cube map.
+     */
+    VkBool32 prefilter();
+
+};
+
+}
+
+#endif /* VKTS_IMAGEDATAPREFILTER_HPP_ */
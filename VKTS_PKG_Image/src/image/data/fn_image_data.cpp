@@ -617,7 +617,7 @@ IImageDataSP VKTS_APIENTRY imageDataLoad(const char* filename)
         return IImageDataSP();
     }
 
-    auto buffer = fileLoadBinary(filename);
+    auto buffer = fileMapBinary(filename);
 
     if (!buffer.get())
     {
@@ -651,6 +651,10 @@ IImageDataSP VKTS_APIENTRY imageDataLoad(const char* filename)
     {
         return imageDataLoadStb(filename, buffer);
     }
+    else if (lowerCaseExtension == ".vkti")
+    {
+        return imageDataLoadPacked(filename, buffer);
+    }
 
     return IImageDataSP();
 }
@@ -667,7 +671,7 @@ IImageDataSP VKTS_APIENTRY imageDataLoadRaw(const char* filename, const uint32_t
     	return IImageDataSP();
     }
 
-    auto buffer = fileLoadBinary(filename);
+    auto buffer = fileMapBinary(filename);
 
     if (!buffer.get())
     {
@@ -958,6 +962,10 @@ VkBool32 VKTS_APIENTRY imageDataSave(const char* filename, const IImageDataSP& i
     {
     	return imageDataSaveStb(filename, imageData, mipLevel, arrayLayer);
     }
+    else if (lowerCaseExtension == ".vkti")
+    {
+    	return imageDataSavePacked(filename, imageData);
+    }
 
     return VK_FALSE;
 }
@@ -998,6 +1006,10 @@ IImageDataSP VKTS_APIENTRY imageDataCreate(const std::string& name, const std::s
     {
         return imageDataLoadStb(filename, buffer);
     }
+    else if (lowerCaseExtension == ".vkti")
+    {
+        return imageDataLoadPacked(filename, buffer);
+    }
 
     return IImageDataSP();
 }
@@ -1140,14 +1152,31 @@ IImageDataSP VKTS_APIENTRY imageDataCreate(const std::string& name, const uint32
         return IImageDataSP();
     }
 
+    const ImageDataView view = currentImageData->getView(0, 0);
+
+    if (!view.isValid())
+    {
+        return currentImageData;
+    }
+
+    // Encode the first row once and copy it to all other rows.
+
+    std::vector<glm::vec4> row(width, color);
+
+    view.encodeRow(&row[0], 0, 0, 0, width);
+
+    const uint32_t rowSize = width * view.getBytesPerTexel();
+
     for (uint32_t z = 0; z < depth; z++)
     {
         for (uint32_t y = 0; y < height; y++)
         {
-            for (uint32_t x = 0; x < width; x++)
+            if (y == 0 && z == 0)
             {
-            	currentImageData->setTexel(color, x, y, z, 0, 0);
+                continue;
             }
+
+            memcpy(view.getRow(y, z), view.getRow(0, 0), rowSize);
         }
     }
 
@@ -1192,21 +1221,47 @@ IImageDataSP VKTS_APIENTRY imageDataUnite(const IImageDataSP& sourceImage0, cons
         return IImageDataSP();
     }
 
+    const ImageDataView sourceView0 = sourceImage0->getView(0, 0);
+    const ImageDataView sourceView1 = sourceImage1->getView(0, 0);
+    const ImageDataView targetView = currentImageData->getView(0, 0);
+
+    std::vector<glm::vec4> sourceRow0(sourceImage0->getWidth());
+    std::vector<glm::vec4> sourceRow1(sourceImage1->getWidth());
+    std::vector<glm::vec4> targetRow(width);
+
     for (uint32_t z = 0; z < depth; z++)
     {
         for (uint32_t y = 0; y < height; y++)
         {
+    		uint32_t y0 = glm::min(y, sourceImage0->getHeight() - 1);
+    		uint32_t z0 = glm::min(z, sourceImage0->getDepth() - 1);
+
+    		uint32_t y1 = glm::min(y, sourceImage1->getHeight() - 1);
+    		uint32_t z1 = glm::min(z, sourceImage1->getDepth() - 1);
+
+    		if (!sourceView0.decodeRow(&sourceRow0[0], 0, y0, z0, (uint32_t)sourceRow0.size()))
+    		{
+    			for (uint32_t x = 0; x < (uint32_t)sourceRow0.size(); x++)
+    			{
+    				sourceRow0[x] = sourceImage0->getTexel(x, y0, z0, 0, 0);
+    			}
+    		}
+
+    		if (!sourceView1.decodeRow(&sourceRow1[0], 0, y1, z1, (uint32_t)sourceRow1.size()))
+    		{
+    			for (uint32_t x = 0; x < (uint32_t)sourceRow1.size(); x++)
+    			{
+    				sourceRow1[x] = sourceImage1->getTexel(x, y1, z1, 0, 0);
+    			}
+    		}
+
             for (uint32_t x = 0; x < width; x++)
             {
             	glm::vec4 color;
 
         		uint32_t x0 = glm::min(x, sourceImage0->getWidth() - 1);
-        		uint32_t y0 = glm::min(y, sourceImage0->getHeight() - 1);
-        		uint32_t z0 = glm::min(z, sourceImage0->getDepth() - 1);
 
         		uint32_t x1 = glm::min(x, sourceImage1->getWidth() - 1);
-        		uint32_t y1 = glm::min(y, sourceImage1->getHeight() - 1);
-        		uint32_t z1 = glm::min(z, sourceImage1->getDepth() - 1);
 
             	for (uint32_t i = 0; i < 4; i++)
             	{
@@ -1233,28 +1288,28 @@ IImageDataSP VKTS_APIENTRY imageDataUnite(const IImageDataSP& sourceImage0, cons
             		switch (current)
             		{
 						case VKTS_SOURCE_0_RED:
-							c = sourceImage0->getTexel(x0, y0, z0, 0, 0).r;
+							c = sourceRow0[x0].r;
 							break;
 						case VKTS_SOURCE_0_GREEN:
-							c = sourceImage0->getTexel(x0, y0, z0, 0, 0).g;
+							c = sourceRow0[x0].g;
 							break;
 						case VKTS_SOURCE_0_BLUE:
-							c = sourceImage0->getTexel(x0, y0, z0, 0, 0).b;
+							c = sourceRow0[x0].b;
 							break;
 						case VKTS_SOURCE_0_ALPHA:
-							c = sourceImage0->getTexel(x0, y0, z0, 0, 0).a;
+							c = sourceRow0[x0].a;
 							break;
 						case VKTS_SOURCE_1_RED:
-							c = sourceImage1->getTexel(x1, y1, z1, 0, 0).r;
+							c = sourceRow1[x1].r;
 							break;
 						case VKTS_SOURCE_1_GREEN:
-							c = sourceImage1->getTexel(x1, y1, z1, 0, 0).g;
+							c = sourceRow1[x1].g;
 							break;
 						case VKTS_SOURCE_1_BLUE:
-							c = sourceImage1->getTexel(x1, y1, z1, 0, 0).b;
+							c = sourceRow1[x1].b;
 							break;
 						case VKTS_SOURCE_1_ALPHA:
-							c = sourceImage1->getTexel(x1, y1, z1, 0, 0).a;
+							c = sourceRow1[x1].a;
 							break;
 						case VKTS_SOURCE_ZERO:
 							c = 0.0f;
@@ -1267,8 +1322,10 @@ IImageDataSP VKTS_APIENTRY imageDataUnite(const IImageDataSP& sourceImage0, cons
             		color[i] = c;
             	}
 
-            	currentImageData->setTexel(color, glm::max(x0, x1), glm::max(y0, y1), glm::max(z0, z1), 0, 0);
+            	targetRow[glm::max(x0, x1)] = color;
             }
+
+            targetView.encodeRow(&targetRow[0], 0, glm::max(y0, y1), glm::max(z0, z1), width);
         }
     }
 
@@ -1696,10 +1753,26 @@ IImageDataSP VKTS_APIENTRY imageDataConvert(const IImageDataSP& sourceImage, con
     uint8_t* currentTargetUINT8 = &targetData[0];
     float* currentTargetFLOAT = (float*) &targetData[0];
 
+    const ImageDataView sourceView = sourceImage->getView(0, 0);
+
+    std::vector<glm::vec4> sourceRow(sourceImage->getWidth());
+
     for (int32_t z = 0; z < (int32_t)sourceImage->getDepth(); z++)
     {
         for (int32_t y = 0; y < (int32_t)sourceImage->getHeight(); y++)
         {
+        	// Decoded texels are only needed for luminance and normal length.
+        	if (sourceImageDataType == VKTS_HDR_COLOR_DATA || sourceImageDataType == VKTS_NORMAL_DATA)
+        	{
+        		if (!sourceView.decodeRow(&sourceRow[0], 0, y, z, (uint32_t)sourceRow.size()))
+        		{
+        			for (int32_t x = 0; x < (int32_t)sourceImage->getWidth(); x++)
+        			{
+        				sourceRow[x] = sourceImage->getTexel(x, y, z, 0, 0);
+        			}
+        		}
+        	}
+
             for (int32_t x = 0; x < (int32_t)sourceImage->getWidth(); x++)
             {
             	int32_t xTarget = mirror[0] ? (sourceImage->getWidth() - 1 - x) : x;
@@ -1711,11 +1784,11 @@ IImageDataSP VKTS_APIENTRY imageDataConvert(const IImageDataSP& sourceImage, con
 
             	if (sourceImageDataType == VKTS_HDR_COLOR_DATA)
 				{
-            		L = renderColorGetLuminance(sourceImage->getTexel(x, y, z, 0, 0));
+            		L = renderColorGetLuminance(sourceRow[x]);
 				}
             	else if (sourceImageDataType == VKTS_NORMAL_DATA)
 				{
-            		glm::vec4 scaledNormal = (sourceImage->getTexel(x, y, z, 0, 0) * 2.0f - 1.0f) * factor;
+            		glm::vec4 scaledNormal = (sourceRow[x] * 2.0f - 1.0f) * factor;
 
             		normalLength = glm::length(scaledNormal);
 
@@ -1937,7 +2010,7 @@ IImageDataSP VKTS_APIENTRY imageDataMerge(const SmartPointerVector<IImageDataSP>
         maxLuminance = glm::max(maxLuminance, sourceImages[i]->getMaxLuminance());
     }
 
-    return IImageDataSP(new ImageData(name, imageType, format, extent, mipLevels, arrayLayers, allOffsets, mergedImageData, maxLuminance));
+    return IImageDataSP(new ImageData(name, imageType, format, extent, mipLevels, arrayLayers, allOffsets, mergedImageData, maxLuminance, VK_FALSE));
 }
 
 }
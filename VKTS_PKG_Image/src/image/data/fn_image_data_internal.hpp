@@ -58,6 +58,19 @@ VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataLoadStb(const std::string& name
  */
 VKTS_APICALL VkBool32 VKTS_APIENTRY imageDataSaveStb(const std::string& name, const IImageDataSP& imageData, const uint32_t mipLevel, const uint32_t arrayLayer);
 
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataLoadPacked(const std::string& name, const IBinaryBufferSP& buffer);
+
+/**
+ * Saves all mip levels and array layers.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY imageDataSavePacked(const std::string& name, const IImageDataSP& imageData);
+
 }
 
 #endif /* VKTS_FN_IMAGE_DATA_INTERNAL_HPP_ */
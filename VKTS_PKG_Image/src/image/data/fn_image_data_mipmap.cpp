@@ -95,35 +95,32 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataS
             return SmartPointerVector<IImageDataSP>();
         }
 
+        const ImageDataView sourceView = currentSourceImage->getView(0, 0);
+        const ImageDataView targetView = currentTargetImage->getView(0, 0);
+
+        std::vector<glm::vec4> sourceRow(currentSourceImage->getWidth());
+        std::vector<glm::vec4> targetRow(width);
+
         for (int32_t z = 0; z < depth; z++)
         {
             for (int32_t y = 0; y < height; y++)
             {
-                for (int32_t x = 0; x < width; x++)
-                {
-                    glm::vec4 rgba = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
-                    float sampleCount = 0.0f;
+                // Every second texel of every second row is taken.
 
-                    for (int32_t iz = z * 2; iz < z * 2 + 1; iz++)
+                if (!sourceView.decodeRow(&sourceRow[0], 0, y * 2, z * 2, (uint32_t)sourceRow.size()))
+                {
+                    for (int32_t ix = 0; ix < (int32_t)sourceRow.size(); ix++)
                     {
-                        for (int32_t iy = y * 2; iy < y * 2 + 1; iy++)
-                        {
-                            for (int32_t ix = x * 2; ix < x * 2 + 1; ix++)
-                            {
-                                rgba += currentSourceImage->getTexel(ix, iy, iz, 0, 0);
-
-                                sampleCount += 1.0f;
-                            }
-                        }
+                        sourceRow[ix] = currentSourceImage->getTexel(ix, y * 2, z * 2, 0, 0);
                     }
+                }
 
-                    if (sampleCount > 0.0f)
-                    {
-                        rgba /= sampleCount;
-
-                        currentTargetImage->setTexel(rgba, x, y, z, 0, 0);
-                    }
+                for (int32_t x = 0; x < width; x++)
+                {
+                    targetRow[x] = sourceRow[x * 2];
                 }
+
+                targetView.encodeRow(&targetRow[0], 0, y, z, width);
             }
         }
 
@@ -0,0 +1,332 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/image/vkts_image.hpp>
+
+#include "ImageData.hpp"
+
+#define VKTS_PACKED_IDENTIFIER_SIZE 12
+
+#define VKTS_PACKED_PAYLOAD_ALIGNMENT 16
+
+namespace vkts
+{
+
+//
+// Packed image container, similar to KTX2: A fixed header is followed by the offsets of all sub resources and the raw texel payload.
+// The payload is stored as is, so it can be used directly out of the mapped file.
+//
+
+typedef struct PackedHeader_
+{
+	uint8_t identifier[VKTS_PACKED_IDENTIFIER_SIZE];
+	uint32_t format;
+	uint32_t imageType;
+	uint32_t width;
+	uint32_t height;
+	uint32_t depth;
+	uint32_t mipLevels;
+	uint32_t arrayLayers;
+	float maxLuminance;
+	uint32_t payloadOffset;
+	uint32_t payloadSize;
+} PackedHeader;
+
+static const uint8_t g_packedIdentifier[VKTS_PACKED_IDENTIFIER_SIZE] = {0xAB, 'V', 'K', 'T', 'S', ' ', '1', '0', 0xBB, '\r', '\n', 0x1A};
+
+static void imageDataPackedGetBlockExtent(uint32_t& blockWidth, uint32_t& blockHeight, const VkFormat format)
+{
+	switch (format)
+	{
+		case VK_FORMAT_ASTC_5x4_UNORM_BLOCK:
+			blockWidth = 5;
+			blockHeight = 4;
+			return;
+		case VK_FORMAT_ASTC_5x5_UNORM_BLOCK:
+			blockWidth = 5;
+			blockHeight = 5;
+			return;
+		case VK_FORMAT_ASTC_6x5_UNORM_BLOCK:
+			blockWidth = 6;
+			blockHeight = 5;
+			return;
+		case VK_FORMAT_ASTC_6x6_UNORM_BLOCK:
+			blockWidth = 6;
+			blockHeight = 6;
+			return;
+		case VK_FORMAT_ASTC_8x5_UNORM_BLOCK:
+			blockWidth = 8;
+			blockHeight = 5;
+			return;
+		case VK_FORMAT_ASTC_8x6_UNORM_BLOCK:
+			blockWidth = 8;
+			blockHeight = 6;
+			return;
+		case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
+			blockWidth = 8;
+			blockHeight = 8;
+			return;
+		case VK_FORMAT_ASTC_10x5_UNORM_BLOCK:
+			blockWidth = 10;
+			blockHeight = 5;
+			return;
+		case VK_FORMAT_ASTC_10x6_UNORM_BLOCK:
+			blockWidth = 10;
+			blockHeight = 6;
+			return;
+		case VK_FORMAT_ASTC_10x8_UNORM_BLOCK:
+			blockWidth = 10;
+			blockHeight = 8;
+			return;
+		case VK_FORMAT_ASTC_10x10_UNORM_BLOCK:
+			blockWidth = 10;
+			blockHeight = 10;
+			return;
+		case VK_FORMAT_ASTC_12x10_UNORM_BLOCK:
+			blockWidth = 12;
+			blockHeight = 10;
+			return;
+		case VK_FORMAT_ASTC_12x12_UNORM_BLOCK:
+			blockWidth = 12;
+			blockHeight = 12;
+			return;
+		default:
+			break;
+	}
+
+	if (imageDataIsBLOCK(format))
+	{
+		// BC, ETC2 and EAC.
+		blockWidth = 4;
+		blockHeight = 4;
+
+		return;
+	}
+
+	blockWidth = 1;
+	blockHeight = 1;
+}
+
+static VkBool32 imageDataPackedIsValidHeader(const PackedHeader& header)
+{
+	if (header.width == 0 || header.height == 0 || header.depth == 0 || header.mipLevels == 0 || header.arrayLayers == 0 || header.payloadSize == 0)
+	{
+		return VK_FALSE;
+	}
+
+	// Only formats, which can be sized, are accepted.
+	if (imageDataGetBytesPerTexel((VkFormat)header.format) == 0)
+	{
+		return VK_FALSE;
+	}
+
+	switch ((VkImageType)header.imageType)
+	{
+		case VK_IMAGE_TYPE_1D:
+			if (header.height != 1 || header.depth != 1)
+			{
+				return VK_FALSE;
+			}
+			break;
+		case VK_IMAGE_TYPE_2D:
+			if (header.depth != 1)
+			{
+				return VK_FALSE;
+			}
+			break;
+		case VK_IMAGE_TYPE_3D:
+			if (header.arrayLayers != 1)
+			{
+				return VK_FALSE;
+			}
+			break;
+		default:
+			return VK_FALSE;
+	}
+
+	uint32_t maxExtent = glm::max(header.width, glm::max(header.height, header.depth));
+
+	uint32_t maxMipLevels = 1;
+
+	while (maxExtent > 1)
+	{
+		maxExtent >>= 1;
+
+		maxMipLevels++;
+	}
+
+	if (header.mipLevels > maxMipLevels)
+	{
+		return VK_FALSE;
+	}
+
+	return VK_TRUE;
+}
+
+IImageDataSP VKTS_APIENTRY imageDataLoadPacked(const std::string& name, const IBinaryBufferSP& buffer)
+{
+	if (!buffer.get() || !buffer->getByteData() || buffer->getSize() < (uint32_t)sizeof(PackedHeader))
+	{
+		return IImageDataSP();
+	}
+
+	PackedHeader header;
+
+	memcpy(&header, buffer->getByteData(), sizeof(PackedHeader));
+
+	if (memcmp(header.identifier, g_packedIdentifier, VKTS_PACKED_IDENTIFIER_SIZE) != 0)
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No packed image '%s'", name.c_str());
+
+		return IImageDataSP();
+	}
+
+	if (!imageDataPackedIsValidHeader(header))
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Invalid packed image '%s'", name.c_str());
+
+		return IImageDataSP();
+	}
+
+	uint64_t subresourceCount = (uint64_t)header.mipLevels * (uint64_t)header.arrayLayers;
+
+	if ((uint64_t)sizeof(PackedHeader) + subresourceCount * sizeof(uint32_t) > (uint64_t)header.payloadOffset || (uint64_t)header.payloadOffset + (uint64_t)header.payloadSize > (uint64_t)buffer->getSize())
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Truncated packed image '%s'", name.c_str());
+
+		return IImageDataSP();
+	}
+
+	std::vector<uint32_t> allOffsets((size_t)subresourceCount);
+
+	memcpy(&allOffsets[0], buffer->getByteData() + sizeof(PackedHeader), allOffsets.size() * sizeof(uint32_t));
+
+	const VkFormat format = (VkFormat)header.format;
+
+	const uint64_t bytesPerTexel = (uint64_t)imageDataGetBytesPerTexel(format);
+
+	uint32_t blockWidth;
+	uint32_t blockHeight;
+
+	imageDataPackedGetBlockExtent(blockWidth, blockHeight, format);
+
+	// Every sub resource has to fit completely into the payload.
+	for (uint32_t arrayLayer = 0; arrayLayer < header.arrayLayers; arrayLayer++)
+	{
+		for (uint32_t mipLevel = 0; mipLevel < header.mipLevels; mipLevel++)
+		{
+			uint64_t width = (uint64_t)glm::max(header.width >> mipLevel, 1u);
+			uint64_t height = (uint64_t)glm::max(header.height >> mipLevel, 1u);
+			uint64_t depth = (uint64_t)glm::max(header.depth >> mipLevel, 1u);
+
+			uint64_t levelSize = ((width + blockWidth - 1) / blockWidth) * ((height + blockHeight - 1) / blockHeight) * depth * bytesPerTexel;
+
+			if ((uint64_t)allOffsets[arrayLayer * header.mipLevels + mipLevel] + levelSize > (uint64_t)header.payloadSize)
+			{
+				logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Truncated packed image '%s'", name.c_str());
+
+				return IImageDataSP();
+			}
+		}
+	}
+
+	// Texels are not copied, the payload references the given buffer.
+	auto payload = binaryBufferCreate(buffer, header.payloadOffset, header.payloadSize);
+
+	if (!payload.get())
+	{
+		return IImageDataSP();
+	}
+
+	VkExtent3D extent = {header.width, header.height, header.depth};
+
+	// The payload can be a read only mapped file, so it is copied before any texel is written.
+	return IImageDataSP(new ImageData(name, (VkImageType)header.imageType, format, extent, header.mipLevels, header.arrayLayers, allOffsets, payload, header.maxLuminance, VK_TRUE));
+}
+
+VkBool32 VKTS_APIENTRY imageDataSavePacked(const std::string& name, const IImageDataSP& imageData)
+{
+	if (!imageData.get() || !imageData->getByteData() || imageData->getSize() == 0)
+	{
+		return VK_FALSE;
+	}
+
+	const auto& allOffsets = imageData->getAllOffsets();
+
+	if (allOffsets.size() != imageData->getMipLevels() * imageData->getArrayLayers())
+	{
+		return VK_FALSE;
+	}
+
+	PackedHeader header;
+
+	memcpy(header.identifier, g_packedIdentifier, VKTS_PACKED_IDENTIFIER_SIZE);
+	header.format = (uint32_t)imageData->getFormat();
+	header.imageType = (uint32_t)imageData->getImageType();
+	header.width = imageData->getWidth();
+	header.height = imageData->getHeight();
+	header.depth = imageData->getDepth();
+	header.mipLevels = imageData->getMipLevels();
+	header.arrayLayers = imageData->getArrayLayers();
+	header.maxLuminance = imageData->getMaxLuminance();
+
+	// Aligned, so texels can be accessed directly from the mapped file.
+	uint32_t offsetsEnd = (uint32_t)(sizeof(PackedHeader) + allOffsets.size() * sizeof(uint32_t));
+
+	header.payloadOffset = (offsetsEnd + VKTS_PACKED_PAYLOAD_ALIGNMENT - 1) & ~(VKTS_PACKED_PAYLOAD_ALIGNMENT - 1);
+	header.payloadSize = imageData->getSize();
+
+	auto buffer = binaryBufferCreate(header.payloadOffset + header.payloadSize);
+
+	if (!buffer.get())
+	{
+		return VK_FALSE;
+	}
+
+	if (buffer->write(&header, sizeof(PackedHeader), 1) != 1)
+	{
+		return VK_FALSE;
+	}
+
+	if (buffer->write(&allOffsets[0], sizeof(uint32_t), (uint32_t)allOffsets.size()) != (uint32_t)allOffsets.size())
+	{
+		return VK_FALSE;
+	}
+
+	if (!buffer->seek(header.payloadOffset, VKTS_SEARCH_ABSOLUTE))
+	{
+		return VK_FALSE;
+	}
+
+	if (buffer->write(imageData->getByteData(), 1, header.payloadSize) != header.payloadSize)
+	{
+		return VK_FALSE;
+	}
+
+	return fileSaveBinary(name.c_str(), buffer);
+}
+
+}
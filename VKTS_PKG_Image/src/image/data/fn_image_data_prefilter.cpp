@@ -26,6 +26,8 @@
 
 #include <vkts/image/vkts_image.hpp>
 
+#include "ImageDataPrefilter.hpp"
+
 namespace vkts
 {
 
@@ -136,6 +138,8 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterCookTorrance(co
     // Cook torrance specular.
     //
 
+    ImageDataPrefilter imageDataPrefilter(ImageDataPrefilterType_CookTorrance, sourceImage, samples);
+
     uint32_t roughnessSamples = result.size() / 6;
 
     for (uint32_t side = 0; side < 6; side++)
@@ -144,60 +148,17 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterCookTorrance(co
     	{
     		uint32_t length = sourceImage->getWidth() / (1 << roughnessSampleIndex);
 
-    		// 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-    		float step = 2.0f / (float)length;
-    		float offset = step * 0.5f;
-
-    		//
-
     		float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
 
-    		//
-
-    		glm::vec3 scanVector;
-
-    		for (uint32_t y = 0; y < length; y++)
-    		{
-    			for (uint32_t x = 0; x < length; x++)
-    			{
-    				scanVector = imageDataGetScanVector(x, y, side, step, offset);
-
-    				//
-
-    				glm::mat3 basis = renderGetBasis(scanVector);
-
-    				glm::vec3 colorCookTorrance = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    				float sampleDivisior = 0.0f;
-
-    				for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    				{
-    					glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
-
-    					// N = V
-    					auto currentColorCookTorrance = renderCookTorrance(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, roughness);
-
-    					if (!std::isnan(currentColorCookTorrance.x) && !std::isnan(currentColorCookTorrance.y) && !std::isnan(currentColorCookTorrance.z))
-    					{
-    						colorCookTorrance += currentColorCookTorrance;
-
-    						sampleDivisior += 1.0f;
-    					}
-    				}
-
-    				//
-
-    				if (sampleDivisior > 0.0f)
-    				{
-    					colorCookTorrance = colorCookTorrance / sampleDivisior;
-    				}
-
-    				result[side * roughnessSamples + roughnessSampleIndex]->setTexel(glm::vec4(colorCookTorrance, 1.0f), x, y, 0, 0, 0);
-    			}
-    		}
+    		imageDataPrefilter.addTarget(result[side * roughnessSamples + roughnessSampleIndex], side, roughness, length);
     	}
     }
 
+    if (!imageDataPrefilter.prefilter())
+    {
+    	return SmartPointerVector<IImageDataSP>();
+    }
+
     //
 
     return result;
@@ -259,65 +220,28 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterOrenNayar(const
     // Oren-Nayar diffuse.
     //
 
+    ImageDataPrefilter imageDataPrefilter(ImageDataPrefilterType_OrenNayar, sourceImage, samples);
+
     uint32_t roughnessSamples = result.size() / 6;
 
+    // All levels are scanned with the length of the source.
     uint32_t length = sourceImage->getWidth();
 
-    // 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-	float step = 2.0f / (float)length;
-	float offset = step * 0.5f;
-
     for (uint32_t side = 0; side < 6; side++)
     {
-    	glm::vec3 scanVector;
-
-    	for (uint32_t y = 0; y < length; y++)
+    	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
     	{
-    		for (uint32_t x = 0; x < length; x++)
-    		{
-    			scanVector = imageDataGetScanVector(x, y, side, step, offset);
-
-    			//
-
-    			glm::mat3 basis = renderGetBasis(scanVector);
-
-    			for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
-    			{
-    				glm::vec3 colorOrenNayar = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    				float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
-
-    				float sampleDivisior = 0.0f;
-
-    				for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    				{
-    					glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
-
-    					// N = V
-    					auto currentColorOrenNayar = renderOrenNayar(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, scanVector, roughness);
-
-    					if (!std::isnan(currentColorOrenNayar.x) && !std::isnan(currentColorOrenNayar.y) && !std::isnan(currentColorOrenNayar.z))
-    					{
-    						colorOrenNayar += currentColorOrenNayar;
-
-    						sampleDivisior += 1.0f;
-    					}
-
-    				}
-
-    				//
-
-    				if (sampleDivisior > 0.0f)
-    				{
-    					colorOrenNayar = colorOrenNayar / sampleDivisior;
-    				}
+    		float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
 
-    				result[side * roughnessSamples + roughnessSampleIndex]->setTexel(glm::vec4(colorOrenNayar, 1.0f), x, y, 0, 0, 0);
-    			}
-    		}
+    		imageDataPrefilter.addTarget(result[side * roughnessSamples + roughnessSampleIndex], side, roughness, length);
     	}
     }
 
+    if (!imageDataPrefilter.prefilter())
+    {
+    	return SmartPointerVector<IImageDataSP>();
+    }
+
     //
 
     return result;
@@ -366,54 +290,18 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterLambert(const I
     // Lambert diffuse.
     //
 
-    uint32_t length = sourceImage->getWidth();
+    ImageDataPrefilter imageDataPrefilter(ImageDataPrefilterType_Lambert, sourceImage, samples);
 
-    // 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-	float step = 2.0f / (float)length;
-	float offset = step * 0.5f;
+    uint32_t length = sourceImage->getWidth();
 
     for (uint32_t side = 0; side < 6; side++)
     {
-    	glm::vec3 scanVector;
-
-    	for (uint32_t y = 0; y < length; y++)
-    	{
-    		for (uint32_t x = 0; x < length; x++)
-    		{
-    			scanVector = imageDataGetScanVector(x, y, side, step, offset);
-
-    			//
-
-    			glm::mat3 basis = renderGetBasis(scanVector);
-
-    			glm::vec3 colorLambert = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    			float sampleDivisior = 0.0f;
-
-    			for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    			{
-    				glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
-
-    				auto currentColorLambert = renderLambert(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis);
-
-    				if (!std::isnan(currentColorLambert.x) && !std::isnan(currentColorLambert.y) && !std::isnan(currentColorLambert.z))
-    				{
-    					colorLambert += currentColorLambert;
-
-    					sampleDivisior += 1.0f;
-    				}
-    			}
-
-    			//
-
-    			if (sampleDivisior > 0.0f)
-    			{
-    				colorLambert = colorLambert / sampleDivisior;
-    			}
+    	imageDataPrefilter.addTarget(result[side], side, 0.0f, length);
+    }
 
-    			result[side]->setTexel(glm::vec4(colorLambert, 1.0f), x, y, 0, 0, 0);
-    		}
-    	}
+    if (!imageDataPrefilter.prefilter())
+    {
+    	return SmartPointerVector<IImageDataSP>();
     }
 
     //
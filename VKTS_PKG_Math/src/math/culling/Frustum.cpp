@@ -26,6 +26,28 @@
 
 #include <vkts/math/vkts_math.hpp>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_FRUSTUM_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX is always compiled on x86, but only used, if the processor supports it.
+
+#if defined(VKTS_FRUSTUM_SSE2) && defined(_MSC_VER)
+#define VKTS_FRUSTUM_AVX
+#define VKTS_FRUSTUM_TARGET_AVX
+#include <immintrin.h>
+#elif defined(VKTS_FRUSTUM_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define VKTS_FRUSTUM_AVX
+#define VKTS_FRUSTUM_TARGET_AVX __attribute__((target("avx")))
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define VKTS_FRUSTUM_NEON
+#include <arm_neon.h>
+#endif
+
 namespace vkts
 {
 
@@ -35,7 +57,7 @@ namespace vkts
 const Plane Frustum::sidesNDC[6] = {Plane(glm::vec3(1.0f, 0.0f, 0.0f), 1.0f), Plane(glm::vec3(-1.0f, 0.0f, 0.0f), 1.0f), Plane(glm::vec3(0.0f, -1.0f, 0.0f), 1.0f), Plane(glm::vec3(0.0f, 1.0f, 0.0f), 1.0f), Plane(glm::vec3(0.0f, 0.0f, 1.0f), 0.0f), Plane(glm::vec3(0.0f, 0.0f, -1.0f), 1.0f)};
 
 Frustum::Frustum(const glm::mat4& projectionMatrix, const glm::mat4& viewMatrix) :
-	sidesWorld()
+	sidesWorld(), planesX(), planesY(), planesZ(), planesD()
 {
 	toWorldSpace(projectionMatrix, viewMatrix);
 }
@@ -51,7 +73,261 @@ void Frustum::toWorldSpace(const glm::mat4& projectionMatrix, const glm::mat4& v
 	for (int32_t i = 0; i < 6; i++)
 	{
 		sidesWorld[i] = transposedViewProjectionMatrix * sidesNDC[i];
+
+		planesX[i] = sidesWorld[i].getNormal().x;
+		planesY[i] = sidesWorld[i].getNormal().y;
+		planesZ[i] = sidesWorld[i].getNormal().z;
+		planesD[i] = sidesWorld[i].getD();
+	}
+
+	for (int32_t i = 6; i < 8; i++)
+	{
+		planesX[i] = 0.0f;
+		planesY[i] = 0.0f;
+		planesZ[i] = 0.0f;
+		planesD[i] = 1.0f;
+	}
+}
+
+uint32_t Frustum::testPlanes(const float centerX, const float centerY, const float centerZ, const float extentX, const float extentY, const float extentZ, const float radius, uint32_t& planeMask) const
+{
+	// Returns the planes, the volume is outside of. The planes containing the volume are removed from the mask.
+
+	uint32_t outsideMask = 0;
+	uint32_t insideMask = 0;
+
+#ifdef VKTS_FRUSTUM_SSE2
+	const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	const __m128 zero = _mm_setzero_ps();
+
+	const __m128 cx = _mm_set1_ps(centerX);
+	const __m128 cy = _mm_set1_ps(centerY);
+	const __m128 cz = _mm_set1_ps(centerZ);
+
+	const __m128 ex = _mm_set1_ps(extentX);
+	const __m128 ey = _mm_set1_ps(extentY);
+	const __m128 ez = _mm_set1_ps(extentZ);
+
+	const __m128 r = _mm_set1_ps(radius);
+
+	for (uint32_t i = 0; i < 8; i += 4)
+	{
+		__m128 px = _mm_loadu_ps(&planesX[i]);
+		__m128 py = _mm_loadu_ps(&planesY[i]);
+		__m128 pz = _mm_loadu_ps(&planesZ[i]);
+
+		__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, cx), _mm_mul_ps(py, cy)), _mm_add_ps(_mm_mul_ps(pz, cz), _mm_loadu_ps(&planesD[i])));
+
+		// Projected extent of the box onto the plane normal plus the sphere radius.
+
+		__m128 projected = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(px, signMask), ex), _mm_mul_ps(_mm_and_ps(py, signMask), ey)), _mm_add_ps(_mm_mul_ps(_mm_and_ps(pz, signMask), ez), r));
+
+		outsideMask |= (uint32_t)_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, projected), zero)) << i;
+		insideMask |= (uint32_t)_mm_movemask_ps(_mm_cmpge_ps(_mm_sub_ps(distance, projected), zero)) << i;
 	}
+#else
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		float distance = planesX[i] * centerX + planesY[i] * centerY + planesZ[i] * centerZ + planesD[i];
+
+		float projected = fabsf(planesX[i]) * extentX + fabsf(planesY[i]) * extentY + fabsf(planesZ[i]) * extentZ + radius;
+
+		if (distance + projected < 0.0f)
+		{
+			outsideMask |= 1 << i;
+		}
+		else if (distance - projected >= 0.0f)
+		{
+			insideMask |= 1 << i;
+		}
+	}
+#endif
+
+	outsideMask &= planeMask;
+
+	planeMask &= ~insideMask;
+
+	return outsideMask;
+}
+
+#ifdef VKTS_FRUSTUM_AVX
+
+VKTS_FRUSTUM_TARGET_AVX static uint32_t cullVolumesAvx(const float* planesX, const float* planesY, const float* planesZ, const float* planesD, const uint32_t* selectX, const uint32_t* selectY, const uint32_t* selectZ, const float* allX[2], const float* allY[2], const float* allZ[2], const float* allRadius, const uint32_t count, uint32_t& firstPlane, uint32_t* visibilityMask)
+{
+	const __m256 zero = _mm256_setzero_ps();
+
+	uint32_t index = 0;
+
+	for (; index + 8 <= count; index += 8)
+	{
+		const __m256 x[2] = {_mm256_loadu_ps(allX[0] + index), _mm256_loadu_ps(allX[1] + index)};
+		const __m256 y[2] = {_mm256_loadu_ps(allY[0] + index), _mm256_loadu_ps(allY[1] + index)};
+		const __m256 z[2] = {_mm256_loadu_ps(allZ[0] + index), _mm256_loadu_ps(allZ[1] + index)};
+
+		const __m256 radius = allRadius ? _mm256_loadu_ps(allRadius + index) : zero;
+
+		uint32_t visible = 0xFF;
+
+		for (uint32_t i = 0; i < 6 && visible; i++)
+		{
+			const uint32_t plane = (firstPlane + i) % 6;
+
+			__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planesX[plane]), x[selectX[plane]]), _mm256_mul_ps(_mm256_set1_ps(planesY[plane]), y[selectY[plane]])), _mm256_mul_ps(_mm256_set1_ps(planesZ[plane]), z[selectZ[plane]])), _mm256_set1_ps(planesD[plane]));
+
+			visible &= ~(uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_LT_OQ));
+
+			if (!visible)
+			{
+				firstPlane = plane;
+			}
+		}
+
+		visibilityMask[index / 32] |= visible << (index % 32);
+	}
+
+	return index;
+}
+
+#endif
+
+uint32_t Frustum::cullVolumes(const float* allX[2], const float* allY[2], const float* allZ[2], const float* allRadius, const uint32_t count, uint32_t* visibilityMask) const
+{
+	// Per plane, the maximum is selected for a positive and the minimum for a negative normal component.
+	// The volume is outside, if this corner is outside. Spheres pass their center as minimum and maximum.
+
+	uint32_t selectX[6];
+	uint32_t selectY[6];
+	uint32_t selectZ[6];
+
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		selectX[i] = planesX[i] >= 0.0f ? 1 : 0;
+		selectY[i] = planesY[i] >= 0.0f ? 1 : 0;
+		selectZ[i] = planesZ[i] >= 0.0f ? 1 : 0;
+	}
+
+	for (uint32_t i = 0; i < (count + 31) / 32; i++)
+	{
+		visibilityMask[i] = 0;
+	}
+
+	uint32_t firstPlane = 0;
+
+	uint32_t index = 0;
+
+#ifdef VKTS_FRUSTUM_AVX
+	if (processorGetFeatures() & VKTS_PROCESSOR_FEATURE_AVX)
+	{
+		index = cullVolumesAvx(planesX, planesY, planesZ, planesD, selectX, selectY, selectZ, allX, allY, allZ, allRadius, count, firstPlane, visibilityMask);
+	}
+#endif
+
+#if defined(VKTS_FRUSTUM_SSE2)
+	const __m128 zero = _mm_setzero_ps();
+
+	for (; index + 4 <= count; index += 4)
+	{
+		const __m128 x[2] = {_mm_loadu_ps(allX[0] + index), _mm_loadu_ps(allX[1] + index)};
+		const __m128 y[2] = {_mm_loadu_ps(allY[0] + index), _mm_loadu_ps(allY[1] + index)};
+		const __m128 z[2] = {_mm_loadu_ps(allZ[0] + index), _mm_loadu_ps(allZ[1] + index)};
+
+		const __m128 radius = allRadius ? _mm_loadu_ps(allRadius + index) : zero;
+
+		uint32_t visible = 0xF;
+
+		for (uint32_t i = 0; i < 6 && visible; i++)
+		{
+			const uint32_t plane = (firstPlane + i) % 6;
+
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planesX[plane]), x[selectX[plane]]), _mm_mul_ps(_mm_set1_ps(planesY[plane]), y[selectY[plane]])), _mm_mul_ps(_mm_set1_ps(planesZ[plane]), z[selectZ[plane]])), _mm_set1_ps(planesD[plane]));
+
+			visible &= ~(uint32_t)_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+
+			if (!visible)
+			{
+				firstPlane = plane;
+			}
+		}
+
+		visibilityMask[index / 32] |= visible << (index % 32);
+	}
+#elif defined(VKTS_FRUSTUM_NEON)
+	static const uint32_t laneBits[4] = {1, 2, 4, 8};
+
+	const uint32x4_t bits = vld1q_u32(laneBits);
+	const float32x4_t zero = vdupq_n_f32(0.0f);
+
+	for (; index + 4 <= count; index += 4)
+	{
+		const float32x4_t x[2] = {vld1q_f32(allX[0] + index), vld1q_f32(allX[1] + index)};
+		const float32x4_t y[2] = {vld1q_f32(allY[0] + index), vld1q_f32(allY[1] + index)};
+		const float32x4_t z[2] = {vld1q_f32(allZ[0] + index), vld1q_f32(allZ[1] + index)};
+
+		const float32x4_t radius = allRadius ? vld1q_f32(allRadius + index) : zero;
+
+		uint32_t visible = 0xF;
+
+		for (uint32_t i = 0; i < 6 && visible; i++)
+		{
+			const uint32_t plane = (firstPlane + i) % 6;
+
+			float32x4_t distance = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(vdupq_n_f32(planesX[plane]), x[selectX[plane]]), vmulq_f32(vdupq_n_f32(planesY[plane]), y[selectY[plane]])), vmulq_f32(vdupq_n_f32(planesZ[plane]), z[selectZ[plane]])), vdupq_n_f32(planesD[plane]));
+
+			// No movemask, so each lane contributes its bit.
+
+			const uint32x4_t outside = vandq_u32(vcltq_f32(vaddq_f32(distance, radius), zero), bits);
+			const uint32x2_t outsidePairs = vorr_u32(vget_low_u32(outside), vget_high_u32(outside));
+
+			visible &= ~(vget_lane_u32(outsidePairs, 0) | vget_lane_u32(outsidePairs, 1));
+
+			if (!visible)
+			{
+				firstPlane = plane;
+			}
+		}
+
+		visibilityMask[index / 32] |= visible << (index % 32);
+	}
+#endif
+
+	for (; index < count; index++)
+	{
+		const float radius = allRadius ? allRadius[index] : 0.0f;
+
+		uint32_t visible = 1;
+
+		for (uint32_t i = 0; i < 6 && visible; i++)
+		{
+			const uint32_t plane = (firstPlane + i) % 6;
+
+			const float distance = planesX[plane] * allX[selectX[plane]][index] + planesY[plane] * allY[selectY[plane]][index] + planesZ[plane] * allZ[selectZ[plane]][index] + planesD[plane];
+
+			if (distance + radius < 0.0f)
+			{
+				visible = 0;
+
+				firstPlane = plane;
+			}
+		}
+
+		visibilityMask[index / 32] |= visible << (index % 32);
+	}
+
+	uint32_t visibleCount = 0;
+
+	for (uint32_t i = 0; i < (count + 31) / 32; i++)
+	{
+		uint32_t currentMask = visibilityMask[i];
+
+		while (currentMask)
+		{
+			currentMask &= currentMask - 1;
+
+			visibleCount++;
+		}
+	}
+
+	return visibleCount;
 }
 
 VkBool32 Frustum::isVisible(const glm::vec4& pointWorld) const
@@ -112,4 +388,52 @@ VkBool32 Frustum::isVisible(const Obb& obbWorld) const
 	return VK_TRUE;
 }
 
+VkBool32 Frustum::isVisible(const Sphere& sphereWorld, uint32_t& planeMask) const
+{
+	if (!planeMask)
+	{
+		return VK_TRUE;
+	}
+
+	const glm::vec4& center = sphereWorld.getCenter();
+
+	return testPlanes(center.x, center.y, center.z, 0.0f, 0.0f, 0.0f, sphereWorld.getRadius(), planeMask) == 0;
+}
+
+VkBool32 Frustum::isVisible(const glm::vec3& minimumWorld, const glm::vec3& maximumWorld, uint32_t& planeMask) const
+{
+	if (!planeMask)
+	{
+		return VK_TRUE;
+	}
+
+	glm::vec3 center = (maximumWorld + minimumWorld) * 0.5f;
+	glm::vec3 extent = (maximumWorld - minimumWorld) * 0.5f;
+
+	return testPlanes(center.x, center.y, center.z, extent.x, extent.y, extent.z, 0.0f, planeMask) == 0;
+}
+
+VkBool32 Frustum::isVisible(const Aabb& aabbWorld, uint32_t& planeMask) const
+{
+	return isVisible(glm::vec3(aabbWorld.getCorner(0)), glm::vec3(aabbWorld.getCorner(1)), planeMask);
+}
+
+uint32_t Frustum::cullSpheres(const float* centerX, const float* centerY, const float* centerZ, const float* radius, const uint32_t count, uint32_t* visibilityMask) const
+{
+	const float* allX[2] = {centerX, centerX};
+	const float* allY[2] = {centerY, centerY};
+	const float* allZ[2] = {centerZ, centerZ};
+
+	return cullVolumes(allX, allY, allZ, radius, count, visibilityMask);
+}
+
+uint32_t Frustum::cullAabbs(const float* minimumX, const float* minimumY, const float* minimumZ, const float* maximumX, const float* maximumY, const float* maximumZ, const uint32_t count, uint32_t* visibilityMask) const
+{
+	const float* allX[2] = {minimumX, maximumX};
+	const float* allY[2] = {minimumY, maximumY};
+	const float* allZ[2] = {minimumZ, maximumZ};
+
+	return cullVolumes(allX, allY, allZ, nullptr, count, visibilityMask);
+}
+
 } /* namespace vkts */
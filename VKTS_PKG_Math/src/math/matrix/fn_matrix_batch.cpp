@@ -0,0 +1,599 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/math/vkts_math.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_MATRIX_BATCH_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX is always compiled on x86, but only used, if the processor supports it.
+
+#if defined(VKTS_MATRIX_BATCH_SSE2) && defined(_MSC_VER)
+#define VKTS_MATRIX_BATCH_AVX
+#define VKTS_MATRIX_BATCH_TARGET_AVX
+#include <immintrin.h>
+#elif defined(VKTS_MATRIX_BATCH_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define VKTS_MATRIX_BATCH_AVX
+#define VKTS_MATRIX_BATCH_TARGET_AVX __attribute__((target("avx")))
+#include <immintrin.h>
+#endif
+
+#if !defined(VKTS_MATRIX_BATCH_SSE2) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define VKTS_MATRIX_BATCH_NEON
+#include <arm_neon.h>
+#endif
+
+namespace vkts
+{
+
+struct MatrixBatchTransforms
+{
+	const float* translateX;
+	const float* translateY;
+	const float* translateZ;
+	const float* rotateX;
+	const float* rotateY;
+	const float* rotateZ;
+	const float* rotateW;
+	const float* scaleX;
+	const float* scaleY;
+	const float* scaleZ;
+};
+
+//
+// Scalar.
+//
+
+static void composeMat4Scalar(const MatrixBatchTransforms& transforms, uint32_t index, const uint32_t count, glm::mat4* matrices)
+{
+	for (; index < count; index++)
+	{
+		const float x = transforms.rotateX[index];
+		const float y = transforms.rotateY[index];
+		const float z = transforms.rotateZ[index];
+		const float w = transforms.rotateW[index];
+
+		const float scaleX = transforms.scaleX[index];
+		const float scaleY = transforms.scaleY[index];
+		const float scaleZ = transforms.scaleZ[index];
+
+		glm::mat4& matrix = matrices[index];
+
+		// Same operations as Quat::mat3(), each column multiplied by its scale.
+
+		matrix[0][0] = (1.0f - 2.0f * y * y - 2.0f * z * z) * scaleX;
+		matrix[0][1] = (2.0f * x * y + 2.0f * w * z) * scaleX;
+		matrix[0][2] = (2.0f * x * z - 2.0f * w * y) * scaleX;
+		matrix[0][3] = 0.0f;
+
+		matrix[1][0] = (2.0f * x * y - 2.0f * w * z) * scaleY;
+		matrix[1][1] = (1.0f - 2.0f * x * x - 2.0f * z * z) * scaleY;
+		matrix[1][2] = (2.0f * y * z + 2.0f * w * x) * scaleY;
+		matrix[1][3] = 0.0f;
+
+		matrix[2][0] = (2.0f * x * z + 2.0f * w * y) * scaleZ;
+		matrix[2][1] = (2.0f * y * z - 2.0f * w * x) * scaleZ;
+		matrix[2][2] = (1.0f - 2.0f * x * x - 2.0f * y * y) * scaleZ;
+		matrix[2][3] = 0.0f;
+
+		matrix[3][0] = transforms.translateX[index];
+		matrix[3][1] = transforms.translateY[index];
+		matrix[3][2] = transforms.translateZ[index];
+		matrix[3][3] = 1.0f;
+	}
+}
+
+static void normalMat3Scalar(const glm::mat4* matrices, uint32_t index, const uint32_t count, glm::mat3* normalMatrices)
+{
+	for (; index < count; index++)
+	{
+		const glm::mat3 m(matrices[index]);
+
+		// Cofactors and determinant in the same order as glm::inverse(), stored transposed.
+
+		const float c00 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+		const float c01 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
+		const float c02 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+		const float c10 = m[0][1] * m[2][2] - m[2][1] * m[0][2];
+		const float c11 = m[0][0] * m[2][2] - m[2][0] * m[0][2];
+		const float c12 = m[0][0] * m[2][1] - m[2][0] * m[0][1];
+		const float c20 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+		const float c21 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+		const float c22 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+
+		const float oneOverDeterminant = 1.0f / (m[0][0] * c00 - m[1][0] * c10 + m[2][0] * c20);
+
+		glm::mat3& normalMatrix = normalMatrices[index];
+
+		normalMatrix[0][0] = c00 * oneOverDeterminant;
+		normalMatrix[0][1] = -c01 * oneOverDeterminant;
+		normalMatrix[0][2] = c02 * oneOverDeterminant;
+
+		normalMatrix[1][0] = -c10 * oneOverDeterminant;
+		normalMatrix[1][1] = c11 * oneOverDeterminant;
+		normalMatrix[1][2] = -c12 * oneOverDeterminant;
+
+		normalMatrix[2][0] = c20 * oneOverDeterminant;
+		normalMatrix[2][1] = -c21 * oneOverDeterminant;
+		normalMatrix[2][2] = c22 * oneOverDeterminant;
+	}
+}
+
+//
+// SSE2.
+//
+
+#ifdef VKTS_MATRIX_BATCH_SSE2
+
+// Transposes one column of four transforms from structure of arrays and stores it.
+
+static inline void storeColumnsSse2(__m128 x, __m128 y, __m128 z, __m128 w, glm::mat4* matrices, const uint32_t column)
+{
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+
+	_mm_storeu_ps(&matrices[0][column][0], x);
+	_mm_storeu_ps(&matrices[1][column][0], y);
+	_mm_storeu_ps(&matrices[2][column][0], z);
+	_mm_storeu_ps(&matrices[3][column][0], w);
+}
+
+static inline void loadColumnSse2(const glm::mat4* matrices, const uint32_t column, __m128& x, __m128& y, __m128& z)
+{
+	__m128 a = _mm_loadu_ps(&matrices[0][column][0]);
+	__m128 b = _mm_loadu_ps(&matrices[1][column][0]);
+	__m128 c = _mm_loadu_ps(&matrices[2][column][0]);
+	__m128 d = _mm_loadu_ps(&matrices[3][column][0]);
+
+	_MM_TRANSPOSE4_PS(a, b, c, d);
+
+	x = a;
+	y = b;
+	z = c;
+}
+
+// Four 3x3 matrices are 36 consecutive floats, so each matrix is written by two vector and one scalar store.
+
+static inline void storeMat3Sse2(const __m128* elements, glm::mat3* normalMatrices)
+{
+	__m128 a0 = elements[0];
+	__m128 a1 = elements[1];
+	__m128 a2 = elements[2];
+	__m128 a3 = elements[3];
+
+	__m128 b0 = elements[4];
+	__m128 b1 = elements[5];
+	__m128 b2 = elements[6];
+	__m128 b3 = elements[7];
+
+	_MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+	_MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+
+	const __m128 c = elements[8];
+
+	float* destination = &normalMatrices[0][0][0];
+
+	_mm_storeu_ps(destination, a0);
+	_mm_storeu_ps(destination + 4, b0);
+	_mm_store_ss(destination + 8, c);
+
+	_mm_storeu_ps(destination + 9, a1);
+	_mm_storeu_ps(destination + 13, b1);
+	_mm_store_ss(destination + 17, _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1)));
+
+	_mm_storeu_ps(destination + 18, a2);
+	_mm_storeu_ps(destination + 22, b2);
+	_mm_store_ss(destination + 26, _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2)));
+
+	_mm_storeu_ps(destination + 27, a3);
+	_mm_storeu_ps(destination + 31, b3);
+	_mm_store_ss(destination + 35, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3)));
+}
+
+static uint32_t composeMat4Sse2(const MatrixBatchTransforms& transforms, uint32_t index, const uint32_t count, glm::mat4* matrices)
+{
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 two = _mm_set1_ps(2.0f);
+
+	for (; index + 4 <= count; index += 4)
+	{
+		const __m128 x = _mm_loadu_ps(transforms.rotateX + index);
+		const __m128 y = _mm_loadu_ps(transforms.rotateY + index);
+		const __m128 z = _mm_loadu_ps(transforms.rotateZ + index);
+		const __m128 w = _mm_loadu_ps(transforms.rotateW + index);
+
+		const __m128 twoX = _mm_mul_ps(two, x);
+		const __m128 twoY = _mm_mul_ps(two, y);
+		const __m128 twoZ = _mm_mul_ps(two, z);
+		const __m128 twoW = _mm_mul_ps(two, w);
+
+		const __m128 scaleX = _mm_loadu_ps(transforms.scaleX + index);
+		const __m128 scaleY = _mm_loadu_ps(transforms.scaleY + index);
+		const __m128 scaleZ = _mm_loadu_ps(transforms.scaleZ + index);
+
+		storeColumnsSse2(_mm_mul_ps(_mm_sub_ps(_mm_sub_ps(one, _mm_mul_ps(twoY, y)), _mm_mul_ps(twoZ, z)), scaleX), _mm_mul_ps(_mm_add_ps(_mm_mul_ps(twoX, y), _mm_mul_ps(twoW, z)), scaleX), _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(twoX, z), _mm_mul_ps(twoW, y)), scaleX), zero, matrices + index, 0);
+		storeColumnsSse2(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(twoX, y), _mm_mul_ps(twoW, z)), scaleY), _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(one, _mm_mul_ps(twoX, x)), _mm_mul_ps(twoZ, z)), scaleY), _mm_mul_ps(_mm_add_ps(_mm_mul_ps(twoY, z), _mm_mul_ps(twoW, x)), scaleY), zero, matrices + index, 1);
+		storeColumnsSse2(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(twoX, z), _mm_mul_ps(twoW, y)), scaleZ), _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(twoY, z), _mm_mul_ps(twoW, x)), scaleZ), _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(one, _mm_mul_ps(twoX, x)), _mm_mul_ps(twoY, y)), scaleZ), zero, matrices + index, 2);
+		storeColumnsSse2(_mm_loadu_ps(transforms.translateX + index), _mm_loadu_ps(transforms.translateY + index), _mm_loadu_ps(transforms.translateZ + index), one, matrices + index, 3);
+	}
+
+	return index;
+}
+
+static uint32_t normalMat3Sse2(const glm::mat4* matrices, uint32_t index, const uint32_t count, glm::mat3* normalMatrices)
+{
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 sign = _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000));
+
+	for (; index + 4 <= count; index += 4)
+	{
+		__m128 m00, m01, m02, m10, m11, m12, m20, m21, m22;
+
+		loadColumnSse2(matrices + index, 0, m00, m01, m02);
+		loadColumnSse2(matrices + index, 1, m10, m11, m12);
+		loadColumnSse2(matrices + index, 2, m20, m21, m22);
+
+		const __m128 c00 = _mm_sub_ps(_mm_mul_ps(m11, m22), _mm_mul_ps(m21, m12));
+		const __m128 c01 = _mm_sub_ps(_mm_mul_ps(m10, m22), _mm_mul_ps(m20, m12));
+		const __m128 c02 = _mm_sub_ps(_mm_mul_ps(m10, m21), _mm_mul_ps(m20, m11));
+		const __m128 c10 = _mm_sub_ps(_mm_mul_ps(m01, m22), _mm_mul_ps(m21, m02));
+		const __m128 c11 = _mm_sub_ps(_mm_mul_ps(m00, m22), _mm_mul_ps(m20, m02));
+		const __m128 c12 = _mm_sub_ps(_mm_mul_ps(m00, m21), _mm_mul_ps(m20, m01));
+		const __m128 c20 = _mm_sub_ps(_mm_mul_ps(m01, m12), _mm_mul_ps(m11, m02));
+		const __m128 c21 = _mm_sub_ps(_mm_mul_ps(m00, m12), _mm_mul_ps(m10, m02));
+		const __m128 c22 = _mm_sub_ps(_mm_mul_ps(m00, m11), _mm_mul_ps(m10, m01));
+
+		const __m128 oneOverDeterminant = _mm_div_ps(one, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m00, c00), _mm_mul_ps(m10, c10)), _mm_mul_ps(m20, c20)));
+
+		const __m128 elements[9] = {
+			_mm_mul_ps(c00, oneOverDeterminant), _mm_mul_ps(_mm_xor_ps(c01, sign), oneOverDeterminant), _mm_mul_ps(c02, oneOverDeterminant),
+			_mm_mul_ps(_mm_xor_ps(c10, sign), oneOverDeterminant), _mm_mul_ps(c11, oneOverDeterminant), _mm_mul_ps(_mm_xor_ps(c12, sign), oneOverDeterminant),
+			_mm_mul_ps(c20, oneOverDeterminant), _mm_mul_ps(_mm_xor_ps(c21, sign), oneOverDeterminant), _mm_mul_ps(c22, oneOverDeterminant)
+		};
+
+		storeMat3Sse2(elements, normalMatrices + index);
+	}
+
+	return index;
+}
+
+#endif
+
+//
+// AVX.
+//
+
+#ifdef VKTS_MATRIX_BATCH_AVX
+
+VKTS_MATRIX_BATCH_TARGET_AVX static inline void storeColumnsAvx(const __m256 x, const __m256 y, const __m256 z, const __m256 w, glm::mat4* matrices, const uint32_t column)
+{
+	storeColumnsSse2(_mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z), _mm256_castps256_ps128(w), matrices, column);
+	storeColumnsSse2(_mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1), _mm256_extractf128_ps(w, 1), matrices + 4, column);
+}
+
+VKTS_MATRIX_BATCH_TARGET_AVX static inline void loadColumnAvx(const glm::mat4* matrices, const uint32_t column, __m256& x, __m256& y, __m256& z)
+{
+	__m128 lowX, lowY, lowZ, highX, highY, highZ;
+
+	loadColumnSse2(matrices, column, lowX, lowY, lowZ);
+	loadColumnSse2(matrices + 4, column, highX, highY, highZ);
+
+	x = _mm256_insertf128_ps(_mm256_castps128_ps256(lowX), highX, 1);
+	y = _mm256_insertf128_ps(_mm256_castps128_ps256(lowY), highY, 1);
+	z = _mm256_insertf128_ps(_mm256_castps128_ps256(lowZ), highZ, 1);
+}
+
+VKTS_MATRIX_BATCH_TARGET_AVX static inline void storeMat3Avx(const __m256* elements, glm::mat3* normalMatrices)
+{
+	__m128 lowElements[9];
+	__m128 highElements[9];
+
+	for (uint32_t i = 0; i < 9; i++)
+	{
+		lowElements[i] = _mm256_castps256_ps128(elements[i]);
+		highElements[i] = _mm256_extractf128_ps(elements[i], 1);
+	}
+
+	storeMat3Sse2(lowElements, normalMatrices);
+	storeMat3Sse2(highElements, normalMatrices + 4);
+}
+
+VKTS_MATRIX_BATCH_TARGET_AVX static uint32_t composeMat4Avx(const MatrixBatchTransforms& transforms, uint32_t index, const uint32_t count, glm::mat4* matrices)
+{
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 two = _mm256_set1_ps(2.0f);
+
+	for (; index + 8 <= count; index += 8)
+	{
+		const __m256 x = _mm256_loadu_ps(transforms.rotateX + index);
+		const __m256 y = _mm256_loadu_ps(transforms.rotateY + index);
+		const __m256 z = _mm256_loadu_ps(transforms.rotateZ + index);
+		const __m256 w = _mm256_loadu_ps(transforms.rotateW + index);
+
+		const __m256 twoX = _mm256_mul_ps(two, x);
+		const __m256 twoY = _mm256_mul_ps(two, y);
+		const __m256 twoZ = _mm256_mul_ps(two, z);
+		const __m256 twoW = _mm256_mul_ps(two, w);
+
+		const __m256 scaleX = _mm256_loadu_ps(transforms.scaleX + index);
+		const __m256 scaleY = _mm256_loadu_ps(transforms.scaleY + index);
+		const __m256 scaleZ = _mm256_loadu_ps(transforms.scaleZ + index);
+
+		storeColumnsAvx(_mm256_mul_ps(_mm256_sub_ps(_mm256_sub_ps(one, _mm256_mul_ps(twoY, y)), _mm256_mul_ps(twoZ, z)), scaleX), _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(twoX, y), _mm256_mul_ps(twoW, z)), scaleX), _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(twoX, z), _mm256_mul_ps(twoW, y)), scaleX), zero, matrices + index, 0);
+		storeColumnsAvx(_mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(twoX, y), _mm256_mul_ps(twoW, z)), scaleY), _mm256_mul_ps(_mm256_sub_ps(_mm256_sub_ps(one, _mm256_mul_ps(twoX, x)), _mm256_mul_ps(twoZ, z)), scaleY), _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(twoY, z), _mm256_mul_ps(twoW, x)), scaleY), zero, matrices + index, 1);
+		storeColumnsAvx(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(twoX, z), _mm256_mul_ps(twoW, y)), scaleZ), _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(twoY, z), _mm256_mul_ps(twoW, x)), scaleZ), _mm256_mul_ps(_mm256_sub_ps(_mm256_sub_ps(one, _mm256_mul_ps(twoX, x)), _mm256_mul_ps(twoY, y)), scaleZ), zero, matrices + index, 2);
+		storeColumnsAvx(_mm256_loadu_ps(transforms.translateX + index), _mm256_loadu_ps(transforms.translateY + index), _mm256_loadu_ps(transforms.translateZ + index), one, matrices + index, 3);
+	}
+
+	_mm256_zeroupper();
+
+	return index;
+}
+
+VKTS_MATRIX_BATCH_TARGET_AVX static uint32_t normalMat3Avx(const glm::mat4* matrices, uint32_t index, const uint32_t count, glm::mat3* normalMatrices)
+{
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 sign = _mm256_set1_ps(-0.0f);
+
+	for (; index + 8 <= count; index += 8)
+	{
+		__m256 m00, m01, m02, m10, m11, m12, m20, m21, m22;
+
+		loadColumnAvx(matrices + index, 0, m00, m01, m02);
+		loadColumnAvx(matrices + index, 1, m10, m11, m12);
+		loadColumnAvx(matrices + index, 2, m20, m21, m22);
+
+		const __m256 c00 = _mm256_sub_ps(_mm256_mul_ps(m11, m22), _mm256_mul_ps(m21, m12));
+		const __m256 c01 = _mm256_sub_ps(_mm256_mul_ps(m10, m22), _mm256_mul_ps(m20, m12));
+		const __m256 c02 = _mm256_sub_ps(_mm256_mul_ps(m10, m21), _mm256_mul_ps(m20, m11));
+		const __m256 c10 = _mm256_sub_ps(_mm256_mul_ps(m01, m22), _mm256_mul_ps(m21, m02));
+		const __m256 c11 = _mm256_sub_ps(_mm256_mul_ps(m00, m22), _mm256_mul_ps(m20, m02));
+		const __m256 c12 = _mm256_sub_ps(_mm256_mul_ps(m00, m21), _mm256_mul_ps(m20, m01));
+		const __m256 c20 = _mm256_sub_ps(_mm256_mul_ps(m01, m12), _mm256_mul_ps(m11, m02));
+		const __m256 c21 = _mm256_sub_ps(_mm256_mul_ps(m00, m12), _mm256_mul_ps(m10, m02));
+		const __m256 c22 = _mm256_sub_ps(_mm256_mul_ps(m00, m11), _mm256_mul_ps(m10, m01));
+
+		const __m256 oneOverDeterminant = _mm256_div_ps(one, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m00, c00), _mm256_mul_ps(m10, c10)), _mm256_mul_ps(m20, c20)));
+
+		const __m256 elements[9] = {
+			_mm256_mul_ps(c00, oneOverDeterminant), _mm256_mul_ps(_mm256_xor_ps(c01, sign), oneOverDeterminant), _mm256_mul_ps(c02, oneOverDeterminant),
+			_mm256_mul_ps(_mm256_xor_ps(c10, sign), oneOverDeterminant), _mm256_mul_ps(c11, oneOverDeterminant), _mm256_mul_ps(_mm256_xor_ps(c12, sign), oneOverDeterminant),
+			_mm256_mul_ps(c20, oneOverDeterminant), _mm256_mul_ps(_mm256_xor_ps(c21, sign), oneOverDeterminant), _mm256_mul_ps(c22, oneOverDeterminant)
+		};
+
+		storeMat3Avx(elements, normalMatrices + index);
+	}
+
+	_mm256_zeroupper();
+
+	return index;
+}
+
+#endif
+
+//
+// NEON.
+//
+
+#ifdef VKTS_MATRIX_BATCH_NEON
+
+static inline void transposeNeon(float32x4_t& a, float32x4_t& b, float32x4_t& c, float32x4_t& d)
+{
+	const float32x4x2_t ab = vtrnq_f32(a, b);
+	const float32x4x2_t cd = vtrnq_f32(c, d);
+
+	a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+	b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+	c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+	d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+}
+
+static inline void storeColumnsNeon(float32x4_t x, float32x4_t y, float32x4_t z, float32x4_t w, glm::mat4* matrices, const uint32_t column)
+{
+	transposeNeon(x, y, z, w);
+
+	vst1q_f32(&matrices[0][column][0], x);
+	vst1q_f32(&matrices[1][column][0], y);
+	vst1q_f32(&matrices[2][column][0], z);
+	vst1q_f32(&matrices[3][column][0], w);
+}
+
+static inline void loadColumnNeon(const glm::mat4* matrices, const uint32_t column, float32x4_t& x, float32x4_t& y, float32x4_t& z)
+{
+	float32x4_t a = vld1q_f32(&matrices[0][column][0]);
+	float32x4_t b = vld1q_f32(&matrices[1][column][0]);
+	float32x4_t c = vld1q_f32(&matrices[2][column][0]);
+	float32x4_t d = vld1q_f32(&matrices[3][column][0]);
+
+	transposeNeon(a, b, c, d);
+
+	x = a;
+	y = b;
+	z = c;
+}
+
+static inline void storeMat3Neon(const float32x4_t* elements, glm::mat3* normalMatrices)
+{
+	float32x4_t a0 = elements[0];
+	float32x4_t a1 = elements[1];
+	float32x4_t a2 = elements[2];
+	float32x4_t a3 = elements[3];
+
+	float32x4_t b0 = elements[4];
+	float32x4_t b1 = elements[5];
+	float32x4_t b2 = elements[6];
+	float32x4_t b3 = elements[7];
+
+	transposeNeon(a0, a1, a2, a3);
+	transposeNeon(b0, b1, b2, b3);
+
+	const float32x4_t c = elements[8];
+
+	float* destination = &normalMatrices[0][0][0];
+
+	vst1q_f32(destination, a0);
+	vst1q_f32(destination + 4, b0);
+	vst1q_lane_f32(destination + 8, c, 0);
+
+	vst1q_f32(destination + 9, a1);
+	vst1q_f32(destination + 13, b1);
+	vst1q_lane_f32(destination + 17, c, 1);
+
+	vst1q_f32(destination + 18, a2);
+	vst1q_f32(destination + 22, b2);
+	vst1q_lane_f32(destination + 26, c, 2);
+
+	vst1q_f32(destination + 27, a3);
+	vst1q_f32(destination + 31, b3);
+	vst1q_lane_f32(destination + 35, c, 3);
+}
+
+static uint32_t composeMat4Neon(const MatrixBatchTransforms& transforms, uint32_t index, const uint32_t count, glm::mat4* matrices)
+{
+	const float32x4_t zero = vdupq_n_f32(0.0f);
+	const float32x4_t one = vdupq_n_f32(1.0f);
+	const float32x4_t two = vdupq_n_f32(2.0f);
+
+	for (; index + 4 <= count; index += 4)
+	{
+		const float32x4_t x = vld1q_f32(transforms.rotateX + index);
+		const float32x4_t y = vld1q_f32(transforms.rotateY + index);
+		const float32x4_t z = vld1q_f32(transforms.rotateZ + index);
+		const float32x4_t w = vld1q_f32(transforms.rotateW + index);
+
+		const float32x4_t twoX = vmulq_f32(two, x);
+		const float32x4_t twoY = vmulq_f32(two, y);
+		const float32x4_t twoZ = vmulq_f32(two, z);
+		const float32x4_t twoW = vmulq_f32(two, w);
+
+		const float32x4_t scaleX = vld1q_f32(transforms.scaleX + index);
+		const float32x4_t scaleY = vld1q_f32(transforms.scaleY + index);
+		const float32x4_t scaleZ = vld1q_f32(transforms.scaleZ + index);
+
+		storeColumnsNeon(vmulq_f32(vsubq_f32(vsubq_f32(one, vmulq_f32(twoY, y)), vmulq_f32(twoZ, z)), scaleX), vmulq_f32(vaddq_f32(vmulq_f32(twoX, y), vmulq_f32(twoW, z)), scaleX), vmulq_f32(vsubq_f32(vmulq_f32(twoX, z), vmulq_f32(twoW, y)), scaleX), zero, matrices + index, 0);
+		storeColumnsNeon(vmulq_f32(vsubq_f32(vmulq_f32(twoX, y), vmulq_f32(twoW, z)), scaleY), vmulq_f32(vsubq_f32(vsubq_f32(one, vmulq_f32(twoX, x)), vmulq_f32(twoZ, z)), scaleY), vmulq_f32(vaddq_f32(vmulq_f32(twoY, z), vmulq_f32(twoW, x)), scaleY), zero, matrices + index, 1);
+		storeColumnsNeon(vmulq_f32(vaddq_f32(vmulq_f32(twoX, z), vmulq_f32(twoW, y)), scaleZ), vmulq_f32(vsubq_f32(vmulq_f32(twoY, z), vmulq_f32(twoW, x)), scaleZ), vmulq_f32(vsubq_f32(vsubq_f32(one, vmulq_f32(twoX, x)), vmulq_f32(twoY, y)), scaleZ), zero, matrices + index, 2);
+		storeColumnsNeon(vld1q_f32(transforms.translateX + index), vld1q_f32(transforms.translateY + index), vld1q_f32(transforms.translateZ + index), one, matrices + index, 3);
+	}
+
+	return index;
+}
+
+static uint32_t normalMat3Neon(const glm::mat4* matrices, uint32_t index, const uint32_t count, glm::mat3* normalMatrices)
+{
+	for (; index + 4 <= count; index += 4)
+	{
+		float32x4_t m00, m01, m02, m10, m11, m12, m20, m21, m22;
+
+		loadColumnNeon(matrices + index, 0, m00, m01, m02);
+		loadColumnNeon(matrices + index, 1, m10, m11, m12);
+		loadColumnNeon(matrices + index, 2, m20, m21, m22);
+
+		const float32x4_t c00 = vsubq_f32(vmulq_f32(m11, m22), vmulq_f32(m21, m12));
+		const float32x4_t c01 = vsubq_f32(vmulq_f32(m10, m22), vmulq_f32(m20, m12));
+		const float32x4_t c02 = vsubq_f32(vmulq_f32(m10, m21), vmulq_f32(m20, m11));
+		const float32x4_t c10 = vsubq_f32(vmulq_f32(m01, m22), vmulq_f32(m21, m02));
+		const float32x4_t c11 = vsubq_f32(vmulq_f32(m00, m22), vmulq_f32(m20, m02));
+		const float32x4_t c12 = vsubq_f32(vmulq_f32(m00, m21), vmulq_f32(m20, m01));
+		const float32x4_t c20 = vsubq_f32(vmulq_f32(m01, m12), vmulq_f32(m11, m02));
+		const float32x4_t c21 = vsubq_f32(vmulq_f32(m00, m12), vmulq_f32(m10, m02));
+		const float32x4_t c22 = vsubq_f32(vmulq_f32(m00, m11), vmulq_f32(m10, m01));
+
+		// No exact vector division on all NEON versions, so the four divisions are scalar.
+
+		float determinants[4];
+
+		vst1q_f32(determinants, vaddq_f32(vsubq_f32(vmulq_f32(m00, c00), vmulq_f32(m10, c10)), vmulq_f32(m20, c20)));
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			determinants[i] = 1.0f / determinants[i];
+		}
+
+		const float32x4_t oneOverDeterminant = vld1q_f32(determinants);
+
+		const float32x4_t elements[9] = {
+			vmulq_f32(c00, oneOverDeterminant), vmulq_f32(vnegq_f32(c01), oneOverDeterminant), vmulq_f32(c02, oneOverDeterminant),
+			vmulq_f32(vnegq_f32(c10), oneOverDeterminant), vmulq_f32(c11, oneOverDeterminant), vmulq_f32(vnegq_f32(c12), oneOverDeterminant),
+			vmulq_f32(c20, oneOverDeterminant), vmulq_f32(vnegq_f32(c21), oneOverDeterminant), vmulq_f32(c22, oneOverDeterminant)
+		};
+
+		storeMat3Neon(elements, normalMatrices + index);
+	}
+
+	return index;
+}
+
+#endif
+
+//
+
+void VKTS_APIENTRY composeMat4Batch(const float* translateX, const float* translateY, const float* translateZ, const float* rotateX, const float* rotateY, const float* rotateZ, const float* rotateW, const float* scaleX, const float* scaleY, const float* scaleZ, const uint32_t count, glm::mat4* matrices)
+{
+	const MatrixBatchTransforms transforms = {translateX, translateY, translateZ, rotateX, rotateY, rotateZ, rotateW, scaleX, scaleY, scaleZ};
+
+	uint32_t index = 0;
+
+#ifdef VKTS_MATRIX_BATCH_AVX
+	if (processorGetFeatures() & VKTS_PROCESSOR_FEATURE_AVX)
+	{
+		index = composeMat4Avx(transforms, index, count, matrices);
+	}
+#endif
+
+#if defined(VKTS_MATRIX_BATCH_SSE2)
+	index = composeMat4Sse2(transforms, index, count, matrices);
+#elif defined(VKTS_MATRIX_BATCH_NEON)
+	index = composeMat4Neon(transforms, index, count, matrices);
+#endif
+
+	composeMat4Scalar(transforms, index, count, matrices);
+}
+
+void VKTS_APIENTRY normalMat3Batch(const glm::mat4* matrices, const uint32_t count, glm::mat3* normalMatrices)
+{
+	uint32_t index = 0;
+
+#ifdef VKTS_MATRIX_BATCH_AVX
+	if (processorGetFeatures() & VKTS_PROCESSOR_FEATURE_AVX)
+	{
+		index = normalMat3Avx(matrices, index, count, normalMatrices);
+	}
+#endif
+
+#if defined(VKTS_MATRIX_BATCH_SSE2)
+	index = normalMat3Sse2(matrices, index, count, normalMatrices);
+#elif defined(VKTS_MATRIX_BATCH_NEON)
+	index = normalMat3Neon(matrices, index, count, normalMatrices);
+#endif
+
+	normalMat3Scalar(matrices, index, count, normalMatrices);
+}
+
+}
@@ -0,0 +1,225 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskDeque.hpp"
+
+namespace vkts
+{
+
+TaskDeque::TaskDequeArray::TaskDequeArray(const int64_t capacity) :
+    capacity(capacity), mask(capacity - 1), elements(new std::atomic<TaskDequeSlot*>[capacity]), slots(new TaskDequeSlot[capacity])
+{
+    for (int64_t i = 0; i < capacity; i++)
+    {
+        elements[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+TaskDeque::TaskDequeArray::~TaskDequeArray()
+{
+    delete[] slots;
+
+    delete[] elements;
+}
+
+TaskDeque::TaskDequeSlot* TaskDeque::TaskDequeArray::get(const int64_t index) const
+{
+    return elements[index & mask].load(std::memory_order_relaxed);
+}
+
+void TaskDeque::TaskDequeArray::put(const int64_t index, TaskDequeSlot* slot)
+{
+    elements[index & mask].store(slot, std::memory_order_relaxed);
+}
+
+TaskDeque::TaskDequeSlot* TaskDeque::TaskDequeArray::acquireSlot(const int64_t index)
+{
+    TaskDequeSlot* slot = &slots[index & mask];
+
+    // The task, which used this slot one lap before, is already taken, as the deque is not full.
+    // Only wait for the executor, which is still moving it out.
+
+    while (slot->used.load(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+
+    return slot;
+}
+
+void TaskDeque::releaseSlot(TaskDequeSlot* slot, ITaskSP& task)
+{
+    task = std::move(slot->task);
+
+    slot->task = ITaskSP();
+
+    slot->used.store(VK_FALSE, std::memory_order_release);
+}
+
+TaskDeque::TaskDequeArray* TaskDeque::grow(TaskDequeArray* currentArray, const int64_t currentBottom, const int64_t currentTop)
+{
+    auto newArray = new TaskDequeArray(currentArray->capacity * 2);
+
+    for (int64_t i = currentTop; i < currentBottom; i++)
+    {
+        newArray->put(i, currentArray->get(i));
+    }
+
+    allRetiredArrays.push_back(currentArray);
+
+    array.store(newArray, std::memory_order_release);
+
+    return newArray;
+}
+
+TaskDeque::TaskDeque() :
+    top(0), bottom(0), array(new TaskDequeArray(VKTS_TASK_DEQUE_INITIAL_CAPACITY)), allRetiredArrays()
+{
+}
+
+TaskDeque::~TaskDeque()
+{
+    ITaskSP task;
+
+    while (pop(task))
+    {
+        task = ITaskSP();
+    }
+
+    delete array.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < allRetiredArrays.size(); i++)
+    {
+        delete allRetiredArrays[i];
+    }
+}
+
+void TaskDeque::push(const ITaskSP& task)
+{
+    const int64_t currentBottom = bottom.load(std::memory_order_relaxed);
+    const int64_t currentTop = top.load(std::memory_order_acquire);
+
+    auto currentArray = array.load(std::memory_order_relaxed);
+
+    if (currentBottom - currentTop > currentArray->capacity - 1)
+    {
+        currentArray = grow(currentArray, currentBottom, currentTop);
+    }
+
+    auto slot = currentArray->acquireSlot(currentBottom);
+
+    slot->task = task;
+
+    slot->used.store(VK_TRUE, std::memory_order_relaxed);
+
+    currentArray->put(currentBottom, slot);
+
+    bottom.store(currentBottom + 1, std::memory_order_release);
+}
+
+VkBool32 TaskDeque::pop(ITaskSP& task)
+{
+    const int64_t currentBottom = bottom.load(std::memory_order_relaxed) - 1;
+
+    auto currentArray = array.load(std::memory_order_relaxed);
+
+    bottom.store(currentBottom, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    int64_t currentTop = top.load(std::memory_order_relaxed);
+
+    if (currentTop > currentBottom)
+    {
+        // Deque was empty.
+
+        bottom.store(currentBottom + 1, std::memory_order_relaxed);
+
+        return VK_FALSE;
+    }
+
+    TaskDequeSlot* element = currentArray->get(currentBottom);
+
+    if (currentTop == currentBottom)
+    {
+        // Last element, race against the stealing executors.
+
+        if (!top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            element = nullptr;
+        }
+
+        bottom.store(currentBottom + 1, std::memory_order_relaxed);
+    }
+
+    if (!element)
+    {
+        return VK_FALSE;
+    }
+
+    releaseSlot(element, task);
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskDeque::steal(ITaskSP& task)
+{
+    int64_t currentTop = top.load(std::memory_order_acquire);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const int64_t currentBottom = bottom.load(std::memory_order_acquire);
+
+    if (currentTop >= currentBottom)
+    {
+        return VK_FALSE;
+    }
+
+    auto currentArray = array.load(std::memory_order_acquire);
+
+    TaskDequeSlot* element = currentArray->get(currentTop);
+
+    if (!top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        // Lost the race against the owner or another stealing executor.
+
+        return VK_FALSE;
+    }
+
+    releaseSlot(element, task);
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskDeque::empty() const
+{
+    const int64_t currentTop = top.load(std::memory_order_acquire);
+    const int64_t currentBottom = bottom.load(std::memory_order_acquire);
+
+    return (VkBool32)(currentTop >= currentBottom);
+}
+
+} /* namespace vkts */
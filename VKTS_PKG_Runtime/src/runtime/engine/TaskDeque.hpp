@@ -0,0 +1,139 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKDEQUE_HPP_
+#define VKTS_TASKDEQUE_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#define VKTS_TASK_DEQUE_INITIAL_CAPACITY 256
+
+namespace vkts
+{
+
+/**
+ * Lock free work stealing deque (Chase-Lev).
+ *
+ * Only the owning executor calls push() and pop(), which work on the bottom end.
+ * All other executors call steal(), which works on the top end.
+ */
+class TaskDeque
+{
+
+private:
+
+    class TaskDequeSlot
+    {
+
+    public:
+
+        ITaskSP task;
+
+        // Set by the owner on push, cleared by the executor, which took the task out.
+        std::atomic<VkBool32> used;
+
+        TaskDequeSlot() :
+            task(), used(VK_FALSE)
+        {
+        }
+
+    };
+
+    class TaskDequeArray
+    {
+
+    public:
+
+        const int64_t capacity;
+
+        const int64_t mask;
+
+        std::atomic<TaskDequeSlot*>* elements;
+
+        // Ring of slots, reused by push() instead of allocating a slot per task.
+        TaskDequeSlot* slots;
+
+        explicit TaskDequeArray(const int64_t capacity);
+        ~TaskDequeArray();
+
+        TaskDequeSlot* get(const int64_t index) const;
+
+        void put(const int64_t index, TaskDequeSlot* slot);
+
+        TaskDequeSlot* acquireSlot(const int64_t index);
+
+    };
+
+    static void releaseSlot(TaskDequeSlot* slot, ITaskSP& task);
+
+    std::atomic<int64_t> top;
+
+    std::atomic<int64_t> bottom;
+
+    std::atomic<TaskDequeArray*> array;
+
+    // Grown arrays can still be accessed by stealing executors, so they are freed at destruction.
+    std::vector<TaskDequeArray*> allRetiredArrays;
+
+    TaskDequeArray* grow(TaskDequeArray* currentArray, const int64_t currentBottom, const int64_t currentTop);
+
+public:
+
+    TaskDeque();
+    TaskDeque(const TaskDeque& other) = delete;
+    TaskDeque(TaskDeque&& other) = delete;
+    ~TaskDeque();
+
+    TaskDeque& operator =(const TaskDeque& other) = delete;
+    TaskDeque& operator =(TaskDeque && other) = delete;
+
+    /**
+     * Owner only.
+     */
+    void push(const ITaskSP& task);
+
+    /**
+     * Owner only.
+     */
+    VkBool32 pop(ITaskSP& task);
+
+    /**
+     * @ThreadSafe
+     */
+    VkBool32 steal(ITaskSP& task);
+
+    /**
+     * @ThreadSafe
+     */
+    VkBool32 empty() const;
+
+};
+
+typedef std::shared_ptr<TaskDeque> TaskDequeSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKDEQUE_HPP_ */
@@ -29,8 +29,8 @@
 namespace vkts
 {
 
-TaskExecutor::TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue) :
-    index(index), sync(sync), sendTaskQueue(sendTaskQueue), executedTaskQueue(executedTaskQueue)
+TaskExecutor::TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskSchedulerSP& sendTaskScheduler, const TaskQueueSP& executedTaskQueue) :
+    index(index), sync(sync), sendTaskScheduler(sendTaskScheduler), executedTaskQueue(executedTaskQueue)
 {
 }
 
@@ -51,9 +51,11 @@ void TaskExecutor::run() const
 
     auto doRun = VK_TRUE;
 
+    sendTaskScheduler->attachExecutor((uint32_t)index);
+
     while (doRun && sync.doAllRun())
     {
-        doRun = sendTaskQueue->receiveTask(task);
+        doRun = sendTaskScheduler->receiveTask((uint32_t)index, task);
 
         if (!task.get())
         {
@@ -64,7 +66,10 @@ void TaskExecutor::run() const
         {
             doRun = task->run();
 
-            doRun = executedTaskQueue->addTask(task) && doRun;
+            if (!task->isDetached())
+            {
+                doRun = executedTaskQueue->addTask(task) && doRun;
+            }
         }
 
         if (doRun)
@@ -75,8 +80,6 @@ void TaskExecutor::run() const
         {
             sync.setDoAllRunFalse();
         }
-
-        std::this_thread::yield();
     }
 
     logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "TaskExecutor %d terminated.", index);
@@ -31,6 +31,7 @@
 
 #include "ExecutorSync.hpp"
 #include "TaskQueue.hpp"
+#include "TaskScheduler.hpp"
 
 namespace vkts
 {
@@ -44,7 +45,7 @@ private:
 
     ExecutorSync& sync;
 
-    TaskQueueSP sendTaskQueue;
+    TaskSchedulerSP sendTaskScheduler;
     TaskQueueSP executedTaskQueue;
 
 public:
@@ -52,7 +53,7 @@ public:
     TaskExecutor() = delete;
     TaskExecutor(const TaskExecutor& other) = delete;
     TaskExecutor(TaskExecutor&& other) = delete;
-    TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue);
+    TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskSchedulerSP& sendTaskScheduler, const TaskQueueSP& executedTaskQueue);
     virtual ~TaskExecutor();
 
     TaskExecutor& operator =(const TaskExecutor& other) = delete;
@@ -0,0 +1,129 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskInbox.hpp"
+
+namespace vkts
+{
+
+TaskInbox::TaskInbox() :
+    enqueuePosition(0), dequeuePosition(0)
+{
+    static_assert((VKTS_TASK_INBOX_CAPACITY & (VKTS_TASK_INBOX_CAPACITY - 1)) == 0, "Capacity has to be a power of two");
+
+    for (uint64_t i = 0; i < VKTS_TASK_INBOX_CAPACITY; i++)
+    {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+TaskInbox::~TaskInbox()
+{
+}
+
+VkBool32 TaskInbox::add(const ITaskSP& task)
+{
+    TaskInboxCell* cell = nullptr;
+
+    uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell = &cells[position & (VKTS_TASK_INBOX_CAPACITY - 1)];
+
+        const uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+
+        const int64_t difference = (int64_t)sequence - (int64_t)position;
+
+        if (difference == 0)
+        {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Inbox is full.
+
+            return VK_FALSE;
+        }
+        else
+        {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->task = task;
+
+    cell->sequence.store(position + 1, std::memory_order_release);
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskInbox::take(ITaskSP& task)
+{
+    TaskInboxCell* cell = nullptr;
+
+    uint64_t position = dequeuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell = &cells[position & (VKTS_TASK_INBOX_CAPACITY - 1)];
+
+        const uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+
+        const int64_t difference = (int64_t)sequence - (int64_t)(position + 1);
+
+        if (difference == 0)
+        {
+            if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Inbox is empty.
+
+            return VK_FALSE;
+        }
+        else
+        {
+            position = dequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    task = std::move(cell->task);
+
+    cell->task = ITaskSP();
+
+    cell->sequence.store(position + VKTS_TASK_INBOX_CAPACITY, std::memory_order_release);
+
+    return VK_TRUE;
+}
+
+} /* namespace vkts */
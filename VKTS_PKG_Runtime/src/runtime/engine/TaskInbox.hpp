@@ -0,0 +1,95 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKINBOX_HPP_
+#define VKTS_TASKINBOX_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#define VKTS_TASK_INBOX_CAPACITY 1024
+
+namespace vkts
+{
+
+/**
+ * Lock free, bounded multi producer and multi consumer queue.
+ *
+ * Receives the tasks, which are sent from the update threads to an executor.
+ */
+class TaskInbox
+{
+
+private:
+
+    class TaskInboxCell
+    {
+
+    public:
+
+        std::atomic<uint64_t> sequence;
+
+        ITaskSP task;
+
+        TaskInboxCell() :
+            sequence(0), task()
+        {
+        }
+
+    };
+
+    TaskInboxCell cells[VKTS_TASK_INBOX_CAPACITY];
+
+    std::atomic<uint64_t> enqueuePosition;
+
+    std::atomic<uint64_t> dequeuePosition;
+
+public:
+
+    TaskInbox();
+    TaskInbox(const TaskInbox& other) = delete;
+    TaskInbox(TaskInbox&& other) = delete;
+    ~TaskInbox();
+
+    TaskInbox& operator =(const TaskInbox& other) = delete;
+    TaskInbox& operator =(TaskInbox && other) = delete;
+
+    /**
+     * @ThreadSafe
+     */
+    VkBool32 add(const ITaskSP& task);
+
+    /**
+     * @ThreadSafe
+     */
+    VkBool32 take(ITaskSP& task);
+
+};
+
+typedef std::shared_ptr<TaskInbox> TaskInboxSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKINBOX_HPP_ */
@@ -35,24 +35,18 @@ TaskQueueElement* TaskQueue::getTaskQueueElement()
 
 	if (taskQueueElementCount == VKTS_MAX_TASK_QUEUE_ELEMENT)
 	{
-		conditionVariable.wait(uniqueLock, [this] {return taskQueueElementCount == VKTS_MAX_TASK_QUEUE_ELEMENT;});
+		conditionVariable.wait(uniqueLock, [this] {return taskQueueElementCount != VKTS_MAX_TASK_QUEUE_ELEMENT;});
 	}
 
-	for (uint64_t i = 0; i < VKTS_MAX_TASK_QUEUE_ELEMENT; i++)
-	{
-		if (taskQueueElementCacheUsed[i] == VK_FALSE)
-		{
-			taskQueueElementCacheUsed[i] = VK_TRUE;
+	const uint64_t i = taskQueueElementCacheFree[VKTS_MAX_TASK_QUEUE_ELEMENT - 1 - taskQueueElementCount];
 
-			taskQueueElementCache[i].used = timeGetRaw();
+	taskQueueElementCacheUsed[i] = VK_TRUE;
 
-			taskQueueElementCount++;
+	taskQueueElementCache[i].used = timeGetRaw();
 
-	        return &taskQueueElementCache[i];
-		}
-	}
+	taskQueueElementCount++;
 
-	return nullptr;
+	return &taskQueueElementCache[i];
 }
 
 void TaskQueue::recycleTaskQueueElement(TaskQueueElement* taskQueueElement)
@@ -72,17 +66,21 @@ void TaskQueue::recycleTaskQueueElement(TaskQueueElement* taskQueueElement)
 
     taskQueueElementCount--;
 
+    taskQueueElementCacheFree[VKTS_MAX_TASK_QUEUE_ELEMENT - 1 - taskQueueElementCount] = taskQueueElement->index;
+
     conditionVariable.notify_all();
 }
 
 TaskQueue::TaskQueue() :
-    taskQueueElementCache(), taskQueueElementCacheUsed(), queue(), mutex(), conditionVariable(), taskQueueElementCount(0)
+    taskQueueElementCache(), taskQueueElementCacheUsed(), taskQueueElementCacheFree(), queue(), mutex(), conditionVariable(), taskQueueElementCount(0)
 {
 	for (uint64_t i = 0; i < VKTS_MAX_TASK_QUEUE_ELEMENT; i++)
 	{
 		taskQueueElementCache[i].index = i;
 
 		taskQueueElementCacheUsed[i] = VK_FALSE;
+
+		taskQueueElementCacheFree[i] = i;
 	}
 }
 
@@ -72,6 +72,9 @@ private:
     TaskQueueElement taskQueueElementCache[VKTS_MAX_TASK_QUEUE_ELEMENT];
     VkBool32 taskQueueElementCacheUsed[VKTS_MAX_TASK_QUEUE_ELEMENT];
 
+    // Stack of unused cache indices, so getting an element does not need to search the cache.
+    uint64_t taskQueueElementCacheFree[VKTS_MAX_TASK_QUEUE_ELEMENT];
+
     ThreadsafeQueue<TaskQueueElement*> queue;
 
     mutable std::mutex mutex;
@@ -0,0 +1,249 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskScheduler.hpp"
+
+namespace vkts
+{
+
+// Executor, the current thread belongs to. Used to send tasks from a running task to the own deque.
+
+static thread_local const TaskScheduler* g_currentTaskScheduler = nullptr;
+
+static thread_local uint32_t g_currentExecutorIndex = 0;
+
+VkBool32 TaskScheduler::findTask(const uint32_t executorIndex, uint32_t& randomState, ITaskSP& task)
+{
+    // Own tasks first, newest ones from the deque to keep the caches warm.
+
+    if (allTaskDeques[executorIndex]->pop(task))
+    {
+        return VK_TRUE;
+    }
+
+    if (allTaskInboxes[executorIndex]->take(task))
+    {
+        return VK_TRUE;
+    }
+
+    if (executorCount <= 1)
+    {
+        return VK_FALSE;
+    }
+
+    // Steal, starting at a random victim, so the executors do not contend on the same one.
+
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+
+    const uint32_t startIndex = randomState % executorCount;
+
+    for (uint32_t i = 0; i < executorCount; i++)
+    {
+        const uint32_t victimIndex = (startIndex + i) % executorCount;
+
+        if (victimIndex == executorIndex)
+        {
+            continue;
+        }
+
+        if (allTaskDeques[victimIndex]->steal(task) || allTaskInboxes[victimIndex]->take(task))
+        {
+            stolenTaskCount.fetch_add(1, std::memory_order_relaxed);
+
+            return VK_TRUE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
+void TaskScheduler::wakeExecutor()
+{
+    if (sleepingExecutorCount.load() > 0)
+    {
+        std::lock_guard<std::mutex> sleepLock(sleepMutex);
+
+        sleepConditionVariable.notify_one();
+    }
+}
+
+TaskScheduler::TaskScheduler(const uint32_t executorCount) :
+    executorCount(executorCount), allTaskDeques(), allTaskInboxes(), nextTaskInbox(0), pendingTaskCount(0), sleepingExecutorCount(0), stopped(VK_FALSE), sleepMutex(), sleepConditionVariable(), executedTaskCount(0), stolenTaskCount(0)
+{
+    for (uint32_t i = 0; i < executorCount; i++)
+    {
+        allTaskDeques.append(TaskDequeSP(new TaskDeque()));
+
+        allTaskInboxes.append(TaskInboxSP(new TaskInbox()));
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    reset();
+}
+
+uint32_t TaskScheduler::getExecutorCount() const
+{
+    return executorCount;
+}
+
+void TaskScheduler::attachExecutor(const uint32_t executorIndex)
+{
+    g_currentTaskScheduler = this;
+
+    g_currentExecutorIndex = executorIndex;
+}
+
+VkBool32 TaskScheduler::addTask(const ITaskSP& task)
+{
+    if (!task.get() || executorCount == 0 || stopped.load())
+    {
+        return VK_FALSE;
+    }
+
+    if (g_currentTaskScheduler == this)
+    {
+        // Sent from a running task, so the executor thread is the owner of the deque.
+
+        allTaskDeques[g_currentExecutorIndex]->push(task);
+    }
+    else
+    {
+        uint32_t inboxIndex = nextTaskInbox.fetch_add(1, std::memory_order_relaxed) % executorCount;
+
+        uint32_t tries = 0;
+
+        while (!allTaskInboxes[inboxIndex]->add(task))
+        {
+            inboxIndex = (inboxIndex + 1) % executorCount;
+
+            tries++;
+
+            if (tries % executorCount == 0)
+            {
+                // All inboxes are full, so give the executors time to catch up.
+
+                if (stopped.load())
+                {
+                    return VK_FALSE;
+                }
+
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    pendingTaskCount.fetch_add(1);
+
+    wakeExecutor();
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskScheduler::receiveTask(const uint32_t executorIndex, ITaskSP& task)
+{
+    if (executorIndex >= executorCount)
+    {
+        return VK_FALSE;
+    }
+
+    uint32_t randomState = executorIndex * 2654435761u + 1u;
+
+    while (!stopped.load())
+    {
+        for (uint32_t spin = 0; spin < VKTS_TASK_SCHEDULER_SPIN_COUNT; spin++)
+        {
+            if (findTask(executorIndex, randomState, task))
+            {
+                pendingTaskCount.fetch_sub(1);
+
+                executedTaskCount.fetch_add(1, std::memory_order_relaxed);
+
+                return VK_TRUE;
+            }
+
+            if (stopped.load())
+            {
+                return VK_FALSE;
+            }
+
+            std::this_thread::yield();
+        }
+
+        // Nothing to do, so sleep until a task is sent.
+
+        sleepingExecutorCount.fetch_add(1);
+
+        {
+            std::unique_lock<std::mutex> sleepLock(sleepMutex);
+
+            sleepConditionVariable.wait(sleepLock, [this] {return pendingTaskCount.load() > 0 || stopped.load();});
+        }
+
+        sleepingExecutorCount.fetch_sub(1);
+    }
+
+    return VK_FALSE;
+}
+
+void TaskScheduler::reset()
+{
+    ITaskSP task;
+
+    for (uint32_t i = 0; i < executorCount; i++)
+    {
+        while (allTaskDeques[i]->steal(task) || allTaskInboxes[i]->take(task))
+        {
+            task = ITaskSP();
+
+            pendingTaskCount.fetch_sub(1);
+        }
+    }
+}
+
+void TaskScheduler::stop()
+{
+    stopped.store(VK_TRUE);
+
+    std::lock_guard<std::mutex> sleepLock(sleepMutex);
+
+    sleepConditionVariable.notify_all();
+}
+
+uint64_t TaskScheduler::getExecutedTaskCount() const
+{
+    return executedTaskCount.load();
+}
+
+uint64_t TaskScheduler::getStolenTaskCount() const
+{
+    return stolenTaskCount.load();
+}
+
+} /* namespace vkts */
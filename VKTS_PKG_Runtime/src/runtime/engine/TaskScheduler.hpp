@@ -0,0 +1,129 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKSCHEDULER_HPP_
+#define VKTS_TASKSCHEDULER_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#include "TaskDeque.hpp"
+#include "TaskInbox.hpp"
+
+#define VKTS_TASK_SCHEDULER_SPIN_COUNT 64
+
+namespace vkts
+{
+
+/**
+ * Work stealing scheduler, feeding the task executors.
+ *
+ * Every executor owns a deque for tasks, which are sent from inside a running task, and an inbox for tasks, which are sent by the update threads.
+ * An idle executor first looks at its own deque and inbox and then steals from the other executors.
+ */
+class TaskScheduler
+{
+
+private:
+
+    const uint32_t executorCount;
+
+    SmartPointerVector<TaskDequeSP> allTaskDeques;
+
+    SmartPointerVector<TaskInboxSP> allTaskInboxes;
+
+    std::atomic<uint32_t> nextTaskInbox;
+
+    std::atomic<int64_t> pendingTaskCount;
+
+    std::atomic<int32_t> sleepingExecutorCount;
+
+    std::atomic<VkBool32> stopped;
+
+    std::mutex sleepMutex;
+
+    std::condition_variable sleepConditionVariable;
+
+    std::atomic<uint64_t> executedTaskCount;
+
+    std::atomic<uint64_t> stolenTaskCount;
+
+    VkBool32 findTask(const uint32_t executorIndex, uint32_t& randomState, ITaskSP& task);
+
+    void wakeExecutor();
+
+public:
+
+    TaskScheduler() = delete;
+    TaskScheduler(const TaskScheduler& other) = delete;
+    TaskScheduler(TaskScheduler&& other) = delete;
+    explicit TaskScheduler(const uint32_t executorCount);
+    virtual ~TaskScheduler();
+
+    TaskScheduler& operator =(const TaskScheduler& other) = delete;
+    TaskScheduler& operator =(TaskScheduler && other) = delete;
+
+    uint32_t getExecutorCount() const;
+
+    /**
+     * Has to be called by the executor thread, before receiving tasks.
+     */
+    void attachExecutor(const uint32_t executorIndex);
+
+    /**
+     * Empty tasks are rejected. Use stop() to end the scheduler.
+     *
+     * @ThreadSafe
+     */
+    VkBool32 addTask(const ITaskSP& task);
+
+    /**
+     * Blocks until a task is available or the scheduler is stopped.
+     *
+     * Executor thread only.
+     */
+    VkBool32 receiveTask(const uint32_t executorIndex, ITaskSP& task);
+
+    /**
+     * @ThreadSafe
+     */
+    void reset();
+
+    /**
+     * @ThreadSafe
+     */
+    void stop();
+
+    uint64_t getExecutedTaskCount() const;
+
+    uint64_t getStolenTaskCount() const;
+
+};
+
+typedef std::shared_ptr<TaskScheduler> TaskSchedulerSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKSCHEDULER_HPP_ */
@@ -29,8 +29,8 @@
 namespace vkts
 {
 
-UpdateThreadContext::UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue) :
-    IUpdateThreadContext(), threadIndex(threadIndex), threadCount(threadCount), sendTaskQueue(sendTaskQueue), executedTaskQueue(executedTaskQueue)
+UpdateThreadContext::UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskSchedulerSP& sendTaskScheduler, const TaskQueueSP& executedTaskQueue) :
+    IUpdateThreadContext(), threadIndex(threadIndex), threadCount(threadCount), sendTaskScheduler(sendTaskScheduler), executedTaskQueue(executedTaskQueue)
 {
     this->startTime = timeGetRaw();
     this->lastTime = startTime;
@@ -54,6 +54,14 @@ void UpdateThreadContext::update()
     currentTicks = static_cast<uint64_t>(getTotalTime() / getTickTime());
 }
 
+void UpdateThreadContext::stopSendTasks() const
+{
+    if (sendTaskScheduler.get())
+    {
+        sendTaskScheduler->stop();
+    }
+}
+
 //
 // IUpdateThreadContext
 //
@@ -99,12 +107,12 @@ uint64_t UpdateThreadContext::getDeltaTicks() const
 
 VkBool32 UpdateThreadContext::sendTask(const ITaskSP& task) const
 {
-    if (!sendTaskQueue.get())
+    if (!sendTaskScheduler.get())
     {
         return VK_FALSE;
     }
 
-    return sendTaskQueue->addTask(task);
+    return sendTaskScheduler->addTask(task);
 }
 
 VkBool32 UpdateThreadContext::receiveExecutedTask(ITaskSP& task, const VkBool32 wait) const
@@ -119,9 +127,9 @@ VkBool32 UpdateThreadContext::receiveExecutedTask(ITaskSP& task, const VkBool32
 
 void UpdateThreadContext::resetSendTasks() const
 {
-    if (sendTaskQueue.get())
+    if (sendTaskScheduler.get())
     {
-    	sendTaskQueue->reset();
+    	sendTaskScheduler->reset();
     }
 }
 
@@ -30,6 +30,7 @@
 #include <vkts/runtime/vkts_runtime.hpp>
 
 #include "TaskQueue.hpp"
+#include "TaskScheduler.hpp"
 
 namespace vkts
 {
@@ -49,7 +50,7 @@ private:
 
     double tickTime;
 
-    TaskQueueSP sendTaskQueue;
+    TaskSchedulerSP sendTaskScheduler;
     TaskQueueSP executedTaskQueue;
 
     uint64_t lastTicks;
@@ -60,7 +61,7 @@ public:
     UpdateThreadContext() = delete;
     UpdateThreadContext(const UpdateThreadContext& other) = delete;
     UpdateThreadContext(UpdateThreadContext&& other) = delete;
-    UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue);
+    UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskSchedulerSP& sendTaskScheduler, const TaskQueueSP& executedTaskQueue);
     virtual ~UpdateThreadContext();
 
     UpdateThreadContext& operator =(const UpdateThreadContext& other) = delete;
@@ -68,6 +69,8 @@ public:
 
     void update();
 
+    void stopSendTasks() const;
+
     //
     // IUpdateThreadContext
     //
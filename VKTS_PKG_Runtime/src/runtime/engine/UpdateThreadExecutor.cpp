@@ -84,7 +84,7 @@ void UpdateThreadExecutor::run() const
 
             logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "UpdateThreadExecutor %d disabling task queue.", index);
 
-            updateThreadContext->sendTask(ITaskSP());
+            updateThreadContext->stopSendTasks();
 
             break;
         }
@@ -106,7 +106,7 @@ void UpdateThreadExecutor::run() const
 
                 logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "UpdateThreadExecutor %d disabling task queue.", index);
 
-                updateThreadContext->sendTask(ITaskSP(nullptr));
+                updateThreadContext->stopSendTasks();
 
                 break;
             }
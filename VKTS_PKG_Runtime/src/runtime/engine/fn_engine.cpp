@@ -161,16 +161,16 @@ VkBool32 VKTS_APIENTRY engineRun()
 
     // Task queue creation.
 
-    TaskQueueSP sendTaskQueue;
+    TaskSchedulerSP sendTaskScheduler;
     TaskQueueSP executedTaskQueue;
 
     if (g_taskExecutorCount > 0)
     {
-        sendTaskQueue = TaskQueueSP(new TaskQueue);
+        sendTaskScheduler = TaskSchedulerSP(new TaskScheduler(g_taskExecutorCount));
 
-        if (!sendTaskQueue.get())
+        if (!sendTaskScheduler.get())
         {
-            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Run failed! Could not create task queue.");
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Run failed! Could not create task scheduler.");
 
             return VK_FALSE;
         }
@@ -198,7 +198,7 @@ VkBool32 VKTS_APIENTRY engineRun()
 
     for (uint32_t i = 0; i < g_taskExecutorCount; i++)
     {
-        auto currentTaskExecutor = TaskExecutorSP(new TaskExecutor(i, executorSync, sendTaskQueue, executedTaskQueue));
+        auto currentTaskExecutor = TaskExecutorSP(new TaskExecutor(i, executorSync, sendTaskScheduler, executedTaskQueue));
 
         if (!currentTaskExecutor.get())
         {
@@ -241,7 +241,7 @@ VkBool32 VKTS_APIENTRY engineRun()
 
         //
 
-        auto currentUpdateThreadContext = UpdateThreadContextSP(new UpdateThreadContext((int32_t) updateThreadIndex, (int32_t) g_allUpdateThreads.size(), g_tickTime, sendTaskQueue, executedTaskQueue));
+        auto currentUpdateThreadContext = UpdateThreadContextSP(new UpdateThreadContext((int32_t) updateThreadIndex, (int32_t) g_allUpdateThreads.size(), g_tickTime, sendTaskScheduler, executedTaskQueue));
 
         if (!currentUpdateThreadContext.get())
         {
@@ -319,24 +319,17 @@ VkBool32 VKTS_APIENTRY engineRun()
 
     //
 
-    if (sendTaskQueue.get())
+    if (sendTaskScheduler.get())
     {
-    	// Empty the queue.
-    	// As no update thread can feed the queue anymore, it is save to call reset.
-
-    	sendTaskQueue->reset();
-
-    	//
+    	// Empty the scheduler.
+    	// As no update thread can feed the scheduler anymore, it is save to call reset.
 
-    	ITaskSP stopTask;
+    	sendTaskScheduler->reset();
 
-        logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "Disabling task queue.");
+    	logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "Disabling task scheduler.");
 
-    	for (uint32_t i = 0; i < g_taskExecutorCount; i++)
-    	{
-    		// Send an empty task to the queue, to exit the thread.
-    		sendTaskQueue->addTask(stopTask);
-    	}
+    	// Wake up all executors, so they can exit the thread.
+    	sendTaskScheduler->stop();
     }
 
     // Wait for all tasks to finish in the reverse order they were created.
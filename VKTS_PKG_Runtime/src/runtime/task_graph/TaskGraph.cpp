@@ -0,0 +1,348 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskGraph.hpp"
+
+#include "TaskGraphTask.hpp"
+
+namespace vkts
+{
+
+VkBool32 TaskGraph::validate() const
+{
+    // Topological sort, which only visits all nodes, if there is no cycle.
+
+    std::vector<uint32_t> allRemainingPredecessors(allNodes.size());
+    std::vector<uint32_t> allReadyNodes;
+
+    for (uint32_t i = 0; i < allNodes.size(); i++)
+    {
+        allRemainingPredecessors[i] = allNodes[i]->predecessorCount;
+
+        if (allRemainingPredecessors[i] == 0)
+        {
+            allReadyNodes.push_back(i);
+        }
+    }
+
+    uint32_t visitedNodes = 0;
+
+    while (allReadyNodes.size() > 0)
+    {
+        const uint32_t handle = allReadyNodes.back();
+        allReadyNodes.pop_back();
+
+        visitedNodes++;
+
+        for (size_t i = 0; i < allNodes[handle]->allSuccessors.size(); i++)
+        {
+            const uint32_t successor = allNodes[handle]->allSuccessors[i];
+
+            allRemainingPredecessors[successor]--;
+
+            if (allRemainingPredecessors[successor] == 0)
+            {
+                allReadyNodes.push_back(successor);
+            }
+        }
+    }
+
+    return visitedNodes == allNodes.size();
+}
+
+void TaskGraph::sendNode(const uint32_t handle, const uint32_t chunkBegin, const uint32_t chunkEnd)
+{
+    auto task = ITaskSP(new TaskGraphTask(*this, handle, chunkBegin, chunkEnd));
+
+    if (!task.get() || !updateContext.sendTask(task))
+    {
+        // No task executors available, so execute on the calling thread.
+
+        executeNode(handle, chunkBegin, chunkEnd);
+    }
+}
+
+void TaskGraph::startNode(const uint32_t handle)
+{
+    const auto& node = allNodes[handle];
+
+    if (node->function)
+    {
+        const uint32_t chunkCount = (node->end - node->begin + node->grainSize - 1) / node->grainSize;
+
+        if (chunkCount == 0)
+        {
+            completeNode(handle);
+
+            return;
+        }
+
+        node->remainingChunks.store(chunkCount);
+
+        for (uint32_t chunkBegin = node->begin; chunkBegin < node->end; chunkBegin += node->grainSize)
+        {
+            sendNode(handle, chunkBegin, glm::min(chunkBegin + node->grainSize, node->end));
+        }
+    }
+    else
+    {
+        sendNode(handle, 0, 0);
+    }
+}
+
+void TaskGraph::completeNode(const uint32_t handle)
+{
+    const auto& node = allNodes[handle];
+
+    for (size_t i = 0; i < node->allSuccessors.size(); i++)
+    {
+        const uint32_t successor = node->allSuccessors[i];
+
+        if (allNodes[successor]->remainingPredecessors.fetch_sub(1) == 1)
+        {
+            startNode(successor);
+        }
+    }
+
+    // Decrement and signal under the wait mutex. Otherwise the last node could let wait() return and destroy the graph,
+    // while this thread still accesses it after its decrement.
+
+    std::lock_guard<std::mutex> waitLock(waitMutex);
+
+    node->done.store(VK_TRUE);
+
+    if (remainingNodes.fetch_sub(1) == 1)
+    {
+        running.store(VK_FALSE);
+
+        waitConditionVariable.notify_all();
+    }
+    else if (waitingThreads.load() > 0)
+    {
+        waitConditionVariable.notify_all();
+    }
+}
+
+TaskGraph::TaskGraph(const IUpdateThreadContext& updateContext) :
+    ITaskGraph(), updateContext(updateContext), allNodes(), validated(VK_TRUE), remainingNodes(0), running(VK_FALSE), failed(VK_FALSE), waitingThreads(0), waitMutex(), waitConditionVariable()
+{
+}
+
+TaskGraph::~TaskGraph()
+{
+    // Running tasks are referencing this graph.
+    wait();
+}
+
+void TaskGraph::executeNode(const uint32_t handle, const uint32_t chunkBegin, const uint32_t chunkEnd)
+{
+    const auto& node = allNodes[handle];
+
+    if (node->function)
+    {
+        if (!node->function(chunkBegin, chunkEnd))
+        {
+            failed.store(VK_TRUE);
+        }
+
+        if (node->remainingChunks.fetch_sub(1) == 1)
+        {
+            completeNode(handle);
+        }
+    }
+    else
+    {
+        if (!TaskGraphTask::runTask(node->task))
+        {
+            failed.store(VK_TRUE);
+        }
+
+        completeNode(handle);
+    }
+}
+
+//
+// ITaskGraph
+//
+
+uint32_t TaskGraph::addTask(const ITaskSP& task)
+{
+    auto node = TaskGraphNodeSP(new TaskGraphNode());
+
+    node->task = task;
+
+    allNodes.append(node);
+
+    return allNodes.size() - 1;
+}
+
+uint32_t TaskGraph::addParallelFor(const uint32_t begin, const uint32_t end, const uint32_t grainSize, const TaskGraphRangeFunction& function)
+{
+    auto node = TaskGraphNodeSP(new TaskGraphNode());
+
+    node->function = function;
+    node->begin = begin;
+    node->end = glm::max(begin, end);
+    node->grainSize = glm::max(grainSize, 1u);
+
+    allNodes.append(node);
+
+    return allNodes.size() - 1;
+}
+
+VkBool32 TaskGraph::addDependency(const uint32_t predecessor, const uint32_t successor)
+{
+    if (predecessor >= allNodes.size() || successor >= allNodes.size() || predecessor == successor)
+    {
+        return VK_FALSE;
+    }
+
+    if (!isDone())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Task graph is running.");
+
+        return VK_FALSE;
+    }
+
+    allNodes[predecessor]->allSuccessors.push_back(successor);
+
+    allNodes[successor]->predecessorCount++;
+
+    validated = VK_FALSE;
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskGraph::run()
+{
+    if (!isDone())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Task graph is running.");
+
+        return VK_FALSE;
+    }
+
+    if (allNodes.size() == 0)
+    {
+        return VK_TRUE;
+    }
+
+    if (!validated)
+    {
+        if (!validate())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Task graph has a cycle.");
+
+            return VK_FALSE;
+        }
+
+        validated = VK_TRUE;
+    }
+
+    // Collect the start nodes before sending, as executed tasks already modify the counters.
+
+    std::vector<uint32_t> allStartNodes;
+
+    for (uint32_t i = 0; i < allNodes.size(); i++)
+    {
+        allNodes[i]->remainingPredecessors.store(allNodes[i]->predecessorCount);
+        allNodes[i]->remainingChunks.store(0);
+        allNodes[i]->done.store(VK_FALSE);
+
+        if (allNodes[i]->predecessorCount == 0)
+        {
+            allStartNodes.push_back(i);
+        }
+    }
+
+    failed.store(VK_FALSE);
+
+    remainingNodes.store(allNodes.size());
+
+    running.store(VK_TRUE);
+
+    for (size_t i = 0; i < allStartNodes.size(); i++)
+    {
+        startNode(allStartNodes[i]);
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskGraph::wait(const uint32_t handle) const
+{
+    if (handle >= allNodes.size())
+    {
+        return VK_FALSE;
+    }
+
+    const auto& node = allNodes[handle];
+
+    if (!node->done.load() && !isDone())
+    {
+        waitingThreads.fetch_add(1);
+
+        {
+            std::unique_lock<std::mutex> waitLock(waitMutex);
+
+            waitConditionVariable.wait(waitLock, [this, &node] {return node->done.load() || !running.load();});
+        }
+
+        waitingThreads.fetch_sub(1);
+    }
+
+    return !failed.load();
+}
+
+VkBool32 TaskGraph::wait() const
+{
+    std::unique_lock<std::mutex> waitLock(waitMutex);
+
+    waitConditionVariable.wait(waitLock, [this] {return !running.load();});
+
+    return !failed.load();
+}
+
+VkBool32 TaskGraph::isDone() const
+{
+    return !running.load();
+}
+
+void TaskGraph::reset()
+{
+    wait();
+
+    allNodes.clear();
+
+    validated = VK_TRUE;
+}
+
+uint32_t TaskGraph::getTaskCount() const
+{
+    return allNodes.size();
+}
+
+} /* namespace vkts */
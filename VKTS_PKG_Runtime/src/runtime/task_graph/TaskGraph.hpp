@@ -0,0 +1,147 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKGRAPH_HPP_
+#define VKTS_TASKGRAPH_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+class TaskGraphNode
+{
+
+public:
+
+    ITaskSP task;
+
+    TaskGraphRangeFunction function;
+
+    uint32_t begin;
+
+    uint32_t end;
+
+    uint32_t grainSize;
+
+    std::vector<uint32_t> allSuccessors;
+
+    uint32_t predecessorCount;
+
+    std::atomic<uint32_t> remainingPredecessors;
+
+    std::atomic<uint32_t> remainingChunks;
+
+    std::atomic<VkBool32> done;
+
+    TaskGraphNode() :
+        task(), function(), begin(0), end(0), grainSize(1), allSuccessors(), predecessorCount(0), remainingPredecessors(0), remainingChunks(0), done(VK_FALSE)
+    {
+    }
+
+    ~TaskGraphNode()
+    {
+    }
+
+};
+
+typedef std::shared_ptr<TaskGraphNode> TaskGraphNodeSP;
+
+class TaskGraph: public ITaskGraph
+{
+
+private:
+
+    const IUpdateThreadContext& updateContext;
+
+    SmartPointerVector<TaskGraphNodeSP> allNodes;
+
+    VkBool32 validated;
+
+    std::atomic<uint32_t> remainingNodes;
+
+    // Only cleared under the wait mutex, so a waiting thread can safely destroy the graph.
+    std::atomic<VkBool32> running;
+
+    std::atomic<VkBool32> failed;
+
+    mutable std::atomic<int32_t> waitingThreads;
+
+    mutable std::mutex waitMutex;
+
+    mutable std::condition_variable waitConditionVariable;
+
+    VkBool32 validate() const;
+
+    void sendNode(const uint32_t handle, const uint32_t chunkBegin, const uint32_t chunkEnd);
+
+    void startNode(const uint32_t handle);
+
+    void completeNode(const uint32_t handle);
+
+public:
+
+    TaskGraph() = delete;
+    TaskGraph(const TaskGraph& other) = delete;
+    TaskGraph(TaskGraph&& other) = delete;
+    explicit TaskGraph(const IUpdateThreadContext& updateContext);
+    virtual ~TaskGraph();
+
+    TaskGraph& operator =(const TaskGraph& other) = delete;
+    TaskGraph& operator =(TaskGraph && other) = delete;
+
+    /**
+     * Called by the task executors.
+     */
+    void executeNode(const uint32_t handle, const uint32_t chunkBegin, const uint32_t chunkEnd);
+
+    //
+    // ITaskGraph
+    //
+
+    virtual uint32_t addTask(const ITaskSP& task) override;
+
+    virtual uint32_t addParallelFor(const uint32_t begin, const uint32_t end, const uint32_t grainSize, const TaskGraphRangeFunction& function) override;
+
+    virtual VkBool32 addDependency(const uint32_t predecessor, const uint32_t successor) override;
+
+    virtual VkBool32 run() override;
+
+    virtual VkBool32 wait(const uint32_t handle) const override;
+
+    virtual VkBool32 wait() const override;
+
+    virtual VkBool32 isDone() const override;
+
+    virtual void reset() override;
+
+    virtual uint32_t getTaskCount() const override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKGRAPH_HPP_ */
@@ -0,0 +1,64 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskGraphTask.hpp"
+
+namespace vkts
+{
+
+VkBool32 TaskGraphTask::execute()
+{
+    taskGraph.executeNode((uint32_t)getID(), chunkBegin, chunkEnd);
+
+    // Failures are collected by the graph, as a failed task would stop the task executor.
+    return VK_TRUE;
+}
+
+VkBool32 TaskGraphTask::isDetached() const
+{
+    return VK_TRUE;
+}
+
+TaskGraphTask::TaskGraphTask(TaskGraph& taskGraph, const uint32_t handle, const uint32_t chunkBegin, const uint32_t chunkEnd) :
+    ITask((uint64_t)handle), taskGraph(taskGraph), chunkBegin(chunkBegin), chunkEnd(chunkEnd)
+{
+}
+
+TaskGraphTask::~TaskGraphTask()
+{
+}
+
+VkBool32 TaskGraphTask::runTask(const ITaskSP& task)
+{
+    if (!task.get())
+    {
+        return VK_TRUE;
+    }
+
+    return task->run();
+}
+
+} /* namespace vkts */
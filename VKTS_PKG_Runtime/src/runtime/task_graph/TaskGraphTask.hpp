@@ -0,0 +1,74 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKGRAPHTASK_HPP_
+#define VKTS_TASKGRAPHTASK_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#include "TaskGraph.hpp"
+
+namespace vkts
+{
+
+/**
+ * Executes one node or one chunk of a parallel for node of a task graph.
+ */
+class TaskGraphTask: public ITask
+{
+
+private:
+
+    TaskGraph& taskGraph;
+
+    const uint32_t chunkBegin;
+
+    const uint32_t chunkEnd;
+
+protected:
+
+    virtual VkBool32 execute() override;
+
+    virtual VkBool32 isDetached() const override;
+
+public:
+
+    TaskGraphTask() = delete;
+    TaskGraphTask(const TaskGraphTask& other) = delete;
+    TaskGraphTask(TaskGraphTask&& other) = delete;
+    TaskGraphTask(TaskGraph& taskGraph, const uint32_t handle, const uint32_t chunkBegin, const uint32_t chunkEnd);
+    virtual ~TaskGraphTask();
+
+    TaskGraphTask& operator =(const TaskGraphTask& other) = delete;
+    TaskGraphTask& operator =(TaskGraphTask && other) = delete;
+
+    static VkBool32 runTask(const ITaskSP& task);
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKGRAPHTASK_HPP_ */
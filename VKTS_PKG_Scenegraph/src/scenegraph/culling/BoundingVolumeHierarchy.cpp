@@ -0,0 +1,635 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "BoundingVolumeHierarchy.hpp"
+
+namespace vkts
+{
+
+void BoundingVolumeHierarchy::gatherNodeRecursive(const INodeSP& node, const int32_t parentIndex, const uint32_t objectIndex)
+{
+	if (!node.get())
+	{
+		return;
+	}
+
+	uint32_t nodeIndex = (uint32_t)allNodes.size();
+
+	allNodes.push_back(node);
+	allParentIndices.push_back(parentIndex);
+	allObjectIndices.push_back(objectIndex);
+	allSubMeshOffsets.push_back((uint32_t)allSubMeshes.size());
+	allTransformMatrices.push_back(node->getTransformMatrix());
+
+	allNodeIndices[node.get()] = nodeIndex;
+
+	const auto& allNodeMeshes = node->getMeshes();
+
+	for (uint32_t i = 0; i < allNodeMeshes.size(); i++)
+	{
+		const auto& allMeshSubMeshes = allNodeMeshes[i]->getSubMeshes();
+
+		for (uint32_t k = 0; k < allMeshSubMeshes.size(); k++)
+		{
+			allMeshes.push_back(allNodeMeshes[i]);
+			allSubMeshes.push_back(allMeshSubMeshes[k]);
+			allSubMeshNodeIndices.push_back(nodeIndex);
+
+			// The box of a skinned sub mesh does not cover the animated vertices.
+			allCullable.push_back((allMeshSubMeshes[k]->getVertexBufferType() & VKTS_VERTEX_BUFFER_TYPE_BONES) ? 0 : 1);
+		}
+	}
+
+	for (uint32_t i = 0; i < node->getNumberChildNodes(); i++)
+	{
+		gatherNodeRecursive(node->getChildNodes()[i], (int32_t)nodeIndex, objectIndex);
+	}
+}
+
+void BoundingVolumeHierarchy::updateBox(const uint32_t subMeshIndex, const glm::mat4& transformMatrix)
+{
+	const Aabb& box = allSubMeshes[subMeshIndex]->getAABB();
+
+	glm::vec4 center = (box.getCorner(1) + box.getCorner(0)) * 0.5f;
+	glm::vec3 extent = glm::vec3(box.getCorner(1) - box.getCorner(0)) * 0.5f;
+
+	// Extent of the transformed box, without transforming all eight corners.
+
+	glm::mat3 absoluteMatrix = glm::mat3(transformMatrix);
+
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		absoluteMatrix[i] = glm::abs(absoluteMatrix[i]);
+	}
+
+	glm::vec3 worldCenter = glm::vec3(transformMatrix * glm::vec4(glm::vec3(center), 1.0f));
+	glm::vec3 worldExtent = absoluteMatrix * extent;
+
+	allMinimums[subMeshIndex] = worldCenter - worldExtent;
+	allMaximums[subMeshIndex] = worldCenter + worldExtent;
+}
+
+void BoundingVolumeHierarchy::buildRecursive(const uint32_t begin, const uint32_t end)
+{
+	uint32_t volumeIndex = (uint32_t)allVolumes.size();
+
+	allVolumes.push_back(Volume{allMinimums[allVolumeSubMeshIndices[begin]], allMaximums[allVolumeSubMeshIndices[begin]], 0, begin, 0});
+
+	glm::vec3 centerMinimum = (allVolumes[volumeIndex].minimum + allVolumes[volumeIndex].maximum) * 0.5f;
+	glm::vec3 centerMaximum = centerMinimum;
+
+	for (uint32_t i = begin + 1; i < end; i++)
+	{
+		uint32_t subMeshIndex = allVolumeSubMeshIndices[i];
+
+		allVolumes[volumeIndex].minimum = glm::min(allVolumes[volumeIndex].minimum, allMinimums[subMeshIndex]);
+		allVolumes[volumeIndex].maximum = glm::max(allVolumes[volumeIndex].maximum, allMaximums[subMeshIndex]);
+
+		glm::vec3 center = (allMinimums[subMeshIndex] + allMaximums[subMeshIndex]) * 0.5f;
+
+		centerMinimum = glm::min(centerMinimum, center);
+		centerMaximum = glm::max(centerMaximum, center);
+	}
+
+	glm::vec3 centerExtent = centerMaximum - centerMinimum;
+
+	if (end - begin <= subMeshesPerLeaf || (centerExtent.x <= 0.0f && centerExtent.y <= 0.0f && centerExtent.z <= 0.0f))
+	{
+		allVolumes[volumeIndex].count = end - begin;
+
+		return;
+	}
+
+	// Median split along the longest axis of the centers keeps the hierarchy balanced.
+
+	uint32_t axis = 0;
+
+	if (centerExtent.y > centerExtent[axis])
+	{
+		axis = 1;
+	}
+	if (centerExtent.z > centerExtent[axis])
+	{
+		axis = 2;
+	}
+
+	uint32_t middle = begin + (end - begin) / 2;
+
+	std::nth_element(allVolumeSubMeshIndices.begin() + begin, allVolumeSubMeshIndices.begin() + middle, allVolumeSubMeshIndices.begin() + end, [this, axis](const uint32_t a, const uint32_t b)
+	{
+		return allMinimums[a][axis] + allMaximums[a][axis] < allMinimums[b][axis] + allMaximums[b][axis];
+	});
+
+	buildRecursive(begin, middle);
+
+	allVolumes[volumeIndex].secondChild = (uint32_t)allVolumes.size();
+
+	buildRecursive(middle, end);
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const ISceneSP& scene, const uint32_t subMeshesPerLeaf) :
+	IBoundingVolumeHierarchy(), scene(scene), subMeshesPerLeaf(subMeshesPerLeaf), allNodes(), allParentIndices(), allObjectIndices(), allSubMeshOffsets(), allTransformMatrices(), allNodeVisible(), allNodeAccepted(), allNodeIndices(), allMeshes(), allSubMeshes(), allSubMeshNodeIndices(), allMinimums(), allMaximums(), allCullable(), allDirty(), allVisible(), allVolumes(), allVolumeDirty(), allVolumeSubMeshIndices(), statistics{}
+{
+}
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+}
+
+//
+// IBoundingVolumeHierarchy
+//
+
+const ISceneSP& BoundingVolumeHierarchy::getScene() const
+{
+	return scene;
+}
+
+VkBool32 BoundingVolumeHierarchy::rebuild()
+{
+	allNodes.clear();
+	allParentIndices.clear();
+	allObjectIndices.clear();
+	allSubMeshOffsets.clear();
+	allTransformMatrices.clear();
+	allNodeIndices.clear();
+
+	allMeshes.clear();
+	allSubMeshes.clear();
+	allSubMeshNodeIndices.clear();
+	allCullable.clear();
+
+	allVolumes.clear();
+	allVolumeSubMeshIndices.clear();
+
+	//
+
+	const auto& allObjects = scene->getObjects();
+
+	for (uint32_t i = 0; i < allObjects.size(); i++)
+	{
+		gatherNodeRecursive(allObjects[i]->getRootNode(), -1, i);
+	}
+
+	allSubMeshOffsets.push_back((uint32_t)allSubMeshes.size());
+
+	allNodeVisible.assign(allNodes.size(), 1);
+	allNodeAccepted.assign(allNodes.size(), 0);
+
+	allMinimums.resize(allSubMeshes.size());
+	allMaximums.resize(allSubMeshes.size());
+	allDirty.assign(allSubMeshes.size(), 0);
+	allVisible.assign(allSubMeshes.size(), 1);
+
+	for (uint32_t i = 0; i < (uint32_t)allSubMeshes.size(); i++)
+	{
+		updateBox(i, allTransformMatrices[allSubMeshNodeIndices[i]]);
+
+		if (allCullable[i])
+		{
+			allVolumeSubMeshIndices.push_back(i);
+		}
+	}
+
+	if (allVolumeSubMeshIndices.size() > 0)
+	{
+		buildRecursive(0, (uint32_t)allVolumeSubMeshIndices.size());
+	}
+
+	allVolumeDirty.assign(allVolumes.size(), 0);
+
+	statistics = VkTsCullStatistics{};
+
+	return VK_TRUE;
+}
+
+void BoundingVolumeHierarchy::refit()
+{
+	VkBool32 anyDirty = VK_FALSE;
+
+	for (uint32_t i = 0; i < (uint32_t)allNodes.size(); i++)
+	{
+		if (allSubMeshOffsets[i] == allSubMeshOffsets[i + 1])
+		{
+			continue;
+		}
+
+		const glm::mat4& transformMatrix = allNodes[i]->getTransformMatrix();
+
+		if (transformMatrix == allTransformMatrices[i])
+		{
+			continue;
+		}
+
+		allTransformMatrices[i] = transformMatrix;
+
+		for (uint32_t k = allSubMeshOffsets[i]; k < allSubMeshOffsets[i + 1]; k++)
+		{
+			updateBox(k, transformMatrix);
+
+			allDirty[k] = 1;
+		}
+
+		anyDirty = VK_TRUE;
+	}
+
+	if (!anyDirty)
+	{
+		return;
+	}
+
+	// Children have a higher index than their parent, so the volumes are refitted bottom up.
+
+	for (uint32_t i = (uint32_t)allVolumes.size(); i > 0; i--)
+	{
+		Volume& volume = allVolumes[i - 1];
+
+		uint8_t volumeDirty = 0;
+
+		if (volume.count > 0)
+		{
+			for (uint32_t k = volume.first; k < volume.first + volume.count; k++)
+			{
+				volumeDirty |= allDirty[allVolumeSubMeshIndices[k]];
+			}
+
+			if (volumeDirty)
+			{
+				uint32_t subMeshIndex = allVolumeSubMeshIndices[volume.first];
+
+				volume.minimum = allMinimums[subMeshIndex];
+				volume.maximum = allMaximums[subMeshIndex];
+
+				for (uint32_t k = volume.first + 1; k < volume.first + volume.count; k++)
+				{
+					subMeshIndex = allVolumeSubMeshIndices[k];
+
+					volume.minimum = glm::min(volume.minimum, allMinimums[subMeshIndex]);
+					volume.maximum = glm::max(volume.maximum, allMaximums[subMeshIndex]);
+				}
+			}
+		}
+		else
+		{
+			const Volume& firstChild = allVolumes[i];
+			const Volume& secondChild = allVolumes[volume.secondChild];
+
+			volumeDirty = allVolumeDirty[i] | allVolumeDirty[volume.secondChild];
+
+			if (volumeDirty)
+			{
+				volume.minimum = glm::min(firstChild.minimum, secondChild.minimum);
+				volume.maximum = glm::max(firstChild.maximum, secondChild.maximum);
+			}
+		}
+
+		allVolumeDirty[i - 1] = volumeDirty;
+	}
+
+	std::fill(allDirty.begin(), allDirty.end(), 0);
+	std::fill(allVolumeDirty.begin(), allVolumeDirty.end(), 0);
+}
+
+uint32_t BoundingVolumeHierarchy::getNumberVolumes() const
+{
+	return (uint32_t)allVolumes.size();
+}
+
+uint32_t BoundingVolumeHierarchy::getNumberSubMeshes() const
+{
+	return (uint32_t)allSubMeshes.size();
+}
+
+void BoundingVolumeHierarchy::cull(const Frustum& frustum)
+{
+	statistics = VkTsCullStatistics{};
+
+	// Sub meshes not being part of the hierarchy stay visible.
+
+	for (uint32_t i = 0; i < (uint32_t)allSubMeshes.size(); i++)
+	{
+		allVisible[i] = allCullable[i] ? 0 : 1;
+	}
+
+	if (allVolumes.size() > 0)
+	{
+		uint32_t stackVolumes[VKTS_BOUNDING_VOLUME_STACK_SIZE];
+		uint32_t stackPlaneMasks[VKTS_BOUNDING_VOLUME_STACK_SIZE];
+		uint32_t stackSize = 0;
+
+		stackVolumes[stackSize] = 0;
+		stackPlaneMasks[stackSize] = VKTS_FRUSTUM_PLANE_MASK_ALL;
+		stackSize++;
+
+		while (stackSize > 0)
+		{
+			stackSize--;
+
+			uint32_t volumeIndex = stackVolumes[stackSize];
+
+			const Volume& volume = allVolumes[volumeIndex];
+			uint32_t planeMask = stackPlaneMasks[stackSize];
+
+			// Volumes completely inside the frustum are accepted without any further test.
+
+			if (planeMask)
+			{
+				statistics.volumeTestCount++;
+
+				if (!frustum.isVisible(volume.minimum, volume.maximum, planeMask))
+				{
+					continue;
+				}
+			}
+
+			if (volume.count > 0)
+			{
+				for (uint32_t k = volume.first; k < volume.first + volume.count; k++)
+				{
+					uint32_t subMeshIndex = allVolumeSubMeshIndices[k];
+
+					uint32_t subMeshPlaneMask = planeMask;
+
+					if (subMeshPlaneMask)
+					{
+						statistics.volumeTestCount++;
+					}
+
+					allVisible[subMeshIndex] = frustum.isVisible(allMinimums[subMeshIndex], allMaximums[subMeshIndex], subMeshPlaneMask) ? 1 : 0;
+				}
+
+				continue;
+			}
+
+			if (stackSize + 2 > VKTS_BOUNDING_VOLUME_STACK_SIZE)
+			{
+				logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bounding volume hierarchy too deep");
+
+				continue;
+			}
+
+			stackVolumes[stackSize] = volume.secondChild;
+			stackPlaneMasks[stackSize] = planeMask;
+			stackSize++;
+
+			stackVolumes[stackSize] = volumeIndex + 1;
+			stackPlaneMasks[stackSize] = planeMask;
+			stackSize++;
+		}
+	}
+
+	// A node is visible, if one of its sub meshes is visible. Visibility is propagated to the parents, as children are stored after their parent.
+
+	for (uint32_t i = 0; i < (uint32_t)allNodes.size(); i++)
+	{
+		uint8_t nodeVisible = 0;
+
+		for (uint32_t k = allSubMeshOffsets[i]; k < allSubMeshOffsets[i + 1]; k++)
+		{
+			if (allVisible[k])
+			{
+				statistics.subMeshVisibleCount++;
+			}
+			else
+			{
+				statistics.subMeshCulledCount++;
+			}
+
+			nodeVisible |= allVisible[k];
+		}
+
+		if (allSubMeshOffsets[i] != allSubMeshOffsets[i + 1])
+		{
+			if (nodeVisible)
+			{
+				statistics.nodeVisibleCount++;
+			}
+			else
+			{
+				statistics.nodeCulledCount++;
+			}
+		}
+
+		allNodeVisible[i] = nodeVisible;
+	}
+
+	for (uint32_t i = (uint32_t)allNodes.size(); i > 0; i--)
+	{
+		int32_t parentIndex = allParentIndices[i - 1];
+
+		if (parentIndex >= 0)
+		{
+			allNodeVisible[parentIndex] |= allNodeVisible[i - 1];
+		}
+	}
+}
+
+VkBool32 BoundingVolumeHierarchy::isSubMeshVisible(const uint32_t index) const
+{
+	if (index >= (uint32_t)allVisible.size())
+	{
+		return VK_FALSE;
+	}
+
+	return (VkBool32)allVisible[index];
+}
+
+VkBool32 BoundingVolumeHierarchy::isNodeVisible(const INode& node) const
+{
+	auto foundNode = allNodeIndices.find(&node);
+
+	if (foundNode == allNodeIndices.end())
+	{
+		return VK_TRUE;
+	}
+
+	return (VkBool32)allNodeVisible[foundNode->second];
+}
+
+const VkTsCullStatistics& BoundingVolumeHierarchy::getStatistics() const
+{
+	return statistics;
+}
+
+void BoundingVolumeHierarchy::collect(IRenderQueue& renderQueue, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const uint32_t objectOffset, const uint32_t objectStep, const uint32_t objectLimit)
+{
+	VkTsDrawPacket drawPacket{};
+
+    const OverwriteDraw* currentOverwrite = renderOverwrite;
+    while (currentOverwrite)
+    {
+    	if (!currentOverwrite->visit(*scene, drawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, objectOffset, objectStep, objectLimit))
+    	{
+    		return;
+    	}
+
+    	currentOverwrite = currentOverwrite->getNextOverwrite();
+    }
+
+    //
+
+    if (objectStep == 0)
+    {
+        return;
+    }
+
+    // Overwrites are visited in the same order as by the recursive collect, but only for the visible nodes.
+
+    uint32_t currentObjectIndex = UINT32_MAX;
+    VkBool32 objectAccepted = VK_FALSE;
+    VkTsDrawPacket objectDrawPacket{};
+
+	for (uint32_t i = 0; i < (uint32_t)allNodes.size(); i++)
+	{
+		allNodeAccepted[i] = 0;
+
+		uint32_t objectIndex = allObjectIndices[i];
+
+		if (objectIndex < objectOffset || objectIndex >= objectLimit || ((objectIndex - objectOffset) % objectStep) != 0)
+		{
+			continue;
+		}
+
+		if (!allNodeVisible[i])
+		{
+			continue;
+		}
+
+		int32_t parentIndex = allParentIndices[i];
+
+		if (parentIndex >= 0 && !allNodeAccepted[parentIndex])
+		{
+			continue;
+		}
+
+		if (objectIndex != currentObjectIndex)
+		{
+			currentObjectIndex = objectIndex;
+
+			objectDrawPacket = drawPacket;
+			objectAccepted = VK_TRUE;
+
+		    currentOverwrite = renderOverwrite;
+		    while (currentOverwrite)
+		    {
+		    	if (!currentOverwrite->visit(*scene->getObjects()[objectIndex], objectDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings))
+		    	{
+		    		objectAccepted = VK_FALSE;
+
+		    		break;
+		    	}
+
+		    	currentOverwrite = currentOverwrite->getNextOverwrite();
+		    }
+		}
+
+		if (!objectAccepted)
+		{
+			continue;
+		}
+
+		//
+
+		const auto& node = allNodes[i];
+
+		VkTsDrawPacket nodeDrawPacket = objectDrawPacket;
+
+		VkBool32 nodeAccepted = VK_TRUE;
+
+	    currentOverwrite = renderOverwrite;
+	    while (currentOverwrite)
+	    {
+	    	if (!currentOverwrite->visit(*node, nodeDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings))
+	    	{
+	    		nodeAccepted = VK_FALSE;
+
+	    		break;
+	    	}
+
+	    	currentOverwrite = currentOverwrite->getNextOverwrite();
+	    }
+
+	    if (!nodeAccepted)
+	    {
+	    	continue;
+	    }
+
+	    allNodeAccepted[i] = 1;
+
+	    if (allSubMeshOffsets[i] == allSubMeshOffsets[i + 1])
+	    {
+	    	continue;
+	    }
+
+		nodeDrawPacket.depth = -(renderQueue.getViewMatrix() * node->getTransformMatrix() * node->getAABB().getSphere().getCenter()).z;
+
+		nodeDrawPacket.transformMatrix = node->getTransformMatrix();
+
+		// Sub meshes of the same mesh are stored one after the other.
+
+		const IMesh* currentMesh = nullptr;
+		VkBool32 meshAccepted = VK_FALSE;
+		VkTsDrawPacket meshDrawPacket{};
+
+		for (uint32_t k = allSubMeshOffsets[i]; k < allSubMeshOffsets[i + 1]; k++)
+		{
+			if (!allVisible[k])
+			{
+				continue;
+			}
+
+			if (allMeshes[k].get() != currentMesh)
+			{
+				currentMesh = allMeshes[k].get();
+
+				meshDrawPacket = nodeDrawPacket;
+				meshAccepted = VK_TRUE;
+
+			    currentOverwrite = renderOverwrite;
+			    while (currentOverwrite)
+			    {
+			    	if (!currentOverwrite->visit(*currentMesh, meshDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings))
+			    	{
+			    		meshAccepted = VK_FALSE;
+
+			    		break;
+			    	}
+
+			    	currentOverwrite = currentOverwrite->getNextOverwrite();
+			    }
+			}
+
+			if (!meshAccepted)
+			{
+				continue;
+			}
+
+			allSubMeshes[k]->collectRecursive(renderQueue, meshDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite, node->getName());
+		}
+	}
+}
+
+} /* namespace vkts */
@@ -0,0 +1,131 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_BOUNDINGVOLUMEHIERARCHY_HPP_
+#define VKTS_BOUNDINGVOLUMEHIERARCHY_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+#define VKTS_BOUNDING_VOLUME_STACK_SIZE 64
+
+namespace vkts
+{
+
+class BoundingVolumeHierarchy: public IBoundingVolumeHierarchy
+{
+
+private:
+
+	// Leaves have a count greater zero and reference their sub meshes. The first child follows its parent, so children always have a higher index.
+
+	struct Volume
+	{
+		glm::vec3 minimum;
+		glm::vec3 maximum;
+		uint32_t secondChild;
+		uint32_t first;
+		uint32_t count;
+	};
+
+	const ISceneSP scene;
+
+	const uint32_t subMeshesPerLeaf;
+
+	// Flattened nodes, parents are stored before their children.
+
+	std::vector<INodeSP> allNodes;
+	std::vector<int32_t> allParentIndices;
+	std::vector<uint32_t> allObjectIndices;
+	std::vector<uint32_t> allSubMeshOffsets;
+	std::vector<glm::mat4> allTransformMatrices;
+	std::vector<uint8_t> allNodeVisible;
+	std::vector<uint8_t> allNodeAccepted;
+
+	std::map<const INode*, uint32_t> allNodeIndices;
+
+	// Sub meshes, ordered by their node, structure of arrays.
+
+	std::vector<IMeshSP> allMeshes;
+	std::vector<ISubMeshSP> allSubMeshes;
+	std::vector<uint32_t> allSubMeshNodeIndices;
+	std::vector<glm::vec3> allMinimums;
+	std::vector<glm::vec3> allMaximums;
+	std::vector<uint8_t> allCullable;
+	std::vector<uint8_t> allDirty;
+	std::vector<uint8_t> allVisible;
+
+	std::vector<Volume> allVolumes;
+	std::vector<uint8_t> allVolumeDirty;
+	std::vector<uint32_t> allVolumeSubMeshIndices;
+
+	VkTsCullStatistics statistics;
+
+	void gatherNodeRecursive(const INodeSP& node, const int32_t parentIndex, const uint32_t objectIndex);
+
+	void updateBox(const uint32_t subMeshIndex, const glm::mat4& transformMatrix);
+
+	void buildRecursive(const uint32_t begin, const uint32_t end);
+
+public:
+
+	BoundingVolumeHierarchy() = delete;
+	BoundingVolumeHierarchy(const ISceneSP& scene, const uint32_t subMeshesPerLeaf);
+	BoundingVolumeHierarchy(const BoundingVolumeHierarchy& other) = delete;
+	BoundingVolumeHierarchy(BoundingVolumeHierarchy&& other) = delete;
+    virtual ~BoundingVolumeHierarchy();
+
+    BoundingVolumeHierarchy& operator =(const BoundingVolumeHierarchy& other) = delete;
+    BoundingVolumeHierarchy& operator =(BoundingVolumeHierarchy && other) = delete;
+
+    //
+    // IBoundingVolumeHierarchy
+    //
+
+    virtual const ISceneSP& getScene() const override;
+
+    virtual VkBool32 rebuild() override;
+
+    virtual void refit() override;
+
+    virtual uint32_t getNumberVolumes() const override;
+
+    virtual uint32_t getNumberSubMeshes() const override;
+
+    virtual void cull(const Frustum& frustum) override;
+
+    virtual VkBool32 isSubMeshVisible(const uint32_t index) const override;
+
+    virtual VkBool32 isNodeVisible(const INode& node) const override;
+
+    virtual const VkTsCullStatistics& getStatistics() const override;
+
+    virtual void collect(IRenderQueue& renderQueue, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr, const uint32_t objectOffset = 0, const uint32_t objectStep = 1, const uint32_t objectLimit = UINT32_MAX) override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_BOUNDINGVOLUMEHIERARCHY_HPP_ */
@@ -0,0 +1,485 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TransformHierarchy.hpp"
+
+namespace vkts
+{
+
+void TransformHierarchy::gatherNodeRecursive(const INodeSP& node, const int32_t parentIndex, const uint32_t objectIndex, const int32_t armatureIndex, const uint32_t level, std::vector<std::vector<uint32_t>>& allLevels)
+{
+	if (!node.get())
+	{
+		return;
+	}
+
+	uint32_t nodeIndex = (uint32_t)allNodes.size();
+
+	allNodes.push_back(node);
+	allParentIndices.push_back(parentIndex);
+	allObjectIndices.push_back(objectIndex);
+	allArmatureIndices.push_back(node->isArmature() ? (int32_t)nodeIndex : armatureIndex);
+
+	if (level >= (uint32_t)allLevels.size())
+	{
+		allLevels.resize(level + 1);
+	}
+
+	allLevels[level].push_back(nodeIndex);
+
+	for (uint32_t i = 0; i < node->getNumberChildNodes(); i++)
+	{
+		gatherNodeRecursive(node->getChildNodes()[i], (int32_t)nodeIndex, objectIndex, allArmatureIndices[nodeIndex], level + 1, allLevels);
+	}
+}
+
+VkBool32 TransformHierarchy::addUniformBuffers()
+{
+	if (!uploadBatch.get())
+	{
+		return VK_TRUE;
+	}
+
+	for (uint32_t i = 0; i < (uint32_t)allNodes.size(); i++)
+	{
+		if (allNodes[i]->getTransformUniformBuffer().get() && !uploadBatch->addBufferObject(allNodes[i]->getTransformUniformBuffer()))
+		{
+			return VK_FALSE;
+		}
+
+		if (allNodes[i]->getJointsUniformBuffer().get() && !uploadBatch->addBufferObject(allNodes[i]->getJointsUniformBuffer()))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
+
+VkBool32 TransformHierarchy::updateLevel(const uint32_t begin, const uint32_t end)
+{
+	for (uint32_t i = begin; i < end; i++)
+	{
+		const auto& node = allNodes[i];
+
+		int32_t parentIndex = allParentIndices[i];
+
+		const glm::mat4& parentTransformMatrix = parentIndex >= 0 ? allTransformMatrices[parentIndex] : allObjectTransformMatrices[allObjectIndices[i]];
+		VkBool32 parentTransformMatrixDirty = parentIndex >= 0 ? allDirty[parentIndex] : allObjectDirty[allObjectIndices[i]];
+		VkBool32 parentActive = parentIndex >= 0 ? allActive[parentIndex] : allObjectActive[allObjectIndices[i]];
+
+		allDirty[i] = VK_FALSE;
+		allActive[i] = VK_FALSE;
+
+		if (!parentActive)
+		{
+			continue;
+		}
+
+		// The overwrite is visited with the armature of the parent, as done by the recursive update.
+
+		int32_t armatureIndex = parentIndex >= 0 ? allArmatureIndices[parentIndex] : -1;
+
+		VkBool32 visit = VK_TRUE;
+
+	    const OverwriteUpdate* currentOverwrite = updateOverwrite;
+	    while (currentOverwrite)
+	    {
+	    	if (!currentOverwrite->visit(*node, deltaTime, deltaTicks, tickTime, currentBuffer, parentTransformMatrix, parentTransformMatrixDirty, armatureIndex >= 0 ? allNodes[armatureIndex].get() : nullptr))
+	    	{
+	    		visit = VK_FALSE;
+
+	    		break;
+	    	}
+
+	    	currentOverwrite = currentOverwrite->getNextOverwrite();
+	    }
+
+	    if (!visit)
+	    {
+	    	continue;
+	    }
+
+	    //
+
+		VkBool32 transformMatrixDirty = node->updateLocalTransform(deltaTime, currentBuffer, parentTransformMatrixDirty);
+
+		const glm::vec3& translate = node->getFinalTranslate();
+		const Quat& rotate = node->getFinalRotate();
+		const glm::vec3& scale = node->getFinalScale();
+
+		allTranslateX[i] = translate.x;
+		allTranslateY[i] = translate.y;
+		allTranslateZ[i] = translate.z;
+		allRotateX[i] = rotate.x;
+		allRotateY[i] = rotate.y;
+		allRotateZ[i] = rotate.z;
+		allRotateW[i] = rotate.w;
+		allScaleX[i] = scale.x;
+		allScaleY[i] = scale.y;
+		allScaleZ[i] = scale.z;
+
+		allDirty[i] = (uint8_t)transformMatrixDirty;
+		allActive[i] = VK_TRUE;
+	}
+
+	// Same local matrices as translateMat4() * Quat::mat4() * scaleMat4(). The parent matrix is multiplied afterwards, as in the recursive update.
+
+	composeMat4Batch(&allTranslateX[begin], &allTranslateY[begin], &allTranslateZ[begin], &allRotateX[begin], &allRotateY[begin], &allRotateZ[begin], &allRotateW[begin], &allScaleX[begin], &allScaleY[begin], &allScaleZ[begin], end - begin, &allLocalTransformMatrices[begin]);
+
+	for (uint32_t i = begin; i < end; i++)
+	{
+		if (!allActive[i] || !allDirty[i])
+		{
+			continue;
+		}
+
+		int32_t parentIndex = allParentIndices[i];
+
+		const glm::mat4& parentTransformMatrix = parentIndex >= 0 ? allTransformMatrices[parentIndex] : allObjectTransformMatrices[allObjectIndices[i]];
+
+		allTransformMatrices[i] = parentTransformMatrix * allLocalTransformMatrices[i];
+	}
+
+	normalMat3Batch(&allTransformMatrices[begin], end - begin, &allTransformNormalMatrices[begin]);
+
+	return VK_TRUE;
+}
+
+VkBool32 TransformHierarchy::uploadGroups(const uint32_t begin, const uint32_t end)
+{
+	VkBool32 result = VK_TRUE;
+
+	for (uint32_t group = begin; group < end; group++)
+	{
+		for (uint32_t k = allGroupOffsets[group]; k < allGroupOffsets[group + 1]; k++)
+		{
+			uint32_t i = allGroupNodeIndices[k];
+
+			if (!allActive[i] || !allDirty[i])
+			{
+				continue;
+			}
+
+			if (!allNodes[i]->updateTransform(currentBuffer, allTransformMatrices[i], allArmatureIndices[i] >= 0 ? allNodes[allArmatureIndices[i]] : INodeSP(), &allTransformNormalMatrices[i]))
+			{
+				result = VK_FALSE;
+			}
+		}
+	}
+
+	return result;
+}
+
+TransformHierarchy::TransformHierarchy(const IUpdateThreadContext& updateContext, const ISceneSP& scene, const uint32_t grainSize) :
+	ITransformHierarchy(), scene(scene), grainSize(glm::max(grainSize, 1u)), taskGraph(taskGraphCreate(updateContext)), uploadBatch(), allNodes(), allParentIndices(), allObjectIndices(), allArmatureIndices(), allLevelOffsets(), allTranslateX(), allTranslateY(), allTranslateZ(), allRotateX(), allRotateY(), allRotateZ(), allRotateW(), allScaleX(), allScaleY(), allScaleZ(), allLocalTransformMatrices(), allTransformMatrices(), allTransformNormalMatrices(), allDirty(), allActive(), allObjectTransformMatrices(), allObjectDirty(), allObjectActive(), allGroupNodeIndices(), allGroupOffsets(), deltaTime(0.0), deltaTicks(0), tickTime(0.0), currentBuffer(0), updateOverwrite(nullptr)
+{
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+	if (taskGraph.get())
+	{
+		taskGraph->wait();
+	}
+}
+
+//
+// ITransformHierarchy
+//
+
+const ISceneSP& TransformHierarchy::getScene() const
+{
+	return scene;
+}
+
+VkBool32 TransformHierarchy::rebuild()
+{
+	if (!taskGraph.get())
+	{
+		return VK_FALSE;
+	}
+
+	taskGraph->wait();
+	taskGraph->reset();
+
+	allNodes.clear();
+	allParentIndices.clear();
+	allObjectIndices.clear();
+	allArmatureIndices.clear();
+	allLevelOffsets.clear();
+
+	//
+
+	std::vector<std::vector<uint32_t>> allLevels;
+
+	const auto& allObjects = scene->getObjects();
+
+	for (uint32_t i = 0; i < allObjects.size(); i++)
+	{
+		gatherNodeRecursive(allObjects[i]->getRootNode(), -1, i, -1, 0, allLevels);
+	}
+
+	// Sort the nodes by level. Parents are always stored before their children.
+
+	std::vector<uint32_t> allSortedIndices(allNodes.size());
+
+	allLevelOffsets.push_back(0);
+
+	for (uint32_t level = 0; level < (uint32_t)allLevels.size(); level++)
+	{
+		for (uint32_t k = 0; k < (uint32_t)allLevels[level].size(); k++)
+		{
+			allSortedIndices[allLevels[level][k]] = allLevelOffsets.back() + k;
+		}
+
+		allLevelOffsets.push_back(allLevelOffsets.back() + (uint32_t)allLevels[level].size());
+	}
+
+	std::vector<INodeSP> allUnsortedNodes(allNodes.size());
+	std::vector<int32_t> allUnsortedParentIndices(allNodes.size());
+	std::vector<uint32_t> allUnsortedObjectIndices(allNodes.size());
+	std::vector<int32_t> allUnsortedArmatureIndices(allNodes.size());
+
+	allUnsortedNodes.swap(allNodes);
+	allUnsortedParentIndices.swap(allParentIndices);
+	allUnsortedObjectIndices.swap(allObjectIndices);
+	allUnsortedArmatureIndices.swap(allArmatureIndices);
+
+	for (uint32_t i = 0; i < (uint32_t)allUnsortedNodes.size(); i++)
+	{
+		uint32_t sortedIndex = allSortedIndices[i];
+
+		allNodes[sortedIndex] = allUnsortedNodes[i];
+		allParentIndices[sortedIndex] = allUnsortedParentIndices[i] >= 0 ? (int32_t)allSortedIndices[allUnsortedParentIndices[i]] : -1;
+		allObjectIndices[sortedIndex] = allUnsortedObjectIndices[i];
+		allArmatureIndices[sortedIndex] = allUnsortedArmatureIndices[i] >= 0 ? (int32_t)allSortedIndices[allUnsortedArmatureIndices[i]] : -1;
+	}
+
+	//
+
+	allTranslateX.assign(allNodes.size(), 0.0f);
+	allTranslateY.assign(allNodes.size(), 0.0f);
+	allTranslateZ.assign(allNodes.size(), 0.0f);
+	allRotateX.assign(allNodes.size(), 0.0f);
+	allRotateY.assign(allNodes.size(), 0.0f);
+	allRotateZ.assign(allNodes.size(), 0.0f);
+	allRotateW.assign(allNodes.size(), 1.0f);
+	allScaleX.assign(allNodes.size(), 1.0f);
+	allScaleY.assign(allNodes.size(), 1.0f);
+	allScaleZ.assign(allNodes.size(), 1.0f);
+
+	allLocalTransformMatrices.resize(allNodes.size());
+	allTransformMatrices.resize(allNodes.size());
+	allTransformNormalMatrices.resize(allNodes.size());
+	allDirty.assign(allNodes.size(), VK_FALSE);
+	allActive.assign(allNodes.size(), VK_FALSE);
+
+	for (uint32_t i = 0; i < (uint32_t)allNodes.size(); i++)
+	{
+		allTransformMatrices[i] = allNodes[i]->getTransformMatrix();
+	}
+
+	allObjectTransformMatrices.resize(allObjects.size());
+	allObjectDirty.assign(allObjects.size(), VK_FALSE);
+	allObjectActive.assign(allObjects.size(), VK_FALSE);
+
+	// Joints are uploaded to the uniform buffer of their armature, so the armature and its joints are uploaded by the same task.
+
+	std::vector<int32_t> allNodeGroups(allNodes.size(), -1);
+	std::vector<uint32_t> allGroupSizes;
+
+	for (uint32_t i = 0; i < (uint32_t)allNodes.size(); i++)
+	{
+		if (allNodes[i]->isJoint() && allArmatureIndices[i] >= 0 && allNodeGroups[allArmatureIndices[i]] >= 0)
+		{
+			allNodeGroups[i] = allNodeGroups[allArmatureIndices[i]];
+		}
+		else
+		{
+			allNodeGroups[i] = (int32_t)allGroupSizes.size();
+
+			allGroupSizes.push_back(0);
+		}
+
+		allGroupSizes[allNodeGroups[i]]++;
+	}
+
+	allGroupOffsets.assign(allGroupSizes.size() + 1, 0);
+
+	for (uint32_t group = 0; group < (uint32_t)allGroupSizes.size(); group++)
+	{
+		allGroupOffsets[group + 1] = allGroupOffsets[group] + allGroupSizes[group];
+	}
+
+	allGroupNodeIndices.resize(allNodes.size());
+
+	std::vector<uint32_t> allGroupFill(allGroupOffsets.begin(), allGroupOffsets.end() - 1);
+
+	for (uint32_t i = 0; i < (uint32_t)allNodes.size(); i++)
+	{
+		allGroupNodeIndices[allGroupFill[allNodeGroups[i]]++] = i;
+	}
+
+	// One parallel for per level, each depending on the previous one. The uploads are done last.
+
+	uint32_t previousHandle = 0;
+
+	for (uint32_t level = 0; level < getNumberLevels(); level++)
+	{
+		uint32_t handle = taskGraph->addParallelFor(allLevelOffsets[level], allLevelOffsets[level + 1], grainSize, [this](const uint32_t begin, const uint32_t end) { return updateLevel(begin, end); });
+
+		if (level > 0 && !taskGraph->addDependency(previousHandle, handle))
+		{
+			return VK_FALSE;
+		}
+
+		previousHandle = handle;
+	}
+
+	if (allGroupSizes.size() > 0)
+	{
+		uint32_t handle = taskGraph->addParallelFor(0, (uint32_t)allGroupSizes.size(), grainSize, [this](const uint32_t begin, const uint32_t end) { return uploadGroups(begin, end); });
+
+		if (!taskGraph->addDependency(previousHandle, handle))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return addUniformBuffers();
+}
+
+uint32_t TransformHierarchy::getNumberNodes() const
+{
+	return (uint32_t)allNodes.size();
+}
+
+uint32_t TransformHierarchy::getNumberLevels() const
+{
+	return allLevelOffsets.size() > 0 ? (uint32_t)allLevelOffsets.size() - 1 : 0;
+}
+
+const INodeSP& TransformHierarchy::getNode(const uint32_t index) const
+{
+	return allNodes[index];
+}
+
+int32_t TransformHierarchy::getParentIndex(const uint32_t index) const
+{
+	return allParentIndices[index];
+}
+
+const glm::mat4& TransformHierarchy::getTransformMatrix(const uint32_t index) const
+{
+	return allTransformMatrices[index];
+}
+
+const IUniformUploadBatchSP& TransformHierarchy::getUploadBatch() const
+{
+	return uploadBatch;
+}
+
+VkBool32 TransformHierarchy::setUploadBatch(const IUniformUploadBatchSP& uploadBatch)
+{
+	this->uploadBatch = uploadBatch;
+
+	return addUniformBuffers();
+}
+
+VkBool32 TransformHierarchy::updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const OverwriteUpdate* updateOverwrite)
+{
+    const OverwriteUpdate* currentOverwrite = updateOverwrite;
+    while (currentOverwrite)
+    {
+    	if (!currentOverwrite->visit(*scene, deltaTime, deltaTicks, tickTime, currentBuffer, 0, 1, UINT32_MAX))
+    	{
+    		return VK_TRUE;
+    	}
+
+    	currentOverwrite = currentOverwrite->getNextOverwrite();
+    }
+
+    //
+
+    const auto& allObjects = scene->getObjects();
+
+    if (allObjects.size() != allObjectActive.size())
+    {
+    	logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Transform hierarchy not rebuilt");
+
+    	return VK_FALSE;
+    }
+
+	this->deltaTime = deltaTime;
+	this->deltaTicks = deltaTicks;
+	this->tickTime = tickTime;
+	this->currentBuffer = currentBuffer;
+	this->updateOverwrite = updateOverwrite;
+
+    // Objects are few, so they are updated before the levels.
+
+    for (uint32_t i = 0; i < allObjects.size(); i++)
+    {
+    	allObjectActive[i] = (uint8_t)allObjects[i]->updateTransform(deltaTime, deltaTicks, tickTime, currentBuffer, updateOverwrite);
+
+    	allObjectDirty[i] = (uint8_t)allObjects[i]->getDirty();
+    	allObjectTransformMatrices[i] = allObjects[i]->getTransformMatrix();
+    }
+
+    //
+
+    VkBool32 result = VK_TRUE;
+
+    if (taskGraph->getTaskCount() > 0)
+    {
+    	if (!taskGraph->run())
+    	{
+    		return VK_FALSE;
+    	}
+
+    	result = taskGraph->wait();
+    }
+
+    //
+
+    for (uint32_t i = 0; i < allObjects.size(); i++)
+    {
+    	if (allObjectActive[i])
+    	{
+    		allObjects[i]->setDirty(VK_FALSE);
+    	}
+    }
+
+    if (uploadBatch.get() && !uploadBatch->flush())
+    {
+    	return VK_FALSE;
+    }
+
+    return result;
+}
+
+} /* namespace vkts */
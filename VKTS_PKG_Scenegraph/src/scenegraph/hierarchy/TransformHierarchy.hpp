@@ -0,0 +1,142 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TRANSFORMHIERARCHY_HPP_
+#define VKTS_TRANSFORMHIERARCHY_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+class TransformHierarchy: public ITransformHierarchy
+{
+
+private:
+
+	const ISceneSP scene;
+
+	const uint32_t grainSize;
+
+	ITaskGraphSP taskGraph;
+
+	IUniformUploadBatchSP uploadBatch;
+
+	// Flattened nodes, sorted by level.
+
+	std::vector<INodeSP> allNodes;
+	std::vector<int32_t> allParentIndices;
+	std::vector<uint32_t> allObjectIndices;
+	std::vector<int32_t> allArmatureIndices;
+
+	std::vector<uint32_t> allLevelOffsets;
+
+	// Per node state, structure of arrays, as read by the batch kernels.
+
+	std::vector<float> allTranslateX;
+	std::vector<float> allTranslateY;
+	std::vector<float> allTranslateZ;
+	std::vector<float> allRotateX;
+	std::vector<float> allRotateY;
+	std::vector<float> allRotateZ;
+	std::vector<float> allRotateW;
+	std::vector<float> allScaleX;
+	std::vector<float> allScaleY;
+	std::vector<float> allScaleZ;
+
+	std::vector<glm::mat4> allLocalTransformMatrices;
+	std::vector<glm::mat4> allTransformMatrices;
+	std::vector<glm::mat3> allTransformNormalMatrices;
+	std::vector<uint8_t> allDirty;
+	std::vector<uint8_t> allActive;
+
+	// Per object state.
+
+	std::vector<glm::mat4> allObjectTransformMatrices;
+	std::vector<uint8_t> allObjectDirty;
+	std::vector<uint8_t> allObjectActive;
+
+	// Nodes uploading to the same uniform buffer are in the same group.
+
+	std::vector<uint32_t> allGroupNodeIndices;
+	std::vector<uint32_t> allGroupOffsets;
+
+	// Parameters of the current update.
+
+	double deltaTime;
+	uint64_t deltaTicks;
+	double tickTime;
+	uint32_t currentBuffer;
+	const OverwriteUpdate* updateOverwrite;
+
+	void gatherNodeRecursive(const INodeSP& node, const int32_t parentIndex, const uint32_t objectIndex, const int32_t armatureIndex, const uint32_t level, std::vector<std::vector<uint32_t>>& allLevels);
+
+	VkBool32 addUniformBuffers();
+
+	VkBool32 updateLevel(const uint32_t begin, const uint32_t end);
+
+	VkBool32 uploadGroups(const uint32_t begin, const uint32_t end);
+
+public:
+
+	TransformHierarchy() = delete;
+	TransformHierarchy(const IUpdateThreadContext& updateContext, const ISceneSP& scene, const uint32_t grainSize);
+	TransformHierarchy(const TransformHierarchy& other) = delete;
+	TransformHierarchy(TransformHierarchy&& other) = delete;
+    virtual ~TransformHierarchy();
+
+    TransformHierarchy& operator =(const TransformHierarchy& other) = delete;
+    TransformHierarchy& operator =(TransformHierarchy && other) = delete;
+
+    //
+    // ITransformHierarchy
+    //
+
+    virtual const ISceneSP& getScene() const override;
+
+    virtual VkBool32 rebuild() override;
+
+    virtual uint32_t getNumberNodes() const override;
+
+    virtual uint32_t getNumberLevels() const override;
+
+    virtual const INodeSP& getNode(const uint32_t index) const override;
+
+    virtual int32_t getParentIndex(const uint32_t index) const override;
+
+    virtual const glm::mat4& getTransformMatrix(const uint32_t index) const override;
+
+    virtual const IUniformUploadBatchSP& getUploadBatch() const override;
+
+    virtual VkBool32 setUploadBatch(const IUniformUploadBatchSP& uploadBatch) override;
+
+    virtual VkBool32 updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const OverwriteUpdate* updateOverwrite = nullptr) override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_TRANSFORMHIERARCHY_HPP_ */
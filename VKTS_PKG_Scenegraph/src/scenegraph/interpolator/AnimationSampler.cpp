@@ -0,0 +1,754 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+#include "fn_interpolate_internal.hpp"
+
+namespace vkts
+{
+
+AnimationSampler::AnimationSampler() :
+	allKeys(), allValues(), allHandles(), allInterpolators(), allOffsets(), allTargetTransforms(), allTargetTransformElements(), allCursors(), allCompressedTracks(), allSamples8(), allSamples16(), allNumberEntries(), allModificationCounters(), allReleasedChannels(), sampleTime(0.0f), maxError(0.0f)
+{
+}
+
+AnimationSampler::~AnimationSampler()
+{
+}
+
+uint32_t AnimationSampler::findEntry(const uint32_t track, const float key)
+{
+	const uint32_t offset = allOffsets[track];
+	const uint32_t numberEntries = allOffsets[track + 1] - offset;
+
+	const float* keys = &allKeys[offset];
+
+	uint32_t cursor = allCursors[track];
+
+	// Key is in between the first and last key, so a valid cursor is below the last entry.
+
+	if (keys[cursor] <= key)
+	{
+		if (key < keys[cursor + 1])
+		{
+			return cursor;
+		}
+
+		// Playing forward, the key is most likely in the next segment.
+
+		if (cursor + 2 < numberEntries && key < keys[cursor + 2])
+		{
+			allCursors[track] = cursor + 1;
+
+			return cursor + 1;
+		}
+	}
+	else if (cursor > 0 && keys[cursor - 1] <= key)
+	{
+		allCursors[track] = cursor - 1;
+
+		return cursor - 1;
+	}
+
+	cursor = (uint32_t)(std::upper_bound(keys, keys + numberEntries, key) - keys) - 1;
+
+	allCursors[track] = cursor;
+
+	return cursor;
+}
+
+VkBool32 AnimationSampler::compressTrack(CompressedTrack& compressedTrack, const IChannelSP& channel)
+{
+	const uint32_t numberEntries = channel->getNumberEntries();
+
+	if (numberEntries == 0)
+	{
+		return VK_FALSE;
+	}
+
+	const auto& keys = channel->getKeys();
+	const auto& values = channel->getValues();
+	const auto& interpolators = channel->getInterpolators();
+
+	const uint32_t lastIndex = numberEntries - 1;
+
+	const float duration = keys[lastIndex] - keys[0];
+
+	const uint64_t keysSize = (uint64_t)numberEntries * (uint64_t)(2 * sizeof(float) + sizeof(glm::vec4) + sizeof(VkTsInterpolator));
+
+	// Values jump at constant interpolated entries, so these tracks can not be resampled.
+
+	VkBool32 resample = duration > 0.0f;
+	VkBool32 linear = VK_TRUE;
+
+	for (uint32_t i = 0; i < lastIndex; i++)
+	{
+		if (interpolators[i] == VKTS_INTERPOLATOR_CONSTANT)
+		{
+			resample = VK_FALSE;
+		}
+		else if (interpolators[i] != VKTS_INTERPOLATOR_LINEAR)
+		{
+			linear = VK_FALSE;
+		}
+	}
+
+	uint32_t numberSamples = 0;
+
+	if (resample)
+	{
+		const float samples = ceilf(duration / sampleTime) + 1.0f;
+
+		// Even 8 bit samples would not be smaller than the keys.
+
+		if (samples >= (float)keysSize)
+		{
+			resample = VK_FALSE;
+		}
+		else
+		{
+			numberSamples = (uint32_t)samples;
+		}
+	}
+
+	// Curves with other interpolators can leave the range of the values, so the range has to be sampled.
+
+	if (!resample && !linear)
+	{
+		return VK_FALSE;
+	}
+
+	float minimum = values[0];
+	float maximum = values[0];
+
+	for (uint32_t i = 1; i < numberEntries; i++)
+	{
+		minimum = glm::min(minimum, values[i]);
+		maximum = glm::max(maximum, values[i]);
+	}
+
+	// Values at the samples and in between the samples.
+
+	std::vector<float> allSampleValues(numberSamples);
+	std::vector<float> allMiddleValues(numberSamples > 0 ? numberSamples - 1 : 0);
+
+	for (uint32_t i = 0; i < numberSamples; i++)
+	{
+		allSampleValues[i] = interpolate(keys[0] + duration * (float)i / (float)(numberSamples - 1), channel);
+
+		minimum = glm::min(minimum, allSampleValues[i]);
+		maximum = glm::max(maximum, allSampleValues[i]);
+
+		if (i + 1 < numberSamples)
+		{
+			allMiddleValues[i] = interpolate(keys[0] + duration * ((float)i + 0.5f) / (float)(numberSamples - 1), channel);
+
+			minimum = glm::min(minimum, allMiddleValues[i]);
+			maximum = glm::max(maximum, allMiddleValues[i]);
+		}
+	}
+
+	compressedTrack.start = keys[0];
+	compressedTrack.rate = 0.0f;
+	compressedTrack.offset = 0;
+	compressedTrack.numberSamples = 0;
+
+	if (maximum - minimum <= 2.0f * maxError)
+	{
+		compressedTrack.encoding = AnimationTrackConstant;
+		compressedTrack.minimum = (minimum + maximum) * 0.5f;
+		compressedTrack.scale = 0.0f;
+
+		return VK_TRUE;
+	}
+
+	if (!resample)
+	{
+		return VK_FALSE;
+	}
+
+	compressedTrack.minimum = minimum;
+	compressedTrack.rate = (float)(numberSamples - 1) / duration;
+	compressedTrack.numberSamples = numberSamples;
+
+	for (uint32_t bits = 8; bits <= 16; bits += 8)
+	{
+		if ((uint64_t)numberSamples * (uint64_t)(bits / 8) >= keysSize)
+		{
+			break;
+		}
+
+		const float steps = (float)((1 << bits) - 1);
+
+		compressedTrack.encoding = bits == 8 ? AnimationTrackQuantized8 : AnimationTrackQuantized16;
+		compressedTrack.scale = (maximum - minimum) / steps;
+		compressedTrack.offset = bits == 8 ? (uint32_t)allSamples8.size() : (uint32_t)allSamples16.size();
+
+		for (uint32_t i = 0; i < numberSamples; i++)
+		{
+			const float quantized = glm::clamp(roundf((allSampleValues[i] - minimum) / compressedTrack.scale), 0.0f, steps);
+
+			if (bits == 8)
+			{
+				allSamples8.push_back((uint8_t)quantized);
+			}
+			else
+			{
+				allSamples16.push_back((uint16_t)quantized);
+			}
+		}
+
+		// Error is measured with the decoder, at the keys, the samples and in between the samples.
+
+		float error = 0.0f;
+
+		for (uint32_t i = 0; i < numberEntries; i++)
+		{
+			error = glm::max(error, fabsf(decode(compressedTrack, keys[i]) - values[i]));
+		}
+
+		for (uint32_t i = 0; i < numberSamples; i++)
+		{
+			error = glm::max(error, fabsf(decodeSample(compressedTrack, i) - allSampleValues[i]));
+
+			if (i + 1 < numberSamples)
+			{
+				error = glm::max(error, fabsf(decode(compressedTrack, keys[0] + duration * ((float)i + 0.5f) / (float)(numberSamples - 1)) - allMiddleValues[i]));
+			}
+		}
+
+		if (error <= maxError)
+		{
+			return VK_TRUE;
+		}
+
+		if (bits == 8)
+		{
+			allSamples8.resize(compressedTrack.offset);
+		}
+		else
+		{
+			allSamples16.resize(compressedTrack.offset);
+		}
+	}
+
+	return VK_FALSE;
+}
+
+float AnimationSampler::decodeSample(const CompressedTrack& compressedTrack, const uint32_t index) const
+{
+	if (compressedTrack.encoding == AnimationTrackQuantized8)
+	{
+		return compressedTrack.minimum + compressedTrack.scale * (float)allSamples8[compressedTrack.offset + index];
+	}
+
+	return compressedTrack.minimum + compressedTrack.scale * (float)allSamples16[compressedTrack.offset + index];
+}
+
+float AnimationSampler::decode(const CompressedTrack& compressedTrack, const float key) const
+{
+	if (compressedTrack.encoding == AnimationTrackConstant)
+	{
+		return compressedTrack.minimum;
+	}
+
+	const float position = (key - compressedTrack.start) * compressedTrack.rate;
+
+	if (position <= 0.0f)
+	{
+		return decodeSample(compressedTrack, 0);
+	}
+
+	const uint32_t lastIndex = compressedTrack.numberSamples - 1;
+
+	if (position >= (float)lastIndex)
+	{
+		return decodeSample(compressedTrack, lastIndex);
+	}
+
+	const uint32_t index = (uint32_t)position;
+
+	const float before = decodeSample(compressedTrack, index);
+	const float after = decodeSample(compressedTrack, index + 1);
+
+	return (after - before) * (position - (float)index) + before;
+}
+
+void AnimationSampler::decodeSegment(const CompressedTrack& compressedTrack, const float key, float& before, float& after, float& t) const
+{
+	if (compressedTrack.encoding == AnimationTrackConstant)
+	{
+		before = compressedTrack.minimum;
+		after = compressedTrack.minimum;
+
+		return;
+	}
+
+	const float position = (key - compressedTrack.start) * compressedTrack.rate;
+
+	if (position <= 0.0f)
+	{
+		before = decodeSample(compressedTrack, 0);
+		after = before;
+
+		return;
+	}
+
+	const uint32_t lastIndex = compressedTrack.numberSamples - 1;
+
+	if (position >= (float)lastIndex)
+	{
+		before = decodeSample(compressedTrack, lastIndex);
+		after = before;
+
+		return;
+	}
+
+	const uint32_t index = (uint32_t)position;
+
+	t = position - (float)index;
+
+	before = decodeSample(compressedTrack, index);
+	after = decodeSample(compressedTrack, index + 1);
+}
+
+VkBool32 AnimationSampler::isUpToDate(const SmartPointerVector<IChannelSP>& allChannels) const
+{
+	if (allOffsets.size() != allChannels.size() + 1)
+	{
+		return VK_FALSE;
+	}
+
+	for (uint32_t i = 0; i < allChannels.size(); i++)
+	{
+		if (allModificationCounters[i] != allChannels[i]->getModificationCounter())
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
+
+void AnimationSampler::build(const SmartPointerVector<IChannelSP>& allChannels, const VkBool32 releaseEntries)
+{
+	reset();
+
+	uint32_t numberEntries = 0;
+
+	for (uint32_t i = 0; i < allChannels.size(); i++)
+	{
+		numberEntries += allChannels[i]->getNumberEntries();
+	}
+
+	// Compressed tracks do not store their keys.
+
+	if (sampleTime <= 0.0f)
+	{
+		allKeys.reserve(numberEntries);
+		allValues.reserve(numberEntries);
+		allHandles.reserve(numberEntries);
+		allInterpolators.reserve(numberEntries);
+	}
+
+	allOffsets.reserve(allChannels.size() + 1);
+	allTargetTransforms.reserve(allChannels.size());
+	allTargetTransformElements.reserve(allChannels.size());
+	allCompressedTracks.reserve(allChannels.size());
+	allNumberEntries.reserve(allChannels.size());
+	allModificationCounters.reserve(allChannels.size());
+	allReleasedChannels.reserve(allChannels.size());
+
+	allOffsets.push_back(0);
+
+	// The rotation components are interpolated with one t, so resampled rotation tracks have to share the sample positions
+	// and can not be mixed with tracks keeping their keys. Constant tracks do not depend on t.
+
+	std::vector<CompressedTrack> allRotateTracks(allChannels.size());
+	std::vector<uint8_t> allRotateCompressed(allChannels.size(), VK_FALSE);
+
+	if (sampleTime > 0.0f)
+	{
+		VkBool32 keysFound = VK_FALSE;
+		VkBool32 resampledFound = VK_FALSE;
+		VkBool32 sameSamples = VK_TRUE;
+
+		const CompressedTrack* firstResampledTrack = nullptr;
+
+		for (uint32_t i = 0; i < allChannels.size(); i++)
+		{
+			if (allChannels[i]->getTargetTransform() != VKTS_TARGET_TRANSFORM_ROTATE)
+			{
+				continue;
+			}
+
+			allRotateCompressed[i] = (uint8_t)compressTrack(allRotateTracks[i], allChannels[i]);
+
+			if (!allRotateCompressed[i])
+			{
+				keysFound = VK_TRUE;
+			}
+			else if (allRotateTracks[i].encoding != AnimationTrackConstant)
+			{
+				resampledFound = VK_TRUE;
+
+				if (!firstResampledTrack)
+				{
+					firstResampledTrack = &allRotateTracks[i];
+				}
+				else if (allRotateTracks[i].start != firstResampledTrack->start || allRotateTracks[i].rate != firstResampledTrack->rate)
+				{
+					sameSamples = VK_FALSE;
+				}
+			}
+		}
+
+		if (resampledFound && (keysFound || !sameSamples))
+		{
+			// Only the rotation tracks have been resampled so far.
+
+			allSamples8.clear();
+			allSamples16.clear();
+
+			for (uint32_t i = 0; i < allChannels.size(); i++)
+			{
+				if (allRotateCompressed[i] && allRotateTracks[i].encoding != AnimationTrackConstant)
+				{
+					allRotateCompressed[i] = VK_FALSE;
+				}
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < allChannels.size(); i++)
+	{
+		const auto& channel = allChannels[i];
+
+		CompressedTrack compressedTrack;
+
+		VkBool32 compressed = VK_FALSE;
+
+		if (channel->getTargetTransform() == VKTS_TARGET_TRANSFORM_ROTATE)
+		{
+			compressedTrack = allRotateTracks[i];
+
+			compressed = (VkBool32)allRotateCompressed[i];
+		}
+		else if (sampleTime > 0.0f)
+		{
+			compressed = compressTrack(compressedTrack, channel);
+		}
+
+		if (compressed)
+		{
+			allOffsets.push_back((uint32_t)allKeys.size());
+
+			allTargetTransforms.push_back(channel->getTargetTransform());
+			allTargetTransformElements.push_back(channel->getTargetTransformElement());
+			allCompressedTracks.push_back(compressedTrack);
+			allNumberEntries.push_back(channel->getNumberEntries());
+
+			if (releaseEntries)
+			{
+				// Clears the entries, the channel stays valid.
+
+				channel->destroy();
+
+				allReleasedChannels.push_back(channel);
+			}
+			else
+			{
+				allReleasedChannels.push_back(IChannelSP());
+			}
+
+			allModificationCounters.push_back(channel->getModificationCounter());
+
+			continue;
+		}
+
+		compressedTrack.encoding = AnimationTrackKeys;
+		compressedTrack.minimum = 0.0f;
+		compressedTrack.scale = 0.0f;
+		compressedTrack.start = 0.0f;
+		compressedTrack.rate = 0.0f;
+		compressedTrack.offset = 0;
+		compressedTrack.numberSamples = 0;
+
+		allKeys.insert(allKeys.end(), channel->getKeys().begin(), channel->getKeys().end());
+		allValues.insert(allValues.end(), channel->getValues().begin(), channel->getValues().end());
+		allHandles.insert(allHandles.end(), channel->getHandles().begin(), channel->getHandles().end());
+		allInterpolators.insert(allInterpolators.end(), channel->getInterpolators().begin(), channel->getInterpolators().end());
+
+		allOffsets.push_back((uint32_t)allKeys.size());
+
+		allTargetTransforms.push_back(channel->getTargetTransform());
+		allTargetTransformElements.push_back(channel->getTargetTransformElement());
+		allCompressedTracks.push_back(compressedTrack);
+		allNumberEntries.push_back(channel->getNumberEntries());
+		allModificationCounters.push_back(channel->getModificationCounter());
+		allReleasedChannels.push_back(IChannelSP());
+	}
+
+	allCursors.resize(allChannels.size(), 0);
+}
+
+void AnimationSampler::reset()
+{
+	for (uint32_t track = 0; track < (uint32_t)allReleasedChannels.size(); track++)
+	{
+		const auto& channel = allReleasedChannels[track];
+
+		if (channel.get() && channel->getNumberEntries() == 0)
+		{
+			restoreEntries(track, channel);
+		}
+	}
+
+	allReleasedChannels.clear();
+
+	allKeys.clear();
+	allValues.clear();
+	allHandles.clear();
+	allInterpolators.clear();
+
+	allOffsets.clear();
+
+	allTargetTransforms.clear();
+	allTargetTransformElements.clear();
+
+	allCursors.clear();
+
+	allCompressedTracks.clear();
+
+	allSamples8.clear();
+	allSamples16.clear();
+
+	allNumberEntries.clear();
+	allModificationCounters.clear();
+}
+
+void AnimationSampler::setCompression(const float sampleTime, const float maxError)
+{
+	this->sampleTime = sampleTime;
+	this->maxError = maxError;
+
+	reset();
+}
+
+float AnimationSampler::getSampleTime() const
+{
+	return sampleTime;
+}
+
+float AnimationSampler::getMaxError() const
+{
+	return maxError;
+}
+
+enum AnimationTrackEncoding AnimationSampler::getTrackEncoding(const uint32_t track) const
+{
+	return allCompressedTracks[track].encoding;
+}
+
+uint64_t AnimationSampler::getMemorySize() const
+{
+	uint64_t memorySize = 0;
+
+	memorySize += allKeys.size() * sizeof(float);
+	memorySize += allValues.size() * sizeof(float);
+	memorySize += allHandles.size() * sizeof(glm::vec4);
+	memorySize += allInterpolators.size() * sizeof(VkTsInterpolator);
+
+	memorySize += allOffsets.size() * sizeof(uint32_t);
+
+	memorySize += allTargetTransforms.size() * sizeof(VkTsTargetTransform);
+	memorySize += allTargetTransformElements.size() * sizeof(VkTsTargetTransformElement);
+
+	memorySize += allCursors.size() * sizeof(uint32_t);
+
+	memorySize += allCompressedTracks.size() * sizeof(CompressedTrack);
+
+	memorySize += allSamples8.size() * sizeof(uint8_t);
+	memorySize += allSamples16.size() * sizeof(uint16_t);
+
+	memorySize += allNumberEntries.size() * sizeof(uint32_t);
+	memorySize += allModificationCounters.size() * sizeof(uint64_t);
+	memorySize += allReleasedChannels.size() * sizeof(IChannelSP);
+
+	return memorySize;
+}
+
+uint32_t AnimationSampler::getNumberTracks() const
+{
+	return (uint32_t)allTargetTransforms.size();
+}
+
+uint32_t AnimationSampler::getNumberEntries(const uint32_t track) const
+{
+	return allNumberEntries[track];
+}
+
+VkTsTargetTransform AnimationSampler::getTargetTransform(const uint32_t track) const
+{
+	return allTargetTransforms[track];
+}
+
+VkTsTargetTransformElement AnimationSampler::getTargetTransformElement(const uint32_t track) const
+{
+	return allTargetTransformElements[track];
+}
+
+float AnimationSampler::sample(const uint32_t track, const float key)
+{
+	const CompressedTrack& compressedTrack = allCompressedTracks[track];
+
+	if (compressedTrack.encoding != AnimationTrackKeys)
+	{
+		return decode(compressedTrack, key);
+	}
+
+	const uint32_t offset = allOffsets[track];
+	const uint32_t numberEntries = allOffsets[track + 1] - offset;
+
+	if (numberEntries == 0)
+	{
+		return 0.0f;
+	}
+
+	if (numberEntries == 1 || key <= allKeys[offset])
+	{
+		return allValues[offset];
+	}
+
+	const uint32_t lastIndex = numberEntries - 1;
+
+	if (key >= allKeys[offset + lastIndex])
+	{
+		return allValues[offset + lastIndex];
+	}
+
+	return interpolateSegment(key, findEntry(track, key), numberEntries, &allKeys[offset], &allValues[offset], &allHandles[offset], &allInterpolators[offset]);
+}
+
+VkBool32 AnimationSampler::sampleSegment(const uint32_t track, const float key, float& before, float& after, float& t)
+{
+	const CompressedTrack& compressedTrack = allCompressedTracks[track];
+
+	if (compressedTrack.encoding != AnimationTrackKeys)
+	{
+		decodeSegment(compressedTrack, key, before, after, t);
+
+		return VK_TRUE;
+	}
+
+	const uint32_t offset = allOffsets[track];
+	const uint32_t numberEntries = allOffsets[track + 1] - offset;
+
+	if (numberEntries == 0)
+	{
+		return VK_FALSE;
+	}
+
+	if (numberEntries == 1 || key <= allKeys[offset])
+	{
+		before = allValues[offset];
+		after = allValues[offset];
+
+		return VK_TRUE;
+	}
+
+	const uint32_t lastIndex = numberEntries - 1;
+
+	if (key >= allKeys[offset + lastIndex])
+	{
+		before = allValues[offset + lastIndex];
+		after = allValues[offset + lastIndex];
+
+		return VK_TRUE;
+	}
+
+	const uint32_t currentIndex = offset + findEntry(track, key);
+
+	const float delta = allKeys[currentIndex + 1] - allKeys[currentIndex];
+
+	if (delta > 0.0f)
+	{
+		t = glm::clamp((key - allKeys[currentIndex]) / delta, 0.0f, 1.0f);
+	}
+	else
+	{
+		t = 0.0f;
+	}
+
+	before = allValues[currentIndex];
+	after = allValues[currentIndex + 1];
+
+	return VK_TRUE;
+}
+
+VkBool32 AnimationSampler::restoreEntries(const uint32_t track, const IChannelSP& channel) const
+{
+	if (track >= getNumberTracks() || !channel.get())
+	{
+		return VK_FALSE;
+	}
+
+	const CompressedTrack& compressedTrack = allCompressedTracks[track];
+
+	if (compressedTrack.encoding == AnimationTrackKeys)
+	{
+		for (uint32_t i = allOffsets[track]; i < allOffsets[track + 1]; i++)
+		{
+			if (!channel->addEntry(allKeys[i], allValues[i], allHandles[i], allInterpolators[i]))
+			{
+				return VK_FALSE;
+			}
+		}
+
+		return VK_TRUE;
+	}
+
+	if (compressedTrack.encoding == AnimationTrackConstant)
+	{
+		return channel->addEntry(compressedTrack.start, compressedTrack.minimum, glm::vec4(compressedTrack.start, compressedTrack.minimum, compressedTrack.start, compressedTrack.minimum), VKTS_INTERPOLATOR_LINEAR);
+	}
+
+	for (uint32_t i = 0; i < compressedTrack.numberSamples; i++)
+	{
+		const float key = compressedTrack.start + (float)i / compressedTrack.rate;
+		const float value = decodeSample(compressedTrack, i);
+
+		if (!channel->addEntry(key, value, glm::vec4(key, value, key, value), VKTS_INTERPOLATOR_LINEAR))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
+
+} /* namespace vkts */
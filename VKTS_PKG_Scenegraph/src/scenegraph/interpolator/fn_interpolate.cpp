@@ -26,19 +26,23 @@
 
 #include <vkts/scenegraph/vkts_scenegraph.hpp>
 
+#include "fn_interpolate_internal.hpp"
+
 #define VKTS_BEZIER_TOLERANCE 0.1f
 #define VKTS_BEZIER_LOOPS 10
 
 namespace vkts
 {
 
-static float interpolateLinear(const uint32_t currentIndex, const float key, const IChannelSP& channel)
+static VkBool32 g_interpolateCompression = VK_FALSE;
+
+static float interpolateLinear(const uint32_t currentIndex, const float key, const float* keys, const float* values, const glm::vec4* handles)
 {
-    float beforeKey = channel->getKeys()[currentIndex];
-    float beforeValue = channel->getValues()[currentIndex];
+    float beforeKey = keys[currentIndex];
+    float beforeValue = values[currentIndex];
 
-    float afterKey = channel->getKeys()[currentIndex + 1];
-    float afterValue = channel->getValues()[currentIndex + 1];
+    float afterKey = keys[currentIndex + 1];
+    float afterValue = values[currentIndex + 1];
 
     float deltaKey = afterKey - beforeKey;
     if (deltaKey == 0.0f)
@@ -50,16 +54,16 @@ static float interpolateLinear(const uint32_t currentIndex, const float key, con
 }
 
 // see https://en.wikipedia.org/wiki/Cubic_Hermite_spline
-static float interpolateCatmullRom(const uint32_t currentIndex, const float key, const IChannelSP& channel)
+static float interpolateCatmullRom(const uint32_t currentIndex, const float key, const float* keys, const float* values, const glm::vec4* handles)
 {
-    float K0 = channel->getKeys()[currentIndex];
-    float V0 = channel->getValues()[currentIndex];
+    float K0 = keys[currentIndex];
+    float V0 = values[currentIndex];
 
-    float K1 = channel->getKeys()[currentIndex + 1];
-    float V1 = channel->getValues()[currentIndex + 1];
+    float K1 = keys[currentIndex + 1];
+    float V1 = values[currentIndex + 1];
 
-    float M0 = (channel->getValues()[currentIndex + 1] - channel->getValues()[currentIndex - 1]) / (channel->getKeys()[currentIndex + 1] - channel->getKeys()[currentIndex - 1]);
-    float M1 = (channel->getValues()[currentIndex + 1 + 1] - channel->getValues()[currentIndex + 1 - 1]) / (channel->getKeys()[currentIndex + 1 + 1] - channel->getKeys()[currentIndex + 1 - 1]);
+    float M0 = (values[currentIndex + 1] - values[currentIndex - 1]) / (keys[currentIndex + 1] - keys[currentIndex - 1]);
+    float M1 = (values[currentIndex + 1 + 1] - values[currentIndex + 1 - 1]) / (keys[currentIndex + 1 + 1] - keys[currentIndex + 1 - 1]);
 
     //
 
@@ -77,16 +81,16 @@ static float interpolateCatmullRom(const uint32_t currentIndex, const float key,
     return h00 * V0 + h01 * M0 + h10 * V1 + h11 * M1;
 }
 
-static float interpolateCubicSpline(const uint32_t currentIndex, const float key, const IChannelSP& channel)
+static float interpolateCubicSpline(const uint32_t currentIndex, const float key, const float* keys, const float* values, const glm::vec4* handles)
 {
-    float K0 = channel->getKeys()[currentIndex];
-    float V0 = channel->getValues()[currentIndex];
+    float K0 = keys[currentIndex];
+    float V0 = values[currentIndex];
 
-    float K1 = channel->getKeys()[currentIndex + 1];
-    float V1 = channel->getValues()[currentIndex + 1];
+    float K1 = keys[currentIndex + 1];
+    float V1 = values[currentIndex + 1];
 
-    float M0 = channel->getHandles()[currentIndex].y;
-    float M1 = channel->getHandles()[currentIndex + 1].w;
+    float M0 = handles[currentIndex].y;
+    float M1 = handles[currentIndex + 1].w;
 
     //
 
@@ -104,13 +108,13 @@ static float interpolateCubicSpline(const uint32_t currentIndex, const float key
     return h00 * V0 + h01 * M0 + h10 * V1 + h11 * M1;
 }
 
-static float interpolateBezier(const uint32_t currentIndex, const float key, const IChannelSP& channel)
+static float interpolateBezier(const uint32_t currentIndex, const float key, const float* keys, const float* values, const glm::vec4* handles)
 {
-    float beforeKey = channel->getKeys()[currentIndex];
-    float beforeValue = channel->getValues()[currentIndex];
+    float beforeKey = keys[currentIndex];
+    float beforeValue = values[currentIndex];
 
-    float afterKey = channel->getKeys()[currentIndex + 1];
-    float afterValue = channel->getValues()[currentIndex + 1];
+    float afterKey = keys[currentIndex + 1];
+    float afterValue = values[currentIndex + 1];
 
     float deltaKey = afterKey - beforeKey;
     if (deltaKey == 0.0f)
@@ -118,8 +122,8 @@ static float interpolateBezier(const uint32_t currentIndex, const float key, con
         return afterValue;
     }
 
-    float beforeRightHandleKey = channel->getHandles()[currentIndex].z;
-    float afterLeftHandleKey = channel->getHandles()[currentIndex + 1].x;
+    float beforeRightHandleKey = handles[currentIndex].z;
+    float afterLeftHandleKey = handles[currentIndex + 1].x;
 
     float t;
     float t2;
@@ -171,8 +175,8 @@ static float interpolateBezier(const uint32_t currentIndex, const float key, con
     }
     while (doBinarySearch && counter < VKTS_BEZIER_LOOPS);
 
-    float beforeRightHandleValue = channel->getHandles()[currentIndex].w;
-    float afterLeftHandleValue = channel->getHandles()[currentIndex + 1].y;
+    float beforeRightHandleValue = handles[currentIndex].w;
+    float afterLeftHandleValue = handles[currentIndex + 1].y;
 
     t = (currentKey - beforeKey) / deltaKey;
     t2 = t * t;
@@ -184,87 +188,91 @@ static float interpolateBezier(const uint32_t currentIndex, const float key, con
     return ot3 * beforeValue + 3.0f * ot2 * t * beforeRightHandleValue + 3.0f * ot * t2 * afterLeftHandleValue + t3 * afterValue;
 }
 
-float VKTS_APIENTRY interpolate(const float key, const IChannelSP& channel)
+float VKTS_APIENTRY interpolateSegment(const float key, const uint32_t currentIndex, const uint32_t numberEntries, const float* keys, const float* values, const glm::vec4* handles, const VkTsInterpolator* interpolators)
 {
-    if (!channel.get())
+    if (interpolators[currentIndex] == VKTS_INTERPOLATOR_CATMULLROMSPLINE)
     {
-        return 0.0f;
-    }
+        if (currentIndex > 0 && currentIndex < numberEntries - 2)
+        {
+            return interpolateCatmullRom(currentIndex, key, keys, values, handles);
+        }
 
-    if (channel->getNumberEntries() == 0)
-    {
-        return 0.0f;
+        return interpolateLinear(currentIndex, key, keys, values, handles);
     }
 
-    if (channel->getNumberEntries() == 1)
+    if (interpolators[currentIndex] == VKTS_INTERPOLATOR_CUBICSPLINE)
     {
-        return channel->getValues()[0];
+        if (currentIndex > 0 && currentIndex < numberEntries - 2)
+        {
+            return interpolateCubicSpline(currentIndex, key, keys, values, handles);
+        }
+
+        return interpolateLinear(currentIndex, key, keys, values, handles);
     }
 
-    if (key <= channel->getKeys()[0])
+    if (interpolators[currentIndex] == VKTS_INTERPOLATOR_BEZIER)
     {
-        return channel->getValues()[0];
-    }
+        if (interpolators[currentIndex + 1] == VKTS_INTERPOLATOR_BEZIER)
+        {
+            return interpolateBezier(currentIndex, key, keys, values, handles);
+        }
 
-    auto lastIndex = channel->getNumberEntries() - 1;
+        return interpolateLinear(currentIndex, key, keys, values, handles);
+    }
 
-    if (key >= channel->getKeys()[lastIndex])
+    if (interpolators[currentIndex] == VKTS_INTERPOLATOR_LINEAR)
     {
-        return channel->getValues()[lastIndex];
+        return interpolateLinear(currentIndex, key, keys, values, handles);
     }
 
-    // Key is in between the available keys now.
+    // VKTS_INTERPOLATOR_CONSTANT
+    return values[currentIndex];
+}
 
-    uint32_t currentIndex = 0;
-    while (currentIndex < channel->getNumberEntries())
-    {
-        if (key < channel->getKeys()[currentIndex])
-        {
-        	currentIndex--;
+VkBool32 VKTS_APIENTRY interpolateGetCompression()
+{
+    return g_interpolateCompression;
+}
 
-            break;
-        }
+void VKTS_APIENTRY interpolateSetCompression(const VkBool32 compression)
+{
+    g_interpolateCompression = compression;
+}
 
-        currentIndex++;
+float VKTS_APIENTRY interpolate(const float key, const IChannelSP& channel)
+{
+    if (!channel.get())
+    {
+        return 0.0f;
     }
 
-    if (channel->getInterpolators()[currentIndex] == VKTS_INTERPOLATOR_CATMULLROMSPLINE)
+    if (channel->getNumberEntries() == 0)
     {
-        if (currentIndex > 0 && currentIndex < channel->getNumberEntries() - 2)
-        {
-            return interpolateCatmullRom(currentIndex, key, channel);
-        }
-
-        return interpolateLinear(currentIndex, key, channel);
+        return 0.0f;
     }
 
-    if (channel->getInterpolators()[currentIndex] == VKTS_INTERPOLATOR_CUBICSPLINE)
+    if (channel->getNumberEntries() == 1)
     {
-        if (currentIndex > 0 && currentIndex < channel->getNumberEntries() - 2)
-        {
-            return interpolateCubicSpline(currentIndex, key, channel);
-        }
-
-        return interpolateLinear(currentIndex, key, channel);
+        return channel->getValues()[0];
     }
 
-    if (channel->getInterpolators()[currentIndex] == VKTS_INTERPOLATOR_BEZIER)
+    if (key <= channel->getKeys()[0])
     {
-        if (channel->getInterpolators()[currentIndex + 1] == VKTS_INTERPOLATOR_BEZIER)
-        {
-            return interpolateBezier(currentIndex, key, channel);
-        }
-
-        return interpolateLinear(currentIndex, key, channel);
+        return channel->getValues()[0];
     }
 
-    if (channel->getInterpolators()[currentIndex] == VKTS_INTERPOLATOR_LINEAR)
+    auto lastIndex = channel->getNumberEntries() - 1;
+
+    if (key >= channel->getKeys()[lastIndex])
     {
-        return interpolateLinear(currentIndex, key, channel);
+        return channel->getValues()[lastIndex];
     }
 
-    // VKTS_INTERPOLATOR_CONSTANT
-    return channel->getValues()[currentIndex];
+    // Key is in between the available keys now, so search the last key not greater than it.
+
+    uint32_t currentIndex = (uint32_t)(std::upper_bound(channel->getKeys().begin(), channel->getKeys().end(), key) - channel->getKeys().begin()) - 1;
+
+    return interpolateSegment(key, currentIndex, channel->getNumberEntries(), &channel->getKeys()[0], &channel->getValues()[0], &channel->getHandles()[0], &channel->getInterpolators()[0]);
 }
 
 VkBool32 VKTS_APIENTRY interpolateConvert(IChannelSP& converted, const IChannelSP& channel, const float sampleTime)
@@ -0,0 +1,198 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "GltfSaxHandler.hpp"
+
+namespace vkts
+{
+
+GltfSaxHandler::GltfSaxHandler(GltfVisitor& visitor, const enum GltfState gltfState) :
+	JsonSaxHandler(), visitor(visitor), gltfState(gltfState), builder(), depth(0), index(0)
+{
+}
+
+GltfSaxHandler::~GltfSaxHandler()
+{
+}
+
+VkBool32 GltfSaxHandler::visitElement()
+{
+	auto element = builder.getValue();
+
+	if (!element.get())
+	{
+		return VK_FALSE;
+	}
+
+	visitor.visitSectionElement(gltfState, *element, index);
+
+	index++;
+
+	// Release the element, before the next one is built.
+	element = JSONvalueSP();
+
+	builder.reset();
+
+	return visitor.getState() != GltfState_Error;
+}
+
+//
+
+VkBool32 GltfSaxHandler::beginObject()
+{
+	// Top level value has to be an array.
+	if (depth == 0)
+	{
+		return VK_FALSE;
+	}
+
+	depth++;
+
+	return builder.beginObject();
+}
+
+VkBool32 GltfSaxHandler::key(const std::string& key)
+{
+	if (depth <= 1)
+	{
+		return VK_FALSE;
+	}
+
+	return builder.key(key);
+}
+
+VkBool32 GltfSaxHandler::endObject()
+{
+	if (depth <= 1)
+	{
+		return VK_FALSE;
+	}
+
+	depth--;
+
+	if (!builder.endObject())
+	{
+		return VK_FALSE;
+	}
+
+	return depth == 1 ? visitElement() : VK_TRUE;
+}
+
+VkBool32 GltfSaxHandler::beginArray()
+{
+	depth++;
+
+	if (depth == 1)
+	{
+		return VK_TRUE;
+	}
+
+	return builder.beginArray();
+}
+
+VkBool32 GltfSaxHandler::endArray()
+{
+	if (depth == 0)
+	{
+		return VK_FALSE;
+	}
+
+	depth--;
+
+	if (depth == 0)
+	{
+		return VK_TRUE;
+	}
+
+	if (!builder.endArray())
+	{
+		return VK_FALSE;
+	}
+
+	return depth == 1 ? visitElement() : VK_TRUE;
+}
+
+VkBool32 GltfSaxHandler::valueNull()
+{
+	if (depth == 0 || !builder.valueNull())
+	{
+		return VK_FALSE;
+	}
+
+	return depth == 1 ? visitElement() : VK_TRUE;
+}
+
+VkBool32 GltfSaxHandler::valueFalse()
+{
+	if (depth == 0 || !builder.valueFalse())
+	{
+		return VK_FALSE;
+	}
+
+	return depth == 1 ? visitElement() : VK_TRUE;
+}
+
+VkBool32 GltfSaxHandler::valueTrue()
+{
+	if (depth == 0 || !builder.valueTrue())
+	{
+		return VK_FALSE;
+	}
+
+	return depth == 1 ? visitElement() : VK_TRUE;
+}
+
+VkBool32 GltfSaxHandler::valueFloat(const float value)
+{
+	if (depth == 0 || !builder.valueFloat(value))
+	{
+		return VK_FALSE;
+	}
+
+	return depth == 1 ? visitElement() : VK_TRUE;
+}
+
+VkBool32 GltfSaxHandler::valueInteger(const int32_t value)
+{
+	if (depth == 0 || !builder.valueInteger(value))
+	{
+		return VK_FALSE;
+	}
+
+	return depth == 1 ? visitElement() : VK_TRUE;
+}
+
+VkBool32 GltfSaxHandler::valueString(const std::string& value)
+{
+	if (depth == 0 || !builder.valueString(value))
+	{
+		return VK_FALSE;
+	}
+
+	return depth == 1 ? visitElement() : VK_TRUE;
+}
+
+}
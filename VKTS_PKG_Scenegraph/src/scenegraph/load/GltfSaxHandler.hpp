@@ -0,0 +1,99 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_GLTFSAXHANDLER_HPP_
+#define VKTS_GLTFSAXHANDLER_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+#include "GltfVisitor.hpp"
+
+namespace vkts
+{
+
+/**
+ * Receives the events of one top level glTF array. Only the current element is decoded,
+ * which is passed to the visitor and released afterwards.
+ */
+class GltfSaxHandler : public JsonSaxHandler
+{
+
+private:
+
+	GltfVisitor& visitor;
+
+	const enum GltfState gltfState;
+
+	JsonBuilder builder;
+
+	uint32_t depth;
+
+	int32_t index;
+
+	VkBool32 visitElement();
+
+public:
+
+	GltfSaxHandler() = delete;
+	GltfSaxHandler(GltfVisitor& visitor, const enum GltfState gltfState);
+	GltfSaxHandler(const GltfSaxHandler& other) = delete;
+	GltfSaxHandler(GltfSaxHandler&& other) = delete;
+	virtual ~GltfSaxHandler();
+
+	GltfSaxHandler& operator =(const GltfSaxHandler& other) = delete;
+	GltfSaxHandler& operator =(GltfSaxHandler && other) = delete;
+
+	//
+	// JsonSaxHandler
+	//
+
+	virtual VkBool32 beginObject() override;
+
+	virtual VkBool32 key(const std::string& key) override;
+
+	virtual VkBool32 endObject() override;
+
+	virtual VkBool32 beginArray() override;
+
+	virtual VkBool32 endArray() override;
+
+	virtual VkBool32 valueNull() override;
+
+	virtual VkBool32 valueFalse() override;
+
+	virtual VkBool32 valueTrue() override;
+
+	virtual VkBool32 valueFloat(const float value) override;
+
+	virtual VkBool32 valueInteger(const int32_t value) override;
+
+	virtual VkBool32 valueString(const std::string& value) override;
+
+};
+
+}
+
+#endif /* VKTS_GLTFSAXHANDLER_HPP_ */
@@ -40,6 +40,24 @@ GltfVisitor::~GltfVisitor()
 
 //
 
+const GltfSection GltfVisitor::allSections[VKTS_GLTF_SECTION_COUNT] = {
+	{"buffers", GltfState_Buffers},
+	{"bufferViews", GltfState_BufferViews},
+	{"accessors", GltfState_Accessors},
+	{"extensionsRequired", GltfState_ExtensionsRequired},
+	{"extensionsUsed", GltfState_ExtensionsUsed},
+	{"images", GltfState_Images},
+	{"samplers", GltfState_Samplers},
+	{"textures", GltfState_Textures},
+	{"materials", GltfState_Materials},
+	{"meshes", GltfState_Meshes},
+	{"cameras", GltfState_Cameras},
+	{"skins", GltfState_Skins},
+	{"nodes", GltfState_Nodes},
+	{"animations", GltfState_Animations},
+	{"scenes", GltfState_Scenes}
+};
+
 void GltfVisitor::visitBuffer(JSONobject& jsonObject)
 {
 	//
@@ -134,11 +152,11 @@ void GltfVisitor::visitBuffer(JSONobject& jsonObject)
 		{
 			std::string finalFilename = directory + gltfString;
 
-			binaryBuffer = fileLoadBinary(finalFilename.c_str());
+			binaryBuffer = fileMapBinary(finalFilename.c_str());
 
 			if (!binaryBuffer.get())
 			{
-				binaryBuffer = fileLoadBinary(gltfString.c_str());
+				binaryBuffer = fileMapBinary(gltfString.c_str());
 			}
 		}
 
@@ -3360,7 +3378,7 @@ void GltfVisitor::visitAnimation_Channel_Target(JSONobject& jsonObject)
 
 //
 
-void GltfVisitor::visit(JSONnull& jsonNull)
+void GltfVisitor::visitObjectArrayElement(JSONvalue& jsonValue, const int32_t index)
 {
 	auto gltfState = state.top();
 
@@ -3369,1189 +3387,809 @@ void GltfVisitor::visit(JSONnull& jsonNull)
 		return;
 	}
 
-	// No used, so always error.
-	state.push(GltfState_Error);
-}
+	if (gltfState == GltfState_Buffers)
+	{
+		gltfBuffer.binaryBuffer = IBinaryBufferSP();
+		gltfBuffer.byteLength = 0;
+		gltfBuffer.name = "Buffer_" + std::to_string(index);
 
-void GltfVisitor::visit(JSONfalse& jsonFalse)
-{
-	auto gltfState = state.top();
+		//
 
-	if (gltfState == GltfState_Error)
-	{
-		return;
-	}
+		state.push(GltfState_Buffer);
+		jsonValue.visit(*this);
 
-	gltfBool = VK_FALSE;
-}
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
 
-void GltfVisitor::visit(JSONtrue& jsonTrue)
-{
-	auto gltfState = state.top();
+		state.pop();
 
-	if (gltfState == GltfState_Error)
-	{
-		return;
+		//
+
+		allGltfBuffers.append(gltfBuffer);
 	}
+	else if (gltfState == GltfState_BufferViews)
+	{
+		gltfBufferView.buffer = nullptr;
+		gltfBufferView.byteOffset = 0;
+	    gltfBufferView.byteLength = 0;
+	    gltfBufferView.byteStride = 0;
+	    gltfBufferView.target = 0;
+		gltfBufferView.name = "BufferView_" + std::to_string(index);
 
-	gltfBool = VK_TRUE;
-}
+		//
 
-void GltfVisitor::visit(JSONfloat& jsonFloat)
-{
-	auto gltfState = state.top();
+		state.push(GltfState_BufferView);
+		jsonValue.visit(*this);
 
-	if (gltfState == GltfState_Error)
-	{
-		return;
-	}
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
 
-	gltfInteger = (int32_t)jsonFloat.getValue();
-	gltfFloat = jsonFloat.getValue();
-}
+		state.pop();
 
-void GltfVisitor::visit(JSONinteger& jsonInteger)
-{
-	auto gltfState = state.top();
+		//
 
-	if (gltfState == GltfState_Error)
-	{
-		return;
+		allGltfBufferViews.append(gltfBufferView);
 	}
+	else if (gltfState == GltfState_Accessors)
+	{
+		gltfAccessor.bufferView = nullptr;
+		gltfAccessor.byteOffset = 0;
+		gltfAccessor.componentType = 0;
+		gltfAccessor.normalized = VK_FALSE;
+		gltfAccessor.count = 0;
+		gltfAccessor.type = "";
+		gltfAccessor.max.clear();
+		gltfAccessor.min.clear();
+		gltfAccessor.sparse = nullptr;
+		gltfAccessor.name = "Accessor_" + std::to_string(index);
 
-	gltfInteger = jsonInteger.getValue();
-	gltfFloat = (float)jsonInteger.getValue();
-}
+		gltfSparse.count = 0;
+		gltfSparse.indices.clear();
+		gltfSparse.values.clear();
+		gltfSparse.name = gltfAccessor.name + "_Sparse_" + std::to_string(index);
 
-void GltfVisitor::visit(JSONstring& jsonString)
-{
-	auto gltfState = state.top();
+		//
 
-	if (gltfState == GltfState_Error)
-	{
-		return;
-	}
+		state.push(GltfState_Accessor);
+		jsonValue.visit(*this);
 
-	gltfString = jsonString.getValue();
-}
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
 
-void GltfVisitor::visit(JSONarray& jsonArray)
-{
-	auto gltfState = state.top();
+		state.pop();
 
-	if (gltfState == GltfState_Error)
-	{
-		return;
-	}
+		//
 
-	if (numberArray)
+		allGltfAccessors.append(gltfAccessor);
+	}
+	else if (gltfState == GltfState_ExtensionsRequired)
 	{
-		if (arrayIndex >= arraySize || jsonArray.size() != arraySize)
+		jsonValue.visit(*this);
+
+		if (state.top() == GltfState_Error)
 		{
-			state.push(GltfState_Error);
 			return;
 		}
 
-		for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
+		if (gltfString == "KHR_materials_pbrSpecularGlossiness")
 		{
-			jsonArray.getValueAt(i)->visit(*this);
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
+			gltfExtensions.required_pbrSpecularGlossiness = VK_TRUE;
+		}
+	}
+	else if (gltfState == GltfState_ExtensionsUsed)
+	{
+		jsonValue.visit(*this);
 
-			gltfIntegerArray[arrayIndex] = gltfInteger;
-			gltfFloatArray[arrayIndex] = gltfFloat;
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
 
-			arrayIndex++;
+		if (gltfString == "KHR_materials_pbrSpecularGlossiness")
+		{
+			gltfExtensions.used_pbrSpecularGlossiness = VK_TRUE;
 		}
 	}
-	else if (objectArray)
+	else if (gltfState == GltfState_Images)
 	{
-		if (gltfState == GltfState_Buffers)
+		gltfImage.imageData.reset();
+		gltfImage.name = "Image_" + std::to_string(index);
+
+		//
+
+		state.push(GltfState_Image);
+		jsonValue.visit(*this);
+
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfBuffer.binaryBuffer = IBinaryBufferSP();
-				gltfBuffer.byteLength = 0;
-				gltfBuffer.name = "Buffer_" + std::to_string(i);
+			return;
+		}
 
-				//
+		state.pop();
 
-				state.push(GltfState_Buffer);
-				jsonArray.getValueAt(i)->visit(*this);
+		//
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		allGltfImages.append(gltfImage);
+	}
+	else if (gltfState == GltfState_Samplers)
+	{
+		gltfSampler.magFilter = 9729;
+		gltfSampler.minFilter = 9986;
+		gltfSampler.wrapS = 10497;
+		gltfSampler.wrapT = 10497;
+		gltfSampler.name = "Sampler_" + std::to_string(index);
 
-				state.pop();
+		//
 
-				//
+		state.push(GltfState_Sampler);
+		jsonValue.visit(*this);
 
-				allGltfBuffers.append(gltfBuffer);
-			}
-		}
-		else if (gltfState == GltfState_BufferViews)
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfBufferView.buffer = nullptr;
-				gltfBufferView.byteOffset = 0;
-			    gltfBufferView.byteLength = 0;
-			    gltfBufferView.byteStride = 0;
-			    gltfBufferView.target = 0;
-				gltfBufferView.name = "BufferView_" + std::to_string(i);
+			return;
+		}
 
-				//
+		state.pop();
 
-				state.push(GltfState_BufferView);
-				jsonArray.getValueAt(i)->visit(*this);
+		//
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		allGltfSamplers.append(gltfSampler);
+	}
+	else if (gltfState == GltfState_Textures)
+	{
+		gltfTexture.internalFormat = 6408;
+		gltfTexture.format = 6408;
+		gltfTexture.sampler = nullptr;
+		gltfTexture.source = nullptr;
+		gltfTexture.target = 3553;
+		gltfTexture.type = 5121;
+		gltfTexture.name = "Texture_" + std::to_string(index);
+		gltfTexture.texCoord = 0;
 
-				state.pop();
+		//
 
-				//
+		state.push(GltfState_Texture);
+		jsonValue.visit(*this);
 
-				allGltfBufferViews.append(gltfBufferView);
-			}
-		}
-		else if (gltfState == GltfState_Accessors)
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfAccessor.bufferView = nullptr;
-				gltfAccessor.byteOffset = 0;
-				gltfAccessor.componentType = 0;
-				gltfAccessor.normalized = VK_FALSE;
-				gltfAccessor.count = 0;
-				gltfAccessor.type = "";
-				gltfAccessor.max.clear();
-				gltfAccessor.min.clear();
-				gltfAccessor.sparse = nullptr;
-				gltfAccessor.name = "Accessor_" + std::to_string(i);
-
-				gltfSparse.count = 0;
-				gltfSparse.indices.clear();
-				gltfSparse.values.clear();
-				gltfSparse.name = gltfAccessor.name + "_Sparse_" + std::to_string(i);
-
-				//
-
-				state.push(GltfState_Accessor);
-				jsonArray.getValueAt(i)->visit(*this);
+			return;
+		}
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		state.pop();
 
-				state.pop();
+		//
 
-				//
+		allGltfTextures.append(gltfTexture);
+	}
+	else if (gltfState == GltfState_Materials)
+	{
+		gltfMaterial.alphaMode = "OPAQUE";
+		gltfMaterial.alphaCutoff = 0.5f;
+		gltfMaterial.doubleSided = VK_FALSE;
 
-				allGltfAccessors.append(gltfAccessor);
-			}
-		}
-		else if (gltfState == GltfState_ExtensionsRequired)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				jsonArray.getValueAt(i)->visit(*this);
+		// If required, force using specular glossiness model.
+		gltfMaterial.useSpecularGlossiness = gltfExtensions.used_pbrSpecularGlossiness;
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		//
 
-				if (gltfString == "KHR_materials_pbrSpecularGlossiness")
-				{
-					gltfExtensions.required_pbrSpecularGlossiness = VK_TRUE;
-				}
-			}
-		}
-		else if (gltfState == GltfState_ExtensionsUsed)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				jsonArray.getValueAt(i)->visit(*this);
+		gltfMaterial.pbrMetallicRoughness.baseColorFactor[0] = 1.0f;
+		gltfMaterial.pbrMetallicRoughness.baseColorFactor[1] = 1.0f;
+		gltfMaterial.pbrMetallicRoughness.baseColorFactor[2] = 1.0f;
+		gltfMaterial.pbrMetallicRoughness.baseColorFactor[3] = 1.0f;
+		gltfMaterial.pbrMetallicRoughness.baseColorTexture = nullptr;
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		gltfMaterial.pbrMetallicRoughness.metallicFactor = 1.0f;
 
-				if (gltfString == "KHR_materials_pbrSpecularGlossiness")
-				{
-					gltfExtensions.used_pbrSpecularGlossiness = VK_TRUE;
-				}
-			}
-		}
-		else if (gltfState == GltfState_Images)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfImage.imageData.reset();
-				gltfImage.name = "Image_" + std::to_string(i);
+		gltfMaterial.pbrMetallicRoughness.roughnessFactor = 1.0f;
+		gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture = nullptr;
 
-				//
+		//
 
-				state.push(GltfState_Image);
-				jsonArray.getValueAt(i)->visit(*this);
+		gltfMaterial.pbrSpecularGlossiness.diffuseFactor[0] = 1.0f;
+		gltfMaterial.pbrSpecularGlossiness.diffuseFactor[1] = 1.0f;
+		gltfMaterial.pbrSpecularGlossiness.diffuseFactor[2] = 1.0f;
+		gltfMaterial.pbrSpecularGlossiness.diffuseFactor[3] = 1.0f;
+		gltfMaterial.pbrSpecularGlossiness.diffuseTexture = nullptr;
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		gltfMaterial.pbrSpecularGlossiness.specularFactor[0] = 1.0f;
+		gltfMaterial.pbrSpecularGlossiness.specularFactor[1] = 1.0f;
+		gltfMaterial.pbrSpecularGlossiness.specularFactor[2] = 1.0f;
 
-				state.pop();
+		gltfMaterial.pbrSpecularGlossiness.glossinessFactor = 1.0f;
 
-				//
+		gltfMaterial.pbrSpecularGlossiness.specularGlossinessTexture = nullptr;
 
-				allGltfImages.append(gltfImage);
-			}
-		}
-		else if (gltfState == GltfState_Samplers)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfSampler.magFilter = 9729;
-				gltfSampler.minFilter = 9986;
-				gltfSampler.wrapS = 10497;
-				gltfSampler.wrapT = 10497;
-				gltfSampler.name = "Sampler_" + std::to_string(i);
+		//
 
-				//
+		gltfMaterial.normalScale = 1.0f;
+		gltfMaterial.normalTexture = nullptr;
 
-				state.push(GltfState_Sampler);
-				jsonArray.getValueAt(i)->visit(*this);
+		gltfMaterial.occlusionStrength = 1.0f;
+		gltfMaterial.occlusionTexture = nullptr;
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		gltfMaterial.emissiveFactor[0] = 0.0f;
+		gltfMaterial.emissiveFactor[1] = 0.0f;
+		gltfMaterial.emissiveFactor[2] = 0.0f;
+		gltfMaterial.emissiveTexture = nullptr;
 
-				state.pop();
+		gltfMaterial.name = "Material_" + std::to_string(index);
 
-				//
+		//
 
-				allGltfSamplers.append(gltfSampler);
-			}
-		}
-		else if (gltfState == GltfState_Textures)
+		state.push(GltfState_Material);
+		jsonValue.visit(*this);
+
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfTexture.internalFormat = 6408;
-				gltfTexture.format = 6408;
-				gltfTexture.sampler = nullptr;
-				gltfTexture.source = nullptr;
-				gltfTexture.target = 3553;
-				gltfTexture.type = 5121;
-				gltfTexture.name = "Texture_" + std::to_string(i);
-				gltfTexture.texCoord = 0;
+			return;
+		}
 
-				//
+		state.pop();
 
-				state.push(GltfState_Texture);
-				jsonArray.getValueAt(i)->visit(*this);
+		//
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		allGltfMaterials.append(gltfMaterial);
+	}
+	else if (gltfState == GltfState_Meshes)
+	{
+		gltfMesh.primitives.clear();
+		gltfMesh.weights.clear();
+		gltfMesh.name = "Mesh_" + std::to_string(index);
 
-				state.pop();
+		//
 
-				//
+		state.push(GltfState_Mesh);
+		jsonValue.visit(*this);
 
-				allGltfTextures.append(gltfTexture);
-			}
-		}
-		else if (gltfState == GltfState_Materials)
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfMaterial.alphaMode = "OPAQUE";
-				gltfMaterial.alphaCutoff = 0.5f;
-				gltfMaterial.doubleSided = VK_FALSE;
-
-				// If required, force using specular glossiness model.
-				gltfMaterial.useSpecularGlossiness = gltfExtensions.used_pbrSpecularGlossiness;
-
-				//
-
-				gltfMaterial.pbrMetallicRoughness.baseColorFactor[0] = 1.0f;
-				gltfMaterial.pbrMetallicRoughness.baseColorFactor[1] = 1.0f;
-				gltfMaterial.pbrMetallicRoughness.baseColorFactor[2] = 1.0f;
-				gltfMaterial.pbrMetallicRoughness.baseColorFactor[3] = 1.0f;
-				gltfMaterial.pbrMetallicRoughness.baseColorTexture = nullptr;
+			return;
+		}
 
-				gltfMaterial.pbrMetallicRoughness.metallicFactor = 1.0f;
+		state.pop();
 
-				gltfMaterial.pbrMetallicRoughness.roughnessFactor = 1.0f;
-				gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture = nullptr;
+		//
 
-				//
+		allGltfMeshes.append(gltfMesh);
+	}
+	else if (gltfState == GltfState_Cameras)
+	{
+		gltfCamera.orthograpic.xmag = 0.0f;
+		gltfCamera.orthograpic.ymag = 0.0f;
 
-				gltfMaterial.pbrSpecularGlossiness.diffuseFactor[0] = 1.0f;
-				gltfMaterial.pbrSpecularGlossiness.diffuseFactor[1] = 1.0f;
-				gltfMaterial.pbrSpecularGlossiness.diffuseFactor[2] = 1.0f;
-				gltfMaterial.pbrSpecularGlossiness.diffuseFactor[3] = 1.0f;
-				gltfMaterial.pbrSpecularGlossiness.diffuseTexture = nullptr;
+		gltfCamera.perspective.aspectRatio = 1.0f;
+		gltfCamera.perspective.yfov = 0.0f;
+		gltfCamera.perspective.infinite = VK_FALSE;
 
-				gltfMaterial.pbrSpecularGlossiness.specularFactor[0] = 1.0f;
-				gltfMaterial.pbrSpecularGlossiness.specularFactor[1] = 1.0f;
-				gltfMaterial.pbrSpecularGlossiness.specularFactor[2] = 1.0f;
+		gltfCamera.znear = 0.0f;
+		gltfCamera.zfar = 0.0f;
+		gltfCamera.type = "";
+		gltfCamera.name = "Camera_" + std::to_string(index);
 
-				gltfMaterial.pbrSpecularGlossiness.glossinessFactor = 1.0f;
+		//
 
-				gltfMaterial.pbrSpecularGlossiness.specularGlossinessTexture = nullptr;
+		state.push(GltfState_Camera);
+		jsonValue.visit(*this);
 
-				//
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
 
-				gltfMaterial.normalScale = 1.0f;
-				gltfMaterial.normalTexture = nullptr;
+		state.pop();
 
-				gltfMaterial.occlusionStrength = 1.0f;
-				gltfMaterial.occlusionTexture = nullptr;
+		//
 
-				gltfMaterial.emissiveFactor[0] = 0.0f;
-				gltfMaterial.emissiveFactor[1] = 0.0f;
-				gltfMaterial.emissiveFactor[2] = 0.0f;
-				gltfMaterial.emissiveTexture = nullptr;
+		allGltfCameras.append(gltfCamera);
+	}
+	else if (gltfState == GltfState_Skins)
+	{
+		gltfSkin.inverseBindMatrices = nullptr;
+		gltfSkin.skeleton = 0;
+		gltfSkin.joints.clear();
+		gltfSkin.name = "Skin_" + std::to_string(index);
 
-				gltfMaterial.name = "Material_" + std::to_string(i);
+		//
 
-				//
+		state.push(GltfState_Skin);
+		jsonValue.visit(*this);
 
-				state.push(GltfState_Material);
-				jsonArray.getValueAt(i)->visit(*this);
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		state.pop();
 
-				state.pop();
+		//
 
-				//
+		allGltfSkins.append(gltfSkin);
+	}
+	else if (gltfState == GltfState_Nodes)
+	{
+		gltfNode.children.clear();
+		gltfNode.camera = nullptr;
+		gltfNode.skin = nullptr;
+		gltfNode.name = "Node_" + std::to_string(index);
 
-				allGltfMaterials.append(gltfMaterial);
-			}
-		}
-		else if (gltfState == GltfState_Meshes)
+		for (int32_t k = 0; k < 16; k++)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
+			if ((k % 4) - (k / 4) == 0)
+			{
+				gltfNode.matrix[k] = 1.0f;
+			}
+			else
 			{
-				gltfMesh.primitives.clear();
-				gltfMesh.weights.clear();
-				gltfMesh.name = "Mesh_" + std::to_string(i);
+				gltfNode.matrix[k] = 0.0f;
+			}
+		}
 
-				//
+		gltfNode.mesh = nullptr;
 
-				state.push(GltfState_Mesh);
-				jsonArray.getValueAt(i)->visit(*this);
+		gltfNode.rotation[0] = 0.0f;
+		gltfNode.rotation[1] = 0.0f;
+		gltfNode.rotation[2] = 0.0f;
+		gltfNode.rotation[3] = 1.0f;
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		gltfNode.scale[0] = 1.0f;
+		gltfNode.scale[1] = 1.0f;
+		gltfNode.scale[2] = 1.0f;
 
-				state.pop();
+		gltfNode.translation[0] = 0.0f;
+		gltfNode.translation[1] = 0.0f;
+		gltfNode.translation[2] = 0.0f;
 
-				//
+		gltfNode.weights.clear();
 
-				allGltfMeshes.append(gltfMesh);
-			}
-		}
-		else if (gltfState == GltfState_Cameras)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfCamera.orthograpic.xmag = 0.0f;
-				gltfCamera.orthograpic.ymag = 0.0f;
-
-				gltfCamera.perspective.aspectRatio = 1.0f;
-				gltfCamera.perspective.yfov = 0.0f;
-				gltfCamera.perspective.infinite = VK_FALSE;
-
-				gltfCamera.znear = 0.0f;
-				gltfCamera.zfar = 0.0f;
-				gltfCamera.type = "";
-				gltfCamera.name = "Camera_" + std::to_string(i);
-
-				//
-
-				state.push(GltfState_Camera);
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
-
-				state.pop();
-
-				//
-
-				allGltfCameras.append(gltfCamera);
-			}
-		}
-		else if (gltfState == GltfState_Skins)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfSkin.inverseBindMatrices = nullptr;
-				gltfSkin.skeleton = 0;
-				gltfSkin.joints.clear();
-				gltfSkin.name = "Skin_" + std::to_string(i);
-
-				//
-
-				state.push(GltfState_Skin);
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
-
-				state.pop();
+		//
 
-				//
+		state.push(GltfState_Node);
+		jsonValue.visit(*this);
 
-				allGltfSkins.append(gltfSkin);
-			}
-		}
-		else if (gltfState == GltfState_Nodes)
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfNode.children.clear();
-				gltfNode.camera = nullptr;
-				gltfNode.skin = nullptr;
-				gltfNode.name = "Node_" + std::to_string(i);
-
-				for (int32_t k = 0; k < 16; k++)
-				{
-					if ((k % 4) - (k / 4) == 0)
-					{
-						gltfNode.matrix[k] = 1.0f;
-					}
-					else
-					{
-						gltfNode.matrix[k] = 0.0f;
-					}
-				}
-
-				gltfNode.mesh = nullptr;
-
-				gltfNode.rotation[0] = 0.0f;
-				gltfNode.rotation[1] = 0.0f;
-				gltfNode.rotation[2] = 0.0f;
-				gltfNode.rotation[3] = 1.0f;
-
-				gltfNode.scale[0] = 1.0f;
-				gltfNode.scale[1] = 1.0f;
-				gltfNode.scale[2] = 1.0f;
-
-				gltfNode.translation[0] = 0.0f;
-				gltfNode.translation[1] = 0.0f;
-				gltfNode.translation[2] = 0.0f;
-
-				gltfNode.weights.clear();
-
-				//
-
-				state.push(GltfState_Node);
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
-
-				state.pop();
-
-				//
-
-				allGltfNodes.append(gltfNode);
-			}
+			return;
 		}
-		else if (gltfState == GltfState_Animations)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfAnimation.samplers.clear();
-				gltfAnimation.channels.clear();
-				gltfAnimation.name = "Animation_" + std::to_string(i);
 
-				//
+		state.pop();
 
-				state.push(GltfState_Animation);
-				jsonArray.getValueAt(i)->visit(*this);
+		//
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		allGltfNodes.append(gltfNode);
+	}
+	else if (gltfState == GltfState_Animations)
+	{
+		gltfAnimation.samplers.clear();
+		gltfAnimation.channels.clear();
+		gltfAnimation.name = "Animation_" + std::to_string(index);
 
-				state.pop();
+		//
 
-				//
+		state.push(GltfState_Animation);
+		jsonValue.visit(*this);
 
-				allGltfAnimations.append(gltfAnimation);
-			}
-		}
-		else if (gltfState == GltfState_Scenes)
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfScene.nodes.clear();
-				gltfScene.name = "Scene_" + std::to_string(i);
-
-				//
-
-				state.push(GltfState_Scene);
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
-
-				state.pop();
-
-				//
-
-				allGltfScenes.append(gltfScene);
-			}
+			return;
 		}
-		else if (gltfState == GltfState_Mesh_Primitive)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfPrimitive.position = nullptr;
-				gltfPrimitive.normal = nullptr;
-				gltfPrimitive.tangent = nullptr;
-				gltfPrimitive.texCoord0 = nullptr;
-				gltfPrimitive.texCoord1 = nullptr;
-				gltfPrimitive.joints0 = nullptr;
-				gltfPrimitive.joints1 = nullptr;
-				gltfPrimitive.weights0 = nullptr;
-				gltfPrimitive.weights1 = nullptr;
-				gltfPrimitive.color0 = nullptr;
-				gltfPrimitive.color1 = nullptr;
-				gltfPrimitive.indices = nullptr;
-				gltfPrimitive.mode = 4;
-				gltfPrimitive.material = nullptr;
-				gltfPrimitive.targets.clear();
-				gltfPrimitive.name = "Primitive_" + std::to_string(i);
-
-				//
-
-				jsonArray.getValueAt(i)->visit(*this);
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		state.pop();
 
-				gltfMesh.primitives.append(gltfPrimitive);
-			}
-		}
-		else if (gltfState == GltfState_Mesh_Primitive_Targets)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfTarget.position = nullptr;
-				gltfTarget.normal = nullptr;
-				gltfTarget.tangent = nullptr;
+		//
 
-				//
+		allGltfAnimations.append(gltfAnimation);
+	}
+	else if (gltfState == GltfState_Scenes)
+	{
+		gltfScene.nodes.clear();
+		gltfScene.name = "Scene_" + std::to_string(index);
 
-				jsonArray.getValueAt(i)->visit(*this);
+		//
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		state.push(GltfState_Scene);
+		jsonValue.visit(*this);
 
-				gltfPrimitive.targets.append(gltfTarget);
-			}
-		}
-		else if (gltfState == GltfState_Mesh_Weights)
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
-
-				gltfMesh.weights.append(gltfFloat);
-			}
+			return;
 		}
-		else if (gltfState == GltfState_Skin_Joints)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				jsonArray.getValueAt(i)->visit(*this);
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		state.pop();
 
-				gltfSkin.joints.append((uint32_t)gltfInteger);
-			}
-		}
-		else if (gltfState == GltfState_Node_Children)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				jsonArray.getValueAt(i)->visit(*this);
+		//
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		allGltfScenes.append(gltfScene);
+	}
+	else if (gltfState == GltfState_Mesh_Primitive)
+	{
+		gltfPrimitive.position = nullptr;
+		gltfPrimitive.normal = nullptr;
+		gltfPrimitive.tangent = nullptr;
+		gltfPrimitive.texCoord0 = nullptr;
+		gltfPrimitive.texCoord1 = nullptr;
+		gltfPrimitive.joints0 = nullptr;
+		gltfPrimitive.joints1 = nullptr;
+		gltfPrimitive.weights0 = nullptr;
+		gltfPrimitive.weights1 = nullptr;
+		gltfPrimitive.color0 = nullptr;
+		gltfPrimitive.color1 = nullptr;
+		gltfPrimitive.indices = nullptr;
+		gltfPrimitive.mode = 4;
+		gltfPrimitive.material = nullptr;
+		gltfPrimitive.targets.clear();
+		gltfPrimitive.name = "Primitive_" + std::to_string(index);
 
-				gltfNode.children.append((uint32_t)gltfInteger);
-			}
-		}
-		else if (gltfState == GltfState_Node_Weights)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				jsonArray.getValueAt(i)->visit(*this);
+		//
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		jsonValue.visit(*this);
 
-				gltfNode.weights.append(gltfFloat);
-			}
-		}
-		else if (gltfState == GltfState_Animation_Sampler)
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfAnimation_Sampler.input = nullptr;
-				gltfAnimation_Sampler.interpolation = "LINEAR";
-				gltfAnimation_Sampler.output = nullptr;
-				gltfAnimation_Sampler.name = "Sampler_" + std::to_string(i);
-
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
-
-				//
-
-				gltfAnimation.samplers.append(gltfAnimation_Sampler);
-			}
-
+			return;
 		}
-		else if (gltfState == GltfState_Animation_Channel)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfChannel.sampler = nullptr;
-				gltfChannel.targetNode = nullptr;
-				gltfChannel.targetPath = "";
-				gltfChannel.name = "Channel_" + std::to_string(i);
-
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
 
-				gltfAnimation.channels.append(gltfChannel);
-			}
-		}
-		else if (gltfState == GltfState_Scene_Node)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				jsonArray.getValueAt(i)->visit(*this);
+		gltfMesh.primitives.append(gltfPrimitive);
+	}
+	else if (gltfState == GltfState_Mesh_Primitive_Targets)
+	{
+		gltfTarget.position = nullptr;
+		gltfTarget.normal = nullptr;
+		gltfTarget.tangent = nullptr;
 
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		//
 
-				if (allGltfNodes.size() <= (uint32_t)gltfInteger)
-				{
-					state.push(GltfState_Error);
-					return;
-				}
+		jsonValue.visit(*this);
 
-				gltfScene.nodes.append(&allGltfNodes[gltfInteger]);
-			}
-		}
-		else if (gltfState == GltfState_Accessor_Sparse_Indices)
+		if (state.top() == GltfState_Error)
 		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfSparseIndex.bufferView = 0;
-				gltfSparseIndex.byteOffset = 0;
-				gltfSparseIndex.componentType = 0;
-				gltfSparseIndex.name = gltfSparse.name + "_Index_" + std::to_string(i);
-
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
-
-				gltfSparse.indices.push_back(gltfSparseIndex);
-			}
+			return;
 		}
-		else if (gltfState == GltfState_Accessor_Sparse_Values)
-		{
-			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
-			{
-				gltfSparseValue.bufferView = 0;
-				gltfSparseValue.byteOffset = 0;
-				gltfSparseValue.name = gltfSparse.name + "_Value_" + std::to_string(i);
 
-				jsonArray.getValueAt(i)->visit(*this);
-
-				if (state.top() == GltfState_Error)
-				{
-					return;
-				}
+		gltfPrimitive.targets.append(gltfTarget);
+	}
+	else if (gltfState == GltfState_Mesh_Weights)
+	{
+		jsonValue.visit(*this);
 
-				gltfSparse.values.push_back(gltfSparseValue);
-			}
-		}
-		else
+		if (state.top() == GltfState_Error)
 		{
-			state.push(GltfState_Error);
 			return;
 		}
-	}
-	else
-	{
-		state.push(GltfState_Error);
-		return;
-	}
-}
 
-void GltfVisitor::visit(JSONobject& jsonObject)
-{
-	if (state.size() == 0 && subState.size() == 0)
-	{
-		state.push(GltfState_Start);
-		subState.push(GltfSubState_Start);
+		gltfMesh.weights.append(gltfFloat);
 	}
-
-	auto gltfState = state.top();
-
-	//
-
-	if (gltfState == GltfState_Error)
+	else if (gltfState == GltfState_Skin_Joints)
 	{
-		return;
-	}
-	else if (gltfState == GltfState_Start)
-	{
-		//
-		// Required
-		//
+		jsonValue.visit(*this);
 
-		if (!jsonObject.hasKey("asset"))
+		if (state.top() == GltfState_Error)
 		{
-			state.push(GltfState_Error);
 			return;
 		}
 
-		//
-		// Dependencies
-		//
+		gltfSkin.joints.append((uint32_t)gltfInteger);
+	}
+	else if (gltfState == GltfState_Node_Children)
+	{
+		jsonValue.visit(*this);
 
-		if (jsonObject.hasKey("scene") && !jsonObject.hasKey("scenes"))
+		if (state.top() == GltfState_Error)
 		{
-			state.push(GltfState_Error);
 			return;
 		}
 
-		//
-		//
-		//
-
-		auto asset = jsonObject.getValue("asset");
-
-		state.push(GltfState_Asset);
-		asset->visit(*this);
+		gltfNode.children.append((uint32_t)gltfInteger);
+	}
+	else if (gltfState == GltfState_Node_Weights)
+	{
+		jsonValue.visit(*this);
 
 		if (state.top() == GltfState_Error)
 		{
 			return;
 		}
 
-		state.pop();
+		gltfNode.weights.append(gltfFloat);
+	}
+	else if (gltfState == GltfState_Animation_Sampler)
+	{
+		gltfAnimation_Sampler.input = nullptr;
+		gltfAnimation_Sampler.interpolation = "LINEAR";
+		gltfAnimation_Sampler.output = nullptr;
+		gltfAnimation_Sampler.name = "Sampler_" + std::to_string(index);
 
-		// Optional
+		jsonValue.visit(*this);
 
-		if (jsonObject.hasKey("buffers"))
+		if (state.top() == GltfState_Error)
 		{
-			objectArray = VK_TRUE;
-
-			auto buffers = jsonObject.getValue("buffers");
-
-			state.push(GltfState_Buffers);
-			buffers->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-
-			state.pop();
+			return;
 		}
 
 		//
 
-		if (jsonObject.hasKey("bufferViews"))
-		{
-			objectArray = VK_TRUE;
-
-			auto bufferViews = jsonObject.getValue("bufferViews");
-
-			state.push(GltfState_BufferViews);
-			bufferViews->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
+		gltfAnimation.samplers.append(gltfAnimation_Sampler);
+	}
+	else if (gltfState == GltfState_Animation_Channel)
+	{
+		gltfChannel.sampler = nullptr;
+		gltfChannel.targetNode = nullptr;
+		gltfChannel.targetPath = "";
+		gltfChannel.name = "Channel_" + std::to_string(index);
 
-			state.pop();
-		}
+		jsonValue.visit(*this);
 
-		//
-
-		if (jsonObject.hasKey("accessors"))
+		if (state.top() == GltfState_Error)
 		{
-			objectArray = VK_TRUE;
-
-			auto accessors = jsonObject.getValue("accessors");
-
-			state.push(GltfState_Accessors);
-			accessors->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-
-			state.pop();
+			return;
 		}
 
-		//
+		gltfAnimation.channels.append(gltfChannel);
+	}
+	else if (gltfState == GltfState_Scene_Node)
+	{
+		jsonValue.visit(*this);
 
-		if (jsonObject.hasKey("extensionsRequired"))
+		if (state.top() == GltfState_Error)
 		{
-			objectArray = VK_TRUE;
-
-			auto extensionsRequired = jsonObject.getValue("extensionsRequired");
-
-			state.push(GltfState_ExtensionsRequired);
-			extensionsRequired->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-
-			state.pop();
+			return;
 		}
 
-		//
-
-		if (jsonObject.hasKey("extensionsUsed"))
+		if (allGltfNodes.size() <= (uint32_t)gltfInteger)
 		{
-			objectArray = VK_TRUE;
-
-			auto extensionsUsed = jsonObject.getValue("extensionsUsed");
-
-			state.push(GltfState_ExtensionsUsed);
-			extensionsUsed->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-
-			state.pop();
+			state.push(GltfState_Error);
+			return;
 		}
 
-		//
-
-		if (jsonObject.hasKey("images"))
-		{
-			objectArray = VK_TRUE;
-
-			auto images = jsonObject.getValue("images");
-
-			state.push(GltfState_Images);
-			images->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-
-			state.pop();
-		}
+		gltfScene.nodes.append(&allGltfNodes[gltfInteger]);
+	}
+	else if (gltfState == GltfState_Accessor_Sparse_Indices)
+	{
+		gltfSparseIndex.bufferView = 0;
+		gltfSparseIndex.byteOffset = 0;
+		gltfSparseIndex.componentType = 0;
+		gltfSparseIndex.name = gltfSparse.name + "_Index_" + std::to_string(index);
 
-		//
+		jsonValue.visit(*this);
 
-		if (jsonObject.hasKey("samplers"))
+		if (state.top() == GltfState_Error)
 		{
-			objectArray = VK_TRUE;
-
-			auto samplers = jsonObject.getValue("samplers");
-
-			state.push(GltfState_Samplers);
-			samplers->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-
-			state.pop();
+			return;
 		}
 
-		//
-
-		if (jsonObject.hasKey("textures"))
-		{
-			objectArray = VK_TRUE;
-
-			auto textures = jsonObject.getValue("textures");
-
-			state.push(GltfState_Textures);
-			textures->visit(*this);
+		gltfSparse.indices.push_back(gltfSparseIndex);
+	}
+	else if (gltfState == GltfState_Accessor_Sparse_Values)
+	{
+		gltfSparseValue.bufferView = 0;
+		gltfSparseValue.byteOffset = 0;
+		gltfSparseValue.name = gltfSparse.name + "_Value_" + std::to_string(index);
 
-			objectArray = VK_FALSE;
+		jsonValue.visit(*this);
 
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-
-			state.pop();
+		if (state.top() == GltfState_Error)
+		{
+			return;
 		}
 
-		//
+		gltfSparse.values.push_back(gltfSparseValue);
+	}
+	else
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+}
 
-		if (jsonObject.hasKey("materials"))
-		{
-			objectArray = VK_TRUE;
+void GltfVisitor::visit(JSONnull& jsonNull)
+{
+	auto gltfState = state.top();
+
+	if (gltfState == GltfState_Error)
+	{
+		return;
+	}
 
-			auto materials = jsonObject.getValue("materials");
+	// No used, so always error.
+	state.push(GltfState_Error);
+}
 
-			state.push(GltfState_Materials);
-			materials->visit(*this);
+void GltfVisitor::visit(JSONfalse& jsonFalse)
+{
+	auto gltfState = state.top();
 
-			objectArray = VK_FALSE;
+	if (gltfState == GltfState_Error)
+	{
+		return;
+	}
 
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
+	gltfBool = VK_FALSE;
+}
 
-			state.pop();
-		}
+void GltfVisitor::visit(JSONtrue& jsonTrue)
+{
+	auto gltfState = state.top();
 
-		//
+	if (gltfState == GltfState_Error)
+	{
+		return;
+	}
 
-		if (jsonObject.hasKey("meshes"))
-		{
-			objectArray = VK_TRUE;
+	gltfBool = VK_TRUE;
+}
 
-			auto meshes = jsonObject.getValue("meshes");
+void GltfVisitor::visit(JSONfloat& jsonFloat)
+{
+	auto gltfState = state.top();
 
-			state.push(GltfState_Meshes);
-			meshes->visit(*this);
+	if (gltfState == GltfState_Error)
+	{
+		return;
+	}
 
-			objectArray = VK_FALSE;
+	gltfInteger = (int32_t)jsonFloat.getValue();
+	gltfFloat = jsonFloat.getValue();
+}
 
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
+void GltfVisitor::visit(JSONinteger& jsonInteger)
+{
+	auto gltfState = state.top();
 
-			state.pop();
-		}
+	if (gltfState == GltfState_Error)
+	{
+		return;
+	}
 
-		//
+	gltfInteger = jsonInteger.getValue();
+	gltfFloat = (float)jsonInteger.getValue();
+}
 
-		if (jsonObject.hasKey("cameras"))
-		{
-			objectArray = VK_TRUE;
+void GltfVisitor::visit(JSONstring& jsonString)
+{
+	auto gltfState = state.top();
 
-			auto cameras = jsonObject.getValue("cameras");
+	if (gltfState == GltfState_Error)
+	{
+		return;
+	}
 
-			state.push(GltfState_Cameras);
-			cameras->visit(*this);
+	gltfString = jsonString.getValue();
+}
 
-			objectArray = VK_FALSE;
+void GltfVisitor::visit(JSONarray& jsonArray)
+{
+	auto gltfState = state.top();
 
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
+	if (gltfState == GltfState_Error)
+	{
+		return;
+	}
 
-			state.pop();
+	if (numberArray)
+	{
+		if (arrayIndex >= arraySize || jsonArray.size() != arraySize)
+		{
+			state.push(GltfState_Error);
+			return;
 		}
 
-		//
-
-		if (jsonObject.hasKey("skins"))
+		for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
 		{
-			objectArray = VK_TRUE;
-
-			auto skins = jsonObject.getValue("skins");
-
-			state.push(GltfState_Skins);
-			skins->visit(*this);
-
-			objectArray = VK_FALSE;
+			jsonArray.getValueAt(i)->visit(*this);
 
 			if (state.top() == GltfState_Error)
 			{
 				return;
 			}
 
-			state.pop();
-		}
-
-		//
+			gltfIntegerArray[arrayIndex] = gltfInteger;
+			gltfFloatArray[arrayIndex] = gltfFloat;
 
-		if (jsonObject.hasKey("nodes"))
+			arrayIndex++;
+		}
+	}
+	else if (objectArray)
+	{
+		for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
 		{
-			objectArray = VK_TRUE;
-
-			auto nodes = jsonObject.getValue("nodes");
-
-			state.push(GltfState_Nodes);
-			nodes->visit(*this);
-
-			objectArray = VK_FALSE;
+			visitObjectArrayElement(*(jsonArray.getValueAt(i)), i);
 
 			if (state.top() == GltfState_Error)
 			{
 				return;
 			}
-
-			state.pop();
 		}
+	}
+	else
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+}
 
-		//
-
-		if (jsonObject.hasKey("animations"))
-		{
-			objectArray = VK_TRUE;
-
-			auto animations = jsonObject.getValue("animations");
+void GltfVisitor::visit(JSONobject& jsonObject)
+{
+	visitBegin();
 
-			state.push(GltfState_Animations);
-			animations->visit(*this);
+	auto gltfState = state.top();
 
-			objectArray = VK_FALSE;
+	//
 
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
+	if (gltfState == GltfState_Error)
+	{
+		return;
+	}
+	else if (gltfState == GltfState_Start)
+	{
+		//
+		// Required
+		//
 
-			state.pop();
+		if (!jsonObject.hasKey("asset"))
+		{
+			state.push(GltfState_Error);
+			return;
 		}
 
-
+		//
+		// Dependencies
 		//
 
-		if (jsonObject.hasKey("scenes"))
+		if (jsonObject.hasKey("scene") && !jsonObject.hasKey("scenes"))
 		{
-			objectArray = VK_TRUE;
+			state.push(GltfState_Error);
+			return;
+		}
+
+		//
+		//
+		//
 
-			auto scenes = jsonObject.getValue("scenes");
+		visitAsset(*(jsonObject.getValue("asset")));
 
-			state.push(GltfState_Scenes);
-			scenes->visit(*this);
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
 
-			objectArray = VK_FALSE;
+		// Optional
 
-			if (state.top() == GltfState_Error)
+		for (uint32_t i = 0; i < VKTS_GLTF_SECTION_COUNT; i++)
+		{
+			if (jsonObject.hasKey(allSections[i].key))
 			{
-				return;
-			}
+				visitSection(allSections[i].state, *(jsonObject.getValue(allSections[i].key)));
 
-			state.pop();
+				if (state.top() == GltfState_Error)
+				{
+					return;
+				}
+			}
 		}
 
 		//
 
 		if (jsonObject.hasKey("scene"))
 		{
-			auto scene = jsonObject.getValue("scene");
-
-			scene->visit(*this);
+			visitDefaultScene(*(jsonObject.getValue("scene")));
 
 			if (state.top() == GltfState_Error)
 			{
 				return;
 			}
-
-			if (allGltfScenes.size() <= (uint32_t)gltfInteger)
-			{
-				state.push(GltfState_Error);
-				return;
-			}
-
-			defaultScene = &(allGltfScenes[gltfInteger]);
 		}
 
 		//
 		// If this point is reached, the glTF file could be parsed successfully.
 		//
 
-		state.push(GltfState_End);
-		subState.push(GltfSubState_End);
+		visitEnd();
 
 		return;
 	}
@@ -4795,6 +4433,116 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 	}
 }
 
+void GltfVisitor::visitBegin()
+{
+	if (state.size() == 0 && subState.size() == 0)
+	{
+		state.push(GltfState_Start);
+		subState.push(GltfSubState_Start);
+	}
+}
+
+void GltfVisitor::visitAsset(JSONvalue& jsonValue)
+{
+	if (getState() != GltfState_Start)
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+
+	state.push(GltfState_Asset);
+	jsonValue.visit(*this);
+
+	if (state.top() == GltfState_Error)
+	{
+		return;
+	}
+
+	state.pop();
+}
+
+void GltfVisitor::visitSection(const enum GltfState gltfState, JSONvalue& jsonValue)
+{
+	if (getState() != GltfState_Start)
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+
+	objectArray = VK_TRUE;
+
+	state.push(gltfState);
+	jsonValue.visit(*this);
+
+	objectArray = VK_FALSE;
+
+	if (state.top() == GltfState_Error)
+	{
+		return;
+	}
+
+	state.pop();
+}
+
+void GltfVisitor::visitSectionElement(const enum GltfState gltfState, JSONvalue& jsonValue, const int32_t index)
+{
+	if (getState() != GltfState_Start)
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+
+	objectArray = VK_TRUE;
+
+	state.push(gltfState);
+	visitObjectArrayElement(jsonValue, index);
+
+	objectArray = VK_FALSE;
+
+	if (state.top() == GltfState_Error)
+	{
+		return;
+	}
+
+	state.pop();
+}
+
+void GltfVisitor::visitDefaultScene(JSONvalue& jsonValue)
+{
+	if (getState() != GltfState_Start)
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+
+	jsonValue.visit(*this);
+
+	if (state.top() == GltfState_Error)
+	{
+		return;
+	}
+
+	if (allGltfScenes.size() <= (uint32_t)gltfInteger)
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+
+	defaultScene = &(allGltfScenes[gltfInteger]);
+}
+
+void GltfVisitor::visitEnd()
+{
+	if (getState() != GltfState_Start)
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+
+	state.push(GltfState_End);
+	subState.push(GltfSubState_End);
+}
+
 const std::string& GltfVisitor::getDirectory() const
 {
 	return directory;
@@ -324,6 +324,13 @@ typedef struct _GltfScene {
 	std::string name;
 } GltfScene;
 
+#define VKTS_GLTF_SECTION_COUNT 15
+
+typedef struct _GltfSection {
+	const char* key;
+	enum GltfState state;
+} GltfSection;
+
 class GltfVisitor : public JsonVisitor
 {
 
@@ -419,8 +426,15 @@ private:
 	void visitAnimation_Channel(JSONobject& jsonObject);
 	void visitAnimation_Channel_Target(JSONobject& jsonObject);
 
+	void visitObjectArrayElement(JSONvalue& jsonValue, const int32_t index);
+
 public:
 
+	/**
+	 * Top level object arrays in the order they have to be visited, as later ones do reference earlier ones.
+	 */
+	static const GltfSection allSections[VKTS_GLTF_SECTION_COUNT];
+
 	GltfVisitor() = delete;
 
 	explicit GltfVisitor(const std::string& directory, const IBinaryBufferSP& binaryBuffer);
@@ -445,6 +459,22 @@ public:
 
 	virtual void visit(JSONobject& jsonObject) override;
 
+	//
+	// Visiting the top level values one by one, so the document has not to be decoded at once.
+	//
+
+	void visitBegin();
+
+	void visitAsset(JSONvalue& jsonValue);
+
+	void visitSection(const enum GltfState gltfState, JSONvalue& jsonValue);
+
+	void visitSectionElement(const enum GltfState gltfState, JSONvalue& jsonValue, const int32_t index);
+
+	void visitDefaultScene(JSONvalue& jsonValue);
+
+	void visitEnd();
+
 	//
 
 	const std::string& getDirectory() const;
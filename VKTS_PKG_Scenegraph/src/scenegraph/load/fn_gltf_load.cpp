@@ -26,6 +26,7 @@
 
 #include <vkts/scenegraph/vkts_scenegraph.hpp>
 
+#include "GltfSaxHandler.hpp"
 #include "GltfVisitor.hpp"
 
 #define VKTS_GLTF_MR_FORWARD_FRAGMENT_SHADER_NAME "shader/SPIR/V/glTF_mr_forward.frag.spv"
@@ -1718,6 +1719,97 @@ static VkBool32 gltfProcessObject(IObjectSP& object, const GltfVisitor& visitor,
 }
 
 
+static VkBool32 gltfVisit(GltfVisitor& visitor, const std::string& gltfString, const Map<std::string, VkTsJsonRange>& allRanges)
+{
+	//
+	// Required
+	//
+
+	if (!allRanges.contains("asset"))
+	{
+		return VK_FALSE;
+	}
+
+	//
+	// Dependencies
+	//
+
+	if (allRanges.contains("scene") && !allRanges.contains("scenes"))
+	{
+		return VK_FALSE;
+	}
+
+	//
+	//
+	//
+
+	const char* jsonText = gltfString.c_str();
+
+	visitor.visitBegin();
+
+	const auto& assetRange = allRanges["asset"];
+
+	auto asset = jsonDecodeFast(&jsonText[assetRange.offset], assetRange.length);
+
+	if (!asset.get())
+	{
+		return VK_FALSE;
+	}
+
+	visitor.visitAsset(*asset);
+
+	if (visitor.getState() == GltfState_Error)
+	{
+		return VK_FALSE;
+	}
+
+	// Optional: Each array is decoded element by element, in the order of the dependencies and not of the file.
+
+	for (uint32_t i = 0; i < VKTS_GLTF_SECTION_COUNT; i++)
+	{
+		const auto& section = GltfVisitor::allSections[i];
+
+		if (!allRanges.contains(section.key))
+		{
+			continue;
+		}
+
+		const auto& sectionRange = allRanges[section.key];
+
+		GltfSaxHandler saxHandler(visitor, section.state);
+
+		if (!jsonParse(&jsonText[sectionRange.offset], sectionRange.length, saxHandler))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	//
+
+	if (allRanges.contains("scene"))
+	{
+		const auto& sceneRange = allRanges["scene"];
+
+		auto scene = jsonDecodeFast(&jsonText[sceneRange.offset], sceneRange.length);
+
+		if (!scene.get())
+		{
+			return VK_FALSE;
+		}
+
+		visitor.visitDefaultScene(*scene);
+
+		if (visitor.getState() == GltfState_Error)
+		{
+			return VK_FALSE;
+		}
+	}
+
+	visitor.visitEnd();
+
+	return visitor.getState() == GltfState_End;
+}
+
 ISceneSP VKTS_APIENTRY gltfLoad(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const VkBool32 freeHostMemory)
 {
     if (!filename || !sceneManager.get() || !sceneFactory.get())
@@ -1756,7 +1848,7 @@ ISceneSP VKTS_APIENTRY gltfLoad(const char* filename, const ISceneManagerSP& sce
     }
     else if (lowerCaseExtension == ".glb")
     {
-    	auto binaryFile = fileLoadBinary(filename);
+    	auto binaryFile = fileMapBinary(filename);
 
     	if (!binaryFile.get())
     	{
@@ -1856,9 +1948,10 @@ ISceneSP VKTS_APIENTRY gltfLoad(const char* filename, const ISceneManagerSP& sce
 
     //
 
-	auto json = jsonDecode(gltfString);
+	// Only the ranges of the top level values are gathered, as the whole document is never decoded at once.
+	Map<std::string, VkTsJsonRange> allRanges;
 
-	if (!json.get())
+	if (!jsonIndexObject(gltfString.c_str(), (uint32_t)gltfString.length(), allRanges))
 	{
 		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Parsing JSON failed");
 
@@ -1871,9 +1964,7 @@ ISceneSP VKTS_APIENTRY gltfLoad(const char* filename, const ISceneManagerSP& sce
 
 	GltfVisitor visitor(directory, binaryBuffer);
 
-	json->visit(visitor);
-
-	if (visitor.getState() != GltfState_End)
+	if (!gltfVisit(visitor, gltfString, allRanges))
 	{
 		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Processing glTF failed");
 
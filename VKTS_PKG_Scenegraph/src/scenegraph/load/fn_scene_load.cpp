@@ -178,115 +178,98 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
 				if (!imageData.get())
 				{
-					// Load image data.
+					// Cached data is keyed by the source file, so a hit neither loads nor decodes the source.
 
-					imageData = imageDataLoad(finalImageDataFilename.c_str());
+					uint64_t sourceHash = 0;
 
-					if (!imageData.get())
+					if (cacheGetEnabled())
 					{
-						std::string textureImageDataFilename = std::string(VKTS_TEXTURE_DIRECTORY) + imageDataFilename;
-
-						imageData = imageDataLoad(textureImageDataFilename.c_str());
+						sourceHash = cacheHashFile(finalImageDataFilename.c_str());
 
-						if (!imageData.get())
+						if (sourceHash == 0)
 						{
-							imageData = imageDataLoad(imageDataFilename.c_str());
+							sourceHash = cacheHashFile((std::string(VKTS_TEXTURE_DIRECTORY) + imageDataFilename).c_str());
 
-							if (!imageData.get())
+							if (sourceHash == 0)
 							{
-								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load image data '%s'", finalImageDataFilename.c_str());
-
-								return VK_FALSE;
+								sourceHash = cacheHashFile(imageDataFilename.c_str());
 							}
 						}
 					}
 
-					//
-
-					if (mipMap && imageData->getMipLevels() == 1 && (imageData->getExtent3D().width > 1 || imageData->getExtent3D().height > 1 || imageData->getExtent3D().depth > 1))
-					{
-						//
-						// Mip map image creation.
-						//
-
-						auto dotIndex = finalImageDataFilename.rfind(".");
+					// Without a source hash, keys of different images would collide.
+					VkBool32 useCache = sourceHash != 0;
 
-						if (dotIndex == finalImageDataFilename.npos)
-						{
-							logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No valid image filename '%s'", finalImageDataFilename.c_str());
-
-							return VK_FALSE;
-						}
+					// All mip levels are cached in one packed image, which is used without decoding.
+					auto mipMapKey = cacheCreateKey(sourceHash, "MIPMAP");
 
-						auto sourceImageName = finalImageDataFilename.substr(0, dotIndex);
-						auto sourceImageExtension = finalImageDataFilename.substr(dotIndex);
+					// The cube map length is derived from the source, so the converted cube map only depends on the environment type.
+					std::string cubeMapParameters = "_ENVIRONMENT" + std::to_string((int32_t)environmentType);
 
-						int32_t width = imageData->getWidth();
-						int32_t height = imageData->getHeight();
-						int32_t depth = imageData->getDepth();
+					// All mip levels and layers are cached in one packed image, which is used without decoding.
+					auto cubeMapKey = cacheCreateKey(sourceHash, "CUBEMAP" + cubeMapParameters);
 
-						SmartPointerVector<IImageDataSP> allMipMaps;
+					IImageDataSP cachedImageData;
 
-						if (cacheGetEnabled())
+					if (useCache)
+					{
+						if (mipMap)
 						{
-							allMipMaps.append(imageData);
-
-							int32_t level = 1;
+							cachedImageData = cacheLoadImageDataByKey(mipMapKey, finalImageDataFilename);
+						}
+						else if (environment)
+						{
+							cachedImageData = cacheLoadImageDataByKey(cubeMapKey, finalImageDataFilename);
+						}
+					}
 
-							while (width > 1 || height > 1 || depth > 1)
-							{
-								width = glm::max(width / 2, 1);
-								height = glm::max(height / 2, 1);
-								depth = glm::max(depth / 2, 1);
+					if (cachedImageData.get())
+					{
+						logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
 
-								auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(level++) + sourceImageExtension;
+						imageData = cachedImageData;
+					}
+					else
+					{
+						// Load image data.
 
-								auto targetImage = cacheLoadImageData(targetImageFilename.c_str());
+						imageData = imageDataLoad(finalImageDataFilename.c_str());
+					}
 
-								if (!targetImage.get())
-								{
-									allMipMaps.clear();
+					if (!imageData.get())
+					{
+						std::string textureImageDataFilename = std::string(VKTS_TEXTURE_DIRECTORY) + imageDataFilename;
 
-									break;
-								}
+						imageData = imageDataLoad(textureImageDataFilename.c_str());
 
-								allMipMaps.append(targetImage);
+						if (!imageData.get())
+						{
+							imageData = imageDataLoad(imageDataFilename.c_str());
 
-								//
+							if (!imageData.get())
+							{
+								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load image data '%s'", finalImageDataFilename.c_str());
 
-								width = targetImage->getWidth();
-								height = targetImage->getHeight();
-								depth = targetImage->getDepth();
+								return VK_FALSE;
 							}
 						}
+					}
+
+					//
 
+					if (mipMap && !cachedImageData.get() && imageData->getMipLevels() == 1 && (imageData->getExtent3D().width > 1 || imageData->getExtent3D().height > 1 || imageData->getExtent3D().depth > 1))
+					{
+						//
+						// Mip map image creation.
 						//
 
+						auto allMipMaps = imageDataMipmap(imageData, VK_FALSE, finalImageDataFilename);
+
 						if (allMipMaps.size() == 0)
 						{
-							allMipMaps = imageDataMipmap(imageData, VK_FALSE, finalImageDataFilename);
-
-							if (allMipMaps.size() == 0)
-							{
-								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
-
-								return VK_FALSE;
-							}
+							logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
 
-							if (cacheGetEnabled())
-							{
-								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
-
-								// Only cache mip maps sub levels.
-								for (uint32_t i = 1; i < allMipMaps.size(); i++)
-								{
-									cacheSaveImageData(allMipMaps[i]);
-								}
-							}
-						}
-						else
-						{
-							logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
+							return VK_FALSE;
 						}
 
 						for (uint32_t i = 0; i < allMipMaps.size(); i++)
@@ -302,6 +285,13 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
 							return VK_FALSE;
 						}
+
+						if (useCache)
+						{
+							logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
+
+							cacheSaveImageDataByKey(mipMapKey, imageData, VKTS_CACHE_PACKED_EXTENSION);
+						}
 					}
 					else if (environment)
 					{
@@ -309,110 +299,53 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 						// Cube map image creation.
 						//
 
-						auto dotIndex = finalImageDataFilename.rfind(".");
-
-						if (dotIndex == finalImageDataFilename.npos)
+						if (!cachedImageData.get() && imageData->getArrayLayers() % 6 == 0)
 						{
-							logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No valid image filename '%s'", finalImageDataFilename.c_str());
-
-							return VK_FALSE;
+							// Source already is a cube map, so derived data does not depend on a conversion.
+							cubeMapParameters = "";
 						}
-
-						auto sourceImageName = finalImageDataFilename.substr(0, dotIndex);
-						auto sourceImageExtension = finalImageDataFilename.substr(dotIndex);
-
-						if (imageData->getArrayLayers() % 6 != 0)
+						else if (!cachedImageData.get())
 						{
-							SmartPointerVector<IImageDataSP> allCubeMaps;
+							uint32_t currentMapLength = imageData->getHeight() / 2;
 
-							if (cacheGetEnabled())
+							uint32_t cubeMapLength = 1;
+							while (cubeMapLength * 2 <= currentMapLength)
 							{
-								uint32_t levelCount = (uint32_t)log2f((float)(imageData->getHeight()));
-
-								if (cacheGetEnabled())
-								{
-									for (uint32_t layer = 0; layer < 6; layer++)
-									{
-										for (uint32_t level = 0; level < levelCount; level++)
-										{
-											auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(level) + "_LAYER" + std::to_string(layer) + sourceImageExtension;
-
-											auto targetImageData = cacheLoadImageData(targetImageFilename.c_str());
-
-											if (!targetImageData.get())
-											{
-												allCubeMaps.clear();
-
-												break;
-											}
+								cubeMapLength *= 2;
+							}
 
-											allCubeMaps.append(targetImageData);
-										}
-									}
-								}
+							if (environmentType == VKTS_ENVIRONMENT_MIRROR_DOME)
+							{
+								cubeMapLength *= 2;
 							}
 
-							//
+							auto oldAllCubeMaps = imageDataCubemap(imageData, cubeMapLength, finalImageDataFilename, environmentType);
 
-							if (allCubeMaps.size() == 0)
+							if (oldAllCubeMaps.size() != 6)
 							{
-								uint32_t currentMapLength = imageData->getHeight() / 2;
+								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create cube maps for '%s'", finalImageDataFilename.c_str());
 
-								uint32_t cubeMapLength = 1;
-								while (cubeMapLength * 2 <= currentMapLength)
-								{
-									cubeMapLength *= 2;
-								}
+								return VK_FALSE;
+							}
 
-								if (environmentType == VKTS_ENVIRONMENT_MIRROR_DOME)
-								{
-									cubeMapLength *= 2;
-								}
+							SmartPointerVector<IImageDataSP> allCubeMaps;
 
-								auto oldAllCubeMaps = imageDataCubemap(imageData, cubeMapLength, finalImageDataFilename, environmentType);
+					        for (uint32_t layer = 0; layer < 6; layer++)
+					        {
+								auto tempMipMaps = imageDataMipmap(oldAllCubeMaps[layer], VK_FALSE, finalImageDataFilename);
 
-								if (oldAllCubeMaps.size() != 6)
+								if (tempMipMaps.size() == 0)
 								{
-									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create cube maps for '%s'", finalImageDataFilename.c_str());
+									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
 
 									return VK_FALSE;
 								}
 
-						        for (uint32_t layer = 0; layer < 6; layer++)
-						        {
-									auto tempMipMaps = imageDataMipmap(oldAllCubeMaps[layer], VK_FALSE, finalImageDataFilename);
-
-									if (tempMipMaps.size() == 0)
-									{
-										logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
-
-										return VK_FALSE;
-									}
-
-									for (uint32_t mipLevel = 0; mipLevel < tempMipMaps.size(); mipLevel++)
-									{
-										allCubeMaps.append(tempMipMaps[mipLevel]);
-									}
-						        }
-
-								if (cacheGetEnabled())
+								for (uint32_t mipLevel = 0; mipLevel < tempMipMaps.size(); mipLevel++)
 								{
-									logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
-
-									uint32_t mipLevels = allCubeMaps.size() / 6;
-
-									for (uint32_t i = 0; i < allCubeMaps.size(); i++)
-									{
-										auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(i % mipLevels) + "_LAYER" + std::to_string(i / mipLevels) + sourceImageExtension;
-
-										cacheSaveImageData(allCubeMaps[i], targetImageFilename);
-									}
+									allCubeMaps.append(tempMipMaps[mipLevel]);
 								}
-							}
-							else
-							{
-								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
-							}
+					        }
 
 							for (uint32_t i = 0; i < allCubeMaps.size(); i++)
 							{
@@ -427,6 +360,13 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
 								return VK_FALSE;
 							}
+
+							if (useCache)
+							{
+								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
+
+								cacheSaveImageDataByKey(cubeMapKey, imageData, VKTS_CACHE_PACKED_EXTENSION);
+							}
 						}
 
 						if (preFiltered)
@@ -435,29 +375,19 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 							// Pre-filtered diffuse cube map creation.
 							//
 
-							SmartPointerVector<IImageDataSP> allDiffuseCubeMaps;
+							auto diffuseKey = cacheCreateKey(sourceHash, "LAMBERT" + cubeMapParameters + (sceneFactory->useGPU() ? "_GPU" + std::to_string(VKTS_BSDF_SAMPLES_GPU_CUBE_MAP) : "_CPU" + std::to_string(VKTS_BSDF_SAMPLES_CPU_CUBE_MAP)));
 
-							if (cacheGetEnabled())
-							{
-								for (uint32_t layer = 0; layer < 6; layer++)
-								{
-									auto targetImageFilename = sourceImageName + "_LEVEL0_LAYER" + std::to_string(layer) + "_LAMBERT" + sourceImageExtension;
-
-									auto targetImage = cacheLoadImageData(targetImageFilename.c_str());
-
-									if (!targetImage.get())
-									{
-										allDiffuseCubeMaps.clear();
-
-										break;
-									}
+							IImageDataSP diffuseImageData;
 
-									allDiffuseCubeMaps.append(targetImage);
-								}
+							if (useCache)
+							{
+								diffuseImageData = cacheLoadImageDataByKey(diffuseKey, finalImageDataFilename);
 							}
 
-							if (allDiffuseCubeMaps.size() == 0)
+							if (!diffuseImageData.get())
 							{
+								SmartPointerVector<IImageDataSP> allDiffuseCubeMaps;
+
 								if (sceneFactory->useGPU())
 								{
 									allDiffuseCubeMaps = sceneFactory->getSceneRenderFactory()->prefilterLambert(sceneManager, imageData, VKTS_BSDF_SAMPLES_GPU_CUBE_MAP, finalImageDataFilename);
@@ -474,23 +404,25 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 									return VK_FALSE;
 								}
 
-								if (cacheGetEnabled())
+								for (uint32_t i = 0; i < allDiffuseCubeMaps.size(); i++)
+								{
+									allDiffuseCubeMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allDiffuseCubeMaps[i]);
+								}
+
+								diffuseImageData = imageDataMerge(allDiffuseCubeMaps, finalImageDataFilename, 1, allDiffuseCubeMaps.size());
+
+								if (!diffuseImageData.get())
+								{
+									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
+
+									return VK_FALSE;
+								}
+
+								if (useCache)
 								{
 									logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
 
-									for (uint32_t i = 0; i < allDiffuseCubeMaps.size(); i++)
-									{
-										if (allDiffuseCubeMaps[i]->getFormat() == VK_FORMAT_R32G32B32A32_SFLOAT)
-										{
-											auto tempCubeMap = imageDataConvert(allDiffuseCubeMaps[i], VK_FORMAT_R32G32B32_SFLOAT, allDiffuseCubeMaps[i]->getName());
-
-											cacheSaveImageData(tempCubeMap);
-										}
-										else
-										{
-											cacheSaveImageData(allDiffuseCubeMaps[i]);
-										}
-									}
+									cacheSaveImageDataByKey(diffuseKey, diffuseImageData, VKTS_CACHE_PACKED_EXTENSION);
 								}
 							}
 							else
@@ -498,20 +430,6 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
 							}
 
-							for (uint32_t i = 0; i < allDiffuseCubeMaps.size(); i++)
-							{
-								allDiffuseCubeMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allDiffuseCubeMaps[i]);
-							}
-
-							auto diffuseImageData = imageDataMerge(allDiffuseCubeMaps, finalImageDataFilename, 1, allDiffuseCubeMaps.size());
-
-							if (!diffuseImageData.get())
-							{
-								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
-
-								return VK_FALSE;
-							}
-
 							sceneManager->addImageData(diffuseImageData);
 
 							//
@@ -529,47 +447,19 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 							// Pre-filtered cook torrance cube map creation.
 							//
 
-							SmartPointerVector<IImageDataSP> allCookTorranceCubeMaps;
+							auto specularKey = cacheCreateKey(sourceHash, "COOKTORRANCE" + cubeMapParameters + (sceneFactory->useGPU() ? "_GPU" + std::to_string(VKTS_BSDF_SAMPLES_GPU_CUBE_MAP) : "_CPU" + std::to_string(VKTS_BSDF_SAMPLES_CPU_CUBE_MAP)));
 
-							uint32_t levelCount = 1;
+							IImageDataSP cookTorranceImageData;
 
-							if (cacheGetEnabled())
+							if (useCache)
 							{
-								for (uint32_t layer = 0; layer < 6; layer++)
-								{
-									for (uint32_t level = 0; level < levelCount; level++)
-									{
-										auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(level) + "_LAYER" + std::to_string(layer) + "_COOKTORRANCE" + sourceImageExtension;
-
-										auto targetImageData = cacheLoadImageData(targetImageFilename.c_str());
-
-										if (!targetImageData.get())
-										{
-											allCookTorranceCubeMaps.clear();
-
-											break;
-										}
-
-										// Gather level count iterations by first image.
-										if (layer == 0 && level == 0)
-										{
-											uint32_t testWidth = targetImageData->getWidth();
-
-											while (testWidth > 1)
-											{
-												testWidth /= 2;
-
-												levelCount++;
-											}
-										}
-
-										allCookTorranceCubeMaps.append(targetImageData);
-									}
-								}
+								cookTorranceImageData = cacheLoadImageDataByKey(specularKey, finalImageDataFilename);
 							}
 
-							if (allCookTorranceCubeMaps.size() == 0)
+							if (!cookTorranceImageData.get())
 							{
+								SmartPointerVector<IImageDataSP> allCookTorranceCubeMaps;
+
 								if (sceneFactory->useGPU())
 								{
 									allCookTorranceCubeMaps = sceneFactory->getSceneRenderFactory()->prefilterCookTorrance(sceneManager, imageData, VKTS_BSDF_SAMPLES_GPU_CUBE_MAP, finalImageDataFilename);
@@ -586,25 +476,25 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 									return VK_FALSE;
 								}
 
-								levelCount = allCookTorranceCubeMaps.size() / 6;
+								for (uint32_t i = 0; i < allCookTorranceCubeMaps.size(); i++)
+								{
+									allCookTorranceCubeMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allCookTorranceCubeMaps[i]);
+								}
+
+								cookTorranceImageData = imageDataMerge(allCookTorranceCubeMaps, finalImageDataFilename, allCookTorranceCubeMaps.size() / 6, 6);
 
-								if (cacheGetEnabled())
+								if (!cookTorranceImageData.get())
+								{
+									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
+
+									return VK_FALSE;
+								}
+
+								if (useCache)
 								{
 									logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
 
-									for (uint32_t i = 0; i < allCookTorranceCubeMaps.size(); i++)
-									{
-										if (allCookTorranceCubeMaps[i]->getFormat() == VK_FORMAT_R32G32B32A32_SFLOAT)
-										{
-											auto tempCubeMap = imageDataConvert(allCookTorranceCubeMaps[i], VK_FORMAT_R32G32B32_SFLOAT, allCookTorranceCubeMaps[i]->getName());
-
-											cacheSaveImageData(tempCubeMap);
-										}
-										else
-										{
-											cacheSaveImageData(allCookTorranceCubeMaps[i]);
-										}
-									}
+									cacheSaveImageDataByKey(specularKey, cookTorranceImageData, VKTS_CACHE_PACKED_EXTENSION);
 								}
 							}
 							else
@@ -612,20 +502,6 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
 							}
 
-							for (uint32_t i = 0; i < allCookTorranceCubeMaps.size(); i++)
-							{
-								allCookTorranceCubeMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allCookTorranceCubeMaps[i]);
-							}
-
-							auto cookTorranceImageData = imageDataMerge(allCookTorranceCubeMaps, finalImageDataFilename, levelCount, 6);
-
-							if (!cookTorranceImageData.get())
-							{
-								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
-
-								return VK_FALSE;
-							}
-
 							sceneManager->addImageData(cookTorranceImageData);
 
 							//
@@ -691,7 +567,7 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 							sceneManager->addImageObject(imageObject);
 						}
 					}
-					else
+					else if (!cachedImageData.get())
 					{
 						imageData = createDeviceImageData(sceneManager->getAssetManager(), imageData);
 
@@ -1721,6 +1597,376 @@ static VkBool32 sceneLoadMaterials(const char* directory, const char* filename,
     return VK_TRUE;
 }
 
+#define VKTS_SUB_MESH_BINARY_MAGIC 0x4D534B56
+#define VKTS_SUB_MESH_BINARY_VERSION 1
+#define VKTS_SUB_MESH_BINARY_SUFFIX ".bin"
+
+// FNV-1a hash, used to detect changes of the text file.
+static uint64_t sceneHashText(const ITextBufferSP& textBuffer)
+{
+    uint64_t hash = 14695981039346656037ull;
+
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(textBuffer->getString());
+
+    for (uint32_t i = 0; i < textBuffer->getLength(); i++)
+    {
+        hash ^= (uint64_t)data[i];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+static void sceneWriteBinary(std::vector<uint8_t>& binary, const void* data, const uint32_t size)
+{
+    binary.insert(binary.end(), reinterpret_cast<const uint8_t*>(data), reinterpret_cast<const uint8_t*>(data) + size);
+}
+
+static void sceneWriteBinaryUInt32(std::vector<uint8_t>& binary, const uint32_t value)
+{
+    sceneWriteBinary(binary, &value, sizeof(uint32_t));
+}
+
+static void sceneWriteBinaryString(std::vector<uint8_t>& binary, const std::string& value)
+{
+    sceneWriteBinaryUInt32(binary, (uint32_t)value.size());
+
+    sceneWriteBinary(binary, value.c_str(), (uint32_t)value.size());
+}
+
+static VkBool32 sceneReadBinaryUInt32(const IBinaryBufferSP& binaryBuffer, uint32_t& value)
+{
+    return binaryBuffer->read(&value, sizeof(uint32_t), 1) == 1;
+}
+
+static uint32_t sceneGetBinaryRemainingSize(const IBinaryBufferSP& binaryBuffer)
+{
+    if (!binaryBuffer->getByteData() || !binaryBuffer->getCurrentByteData())
+    {
+        return 0;
+    }
+
+    const uint32_t position = (uint32_t)(binaryBuffer->getCurrentByteData() - binaryBuffer->getByteData());
+
+    return position < binaryBuffer->getSize() ? binaryBuffer->getSize() - position : 0;
+}
+
+static VkBool32 sceneReadBinaryString(const IBinaryBufferSP& binaryBuffer, std::string& value)
+{
+    uint32_t length;
+
+    // Truncated or stale files must not let the read pass the end of the buffer.
+    if (!sceneReadBinaryUInt32(binaryBuffer, length) || length > sceneGetBinaryRemainingSize(binaryBuffer))
+    {
+        return VK_FALSE;
+    }
+
+    value.resize(length);
+
+    if (length == 0)
+    {
+        return VK_TRUE;
+    }
+
+    return binaryBuffer->read(&value[0], 1, length) == length;
+}
+
+static IBinaryBufferSP sceneReadBinaryBuffer(const IBinaryBufferSP& binaryBuffer)
+{
+    uint32_t size;
+
+    if (!sceneReadBinaryUInt32(binaryBuffer, size) || size == 0 || size > sceneGetBinaryRemainingSize(binaryBuffer))
+    {
+        return IBinaryBufferSP();
+    }
+
+    auto result = binaryBufferCreate(binaryBuffer->getCurrentByteData(), size);
+
+    if (!result.get() || result->getSize() != size || !binaryBuffer->seek(size, VKTS_SEARCH_RELATVE))
+    {
+        return IBinaryBufferSP();
+    }
+
+    return result;
+}
+
+static VkBool32 sceneSaveBinaryFile(const std::string& filename, const std::vector<uint8_t>& binary)
+{
+    // Write to a temporary file and rename it, so a reader never sees a partially written file.
+    // A still mapped previous file also stays intact.
+
+    std::string temporaryFilename = filename + ".tmp";
+
+    if (!fileSaveBinaryData(temporaryFilename.c_str(), &binary[0], (uint32_t)binary.size()))
+    {
+        return VK_FALSE;
+    }
+
+    std::string fullFilename = filename;
+    std::string fullTemporaryFilename = temporaryFilename;
+
+    if (!fileIsAbsolutePath(filename.c_str()))
+    {
+        fullFilename = std::string(fileGetBaseDirectory()) + filename;
+        fullTemporaryFilename = std::string(fileGetBaseDirectory()) + temporaryFilename;
+    }
+
+    if (rename(fullTemporaryFilename.c_str(), fullFilename.c_str()) == 0)
+    {
+        return VK_TRUE;
+    }
+
+    // Some platforms do not replace an existing file.
+    remove(fullFilename.c_str());
+
+    if (rename(fullTemporaryFilename.c_str(), fullFilename.c_str()) == 0)
+    {
+        return VK_TRUE;
+    }
+
+    remove(fullTemporaryFilename.c_str());
+
+    return VK_FALSE;
+}
+
+static VkBool32 sceneAddSubMesh(const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ISubMeshSP& subMesh, const VkTsVertexBufferType vertexBufferType, const IBinaryBufferSP& vertexBinaryBuffer, const IBinaryBufferSP& indicesBinaryBuffer)
+{
+    auto vertexBuffer = createVertexBufferObject(sceneManager->getAssetManager(), vertexBinaryBuffer);
+
+    if (!vertexBuffer.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex buffer");
+
+        return VK_FALSE;
+    }
+
+    //
+
+    subMesh->setVertexBuffer(vertexBuffer, vertexBufferType, Aabb((const float*)vertexBinaryBuffer->getData(), subMesh->getNumberVertices(), subMesh->getStrideInBytes()), vertexBinaryBuffer);
+
+    //
+
+    auto indexVertexBuffer = createIndexBufferObject(sceneManager->getAssetManager(), indicesBinaryBuffer);
+
+    if (!indexVertexBuffer.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices vertex buffer");
+
+        return VK_FALSE;
+    }
+
+    //
+
+    subMesh->setIndexBuffer(indexVertexBuffer, indicesBinaryBuffer);
+
+    //
+
+    if (subMesh->getBSDFMaterial().get() && sceneFactory->getSceneRenderFactory().get())
+    {
+    	if (!sceneFactory->getSceneRenderFactory()->prepareBSDFMaterial(sceneManager, subMesh))
+    	{
+    		return VK_FALSE;
+    	}
+    }
+
+    //
+
+    sceneManager->addSubMesh(subMesh);
+
+    return VK_TRUE;
+}
+
+static VkBool32 sceneSetSubMeshMaterial(const ISceneManagerSP& sceneManager, const ISubMeshSP& subMesh, const char* materialName)
+{
+    const auto phongMaterial = sceneManager->usePhongMaterial(materialName);
+
+    if (phongMaterial.get())
+    {
+        subMesh->setPhongMaterial(phongMaterial);
+    }
+    else
+    {
+        const auto bsdfMaterial = sceneManager->useBSDFMaterial(materialName);
+
+        if (bsdfMaterial.get())
+        {
+            subMesh->setBSDFMaterial(bsdfMaterial);
+        }
+        else
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Material not found: '%s'", materialName);
+
+            return VK_FALSE;
+        }
+    }
+
+    return VK_TRUE;
+}
+
+static void sceneWriteSubMeshBinary(std::vector<uint8_t>& binary, const ISubMeshSP& subMesh, const std::string& materialName, const IBinaryBufferSP& vertexBinaryBuffer, const IBinaryBufferSP& indicesBinaryBuffer)
+{
+    sceneWriteBinaryString(binary, subMesh->getName());
+    sceneWriteBinaryString(binary, materialName);
+
+    sceneWriteBinaryUInt32(binary, subMesh->getDoubleSided());
+    sceneWriteBinaryUInt32(binary, subMesh->getVertexBufferType());
+    sceneWriteBinaryUInt32(binary, (uint32_t)subMesh->getNumberVertices());
+    sceneWriteBinaryUInt32(binary, (uint32_t)subMesh->getNumberIndices());
+    sceneWriteBinaryUInt32(binary, subMesh->getStrideInBytes());
+
+    int32_t offsets[10] = {subMesh->getVertexOffset(), subMesh->getNormalOffset(), subMesh->getBitangentOffset(), subMesh->getTangentOffset(), subMesh->getTexcoord0Offset(), subMesh->getBoneIndices0Offset(), subMesh->getBoneIndices1Offset(), subMesh->getBoneWeights0Offset(), subMesh->getBoneWeights1Offset(), subMesh->getNumberBonesOffset()};
+
+    sceneWriteBinary(binary, offsets, sizeof(offsets));
+
+    sceneWriteBinaryUInt32(binary, vertexBinaryBuffer->getSize());
+    sceneWriteBinary(binary, vertexBinaryBuffer->getData(), vertexBinaryBuffer->getSize());
+
+    sceneWriteBinaryUInt32(binary, indicesBinaryBuffer->getSize());
+    sceneWriteBinary(binary, indicesBinaryBuffer->getData(), indicesBinaryBuffer->getSize());
+}
+
+// Returns the binary file positioned after the header, if it was created from the given text file.
+static IBinaryBufferSP sceneLoadSubMeshesBinaryFile(const char* filename, const ITextBufferSP& textBuffer)
+{
+    auto binaryBuffer = fileMapBinary(filename);
+
+    if (!binaryBuffer.get())
+    {
+        return IBinaryBufferSP();
+    }
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t textLength;
+    uint64_t textHash;
+
+    if (!sceneReadBinaryUInt32(binaryBuffer, magic) || !sceneReadBinaryUInt32(binaryBuffer, version) || !sceneReadBinaryUInt32(binaryBuffer, textLength) || binaryBuffer->read(&textHash, sizeof(uint64_t), 1) != 1)
+    {
+        return IBinaryBufferSP();
+    }
+
+    if (magic != VKTS_SUB_MESH_BINARY_MAGIC || version != VKTS_SUB_MESH_BINARY_VERSION || textLength != textBuffer->getLength() || textHash != sceneHashText(textBuffer))
+    {
+        logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Sub mesh binary file outdated: '%s'", filename);
+
+        return IBinaryBufferSP();
+    }
+
+    return binaryBuffer;
+}
+
+static VkBool32 sceneLoadSubMeshesBinary(const char* directory, const IBinaryBufferSP& binaryBuffer, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
+{
+    uint32_t count;
+
+    std::string sdata;
+
+    if (!sceneReadBinaryUInt32(binaryBuffer, count))
+    {
+        return VK_FALSE;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!sceneReadBinaryString(binaryBuffer, sdata))
+        {
+            return VK_FALSE;
+        }
+
+        if (!sceneLoadMaterials(directory, sdata.c_str(), sceneManager, sceneFactory))
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load materials: '%s'", sdata.c_str());
+
+            return VK_FALSE;
+        }
+    }
+
+    if (!sceneReadBinaryUInt32(binaryBuffer, count))
+    {
+        return VK_FALSE;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        std::string materialName;
+
+        uint32_t doubleSided;
+        uint32_t vertexBufferType;
+        uint32_t numberVertices;
+        uint32_t numberIndices;
+        uint32_t strideInBytes;
+
+        int32_t offsets[10];
+
+        if (!sceneReadBinaryString(binaryBuffer, sdata) || !sceneReadBinaryString(binaryBuffer, materialName))
+        {
+            return VK_FALSE;
+        }
+
+        if (!sceneReadBinaryUInt32(binaryBuffer, doubleSided) || !sceneReadBinaryUInt32(binaryBuffer, vertexBufferType) || !sceneReadBinaryUInt32(binaryBuffer, numberVertices) || !sceneReadBinaryUInt32(binaryBuffer, numberIndices) || !sceneReadBinaryUInt32(binaryBuffer, strideInBytes))
+        {
+            return VK_FALSE;
+        }
+
+        if (binaryBuffer->read(offsets, sizeof(offsets), 1) != 1)
+        {
+            return VK_FALSE;
+        }
+
+        auto vertexBinaryBuffer = sceneReadBinaryBuffer(binaryBuffer);
+        auto indicesBinaryBuffer = sceneReadBinaryBuffer(binaryBuffer);
+
+        if (!vertexBinaryBuffer.get() || !indicesBinaryBuffer.get() || vertexBinaryBuffer->getSize() != numberVertices * strideInBytes || indicesBinaryBuffer->getSize() != numberIndices * sizeof(int32_t))
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
+
+            return VK_FALSE;
+        }
+
+        //
+
+        auto subMesh = sceneFactory->createSubMesh(sceneManager);
+
+        if (!subMesh.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not created: '%s'", sdata.c_str());
+
+            return VK_FALSE;
+        }
+
+        subMesh->setName(sdata);
+        subMesh->setDoubleSided(doubleSided);
+
+        if (!sceneSetSubMeshMaterial(sceneManager, subMesh, materialName.c_str()))
+        {
+            return VK_FALSE;
+        }
+
+        subMesh->setNumberVertices((int32_t)numberVertices);
+        subMesh->setNumberIndices((int32_t)numberIndices);
+
+        subMesh->setVertexOffset(offsets[0]);
+        subMesh->setNormalOffset(offsets[1]);
+        subMesh->setBitangentOffset(offsets[2]);
+        subMesh->setTangentOffset(offsets[3]);
+        subMesh->setTexcoord0Offset(offsets[4]);
+        subMesh->setBoneIndices0Offset(offsets[5]);
+        subMesh->setBoneIndices1Offset(offsets[6]);
+        subMesh->setBoneWeights0Offset(offsets[7]);
+        subMesh->setBoneWeights1Offset(offsets[8]);
+        subMesh->setNumberBonesOffset(offsets[9]);
+
+        subMesh->setStrideInBytes(strideInBytes);
+
+        if (!sceneAddSubMesh(sceneManager, sceneFactory, subMesh, (VkTsVertexBufferType)vertexBufferType, vertexBinaryBuffer, indicesBinaryBuffer))
+        {
+            return VK_FALSE;
+        }
+    }
+
+    return VK_TRUE;
+}
+
 static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
 {
     if (!directory || !filename || !sceneManager.get())
@@ -1734,6 +1980,8 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
 
     if (!textBuffer.get())
     {
+    	finalFilename = std::string(filename);
+
         textBuffer = fileLoadText(filename);
 
         if (!textBuffer.get())
@@ -1742,6 +1990,17 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
         }
     }
 
+    // Prefer the binary file, as long as it was created from the same text file.
+
+    std::string binaryFilename = finalFilename + VKTS_SUB_MESH_BINARY_SUFFIX;
+
+    auto binaryBuffer = sceneLoadSubMeshesBinaryFile(binaryFilename.c_str(), textBuffer);
+
+    if (binaryBuffer.get())
+    {
+    	return sceneLoadSubMeshesBinary(directory, binaryBuffer, sceneManager, sceneFactory);
+    }
+
     char buffer[VKTS_MAX_BUFFER_CHARS + 1];
     char sdata[VKTS_MAX_TOKEN_CHARS + 1];
     float fdata[8];
@@ -1750,6 +2009,11 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
 
     auto subMesh = ISubMeshSP();
 
+    std::vector<std::string> allMaterialLibraries;
+
+    std::vector<uint8_t> allSubMeshesBinary;
+    uint32_t subMeshesBinaryCount = 0;
+
     std::vector<float> vertex;
     std::vector<float> normal;
     std::vector<float> bitangent;
@@ -1784,6 +2048,8 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
 
                 return VK_FALSE;
             }
+
+            allMaterialLibraries.push_back(sdata);
         }
         else if (parseIsToken(buffer, "name"))
         {
@@ -2030,26 +2296,9 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
 
             if (subMesh.get())
             {
-                const auto phongMaterial = sceneManager->usePhongMaterial(sdata);
-
-                if (phongMaterial.get())
-                {
-                    subMesh->setPhongMaterial(phongMaterial);
-                }
-                else
+                if (!sceneSetSubMeshMaterial(sceneManager, subMesh, sdata))
                 {
-                    const auto bsdfMaterial = sceneManager->useBSDFMaterial(sdata);
-
-                    if (bsdfMaterial.get())
-                    {
-                        subMesh->setBSDFMaterial(bsdfMaterial);
-                    }
-                    else
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Material not found: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                        return VK_FALSE;
-                    }
+                    return VK_FALSE;
                 }
             }
             else
@@ -2274,28 +2523,13 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
 
                     //
 
-                    auto vertexBuffer = createVertexBufferObject(sceneManager->getAssetManager(), vertexBinaryBuffer);
-
-                    if (!vertexBuffer.get())
+                    if (indices.size() == 0)
                     {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex buffer");
+                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
 
                         return VK_FALSE;
                     }
 
-                    //
-
-                    subMesh->setVertexBuffer(vertexBuffer, vertexBufferType, Aabb((const float*)vertexBinaryBuffer->getData(), subMesh->getNumberVertices(), subMesh->getStrideInBytes()), vertexBinaryBuffer);
-                }
-                else
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
-
-                    return VK_FALSE;
-                }
-
-                if (indices.size() > 0)
-                {
                 	uint32_t size = sizeof(int32_t) * subMesh->getNumberIndices();
 
                     auto indicesBinaryBuffer = binaryBufferCreate(reinterpret_cast<const uint8_t*>(&indices[0]), size);
@@ -2309,18 +2543,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
 
                     //
 
-                    auto indexVertexBuffer = createIndexBufferObject(sceneManager->getAssetManager(), indicesBinaryBuffer);
-
-                    if (!indexVertexBuffer.get())
+                    if (!sceneAddSubMesh(sceneManager, sceneFactory, subMesh, vertexBufferType, vertexBinaryBuffer, indicesBinaryBuffer))
                     {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices vertex buffer");
-
                         return VK_FALSE;
                     }
 
-                    //
+                    sceneWriteSubMeshBinary(allSubMeshesBinary, subMesh, sdata, vertexBinaryBuffer, indicesBinaryBuffer);
 
-                    subMesh->setIndexBuffer(indexVertexBuffer, indicesBinaryBuffer);
+                    subMeshesBinaryCount++;
                 }
                 else
                 {
@@ -2328,20 +2558,6 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
 
                     return VK_FALSE;
                 }
-
-                //
-
-                if (subMesh->getBSDFMaterial().get() && sceneFactory->getSceneRenderFactory().get())
-                {
-                	if (!sceneFactory->getSceneRenderFactory()->prepareBSDFMaterial(sceneManager, subMesh))
-                	{
-                		return VK_FALSE;
-                	}
-                }
-
-                //
-
-                sceneManager->addSubMesh(subMesh);
             }
             else
             {
@@ -2370,6 +2586,36 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
         }
     }
 
+    //
+
+    // Store the binary file, so the text file has not to be parsed next time.
+
+    std::vector<uint8_t> binary;
+
+    sceneWriteBinaryUInt32(binary, VKTS_SUB_MESH_BINARY_MAGIC);
+    sceneWriteBinaryUInt32(binary, VKTS_SUB_MESH_BINARY_VERSION);
+    sceneWriteBinaryUInt32(binary, textBuffer->getLength());
+
+    uint64_t textHash = sceneHashText(textBuffer);
+
+    sceneWriteBinary(binary, &textHash, sizeof(uint64_t));
+
+    sceneWriteBinaryUInt32(binary, (uint32_t)allMaterialLibraries.size());
+
+    for (uint32_t i = 0; i < (uint32_t)allMaterialLibraries.size(); i++)
+    {
+    	sceneWriteBinaryString(binary, allMaterialLibraries[i]);
+    }
+
+    sceneWriteBinaryUInt32(binary, subMeshesBinaryCount);
+
+    binary.insert(binary.end(), allSubMeshesBinary.begin(), allSubMeshesBinary.end());
+
+    if (!sceneSaveBinaryFile(binaryFilename, binary))
+    {
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not save sub mesh binary file: '%s'", binaryFilename.c_str());
+    }
+
     return VK_TRUE;
 }
 
@@ -0,0 +1,64 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+VkBool32 VKTS_APIENTRY drawPacketAddPushConstants(VkTsDrawPacket& drawPacket, const VkShaderStageFlags stageFlags, const uint32_t offset, const uint32_t size, const void* data)
+{
+	if (size == 0 || !data)
+	{
+		return VK_FALSE;
+	}
+
+	if (drawPacket.pushConstantRangeCount >= VKTS_MAX_DRAW_PUSH_CONSTANT_RANGES)
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Too many push constant ranges");
+
+		return VK_FALSE;
+	}
+
+	if ((uint64_t)offset + (uint64_t)size > VKTS_MAX_DRAW_PUSH_CONSTANT_SIZE)
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Push constant range out of bounds");
+
+		return VK_FALSE;
+	}
+
+	drawPacket.pushConstantRanges[drawPacket.pushConstantRangeCount].stageFlags = stageFlags;
+	drawPacket.pushConstantRanges[drawPacket.pushConstantRangeCount].offset = offset;
+	drawPacket.pushConstantRanges[drawPacket.pushConstantRangeCount].size = size;
+
+	drawPacket.pushConstantRangeCount++;
+
+	memcpy(&drawPacket.pushConstants[offset], data, size);
+
+	return VK_TRUE;
+}
+
+}
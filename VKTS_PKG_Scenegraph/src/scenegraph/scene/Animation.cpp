@@ -30,16 +30,33 @@ namespace vkts
 {
 
 Animation::Animation() :
-    IAnimation(), name(""), start(0.0f), stop(0.0f), animationType(AnimationLoop), animationScale(1.0f), currentTime(0.0f), allChannels()
+    IAnimation(), name(""), start(0.0f), stop(0.0f), animationType(AnimationLoop), animationScale(1.0f), currentTime(0.0f), allChannels(), sampler()
 {
+    if (interpolateGetCompression())
+    {
+        sampler.setCompression(VKTS_COMPRESS_SAMPLING, VKTS_COMPRESS_ERROR);
+    }
 }
 
 Animation::Animation(const Animation& other) :
-    IAnimation(), name(other.name + "_clone"), start(other.start), stop(other.stop), animationType(other.animationType), animationScale(other.animationScale), currentTime(other.currentTime), allChannels()
+    IAnimation(), name(other.name + "_clone"), start(other.start), stop(other.stop), animationType(other.animationType), animationScale(other.animationScale), currentTime(other.currentTime), allChannels(), sampler()
 {
+    sampler.setCompression(other.sampler.getSampleTime(), other.sampler.getMaxError());
+
+    // Compressed channels could have released their entries, so these are read back through the sampler.
+
+    const VkBool32 samplerUpToDate = other.sampler.isUpToDate(other.allChannels);
+
     for (uint32_t i = 0; i < other.allChannels.size(); i++)
     {
-        allChannels.append(other.allChannels[i]->clone());
+        auto channel = other.allChannels[i]->clone();
+
+        if (channel.get() && channel->getNumberEntries() == 0 && samplerUpToDate)
+        {
+            other.sampler.restoreEntries(i, channel);
+        }
+
+        allChannels.append(channel);
     }
 }
 
@@ -179,10 +196,14 @@ float Animation::update(const float deltaTime)
 void Animation::addChannel(const IChannelSP& channel)
 {
     allChannels.append(channel);
+
+    sampler.reset();
 }
 
 VkBool32 Animation::removeChannel(const IChannelSP& channel)
 {
+    sampler.reset();
+
     return allChannels.remove(channel);
 }
 
@@ -196,6 +217,16 @@ const SmartPointerVector<IChannelSP>& Animation::getChannels() const
     return allChannels;
 }
 
+AnimationSampler& Animation::getSampler()
+{
+	if (!sampler.isUpToDate(allChannels))
+	{
+		sampler.build(allChannels, VK_TRUE);
+	}
+
+	return sampler;
+}
+
 //
 // ICloneable
 //
@@ -220,6 +251,8 @@ void Animation::destroy()
 {
 	try
 	{
+	    sampler.reset();
+
 	    for (uint32_t i = 0; i < allChannels.size(); i++)
 	    {
 	        allChannels[i]->destroy();
@@ -51,6 +51,8 @@ private:
 
     SmartPointerVector<IChannelSP> allChannels;
 
+    AnimationSampler sampler;
+
 public:
 
     Animation();
@@ -99,6 +101,8 @@ public:
 
     virtual const SmartPointerVector<IChannelSP>& getChannels() const override;
 
+    virtual AnimationSampler& getSampler() override;
+
     //
     // ICloneable
     //
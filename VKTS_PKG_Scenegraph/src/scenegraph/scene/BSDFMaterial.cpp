@@ -272,6 +272,34 @@ void BSDFMaterial::drawRecursive(const ICommandBuffersSP& cmdBuffer, const IGrap
 	}
 }
 
+VkBool32 BSDFMaterial::collectRecursive(VkTsDrawPacket& drawPacket, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName)
+{
+    const OverwriteDraw* currentOverwrite = renderOverwrite;
+    while (currentOverwrite)
+    {
+    	if (!currentOverwrite->visit(*this, drawPacket, graphicsPipeline, currentBuffer, dynamicOffsetMappings))
+    	{
+    		return VK_FALSE;
+    	}
+
+    	currentOverwrite = currentOverwrite->getNextOverwrite();
+    }
+
+    //
+
+	if (currentBuffer >= materialData.size())
+	{
+		return VK_FALSE;
+	}
+
+	if (!materialData[currentBuffer].get())
+	{
+		return VK_FALSE;
+	}
+
+	return materialData[currentBuffer]->collect(drawPacket, currentBuffer, dynamicOffsetMappings, nodeName);
+}
+
 //
 // ICloneable
 //
@@ -29,14 +29,24 @@
 namespace vkts
 {
 
+// Shared by all channels, so a replaced channel never has the counter of the previous one.
+static std::atomic<uint64_t> g_channelModificationCounter(0);
+
+void Channel::modified()
+{
+    modificationCounter = ++g_channelModificationCounter;
+}
+
 Channel::Channel() :
-    IChannel(), name(""), targetTransform(VKTS_TARGET_TRANSFORM_TRANSLATE), targetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_X), allKeys(), allValues(), allHandles(), allInterpolators()
+    IChannel(), name(""), targetTransform(VKTS_TARGET_TRANSFORM_TRANSLATE), targetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_X), allKeys(), allValues(), allHandles(), allInterpolators(), modificationCounter(0)
 {
+    modified();
 }
 
 Channel::Channel(const Channel& other) :
-    IChannel(), name(other.name + "_clone"), targetTransform(other.targetTransform), targetTransformElement(other.targetTransformElement), allKeys(other.allKeys), allValues(other.allValues), allHandles(other.allHandles), allInterpolators(other.allInterpolators)
+    IChannel(), name(other.name + "_clone"), targetTransform(other.targetTransform), targetTransformElement(other.targetTransformElement), allKeys(other.allKeys), allValues(other.allValues), allHandles(other.allHandles), allInterpolators(other.allInterpolators), modificationCounter(0)
 {
+    modified();
 }
 
 Channel::~Channel()
@@ -66,6 +76,8 @@ VkTsTargetTransform Channel::getTargetTransform() const
 void Channel::setTargetTransform(VkTsTargetTransform targetTransform)
 {
     this->targetTransform = targetTransform;
+
+    modified();
 }
 
 VkTsTargetTransformElement Channel::getTargetTransformElement() const
@@ -76,6 +88,8 @@ VkTsTargetTransformElement Channel::getTargetTransformElement() const
 void Channel::setTargetTransformElement(VkTsTargetTransformElement targetTransformElement)
 {
     this->targetTransformElement = targetTransformElement;
+
+    modified();
 }
 
 VkBool32 Channel::addEntry(const float key, const float value, const glm::vec4& handles, const VkTsInterpolator interpolator)
@@ -116,6 +130,8 @@ VkBool32 Channel::addEntry(const float key, const float value, const glm::vec4&
         allInterpolators.insert(allInterpolators.begin() + index, interpolator);
     }
 
+    modified();
+
     return VK_TRUE;
 }
 
@@ -132,6 +148,8 @@ VkBool32 Channel::removeEntry(const float key)
             allHandles.erase(allHandles.begin() + index);
             allInterpolators.erase(allInterpolators.begin() + index);
 
+            modified();
+
             return VK_TRUE;
         }
         else if (key > allKeys[index])
@@ -170,6 +188,11 @@ const std::vector<VkTsInterpolator>& Channel::getInterpolators() const
     return allInterpolators;
 }
 
+uint64_t Channel::getModificationCounter() const
+{
+    return modificationCounter;
+}
+
 //
 // ICloneable
 //
@@ -192,6 +215,8 @@ void Channel::destroy()
     allHandles.clear();
 
     allInterpolators.clear();
+
+    modified();
 }
 
 } /* namespace vkts */
@@ -51,6 +51,10 @@ private:
 
     std::vector<VkTsInterpolator> allInterpolators;
 
+    uint64_t modificationCounter;
+
+    void modified();
+
 public:
 
     Channel();
@@ -92,6 +96,8 @@ public:
 
     virtual const std::vector<VkTsInterpolator>& getInterpolators() const override;
 
+    virtual uint64_t getModificationCounter() const override;
+
     //
     // ICloneable
     //
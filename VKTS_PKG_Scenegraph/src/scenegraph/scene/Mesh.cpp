@@ -164,6 +164,29 @@ void Mesh::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerV
     }
 }
 
+void Mesh::collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName)
+{
+	VkTsDrawPacket meshDrawPacket = drawPacket;
+
+    const OverwriteDraw* currentOverwrite = renderOverwrite;
+    while (currentOverwrite)
+    {
+    	if (!currentOverwrite->visit(*this, meshDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings))
+    	{
+    		return;
+    	}
+
+    	currentOverwrite = currentOverwrite->getNextOverwrite();
+    }
+
+    //
+
+    for (uint32_t i = 0; i < allSubMeshes.size(); i++)
+    {
+        allSubMeshes[i]->collectRecursive(renderQueue, meshDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite, nodeName);
+    }
+}
+
 //
 // ICloneable
 //
@@ -66,9 +66,17 @@ void Node::reset()
 
     currentAnimation = -1;
 
+    releaseTransformUniformBuffer();
+
     transformUniformBuffer = IBufferObjectSP();
+    transformUniformBufferOffset = 0;
+    transformUniformBufferRange = 0;
+
+    releaseJointsUniformBuffer();
 
     jointsUniformBuffer = IBufferObjectSP();
+    jointsUniformBufferOffset = 0;
+    jointsUniformBufferRange = 0;
 
     box = Aabb(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
 
@@ -86,15 +94,35 @@ void Node::reset()
     nodeData.clear();
 }
 
+void Node::releaseTransformUniformBuffer()
+{
+    if (transformUniformBufferPool.get())
+    {
+        transformUniformBufferPool->free(transformUniformBuffer, transformUniformBufferOffset);
+
+        transformUniformBufferPool = IUniformBufferPoolSP();
+    }
+}
+
+void Node::releaseJointsUniformBuffer()
+{
+    if (jointsUniformBufferPool.get())
+    {
+        jointsUniformBufferPool->free(jointsUniformBuffer, jointsUniformBufferOffset);
+
+        jointsUniformBufferPool = IUniformBufferPoolSP();
+    }
+}
+
 Node::Node() :
-    INode(), name(""), parentNode(), translate(0.0f, 0.0f, 0.0f), rotate(), scale(1.0f, 1.0f, 1.0f), finalTranslate(0.0f, 0.0f, 0.0f), finalRotate(), finalScale(1.0f, 1.0f, 1.0f), transformMatrix(1.0f), transformMatrixDirty(), jointIndex(-1), joints(0), inverseBindMatrix(1.0f), allChildNodes(), allMeshes(), allCameras(), allLights(), allAnimations(), currentAnimation(-1), transformUniformBuffer(), jointsUniformBuffer(), box(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)), layers(0x01), nodeData()
+    INode(), name(""), parentNode(), translate(0.0f, 0.0f, 0.0f), rotate(), scale(1.0f, 1.0f, 1.0f), finalTranslate(0.0f, 0.0f, 0.0f), finalRotate(), finalScale(1.0f, 1.0f, 1.0f), transformMatrix(1.0f), transformMatrixDirty(), jointIndex(-1), joints(0), inverseBindMatrix(1.0f), allChildNodes(), allMeshes(), allCameras(), allLights(), allAnimations(), currentAnimation(-1), transformUniformBuffer(), transformUniformBufferOffset(0), transformUniformBufferRange(0), transformUniformBufferPool(), jointsUniformBuffer(), jointsUniformBufferOffset(0), jointsUniformBufferRange(0), jointsUniformBufferPool(), box(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)), layers(0x01), nodeData()
 
 {
     reset();
 }
 
 Node::Node(const Node& other) :
-    INode(), name(other.name + "_clone"), parentNode(other.parentNode), translate(other.translate), rotate(other.rotate), scale(other.scale), finalTranslate(other.finalTranslate), finalRotate(other.finalRotate), finalScale(other.finalScale), transformMatrix(other.transformMatrix), transformMatrixDirty(other.transformMatrixDirty), jointIndex(-1), joints(0), inverseBindMatrix(other.inverseBindMatrix), box(other.box), layers(other.layers), nodeData()
+    INode(), name(other.name + "_clone"), parentNode(other.parentNode), translate(other.translate), rotate(other.rotate), scale(other.scale), finalTranslate(other.finalTranslate), finalRotate(other.finalRotate), finalScale(other.finalScale), transformMatrix(other.transformMatrix), transformMatrixDirty(other.transformMatrixDirty), jointIndex(-1), joints(0), inverseBindMatrix(other.inverseBindMatrix), allChildNodes(), allMeshes(), allCameras(), allLights(), allAnimations(), currentAnimation(-1), transformUniformBuffer(), transformUniformBufferOffset(0), transformUniformBufferRange(0), transformUniformBufferPool(), jointsUniformBuffer(), jointsUniformBufferOffset(0), jointsUniformBufferRange(0), jointsUniformBufferPool(), box(other.box), layers(other.layers), nodeData()
 {
     for (uint32_t i = 0; i < other.nodeData.size(); i++)
     {
@@ -232,9 +260,23 @@ Node::Node(const Node& other) :
 
     //
 
-    if (other.transformUniformBuffer.get())
+    if (other.transformUniformBufferPool.get())
+    {
+    	// Shared buffers have to be used from the same pool, so the dynamic offset stride stays valid.
+    	if (!allocateTransformUniformBuffer(other.transformUniformBufferPool))
+    	{
+			reset();
+
+			return;
+    	}
+    }
+    else if (other.transformUniformBuffer.get())
     {
-		IBufferObjectSP transformUniformBuffer = bufferObjectCreate(other.transformUniformBuffer->getContextObject(), other.transformUniformBuffer->getBuffer()->getBufferCreateInfo(), other.transformUniformBuffer->getDeviceMemory()->getMemoryPropertyFlags());
+		VkBufferCreateInfo bufferCreateInfo = other.transformUniformBuffer->getBuffer()->getBufferCreateInfo();
+
+		bufferCreateInfo.size = bufferCreateInfo.size / other.transformUniformBuffer->getBufferCount();
+
+		IBufferObjectSP transformUniformBuffer = bufferObjectCreate(other.transformUniformBuffer->getContextObject(), bufferCreateInfo, other.transformUniformBuffer->getDeviceMemory()->getMemoryPropertyFlags(), other.transformUniformBuffer->getBufferCount());
 
 		if (!transformUniformBuffer.get())
 		{
@@ -243,7 +285,7 @@ Node::Node(const Node& other) :
 			return;
 		}
 
-		setTransformUniformBuffer(transformUniformBuffer);
+		setTransformUniformBuffer(transformUniformBuffer, other.transformUniformBufferOffset, other.transformUniformBufferRange);
     }
 
     //
@@ -252,9 +294,22 @@ Node::Node(const Node& other) :
 
     //
 
-    if (other.jointsUniformBuffer.get())
+    if (other.jointsUniformBufferPool.get())
+    {
+        if (!allocateJointsUniformBuffer(other.joints, other.jointsUniformBufferPool))
+        {
+            reset();
+
+            return;
+        }
+    }
+    else if (other.jointsUniformBuffer.get())
     {
-        IBufferObjectSP jointsUniformBuffer = bufferObjectCreate(other.jointsUniformBuffer->getContextObject(), other.jointsUniformBuffer->getBuffer()->getBufferCreateInfo(), other.jointsUniformBuffer->getDeviceMemory()->getMemoryPropertyFlags());
+        VkBufferCreateInfo bufferCreateInfo = other.jointsUniformBuffer->getBuffer()->getBufferCreateInfo();
+
+        bufferCreateInfo.size = bufferCreateInfo.size / other.jointsUniformBuffer->getBufferCount();
+
+        IBufferObjectSP jointsUniformBuffer = bufferObjectCreate(other.jointsUniformBuffer->getContextObject(), bufferCreateInfo, other.jointsUniformBuffer->getDeviceMemory()->getMemoryPropertyFlags(), other.jointsUniformBuffer->getBufferCount());
 
         if (!jointsUniformBuffer.get())
         {
@@ -263,7 +318,7 @@ Node::Node(const Node& other) :
             return;
         }
 
-        setJointsUniformBuffer(other.joints, jointsUniformBuffer);
+        setJointsUniformBuffer(other.joints, jointsUniformBuffer, other.jointsUniformBufferOffset, other.jointsUniformBufferRange);
     }
 }
 
@@ -618,9 +673,23 @@ IBufferObjectSP Node::getTransformUniformBuffer() const
     return transformUniformBuffer;
 }
 
-void Node::setTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer)
+VkDeviceSize Node::getTransformUniformBufferOffset() const
+{
+    return transformUniformBufferOffset;
+}
+
+VkDeviceSize Node::getTransformUniformBufferRange() const
+{
+    return transformUniformBufferRange;
+}
+
+void Node::setTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range)
 {
+    releaseTransformUniformBuffer();
+
     this->transformUniformBuffer = transformUniformBuffer;
+    this->transformUniformBufferOffset = offset;
+    this->transformUniformBufferRange = range;
 
     this->transformMatrixDirty.resize(0);
 
@@ -628,20 +697,56 @@ void Node::setTransformUniformBuffer(const IBufferObjectSP& transformUniformBuff
     {
         if (nodeData[i].get())
         {
-            nodeData[i]->updateTransformUniformBuffer(transformUniformBuffer);
+            nodeData[i]->updateTransformUniformBuffer(transformUniformBuffer, offset, range);
         }
     }
 }
 
+VkBool32 Node::allocateTransformUniformBuffer(const IUniformBufferPoolSP& transformUniformBufferPool)
+{
+    if (!transformUniformBufferPool.get())
+    {
+        return VK_FALSE;
+    }
+
+    IBufferObjectSP transformUniformBuffer;
+    VkDeviceSize offset;
+
+    if (!transformUniformBufferPool->allocate(transformUniformBuffer, offset))
+    {
+        return VK_FALSE;
+    }
+
+    setTransformUniformBuffer(transformUniformBuffer, offset, transformUniformBufferPool->getSlotSize());
+
+    this->transformUniformBufferPool = transformUniformBufferPool;
+
+    return VK_TRUE;
+}
+
 IBufferObjectSP Node::getJointsUniformBuffer() const
 {
 	return jointsUniformBuffer;
 }
 
-void Node::setJointsUniformBuffer(const int32_t joints, const IBufferObjectSP& jointsUniformBuffer)
+VkDeviceSize Node::getJointsUniformBufferOffset() const
+{
+	return jointsUniformBufferOffset;
+}
+
+VkDeviceSize Node::getJointsUniformBufferRange() const
+{
+	return jointsUniformBufferRange;
+}
+
+void Node::setJointsUniformBuffer(const int32_t joints, const IBufferObjectSP& jointsUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range)
 {
+	releaseJointsUniformBuffer();
+
 	this->joints = joints;
 	this->jointsUniformBuffer = jointsUniformBuffer;
+	this->jointsUniformBufferOffset = offset;
+	this->jointsUniformBufferRange = range;
 
     this->transformMatrixDirty.resize(0);
 
@@ -649,11 +754,33 @@ void Node::setJointsUniformBuffer(const int32_t joints, const IBufferObjectSP& j
     {
         if (nodeData[i].get())
         {
-            nodeData[i]->updateJointsUniformBuffer(jointsUniformBuffer);
+            nodeData[i]->updateJointsUniformBuffer(jointsUniformBuffer, offset, range);
         }
     }
 }
 
+VkBool32 Node::allocateJointsUniformBuffer(const int32_t joints, const IUniformBufferPoolSP& jointsUniformBufferPool)
+{
+	if (!jointsUniformBufferPool.get())
+	{
+		return VK_FALSE;
+	}
+
+	IBufferObjectSP jointsUniformBuffer;
+	VkDeviceSize offset;
+
+	if (!jointsUniformBufferPool->allocate(jointsUniformBuffer, offset))
+	{
+		return VK_FALSE;
+	}
+
+	setJointsUniformBuffer(joints, jointsUniformBuffer, offset, jointsUniformBufferPool->getSlotSize());
+
+	this->jointsUniformBufferPool = jointsUniformBufferPool;
+
+	return VK_TRUE;
+}
+
 const Aabb& Node::getAABB() const
 {
 	return box;
@@ -716,6 +843,16 @@ const glm::mat4& Node::getTransformMatrix() const
 	return transformMatrix;
 }
 
+void Node::setTransformMatrix(const uint32_t currentBuffer, const glm::mat4& transformMatrix)
+{
+	this->transformMatrix = transformMatrix;
+
+    if (currentBuffer < (uint32_t)transformMatrixDirty.size())
+    {
+    	transformMatrixDirty[currentBuffer] = VK_FALSE;
+    }
+}
+
 INodeSP Node::findNodeRecursive(const std::string& searchName)
 {
 	if (name == searchName)
@@ -825,6 +962,46 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
 	//
     //
 
+    auto currentTransformMatrixDirty = updateLocalTransform(deltaTime, currentBuffer, parentTransformMatrixDirty);
+
+    // Gathering armature.
+    auto newArmatureNode = isArmature() ? INode::shared_from_this() : armatureNode;
+
+    //
+	//
+
+    if (currentTransformMatrixDirty)
+    {
+    	// Same kernels as the transform hierarchy, so both updates calculate the same matrices.
+
+    	glm::mat4 localTransformMatrix;
+
+    	composeMat4Batch(&finalTranslate.x, &finalTranslate.y, &finalTranslate.z, &finalRotate.x, &finalRotate.y, &finalRotate.z, &finalRotate.w, &finalScale.x, &finalScale.y, &finalScale.z, 1, &localTransformMatrix);
+
+    	glm::mat4 currentTransformMatrix = parentTransformMatrix * localTransformMatrix;
+
+    	glm::mat3 currentTransformNormalMatrix;
+
+    	normalMat3Batch(&currentTransformMatrix, 1, &currentTransformNormalMatrix);
+
+    	if (!updateTransform(currentBuffer, currentTransformMatrix, newArmatureNode, &currentTransformNormalMatrix))
+    	{
+    		return;
+    	}
+    }
+
+    //
+
+    // Process children.
+
+    for (uint32_t i = 0; i < allChildNodes.size(); i++)
+    {
+        allChildNodes[i]->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, this->transformMatrix, currentTransformMatrixDirty, newArmatureNode, updateOverwrite);
+    }
+}
+
+VkBool32 Node::updateLocalTransform(const double deltaTime, const uint32_t currentBuffer, const VkBool32 parentTransformMatrixDirty)
+{
 	if (currentBuffer >= (uint32_t)transformMatrixDirty.size())
 	{
 		transformMatrixDirty.resize(currentBuffer + 1);
@@ -837,12 +1014,6 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
     //
     //
 
-    // Gathering armature.
-    auto newArmatureNode = isArmature() ? INode::shared_from_this() : armatureNode;
-
-    //
-    //
-
     finalTranslate = translate;
     finalRotate = rotate;
     finalScale = scale;
@@ -854,7 +1025,7 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
     {
     	float currentTime = allAnimations[currentAnimation]->update((float)deltaTime);
 
-        const auto& currentChannels = allAnimations[currentAnimation]->getChannels();
+        auto& sampler = allAnimations[currentAnimation]->getSampler();
 
         //
 
@@ -868,78 +1039,38 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
 
         //
 
-        for (uint32_t i = 0; i < currentChannels.size(); i++)
+        for (uint32_t i = 0; i < sampler.getNumberTracks(); i++)
         {
-        	if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_ROTATE)
+        	if (sampler.getTargetTransform(i) == VKTS_TARGET_TRANSFORM_ROTATE)
         	{
         		quaternionDirty = VK_TRUE;
 
-        	    if (currentChannels[i]->getNumberEntries() == 0)
-        	    {
-        	        // Do nothing.
-        	    }
-        	    else if (currentChannels[i]->getNumberEntries() == 1 || currentTime <= currentChannels[i]->getKeys()[0])
-        	    {
-        	        a[currentChannels[i]->getTargetTransformElement()] = currentChannels[i]->getValues()[0];
-        	        b[currentChannels[i]->getTargetTransformElement()] = currentChannels[i]->getValues()[0];
-        	    }
-        	    else
-        	    {
-            	    auto lastIndex = currentChannels[i]->getNumberEntries() - 1;
-
-            	    if (currentTime >= currentChannels[i]->getKeys()[lastIndex])
-            	    {
-            	    	a[currentChannels[i]->getTargetTransformElement()] = currentChannels[i]->getValues()[lastIndex];
-            	    	b[currentChannels[i]->getTargetTransformElement()] = currentChannels[i]->getValues()[lastIndex];
-            	    }
-            	    else
-            	    {
-            	        uint32_t currentIndex = 0;
-            	        while (currentIndex < currentChannels[i]->getNumberEntries())
-            	        {
-            	            if (currentTime < currentChannels[i]->getKeys()[currentIndex])
-            	            {
-            	            	currentIndex--;
-
-            	                break;
-            	            }
-
-            	            currentIndex++;
-            	        }
-
-            	        float delta = (currentChannels[i]->getKeys()[currentIndex + 1] - currentChannels[i]->getKeys()[currentIndex]);
-
-            	        if (delta > 0.0f)
-            	        {
-            	        	t = glm::clamp((currentTime - currentChannels[i]->getKeys()[currentIndex]) / delta, 0.0f, 1.0f);
-            	        }
-            	        else
-            	        {
-            	        	t = 0.0f;
-            	        }
-
-            	    	a[currentChannels[i]->getTargetTransformElement()] = currentChannels[i]->getValues()[currentIndex];
-            	    	b[currentChannels[i]->getTargetTransformElement()] = currentChannels[i]->getValues()[currentIndex + 1];
-            	    }
-        	    }
+        		float before;
+        		float after;
+
+        		if (sampler.sampleSegment(i, currentTime, before, after, t))
+        		{
+        			a[sampler.getTargetTransformElement(i)] = before;
+        			b[sampler.getTargetTransformElement(i)] = after;
+        		}
         	}
         	else
         	{
-				float value = interpolate(currentTime, currentChannels[i]);
+				float value = sampler.sample(i, currentTime);
 
-				if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_TRANSLATE)
+				if (sampler.getTargetTransform(i) == VKTS_TARGET_TRANSFORM_TRANSLATE)
 				{
-					finalTranslate[currentChannels[i]->getTargetTransformElement()] = value;
+					finalTranslate[sampler.getTargetTransformElement(i)] = value;
 				}
-				else if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_EULER_ROTATE)
+				else if (sampler.getTargetTransform(i) == VKTS_TARGET_TRANSFORM_EULER_ROTATE)
 				{
-					eulerRotation[currentChannels[i]->getTargetTransformElement()] = value;
+					eulerRotation[sampler.getTargetTransformElement(i)] = value;
 
 					eulerDirty = VK_TRUE;
 				}
-				else if (currentChannels[i]->getTargetTransform() == VKTS_TARGET_TRANSFORM_SCALE)
+				else if (sampler.getTargetTransform(i) == VKTS_TARGET_TRANSFORM_SCALE)
 				{
-					finalScale[currentChannels[i]->getTargetTransformElement()] = value;
+					finalScale[sampler.getTargetTransformElement(i)] = value;
 				}
         	}
         }
@@ -961,149 +1092,142 @@ void Node::updateTransformRecursive(const double deltaTime, const uint64_t delta
         transformMatrixDirty[currentBuffer] = VK_TRUE;
     }
 
-    //
-	//
+    return transformMatrixDirty[currentBuffer];
+}
 
-    if (transformMatrixDirty[currentBuffer])
-    {
-		this->transformMatrix = parentTransformMatrix * translateMat4(finalTranslate.x, finalTranslate.y, finalTranslate.z) * finalRotate.mat4() * scaleMat4(finalScale.x, finalScale.y, finalScale.z);
+VkBool32 Node::updateTransform(const uint32_t currentBuffer, const glm::mat4& transformMatrix, const INodeSP& armatureNode, const glm::mat3* transformNormalMatrix)
+{
+	this->transformMatrix = transformMatrix;
 
-        if (isNode() || isArmature())
-        {
-    		if (isArmature())
-    		{
-        		// Skeleton/Armature.
+    if (isNode() || isArmature())
+    {
+		if (isArmature())
+		{
+    		// Skeleton/Armature.
 
-    			auto currentJointsUniformBuffer = getJointsUniformBuffer();
+			auto currentJointsUniformBuffer = getJointsUniformBuffer();
 
-    			if (currentJointsUniformBuffer.get())
-    			{
-    	        	uint32_t dynamicOffset = currentBuffer * (uint32_t)(currentJointsUniformBuffer->getBuffer()->getSize() / currentJointsUniformBuffer->getBufferCount());
+			if (currentJointsUniformBuffer.get())
+			{
+	        	uint32_t dynamicOffset = (uint32_t)jointsUniformBufferOffset + currentBuffer * (uint32_t)(currentJointsUniformBuffer->getBuffer()->getSize() / currentJointsUniformBuffer->getBufferCount());
 
-    	        	glm::mat4 inverseTransfromMatrix = glm::inverse(this->transformMatrix);
+	        	glm::mat4 inverseTransfromMatrix = glm::inverse(this->transformMatrix);
 
-    				if (!currentJointsUniformBuffer->upload(dynamicOffset + 0, 0, inverseTransfromMatrix))
-    				{
-    					return;
-    				}
+				if (!currentJointsUniformBuffer->upload(dynamicOffset + 0, 0, inverseTransfromMatrix))
+				{
+					return VK_FALSE;
+				}
 
-    	            auto inverseTransformNormalMatrix = glm::transpose(glm::mat3(this->transformMatrix));
+	            auto inverseTransformNormalMatrix = glm::transpose(glm::mat3(this->transformMatrix));
 
-    	            if (!currentJointsUniformBuffer->upload(dynamicOffset + sizeof(float) * 16, 0, inverseTransformNormalMatrix))
-    	            {
-    	            	return;
-    	            }
-    			}
-    		}
+	            if (!currentJointsUniformBuffer->upload(dynamicOffset + sizeof(float) * 16, 0, inverseTransformNormalMatrix))
+	            {
+	            	return VK_FALSE;
+	            }
+			}
+		}
 
-    		// Process node and armature.
+		// Process node and armature.
 
-        	if (allCameras.size() > 0)
+    	if (allCameras.size() > 0)
+		{
+			for (uint32_t i = 0; i < allCameras.size(); i++)
 			{
-				for (uint32_t i = 0; i < allCameras.size(); i++)
-				{
-					allCameras[i]->updateViewMatrix(this->transformMatrix);
-				}
+				allCameras[i]->updateViewMatrix(this->transformMatrix);
 			}
+		}
 
-			if (allLights.size() > 0)
+		if (allLights.size() > 0)
+		{
+			for (uint32_t i = 0; i < allLights.size(); i++)
 			{
-				for (uint32_t i = 0; i < allLights.size(); i++)
-				{
-					allLights[i]->updateDirection(this->transformMatrix);
-				}
+				allLights[i]->updateDirection(this->transformMatrix);
 			}
+		}
 
-			if (allMeshes.size() > 0)
-			{
-				uint32_t dynamicOffset = currentBuffer * (uint32_t)(transformUniformBuffer->getBuffer()->getSize() / transformUniformBuffer->getBufferCount());
+		if (allMeshes.size() > 0)
+		{
+			uint32_t dynamicOffset = (uint32_t)transformUniformBufferOffset + currentBuffer * (uint32_t)(transformUniformBuffer->getBuffer()->getSize() / transformUniformBuffer->getBufferCount());
 
-				// A mesh has to be rendered, so update with transform matrix from the node tree.
+			// A mesh has to be rendered, so update with transform matrix from the node tree.
 
-				if (!transformUniformBuffer->upload(dynamicOffset + 0, 0, this->transformMatrix))
-				{
-					return;
-				}
+			if (!transformUniformBuffer->upload(dynamicOffset + 0, 0, this->transformMatrix))
+			{
+				return VK_FALSE;
+			}
 
-				auto transformNormalMatrix = glm::transpose(glm::inverse(glm::mat3(this->transformMatrix)));
+			auto currentTransformNormalMatrix = transformNormalMatrix ? *transformNormalMatrix : glm::transpose(glm::inverse(glm::mat3(this->transformMatrix)));
 
-				if (!transformUniformBuffer->upload(dynamicOffset + sizeof(float) * 16, 0, transformNormalMatrix))
-				{
-					return;
-				}
+			if (!transformUniformBuffer->upload(dynamicOffset + sizeof(float) * 16, 0, currentTransformNormalMatrix))
+			{
+				return VK_FALSE;
 			}
-        }
-        else if (isJoint())
-        {
-			// Process joint.
+		}
+    }
+    else if (isJoint())
+    {
+		// Process joint.
 
-			if (jointIndex >= 0 && jointIndex < VKTS_MAX_JOINTS)
+		if (jointIndex >= 0 && jointIndex < VKTS_MAX_JOINTS)
+		{
+			if (armatureNode.get())
 			{
-				if (newArmatureNode.get())
-				{
-					auto currentJointsUniformBuffer = newArmatureNode->getJointsUniformBuffer();
+				auto currentJointsUniformBuffer = armatureNode->getJointsUniformBuffer();
 
-					if (currentJointsUniformBuffer.get())
-					{
-			        	auto jointMatrix = this->transformMatrix * this->inverseBindMatrix;
+				if (currentJointsUniformBuffer.get())
+				{
+		        	auto jointMatrix = this->transformMatrix * this->inverseBindMatrix;
 
-			        	//
+		        	//
 
-						uint32_t dynamicOffset = currentBuffer * (uint32_t)(currentJointsUniformBuffer->getBuffer()->getSize() / currentJointsUniformBuffer->getBufferCount());
+					uint32_t dynamicOffset = (uint32_t)armatureNode->getJointsUniformBufferOffset() + currentBuffer * (uint32_t)(currentJointsUniformBuffer->getBuffer()->getSize() / currentJointsUniformBuffer->getBufferCount());
 
-						uint32_t offset = sizeof(float) * 16 + sizeof(float) * 12;
+					uint32_t offset = sizeof(float) * 16 + sizeof(float) * 12;
 
-						// Upload the joint matrices to blend them on the GPU.
+					// Upload the joint matrices to blend them on the GPU.
 
-						if (!currentJointsUniformBuffer->upload(dynamicOffset + offset + jointIndex * sizeof(float) * 16, 0, jointMatrix))
-						{
-							return;
-						}
+					if (!currentJointsUniformBuffer->upload(dynamicOffset + offset + jointIndex * sizeof(float) * 16, 0, jointMatrix))
+					{
+						return VK_FALSE;
+					}
 
-						auto transformNormalMatrix = glm::transpose(glm::inverse(glm::mat3(jointMatrix)));
+					auto transformNormalMatrix = glm::transpose(glm::inverse(glm::mat3(jointMatrix)));
 
-						if (!currentJointsUniformBuffer->upload(dynamicOffset + offset + VKTS_MAX_JOINTS * sizeof(float) * 16 + jointIndex * sizeof(float) * 12, 0, transformNormalMatrix))
-						{
-							return;
-						}
-					}
-					else
+					if (!currentJointsUniformBuffer->upload(dynamicOffset + offset + VKTS_MAX_JOINTS * sizeof(float) * 16 + jointIndex * sizeof(float) * 12, 0, transformNormalMatrix))
 					{
-						logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No joint uniform buffer");
-
-						return;
+						return VK_FALSE;
 					}
 				}
 				else
 				{
-					logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No root armature node");
+					logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No joint uniform buffer");
 
-					return;
+					return VK_FALSE;
 				}
 			}
-			else if (jointIndex >= VKTS_MAX_JOINTS)
+			else
 			{
-				logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Too many joints: %d >= %d",  jointIndex, VKTS_MAX_JOINTS);
+				logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No root armature node");
 
-				return;
+				return VK_FALSE;
 			}
-        }
-    }
+		}
+		else if (jointIndex >= VKTS_MAX_JOINTS)
+		{
+			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Too many joints: %d >= %d",  jointIndex, VKTS_MAX_JOINTS);
 
-    //
+			return VK_FALSE;
+		}
+    }
 
-    // Process children.
+    // Reset dirty for current buffer.
 
-    for (uint32_t i = 0; i < allChildNodes.size(); i++)
+    if (currentBuffer < (uint32_t)transformMatrixDirty.size())
     {
-        allChildNodes[i]->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, this->transformMatrix, this->transformMatrixDirty[currentBuffer], newArmatureNode, updateOverwrite);
+    	transformMatrixDirty[currentBuffer] = VK_FALSE;
     }
 
-    //
-
-    // Reset dirty for current buffer.
-
-    transformMatrixDirty[currentBuffer] = VK_FALSE;
+    return VK_TRUE;
 }
 
 void Node::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite)
@@ -1132,6 +1256,42 @@ void Node::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerV
 	}
 }
 
+void Node::collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite)
+{
+	VkTsDrawPacket nodeDrawPacket = drawPacket;
+
+    const OverwriteDraw* currentOverwrite = renderOverwrite;
+    while (currentOverwrite)
+    {
+    	if (!currentOverwrite->visit(*this, nodeDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings))
+    	{
+    		return;
+    	}
+
+    	currentOverwrite = currentOverwrite->getNextOverwrite();
+    }
+
+    //
+
+	if (allMeshes.size() > 0)
+	{
+		// Only the meshes of this node, as getBoundingSphere() also includes the child nodes.
+		nodeDrawPacket.depth = -(renderQueue.getViewMatrix() * transformMatrix * box.getSphere().getCenter()).z;
+
+		nodeDrawPacket.transformMatrix = transformMatrix;
+	}
+
+	for (uint32_t i = 0; i < allMeshes.size(); i++)
+	{
+		allMeshes[i]->collectRecursive(renderQueue, nodeDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite, name);
+	}
+
+	for (uint32_t i = 0; i < allChildNodes.size(); i++)
+	{
+		allChildNodes[i]->collectRecursive(renderQueue, drawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite);
+	}
+}
+
 VkBool32 Node::isNode() const
 {
 	return (joints == 0) && (jointIndex == -1);
@@ -1233,6 +1393,10 @@ void Node::destroy()
 	        	nodeData[i]->destroy();
 	        }
 	    }
+
+	    releaseTransformUniformBuffer();
+
+	    releaseJointsUniformBuffer();
 	}
 	catch(const std::exception& e)
 	{
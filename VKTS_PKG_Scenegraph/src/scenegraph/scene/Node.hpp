@@ -69,8 +69,14 @@ private:
     int32_t currentAnimation;
 
     IBufferObjectSP transformUniformBuffer;
+    VkDeviceSize transformUniformBufferOffset;
+    VkDeviceSize transformUniformBufferRange;
+    IUniformBufferPoolSP transformUniformBufferPool;
 
     IBufferObjectSP jointsUniformBuffer;
+    VkDeviceSize jointsUniformBufferOffset;
+    VkDeviceSize jointsUniformBufferRange;
+    IUniformBufferPoolSP jointsUniformBufferPool;
 
     Aabb box;
 
@@ -80,6 +86,10 @@ private:
 
     void reset();
 
+    void releaseTransformUniformBuffer();
+
+    void releaseJointsUniformBuffer();
+
 public:
 
     Node();
@@ -197,11 +207,23 @@ public:
 
     virtual IBufferObjectSP getTransformUniformBuffer() const override;
 
-    virtual void setTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer) override;
+    virtual VkDeviceSize getTransformUniformBufferOffset() const override;
+
+    virtual VkDeviceSize getTransformUniformBufferRange() const override;
+
+    virtual void setTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range) override;
+
+    virtual VkBool32 allocateTransformUniformBuffer(const IUniformBufferPoolSP& transformUniformBufferPool) override;
 
     virtual IBufferObjectSP getJointsUniformBuffer() const override;
 
-    virtual void setJointsUniformBuffer(const int32_t joints, const IBufferObjectSP& jointsUniformBuffer) override;
+    virtual VkDeviceSize getJointsUniformBufferOffset() const override;
+
+    virtual VkDeviceSize getJointsUniformBufferRange() const override;
+
+    virtual void setJointsUniformBuffer(const int32_t joints, const IBufferObjectSP& jointsUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range) override;
+
+    virtual VkBool32 allocateJointsUniformBuffer(const int32_t joints, const IUniformBufferPoolSP& jointsUniformBufferPool) override;
 
     virtual const Aabb& getAABB() const override;
 
@@ -219,6 +241,8 @@ public:
 
     virtual const glm::mat4& getTransformMatrix() const override;
 
+    virtual void setTransformMatrix(const uint32_t currentBuffer, const glm::mat4& transformMatrix) override;
+
     virtual INodeSP findNodeRecursive(const std::string& searchName) override;
 
     virtual INodeSP findNodeRecursiveFromRoot(const std::string& searchName) override;
@@ -229,8 +253,14 @@ public:
 
     virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const INodeSP& armatureNode, const OverwriteUpdate* updateOverwrite = nullptr) override;
 
+    virtual VkBool32 updateLocalTransform(const double deltaTime, const uint32_t currentBuffer, const VkBool32 parentTransformMatrixDirty) override;
+
+    virtual VkBool32 updateTransform(const uint32_t currentBuffer, const glm::mat4& transformMatrix, const INodeSP& armatureNode, const glm::mat3* transformNormalMatrix = nullptr) override;
+
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) override;
 
+    virtual void collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) override;
+
 
     virtual VkBool32 isNode() const override;
 
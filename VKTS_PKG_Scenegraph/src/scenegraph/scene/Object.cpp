@@ -113,9 +113,19 @@ void Object::setScale(const glm::vec3& scale)
     setDirty();
 }
 
-void Object::setDirty()
+const glm::mat4& Object::getTransformMatrix() const
 {
-    dirty = VK_TRUE;
+	return transformMatrix;
+}
+
+VkBool32 Object::getDirty() const
+{
+	return dirty;
+}
+
+void Object::setDirty(const VkBool32 dirty)
+{
+    this->dirty = dirty;
 }
 
 void Object::updateParameterRecursive(Parameter* parameter)
@@ -142,13 +152,28 @@ void Object::updateDescriptorSetsRecursive(const uint32_t allWriteDescriptorSets
 }
 
 void Object::updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const OverwriteUpdate* updateOverwrite)
+{
+	if (!updateTransform(deltaTime, deltaTicks, tickTime, currentBuffer, updateOverwrite))
+	{
+		return;
+	}
+
+    if (rootNode.get())
+    {
+        rootNode->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, transformMatrix, dirty, INodeSP(), updateOverwrite);
+    }
+
+    dirty = VK_FALSE;
+}
+
+VkBool32 Object::updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const OverwriteUpdate* updateOverwrite)
 {
     const OverwriteUpdate* currentOverwrite = updateOverwrite;
     while (currentOverwrite)
     {
     	if (!currentOverwrite->visit(*this, deltaTime, deltaTicks, tickTime, currentBuffer))
     	{
-    		return;
+    		return VK_FALSE;
     	}
 
     	currentOverwrite = currentOverwrite->getNextOverwrite();
@@ -158,7 +183,7 @@ void Object::updateTransformRecursive(const double deltaTime, const uint64_t del
 
 	if (!IMoveable::update(deltaTime, deltaTicks, tickTime))
 	{
-		return;
+		return VK_FALSE;
 	}
 
     if (dirty)
@@ -166,12 +191,7 @@ void Object::updateTransformRecursive(const double deltaTime, const uint64_t del
         transformMatrix = translateMat4(translate.x, translate.y, translate.z) * (rotateZ * rotateY * rotateX) * scaleMat4(scale.x, scale.y, scale.z);
     }
 
-    if (rootNode.get())
-    {
-        rootNode->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, transformMatrix, dirty, INodeSP(), updateOverwrite);
-    }
-
-    dirty = VK_FALSE;
+    return VK_TRUE;
 }
 
 
@@ -196,6 +216,29 @@ void Object::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointe
     }
 }
 
+void Object::collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite)
+{
+	VkTsDrawPacket objectDrawPacket = drawPacket;
+
+    const OverwriteDraw* currentOverwrite = renderOverwrite;
+    while (currentOverwrite)
+    {
+    	if (!currentOverwrite->visit(*this, objectDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings))
+    	{
+    		return;
+    	}
+
+    	currentOverwrite = currentOverwrite->getNextOverwrite();
+    }
+
+    //
+
+    if (rootNode.get())
+    {
+        rootNode->collectRecursive(renderQueue, objectDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite);
+    }
+}
+
 //
 // ICloneable
 //
@@ -81,7 +81,11 @@ public:
 
     virtual void setRootNode(const INodeSP& rootNode) override;
 
-    virtual void setDirty() override;
+    virtual const glm::mat4& getTransformMatrix() const override;
+
+    virtual VkBool32 getDirty() const override;
+
+    virtual void setDirty(const VkBool32 dirty = VK_TRUE) override;
 
     virtual void updateParameterRecursive(Parameter* parameter) override;
 
@@ -89,8 +93,12 @@ public:
 
     virtual void updateTransformRecursive(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const OverwriteUpdate* updateOverwrite = nullptr) override;
 
+    virtual VkBool32 updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const OverwriteUpdate* updateOverwrite = nullptr) override;
+
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) override;
 
+    virtual void collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite = nullptr) override;
+
     //
     // ICloneable
     //
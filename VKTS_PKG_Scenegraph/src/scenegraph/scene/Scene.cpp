@@ -394,6 +394,34 @@ void Scene::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointer
     }
 }
 
+void Scene::collectRecursive(IRenderQueue& renderQueue, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const uint32_t objectOffset, const uint32_t objectStep, const uint32_t objectLimit)
+{
+	VkTsDrawPacket drawPacket{};
+
+    const OverwriteDraw* currentOverwrite = renderOverwrite;
+    while (currentOverwrite)
+    {
+    	if (!currentOverwrite->visit(*this, drawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, objectOffset, objectStep, objectLimit))
+    	{
+    		return;
+    	}
+
+    	currentOverwrite = currentOverwrite->getNextOverwrite();
+    }
+
+    //
+
+    if (objectStep == 0)
+    {
+        return;
+    }
+
+    for (uint32_t i = objectOffset; i < glm::min(allObjects.size(), objectLimit); i += objectStep)
+    {
+        allObjects[i]->collectRecursive(renderQueue, drawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite);
+    }
+}
+
 //
 // ICloneable
 //
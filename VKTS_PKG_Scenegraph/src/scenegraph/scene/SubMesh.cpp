@@ -30,12 +30,12 @@ namespace vkts
 {
 
 SubMesh::SubMesh() :
-    ISubMesh(), name(""), vertexBuffer(), vertexBinaryBuffer(), vertexBufferType(0), numberVertices(0), indicesVertexBuffer(), indicesBinaryBuffer(), numberIndices(0), primitiveTopology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST), bsdfMaterial(), descriptorSetLayout(), pipelineLayout(), graphicsPipeline(), phongMaterial(), vertexOffset(-1), normalOffset(-1), bitangentOffset(-1), tangentOffset(-1), texcoord0Offset(-1), texcoord1Offset(-1), boneIndices0Offset(-1), boneIndices1Offset(-1), boneWeights0Offset(-1), boneWeights1Offset(-1), numberBonesOffset(-1), strideInBytes(0), box(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)), doubleSided(VK_FALSE), subMeshData()
+    ISubMesh(), name(""), vertexBuffer(), vertexBinaryBuffer(), vertexBufferType(0), numberVertices(0), indicesVertexBuffer(), indicesBinaryBuffer(), numberIndices(0), primitiveTopology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST), bsdfMaterial(), descriptorSetLayout(), pipelineLayout(), graphicsPipeline(), instanceGraphicsPipeline(), phongMaterial(), vertexOffset(-1), normalOffset(-1), bitangentOffset(-1), tangentOffset(-1), texcoord0Offset(-1), texcoord1Offset(-1), boneIndices0Offset(-1), boneIndices1Offset(-1), boneWeights0Offset(-1), boneWeights1Offset(-1), numberBonesOffset(-1), strideInBytes(0), box(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)), doubleSided(VK_FALSE), subMeshData()
 {
 }
 
 SubMesh::SubMesh(const SubMesh& other) :
-    ISubMesh(), name(other.name + "_clone"), vertexBuffer(other.vertexBuffer), vertexBinaryBuffer(other.vertexBinaryBuffer), vertexBufferType(other.vertexBufferType), numberVertices(other.numberVertices), indicesVertexBuffer(other.indicesVertexBuffer), indicesBinaryBuffer(other.indicesBinaryBuffer), numberIndices(other.numberIndices), primitiveTopology(other.primitiveTopology), bsdfMaterial(), descriptorSetLayout(other.descriptorSetLayout), pipelineLayout(other.pipelineLayout), graphicsPipeline(other.graphicsPipeline), phongMaterial(), vertexOffset(other.vertexOffset), normalOffset(other.normalOffset), bitangentOffset(other.bitangentOffset), tangentOffset(other.tangentOffset), texcoord0Offset(other.texcoord0Offset), texcoord1Offset(other.texcoord1Offset), boneIndices0Offset(other.boneIndices0Offset), boneIndices1Offset(other.boneIndices1Offset), boneWeights0Offset(other.boneWeights0Offset), boneWeights1Offset(other.boneWeights1Offset), numberBonesOffset(other.numberBonesOffset), strideInBytes(other.strideInBytes), box(other.box), doubleSided(other.doubleSided), subMeshData(other.subMeshData)
+    ISubMesh(), name(other.name + "_clone"), vertexBuffer(other.vertexBuffer), vertexBinaryBuffer(other.vertexBinaryBuffer), vertexBufferType(other.vertexBufferType), numberVertices(other.numberVertices), indicesVertexBuffer(other.indicesVertexBuffer), indicesBinaryBuffer(other.indicesBinaryBuffer), numberIndices(other.numberIndices), primitiveTopology(other.primitiveTopology), bsdfMaterial(), descriptorSetLayout(other.descriptorSetLayout), pipelineLayout(other.pipelineLayout), graphicsPipeline(other.graphicsPipeline), instanceGraphicsPipeline(other.instanceGraphicsPipeline), phongMaterial(), vertexOffset(other.vertexOffset), normalOffset(other.normalOffset), bitangentOffset(other.bitangentOffset), tangentOffset(other.tangentOffset), texcoord0Offset(other.texcoord0Offset), texcoord1Offset(other.texcoord1Offset), boneIndices0Offset(other.boneIndices0Offset), boneIndices1Offset(other.boneIndices1Offset), boneWeights0Offset(other.boneWeights0Offset), boneWeights1Offset(other.boneWeights1Offset), numberBonesOffset(other.numberBonesOffset), strideInBytes(other.strideInBytes), box(other.box), doubleSided(other.doubleSided), subMeshData(other.subMeshData)
 {
     if (other.bsdfMaterial.get())
     {
@@ -193,6 +193,16 @@ void SubMesh::setGraphicsPipeline(const IGraphicsPipelineSP& graphicsPipeline)
     this->graphicsPipeline = graphicsPipeline;
 }
 
+const IGraphicsPipelineSP& SubMesh::getInstanceGraphicsPipeline() const
+{
+    return instanceGraphicsPipeline;
+}
+
+void SubMesh::setInstanceGraphicsPipeline(const IGraphicsPipelineSP& instanceGraphicsPipeline)
+{
+    this->instanceGraphicsPipeline = instanceGraphicsPipeline;
+}
+
 const IPhongMaterialSP& SubMesh::getPhongMaterial() const
 {
     return phongMaterial;
@@ -401,6 +411,29 @@ void SubMesh::drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPoint
     }
 }
 
+void SubMesh::collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName)
+{
+	VkTsDrawPacket subMeshDrawPacket = drawPacket;
+
+    const OverwriteDraw* currentOverwrite = renderOverwrite;
+    while (currentOverwrite)
+    {
+    	if (!currentOverwrite->visit(*this, subMeshDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings))
+    	{
+    		return;
+    	}
+
+    	currentOverwrite = currentOverwrite->getNextOverwrite();
+    }
+
+    //
+
+    if (subMeshData.get())
+    {
+    	subMeshData->collect(renderQueue, subMeshDrawPacket, allGraphicsPipelines, currentBuffer, dynamicOffsetMappings, renderOverwrite, *this, nodeName);
+    }
+}
+
 //
 // ICloneable
 //
@@ -60,6 +60,8 @@ private:
     IPipelineLayoutSP pipelineLayout;
     IGraphicsPipelineSP graphicsPipeline;
 
+    IGraphicsPipelineSP instanceGraphicsPipeline;
+
     IPhongMaterialSP phongMaterial;
 
     int32_t vertexOffset;
@@ -155,6 +157,10 @@ public:
 
     virtual void setGraphicsPipeline(const IGraphicsPipelineSP& graphicsPipeline) override;
 
+    virtual const IGraphicsPipelineSP& getInstanceGraphicsPipeline() const override;
+
+    virtual void setInstanceGraphicsPipeline(const IGraphicsPipelineSP& instanceGraphicsPipeline) override;
+
     virtual const IPhongMaterialSP& getPhongMaterial() const override;
 
     virtual void setPhongMaterial(const IPhongMaterialSP& phongMaterial) override;
@@ -226,6 +232,8 @@ public:
 
     virtual void drawRecursive(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName) override;
 
+    virtual void collectRecursive(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const std::string& nodeName) override;
+
     //
     // ICloneable
     //
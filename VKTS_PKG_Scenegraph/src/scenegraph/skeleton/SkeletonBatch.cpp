@@ -0,0 +1,522 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SkeletonBatch.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VKTS_SKELETON_SSE2
+#include <emmintrin.h>
+#endif
+
+// Layout of the joints uniform buffer: inverse armature matrix, armature normal matrix, joint matrices and joint normal matrices. A mat3 consumes three vec4 columns.
+#define VKTS_SKELETON_NORMAL_OFFSET 16
+#define VKTS_SKELETON_JOINT_OFFSET (16 + 12)
+#define VKTS_SKELETON_JOINT_NORMAL_OFFSET (VKTS_SKELETON_JOINT_OFFSET + VKTS_MAX_JOINTS * 16)
+#define VKTS_SKELETON_PALETTE_FLOATS (VKTS_SKELETON_JOINT_NORMAL_OFFSET + VKTS_MAX_JOINTS * 12)
+
+namespace vkts
+{
+
+// Same order of operations as glm, so the result is bit identical to the recursive update.
+static inline void skeletonMultiply(float* result, const glm::mat4& a, const glm::mat4& b)
+{
+#ifdef VKTS_SKELETON_SSE2
+	const float* pa = glm::value_ptr(a);
+	const float* pb = glm::value_ptr(b);
+
+	const __m128 a0 = _mm_loadu_ps(pa + 0);
+	const __m128 a1 = _mm_loadu_ps(pa + 4);
+	const __m128 a2 = _mm_loadu_ps(pa + 8);
+	const __m128 a3 = _mm_loadu_ps(pa + 12);
+
+	for (uint32_t column = 0; column < 4; column++)
+	{
+		__m128 sum = _mm_mul_ps(a0, _mm_set1_ps(pb[column * 4 + 0]));
+		sum = _mm_add_ps(sum, _mm_mul_ps(a1, _mm_set1_ps(pb[column * 4 + 1])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(a2, _mm_set1_ps(pb[column * 4 + 2])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(a3, _mm_set1_ps(pb[column * 4 + 3])));
+
+		_mm_storeu_ps(result + column * 4, sum);
+	}
+#else
+	const glm::mat4 product = a * b;
+
+	memcpy(result, glm::value_ptr(product), sizeof(float) * 16);
+#endif
+}
+
+static inline void skeletonStoreNormalMatrix(float* result, const glm::mat3& normalMatrix)
+{
+	for (uint32_t column = 0; column < 3; column++)
+	{
+		result[column * 4 + 0] = normalMatrix[column][0];
+		result[column * 4 + 1] = normalMatrix[column][1];
+		result[column * 4 + 2] = normalMatrix[column][2];
+		result[column * 4 + 3] = 0.0f;
+	}
+}
+
+SkeletonBatchOverwrite::SkeletonBatchOverwrite(const std::map<const INode*, uint32_t>& allSkeletonIndices) :
+	OverwriteUpdate(), allSkeletonIndices(allSkeletonIndices)
+{
+}
+
+SkeletonBatchOverwrite::~SkeletonBatchOverwrite()
+{
+}
+
+VkBool32 SkeletonBatchOverwrite::visit(const INode& node, const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const INode* armatureNode) const
+{
+	// Joints of batched skeletons and their children are updated by the batch.
+
+	if (node.isJoint() && armatureNode && allSkeletonIndices.find(armatureNode) != allSkeletonIndices.end())
+	{
+		return VK_FALSE;
+	}
+
+	return VK_TRUE;
+}
+
+void SkeletonBatch::gatherJointRecursive(const INodeSP& node, const int32_t parentIndex)
+{
+	if (!node->isJoint())
+	{
+		allAttachedNodes.push_back(node);
+		allAttachedParentIndices.push_back((uint32_t)parentIndex);
+		allAttachedSkeletonIndices.push_back((uint32_t)allArmatureNodes.size() - 1);
+
+		return;
+	}
+
+	uint32_t jointIndex = (uint32_t)allJointNodes.size();
+
+	allJointNodes.push_back(node);
+	allParentIndices.push_back(parentIndex);
+	allInverseBindMatrices.push_back(node->getInverseBindMatrix());
+	allTransformMatrices.push_back(node->getTransformMatrix());
+
+	if (node->getJointIndex() >= 0 && node->getJointIndex() < VKTS_MAX_JOINTS)
+	{
+		allPaletteIndices.push_back(node->getJointIndex());
+	}
+	else
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Too many joints: %d >= %d",  node->getJointIndex(), VKTS_MAX_JOINTS);
+
+		allPaletteIndices.push_back(-1);
+	}
+
+	for (uint32_t i = 0; i < node->getNumberChildNodes(); i++)
+	{
+		gatherJointRecursive(node->getChildNodes()[i], (int32_t)jointIndex);
+	}
+}
+
+void SkeletonBatch::gatherArmatureRecursive(const INodeSP& node)
+{
+	if (!node.get())
+	{
+		return;
+	}
+
+	if (node->isArmature() && allSkeletonIndices.find(node.get()) == allSkeletonIndices.end())
+	{
+		allSkeletonIndices[node.get()] = (uint32_t)allArmatureNodes.size();
+
+		allArmatureNodes.push_back(node);
+
+		// Only joints are part of the skeleton, all other children are updated by the scene.
+
+		for (uint32_t i = 0; i < node->getNumberChildNodes(); i++)
+		{
+			if (node->getChildNodes()[i]->isJoint())
+			{
+				gatherJointRecursive(node->getChildNodes()[i], -1);
+			}
+		}
+
+		allJointOffsets.push_back((uint32_t)allJointNodes.size());
+	}
+
+	for (uint32_t i = 0; i < node->getNumberChildNodes(); i++)
+	{
+		if (!node->getChildNodes()[i]->isJoint())
+		{
+			gatherArmatureRecursive(node->getChildNodes()[i]);
+		}
+	}
+}
+
+VkBool32 SkeletonBatch::updateSkeletons(const uint32_t begin, const uint32_t end)
+{
+	auto& allArmatureMatrices = allUploadedArmatureMatrices[currentBuffer];
+
+	for (uint32_t skeleton = begin; skeleton < end; skeleton++)
+	{
+		float* palette = &allPalettes[skeleton * VKTS_SKELETON_PALETTE_FLOATS];
+
+		const glm::mat4& armatureMatrix = allArmatureNodes[skeleton]->getTransformMatrix();
+
+		VkBool32 armatureDirty = memcmp(glm::value_ptr(allArmatureMatrices[skeleton]), glm::value_ptr(armatureMatrix), sizeof(glm::mat4)) != 0;
+
+		if (armatureDirty)
+		{
+			allArmatureMatrices[skeleton] = armatureMatrix;
+
+			memcpy(palette, glm::value_ptr(glm::inverse(armatureMatrix)), sizeof(float) * 16);
+
+			skeletonStoreNormalMatrix(palette + VKTS_SKELETON_NORMAL_OFFSET, glm::transpose(glm::mat3(armatureMatrix)));
+		}
+
+		VkBool32 skeletonDirty = armatureDirty;
+
+		for (uint32_t joint = allJointOffsets[skeleton]; joint < allJointOffsets[skeleton + 1]; joint++)
+		{
+			const auto& node = allJointNodes[joint];
+
+			int32_t parentIndex = allParentIndices[joint];
+
+			const glm::mat4& parentTransformMatrix = parentIndex >= 0 ? allTransformMatrices[parentIndex] : armatureMatrix;
+			VkBool32 parentTransformMatrixDirty = parentIndex >= 0 ? allDirty[parentIndex] : armatureDirty;
+
+			VkBool32 transformMatrixDirty = node->updateLocalTransform(deltaTime, currentBuffer, parentTransformMatrixDirty);
+
+			allDirty[joint] = (uint8_t)transformMatrixDirty;
+
+			if (!transformMatrixDirty)
+			{
+				continue;
+			}
+
+			const glm::vec3& translate = node->getFinalTranslate();
+			const glm::vec3& scale = node->getFinalScale();
+
+			// Multiplied from the left, as done by the recursive update.
+
+			glm::mat4 transformMatrix;
+
+			skeletonMultiply(glm::value_ptr(transformMatrix), parentTransformMatrix, translateMat4(translate.x, translate.y, translate.z));
+			skeletonMultiply(glm::value_ptr(allTransformMatrices[joint]), transformMatrix, node->getFinalRotate().mat4());
+			skeletonMultiply(glm::value_ptr(transformMatrix), allTransformMatrices[joint], scaleMat4(scale.x, scale.y, scale.z));
+
+			allTransformMatrices[joint] = transformMatrix;
+
+			node->setTransformMatrix(currentBuffer, allTransformMatrices[joint]);
+
+			if (allPaletteIndices[joint] >= 0)
+			{
+				float* jointMatrix = palette + VKTS_SKELETON_JOINT_OFFSET + allPaletteIndices[joint] * 16;
+
+				skeletonMultiply(jointMatrix, allTransformMatrices[joint], allInverseBindMatrices[joint]);
+
+				skeletonStoreNormalMatrix(palette + VKTS_SKELETON_JOINT_NORMAL_OFFSET + allPaletteIndices[joint] * 12, glm::transpose(glm::inverse(glm::mat3(glm::make_mat4(jointMatrix)))));
+			}
+
+			skeletonDirty = VK_TRUE;
+		}
+
+		allSkeletonDirty[skeleton] = (uint8_t)skeletonDirty;
+	}
+
+	return VK_TRUE;
+}
+
+VkBool32 SkeletonBatch::uploadPalettes()
+{
+	VkBool32 result = VK_TRUE;
+
+	allSkeletonUploads.clear();
+
+	for (uint32_t skeleton = 0; skeleton < (uint32_t)allArmatureNodes.size(); skeleton++)
+	{
+		const auto& armatureNode = allArmatureNodes[skeleton];
+
+		auto currentJointsUniformBuffer = armatureNode->getJointsUniformBuffer();
+
+		if (!currentJointsUniformBuffer.get())
+		{
+			if (allSkeletonDirty[skeleton])
+			{
+				logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No joint uniform buffer");
+
+				result = VK_FALSE;
+			}
+
+			continue;
+		}
+
+		uint32_t dynamicOffset = (uint32_t)armatureNode->getJointsUniformBufferOffset() + currentBuffer * (uint32_t)(currentJointsUniformBuffer->getBuffer()->getSize() / currentJointsUniformBuffer->getBufferCount());
+
+		allSkeletonUploads.push_back(SkeletonUpload{currentJointsUniformBuffer, dynamicOffset, skeleton});
+	}
+
+	std::sort(allSkeletonUploads.begin(), allSkeletonUploads.end(), [](const SkeletonUpload& a, const SkeletonUpload& b)
+	{
+		if (a.jointsUniformBuffer.get() != b.jointsUniformBuffer.get())
+		{
+			return std::less<const IBufferObject*>()(a.jointsUniformBuffer.get(), b.jointsUniformBuffer.get());
+		}
+
+		return a.offset < b.offset;
+	});
+
+	const uint32_t paletteStride = getPaletteStride();
+
+	size_t first = 0;
+
+	while (first < allSkeletonUploads.size())
+	{
+		// Each slot holds at least one palette, so no other slot fits between two slots closer than two palettes.
+
+		size_t last = first;
+
+		while (last + 1 < allSkeletonUploads.size() && allSkeletonUploads[last + 1].jointsUniformBuffer.get() == allSkeletonUploads[first].jointsUniformBuffer.get() && allSkeletonUploads[last + 1].offset - allSkeletonUploads[last].offset < 2 * paletteStride)
+		{
+			last++;
+		}
+
+		// Unchanged skeletons between changed ones are uploaded as well, as their palette is still current.
+
+		size_t firstDirty = first;
+
+		while (firstDirty <= last && !allSkeletonDirty[allSkeletonUploads[firstDirty].skeleton])
+		{
+			firstDirty++;
+		}
+
+		if (firstDirty <= last)
+		{
+			size_t lastDirty = last;
+
+			while (!allSkeletonDirty[allSkeletonUploads[lastDirty].skeleton])
+			{
+				lastDirty--;
+			}
+
+			const uint32_t uploadOffset = allSkeletonUploads[firstDirty].offset;
+			const uint32_t uploadSize = allSkeletonUploads[lastDirty].offset - uploadOffset + paletteStride;
+
+			const float* palette = &allPalettes[allSkeletonUploads[firstDirty].skeleton * VKTS_SKELETON_PALETTE_FLOATS];
+
+			if (firstDirty != lastDirty)
+			{
+				// Padding between the slots is not used by the shader.
+
+				allUploadBytes.assign(uploadSize, 0);
+
+				for (size_t i = firstDirty; i <= lastDirty; i++)
+				{
+					memcpy(&allUploadBytes[allSkeletonUploads[i].offset - uploadOffset], &allPalettes[allSkeletonUploads[i].skeleton * VKTS_SKELETON_PALETTE_FLOATS], paletteStride);
+				}
+
+				palette = (const float*)&allUploadBytes[0];
+			}
+
+			if (!allSkeletonUploads[firstDirty].jointsUniformBuffer->upload(uploadOffset, 0, palette, uploadSize))
+			{
+				result = VK_FALSE;
+			}
+		}
+
+		first = last + 1;
+	}
+
+	return result;
+}
+
+SkeletonBatch::SkeletonBatch(const IUpdateThreadContext& updateContext, const ISceneSP& scene, const uint32_t grainSize) :
+	ISkeletonBatch(), scene(scene), grainSize(glm::max(grainSize, 1u)), taskGraph(taskGraphCreate(updateContext)), allArmatureNodes(), allJointOffsets(), allSkeletonIndices(), allJointNodes(), allParentIndices(), allPaletteIndices(), allInverseBindMatrices(), allTransformMatrices(), allDirty(), allAttachedNodes(), allAttachedParentIndices(), allAttachedSkeletonIndices(), allPalettes(), allUploadedArmatureMatrices(), allSkeletonDirty(), allSkeletonUploads(), allUploadBytes(), updateOverwrite(allSkeletonIndices), deltaTime(0.0), currentBuffer(0)
+{
+}
+
+SkeletonBatch::~SkeletonBatch()
+{
+	if (taskGraph.get())
+	{
+		taskGraph->wait();
+	}
+}
+
+//
+// ISkeletonBatch
+//
+
+const ISceneSP& SkeletonBatch::getScene() const
+{
+	return scene;
+}
+
+VkBool32 SkeletonBatch::rebuild()
+{
+	if (!taskGraph.get())
+	{
+		return VK_FALSE;
+	}
+
+	taskGraph->wait();
+	taskGraph->reset();
+
+	allArmatureNodes.clear();
+	allJointOffsets.clear();
+	allSkeletonIndices.clear();
+
+	allJointNodes.clear();
+	allParentIndices.clear();
+	allPaletteIndices.clear();
+	allInverseBindMatrices.clear();
+	allTransformMatrices.clear();
+
+	allAttachedNodes.clear();
+	allAttachedParentIndices.clear();
+	allAttachedSkeletonIndices.clear();
+
+	allUploadedArmatureMatrices.clear();
+
+	//
+
+	allJointOffsets.push_back(0);
+
+	const auto& allObjects = scene->getObjects();
+
+	for (uint32_t i = 0; i < allObjects.size(); i++)
+	{
+		gatherArmatureRecursive(allObjects[i]->getRootNode());
+	}
+
+	allDirty.assign(allJointNodes.size(), VK_FALSE);
+
+	allPalettes.assign(allArmatureNodes.size() * VKTS_SKELETON_PALETTE_FLOATS, 0.0f);
+
+	allSkeletonDirty.assign(allArmatureNodes.size(), VK_FALSE);
+
+	//
+
+	if (allArmatureNodes.size() > 0)
+	{
+		taskGraph->addParallelFor(0, (uint32_t)allArmatureNodes.size(), grainSize, [this](const uint32_t begin, const uint32_t end) { return updateSkeletons(begin, end); });
+	}
+
+	return VK_TRUE;
+}
+
+uint32_t SkeletonBatch::getNumberSkeletons() const
+{
+	return (uint32_t)allArmatureNodes.size();
+}
+
+const INodeSP& SkeletonBatch::getArmatureNode(const uint32_t skeleton) const
+{
+	return allArmatureNodes[skeleton];
+}
+
+uint32_t SkeletonBatch::getJointOffset(const uint32_t skeleton) const
+{
+	return allJointOffsets[skeleton];
+}
+
+uint32_t SkeletonBatch::getNumberJoints() const
+{
+	return (uint32_t)allJointNodes.size();
+}
+
+const INodeSP& SkeletonBatch::getJointNode(const uint32_t joint) const
+{
+	return allJointNodes[joint];
+}
+
+int32_t SkeletonBatch::getParentIndex(const uint32_t joint) const
+{
+	return allParentIndices[joint];
+}
+
+uint32_t SkeletonBatch::getPaletteStride() const
+{
+	return VKTS_SKELETON_PALETTE_FLOATS * sizeof(float);
+}
+
+const float* SkeletonBatch::getPalette() const
+{
+	return allPalettes.size() > 0 ? &allPalettes[0] : nullptr;
+}
+
+OverwriteUpdate& SkeletonBatch::getUpdateOverwrite()
+{
+	return updateOverwrite;
+}
+
+VkBool32 SkeletonBatch::updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const OverwriteUpdate* updateOverwrite)
+{
+	if (allJointOffsets.size() != allArmatureNodes.size() + 1)
+	{
+    	logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Skeleton batch not rebuilt");
+
+    	return VK_FALSE;
+	}
+
+	if (allArmatureNodes.size() == 0)
+	{
+		return VK_TRUE;
+	}
+
+	this->deltaTime = deltaTime;
+	this->currentBuffer = currentBuffer;
+
+	// A NaN matrix never equals the armature, so each buffer is uploaded completely the first time.
+
+	while (currentBuffer >= (uint32_t)allUploadedArmatureMatrices.size())
+	{
+		allUploadedArmatureMatrices.push_back(std::vector<glm::mat4>(allArmatureNodes.size(), glm::mat4(NAN)));
+	}
+
+	//
+
+	if (!taskGraph->run())
+	{
+		return VK_FALSE;
+	}
+
+	VkBool32 result = taskGraph->wait();
+
+	// Armatures may share one uniform buffer, so the palettes are uploaded by the calling thread.
+
+	if (!uploadPalettes())
+	{
+		result = VK_FALSE;
+	}
+
+	// Children of joints, which are no joints, e.g. attached meshes.
+
+	for (uint32_t i = 0; i < (uint32_t)allAttachedNodes.size(); i++)
+	{
+		uint32_t parentIndex = allAttachedParentIndices[i];
+
+		allAttachedNodes[i]->updateTransformRecursive(deltaTime, deltaTicks, tickTime, currentBuffer, allTransformMatrices[parentIndex], allDirty[parentIndex], allArmatureNodes[allAttachedSkeletonIndices[i]], updateOverwrite);
+	}
+
+	return result;
+}
+
+} /* namespace vkts */
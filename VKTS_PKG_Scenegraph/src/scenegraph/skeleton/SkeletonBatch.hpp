@@ -0,0 +1,170 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_SKELETONBATCH_HPP_
+#define VKTS_SKELETONBATCH_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+class SkeletonBatchOverwrite: public OverwriteUpdate
+{
+
+private:
+
+	const std::map<const INode*, uint32_t>& allSkeletonIndices;
+
+public:
+
+	SkeletonBatchOverwrite() = delete;
+	SkeletonBatchOverwrite(const std::map<const INode*, uint32_t>& allSkeletonIndices);
+	SkeletonBatchOverwrite(const SkeletonBatchOverwrite& other) = delete;
+	SkeletonBatchOverwrite(SkeletonBatchOverwrite&& other) = delete;
+    virtual ~SkeletonBatchOverwrite();
+
+    SkeletonBatchOverwrite& operator =(const SkeletonBatchOverwrite& other) = delete;
+    SkeletonBatchOverwrite& operator =(SkeletonBatchOverwrite && other) = delete;
+
+    using OverwriteUpdate::visit;
+
+    virtual VkBool32 visit(const INode& node, const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer, const glm::mat4& parentTransformMatrix, const VkBool32 parentTransformMatrixDirty, const INode* armatureNode) const override;
+
+};
+
+class SkeletonBatch: public ISkeletonBatch
+{
+
+private:
+
+	const ISceneSP scene;
+
+	const uint32_t grainSize;
+
+	ITaskGraphSP taskGraph;
+
+	// Flattened skeletons.
+
+	std::vector<INodeSP> allArmatureNodes;
+	std::vector<uint32_t> allJointOffsets;
+
+	std::map<const INode*, uint32_t> allSkeletonIndices;
+
+	// Flattened joints, parents are always stored before their children.
+
+	std::vector<INodeSP> allJointNodes;
+	std::vector<int32_t> allParentIndices;
+	std::vector<int32_t> allPaletteIndices;
+	std::vector<glm::mat4> allInverseBindMatrices;
+
+	std::vector<glm::mat4> allTransformMatrices;
+	std::vector<uint8_t> allDirty;
+
+	// Nodes, which are no joints but children of joints.
+
+	std::vector<INodeSP> allAttachedNodes;
+	std::vector<uint32_t> allAttachedParentIndices;
+	std::vector<uint32_t> allAttachedSkeletonIndices;
+
+	// Palette of all skeletons and the armature transforms last uploaded per buffer.
+
+	std::vector<float> allPalettes;
+
+	std::vector<std::vector<glm::mat4>> allUploadedArmatureMatrices;
+	std::vector<uint8_t> allSkeletonDirty;
+
+	// Slots of the skeletons in the joints uniform buffers, sorted by buffer and offset.
+
+	struct SkeletonUpload
+	{
+		IBufferObjectSP jointsUniformBuffer;
+		uint32_t offset;
+		uint32_t skeleton;
+	};
+
+	std::vector<SkeletonUpload> allSkeletonUploads;
+	std::vector<uint8_t> allUploadBytes;
+
+	SkeletonBatchOverwrite updateOverwrite;
+
+	// Parameters of the current update.
+
+	double deltaTime;
+	uint32_t currentBuffer;
+
+	void gatherJointRecursive(const INodeSP& node, const int32_t parentIndex);
+
+	void gatherArmatureRecursive(const INodeSP& node);
+
+	VkBool32 updateSkeletons(const uint32_t begin, const uint32_t end);
+
+	VkBool32 uploadPalettes();
+
+public:
+
+	SkeletonBatch() = delete;
+	SkeletonBatch(const IUpdateThreadContext& updateContext, const ISceneSP& scene, const uint32_t grainSize);
+	SkeletonBatch(const SkeletonBatch& other) = delete;
+	SkeletonBatch(SkeletonBatch&& other) = delete;
+    virtual ~SkeletonBatch();
+
+    SkeletonBatch& operator =(const SkeletonBatch& other) = delete;
+    SkeletonBatch& operator =(SkeletonBatch && other) = delete;
+
+    //
+    // ISkeletonBatch
+    //
+
+    virtual const ISceneSP& getScene() const override;
+
+    virtual VkBool32 rebuild() override;
+
+    virtual uint32_t getNumberSkeletons() const override;
+
+    virtual const INodeSP& getArmatureNode(const uint32_t skeleton) const override;
+
+    virtual uint32_t getJointOffset(const uint32_t skeleton) const override;
+
+    virtual uint32_t getNumberJoints() const override;
+
+    virtual const INodeSP& getJointNode(const uint32_t joint) const override;
+
+    virtual int32_t getParentIndex(const uint32_t joint) const override;
+
+    virtual uint32_t getPaletteStride() const override;
+
+    virtual const float* getPalette() const override;
+
+    virtual OverwriteUpdate& getUpdateOverwrite() override;
+
+    virtual VkBool32 updateTransform(const double deltaTime, const uint64_t deltaTicks, const double tickTime, const uint32_t currentBuffer = 0, const OverwriteUpdate* updateOverwrite = nullptr) override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_SKELETONBATCH_HPP_ */
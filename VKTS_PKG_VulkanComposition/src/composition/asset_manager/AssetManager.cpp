@@ -30,7 +30,7 @@ namespace vkts
 {
 
 AssetManager::AssetManager(const VkBool32 replace, const IContextObjectSP& contextObject, const ICommandObjectSP& commandObject) :
-    IAssetManager(), replace(replace), contextObject(contextObject), commandObject(commandObject), allTextureObjects(), allImageObjects(), allSamplers(), allImageDatas(), allVertexShaderModules(), allFragmentShaderModules()
+    IAssetManager(), replace(replace), contextObject(contextObject), commandObject(commandObject), imageUploadBatch(), allTextureObjects(), allImageObjects(), allSamplers(), allImageDatas(), allVertexShaderModules(), allFragmentShaderModules()
 {
 }
 
@@ -58,6 +58,16 @@ VkBool32 AssetManager::isReplace() const
     return replace;
 }
 
+const IImageUploadBatchSP& AssetManager::getImageUploadBatch() const
+{
+    return imageUploadBatch;
+}
+
+void AssetManager::setImageUploadBatch(const IImageUploadBatchSP& imageUploadBatch)
+{
+    this->imageUploadBatch = imageUploadBatch;
+}
+
 //
 
 ITextureObjectSP AssetManager::useTextureObject(const std::string& name) const
@@ -271,6 +281,8 @@ VkBool32 AssetManager::removeFragmentShaderModule(const IShaderModuleSP& shaderM
 
 void AssetManager::destroy()
 {
+    imageUploadBatch.reset();
+
     allTextureObjects.clear();
 
     allImageObjects.clear();
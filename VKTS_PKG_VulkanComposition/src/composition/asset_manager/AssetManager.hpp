@@ -43,6 +43,8 @@ protected:
 
     const ICommandObjectSP commandObject;
 
+    IImageUploadBatchSP imageUploadBatch;
+
 
     SmartPointerMap<std::string, ITextureObjectSP> allTextureObjects;
 
@@ -118,6 +120,10 @@ public:
 
     virtual VkBool32 isReplace() const override;
 
+    virtual const IImageUploadBatchSP& getImageUploadBatch() const override;
+
+    virtual void setImageUploadBatch(const IImageUploadBatchSP& imageUploadBatch) override;
+
     //
 
     virtual ITextureObjectSP useTextureObject(const std::string& name) const override;
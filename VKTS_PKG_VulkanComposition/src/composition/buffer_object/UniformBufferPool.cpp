@@ -0,0 +1,144 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "UniformBufferPool.hpp"
+
+namespace vkts
+{
+
+UniformBufferPool::UniformBufferPool(const IContextObjectSP& contextObject, const VkDeviceSize slotSize, const uint32_t slotsPerBuffer, const VkDeviceSize bufferCount) :
+    IUniformBufferPool(), contextObject(contextObject), slotSize(slotSize), slotsPerBuffer(slotsPerBuffer), bufferCount(bufferCount), currentUniformBuffer(), currentSlot(0), allFreeSlots(), poolMutex()
+{
+}
+
+UniformBufferPool::~UniformBufferPool()
+{
+    destroy();
+}
+
+//
+// IUniformBufferPool
+//
+
+VkBool32 UniformBufferPool::allocate(IBufferObjectSP& uniformBuffer, VkDeviceSize& offset)
+{
+    std::lock_guard<std::mutex> poolLock(poolMutex);
+
+    if (allFreeSlots.size() > 0)
+    {
+        uniformBuffer = allFreeSlots.back().first;
+        offset = allFreeSlots.back().second;
+
+        allFreeSlots.pop_back();
+
+        return VK_TRUE;
+    }
+
+    if (!currentUniformBuffer.get() || currentSlot == slotsPerBuffer)
+    {
+        VkBufferCreateInfo bufferCreateInfo{};
+
+        bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+
+        bufferCreateInfo.flags = 0;
+        bufferCreateInfo.size = slotSize * slotsPerBuffer;
+        bufferCreateInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        bufferCreateInfo.queueFamilyIndexCount = 0;
+        bufferCreateInfo.pQueueFamilyIndices = nullptr;
+
+        auto newUniformBuffer = bufferObjectCreate(contextObject, bufferCreateInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, bufferCount);
+
+        if (!newUniformBuffer.get())
+        {
+            return VK_FALSE;
+        }
+
+        // Mapping on each upload would change the mapping state of the shared memory from several threads.
+        if (newUniformBuffer->getDeviceMemory()->mapMemoryPersistent(0) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not map uniform buffer.");
+
+            newUniformBuffer->destroy();
+
+            return VK_FALSE;
+        }
+
+        currentUniformBuffer = newUniformBuffer;
+        currentSlot = 0;
+    }
+
+    uniformBuffer = currentUniformBuffer;
+    offset = slotSize * currentSlot;
+
+    currentSlot++;
+
+    return VK_TRUE;
+}
+
+void UniformBufferPool::free(const IBufferObjectSP& uniformBuffer, const VkDeviceSize offset)
+{
+    if (!uniformBuffer.get())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> poolLock(poolMutex);
+
+    allFreeSlots.push_back(std::make_pair(uniformBuffer, offset));
+}
+
+VkDeviceSize UniformBufferPool::getSlotSize() const
+{
+    return slotSize;
+}
+
+uint32_t UniformBufferPool::getSlotsPerBuffer() const
+{
+    return slotsPerBuffer;
+}
+
+VkDeviceSize UniformBufferPool::getBufferCount() const
+{
+    return bufferCount;
+}
+
+//
+// IDestroyable
+//
+
+void UniformBufferPool::destroy()
+{
+    std::lock_guard<std::mutex> poolLock(poolMutex);
+
+    // The buffers are destroyed by the nodes still using them.
+    currentUniformBuffer = IBufferObjectSP();
+    currentSlot = 0;
+
+    allFreeSlots.clear();
+}
+
+} /* namespace vkts */
@@ -0,0 +1,92 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_UNIFORMBUFFERPOOL_HPP_
+#define VKTS_UNIFORMBUFFERPOOL_HPP_
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+namespace vkts
+{
+
+class UniformBufferPool: public IUniformBufferPool
+{
+
+private:
+
+    const IContextObjectSP contextObject;
+
+    const VkDeviceSize slotSize;
+
+    const uint32_t slotsPerBuffer;
+
+    const VkDeviceSize bufferCount;
+
+    // Buffer, which still has never used slots.
+    IBufferObjectSP currentUniformBuffer;
+    uint32_t currentSlot;
+
+    std::vector<std::pair<IBufferObjectSP, VkDeviceSize>> allFreeSlots;
+
+    std::mutex poolMutex;
+
+public:
+
+    UniformBufferPool() = delete;
+    UniformBufferPool(const IContextObjectSP& contextObject, const VkDeviceSize slotSize, const uint32_t slotsPerBuffer, const VkDeviceSize bufferCount);
+    UniformBufferPool(const UniformBufferPool& other) = delete;
+    UniformBufferPool(UniformBufferPool&& other) = delete;
+    virtual ~UniformBufferPool();
+
+    UniformBufferPool& operator =(const UniformBufferPool& other) = delete;
+
+    UniformBufferPool& operator =(UniformBufferPool && other) = delete;
+
+    //
+    // IUniformBufferPool
+    //
+
+    virtual VkBool32 allocate(IBufferObjectSP& uniformBuffer, VkDeviceSize& offset) override;
+
+    virtual void free(const IBufferObjectSP& uniformBuffer, const VkDeviceSize offset) override;
+
+    virtual VkDeviceSize getSlotSize() const override;
+
+    virtual uint32_t getSlotsPerBuffer() const override;
+
+    virtual VkDeviceSize getBufferCount() const override;
+
+    //
+    // IDestroyable
+    //
+
+    virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_UNIFORMBUFFERPOOL_HPP_ */
@@ -0,0 +1,189 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "UniformUploadBatch.hpp"
+
+namespace vkts
+{
+
+UniformUploadBatch::UniformUploadBatch() :
+    IUniformUploadBatch(), allDeviceMemories(), allAddedDeviceMemories(), allUploadCounts(), allUploadBytes(), allFlushCounts()
+{
+}
+
+UniformUploadBatch::~UniformUploadBatch()
+{
+    destroy();
+}
+
+//
+// IUniformUploadBatch
+//
+
+VkBool32 UniformUploadBatch::addBufferObject(const IBufferObjectSP& bufferObject)
+{
+    if (!bufferObject.get() || !bufferObject->getDeviceMemory().get())
+    {
+        return VK_FALSE;
+    }
+
+    const auto& deviceMemory = bufferObject->getDeviceMemory();
+
+    if (allAddedDeviceMemories.find(deviceMemory.get()) != allAddedDeviceMemories.end())
+    {
+        return VK_TRUE;
+    }
+
+    if (deviceMemory->mapMemoryPersistent(0) != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not map memory.");
+
+        return VK_FALSE;
+    }
+
+    allDeviceMemories.append(deviceMemory);
+
+    allAddedDeviceMemories.insert(deviceMemory.get());
+
+    allUploadCounts.push_back(deviceMemory->getUploadCount());
+    allUploadBytes.push_back(deviceMemory->getUploadBytes());
+    allFlushCounts.push_back(deviceMemory->getFlushCount());
+
+    return VK_TRUE;
+}
+
+uint32_t UniformUploadBatch::getNumberDeviceMemories() const
+{
+    return allDeviceMemories.size();
+}
+
+VkBool32 UniformUploadBatch::flush()
+{
+    VkBool32 result = VK_TRUE;
+
+    for (uint32_t i = 0; i < allDeviceMemories.size(); i++)
+    {
+        if (allDeviceMemories[i]->flushUploads() != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+            result = VK_FALSE;
+        }
+    }
+
+    return result;
+}
+
+uint64_t UniformUploadBatch::getUploadCount() const
+{
+    uint64_t uploadCount = 0;
+
+    for (uint32_t i = 0; i < allDeviceMemories.size(); i++)
+    {
+        uploadCount += allDeviceMemories[i]->getUploadCount() - allUploadCounts[i];
+    }
+
+    return uploadCount;
+}
+
+uint64_t UniformUploadBatch::getUploadBytes() const
+{
+    uint64_t uploadBytes = 0;
+
+    for (uint32_t i = 0; i < allDeviceMemories.size(); i++)
+    {
+        uploadBytes += allDeviceMemories[i]->getUploadBytes() - allUploadBytes[i];
+    }
+
+    return uploadBytes;
+}
+
+uint64_t UniformUploadBatch::getFlushCount() const
+{
+    uint64_t flushCount = 0;
+
+    for (uint32_t i = 0; i < allDeviceMemories.size(); i++)
+    {
+        flushCount += allDeviceMemories[i]->getFlushCount() - allFlushCounts[i];
+    }
+
+    return flushCount;
+}
+
+uint64_t UniformUploadBatch::getSavedCallCount() const
+{
+    uint64_t savedCallCount = 0;
+
+    for (uint32_t i = 0; i < allDeviceMemories.size(); i++)
+    {
+        uint64_t uploadCount = allDeviceMemories[i]->getUploadCount() - allUploadCounts[i];
+
+        // Each upload maps and unmaps the memory. Not host coherent memory is also flushed.
+
+        savedCallCount += 2 * uploadCount;
+
+        if (!(allDeviceMemories[i]->getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+        {
+            uint64_t flushCount = allDeviceMemories[i]->getFlushCount() - allFlushCounts[i];
+
+            savedCallCount += uploadCount > flushCount ? uploadCount - flushCount : 0;
+        }
+    }
+
+    return savedCallCount;
+}
+
+void UniformUploadBatch::resetCounters()
+{
+    for (uint32_t i = 0; i < allDeviceMemories.size(); i++)
+    {
+        allUploadCounts[i] = allDeviceMemories[i]->getUploadCount();
+        allUploadBytes[i] = allDeviceMemories[i]->getUploadBytes();
+        allFlushCounts[i] = allDeviceMemories[i]->getFlushCount();
+    }
+}
+
+//
+// IDestroyable
+//
+
+void UniformUploadBatch::destroy()
+{
+    for (uint32_t i = 0; i < allDeviceMemories.size(); i++)
+    {
+        allDeviceMemories[i]->unmapMemory();
+    }
+
+    allDeviceMemories.clear();
+
+    allAddedDeviceMemories.clear();
+
+    allUploadCounts.clear();
+    allUploadBytes.clear();
+    allFlushCounts.clear();
+}
+
+} /* namespace vkts */
@@ -0,0 +1,94 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_UNIFORMUPLOADBATCH_HPP_
+#define VKTS_UNIFORMUPLOADBATCH_HPP_
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+#include <unordered_set>
+
+namespace vkts
+{
+
+class UniformUploadBatch: public IUniformUploadBatch
+{
+
+private:
+
+    SmartPointerVector<IDeviceMemorySP> allDeviceMemories;
+
+    // Many buffer objects share one device memory, so look up the already added ones in constant time.
+    // Sub-allocations share their block's VkDeviceMemory, but are mapped and flushed on their own, so the key is the device memory object.
+    std::unordered_set<const IDeviceMemory*> allAddedDeviceMemories;
+
+    // Counter values of each device memory at the last reset.
+
+    std::vector<uint64_t> allUploadCounts;
+    std::vector<uint64_t> allUploadBytes;
+    std::vector<uint64_t> allFlushCounts;
+
+public:
+
+    UniformUploadBatch();
+    UniformUploadBatch(const UniformUploadBatch& other) = delete;
+    UniformUploadBatch(UniformUploadBatch&& other) = delete;
+    virtual ~UniformUploadBatch();
+
+    UniformUploadBatch& operator =(const UniformUploadBatch& other) = delete;
+    UniformUploadBatch& operator =(UniformUploadBatch && other) = delete;
+
+    //
+    // IUniformUploadBatch
+    //
+
+    virtual VkBool32 addBufferObject(const IBufferObjectSP& bufferObject) override;
+
+    virtual uint32_t getNumberDeviceMemories() const override;
+
+    virtual VkBool32 flush() override;
+
+    virtual uint64_t getUploadCount() const override;
+
+    virtual uint64_t getUploadBytes() const override;
+
+    virtual uint64_t getFlushCount() const override;
+
+    virtual uint64_t getSavedCallCount() const override;
+
+    virtual void resetCounters() override;
+
+    //
+    // IDestroyable
+    //
+
+    virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_UNIFORMUPLOADBATCH_HPP_ */
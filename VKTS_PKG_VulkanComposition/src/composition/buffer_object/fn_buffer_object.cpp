@@ -67,10 +67,7 @@ static VkBool32 bufferObjectPrepare(IBufferSP& buffer, IDeviceMemorySP& deviceMe
 
     buffer->getBufferMemoryRequirements(memoryRequirements);
 
-    VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
-    contextObject->getPhysicalDevice()->getPhysicalDeviceMemoryProperties(physicalDeviceMemoryProperties);
-
-    deviceMemory = deviceMemoryCreate(contextObject->getDevice()->getDevice(), memoryRequirements, physicalDeviceMemoryProperties.memoryTypeCount, physicalDeviceMemoryProperties.memoryTypes, memoryPropertyFlag);
+    deviceMemory = contextObject->getDeviceMemoryAllocator()->allocate(memoryRequirements, memoryPropertyFlag, VK_TRUE);
 
     if (!deviceMemory.get())
     {
@@ -79,7 +76,7 @@ static VkBool32 bufferObjectPrepare(IBufferSP& buffer, IDeviceMemorySP& deviceMe
         return VK_FALSE;
     }
 
-    result = buffer->bindBufferMemory(deviceMemory->getDeviceMemory(), 0);
+    result = buffer->bindBufferMemory(deviceMemory->getDeviceMemory(), deviceMemory->getOffset());
 
     if (result != VK_SUCCESS)
     {
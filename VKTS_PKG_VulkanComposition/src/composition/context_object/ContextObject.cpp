@@ -29,8 +29,8 @@
 namespace vkts
 {
 
-ContextObject::ContextObject(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const VkBool32 manage) :
-    IContextObject(), instance(instance), physicalDevice(physicalDevice), device(device), queue(queue), manage(manage)
+ContextObject::ContextObject(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const IDeviceMemoryAllocatorSP& deviceMemoryAllocator, const IDescriptorSetAllocatorSP& descriptorSetAllocator, const IPipelineCacheSP& pipelineCache, const std::string& pipelineCacheFilename, const VkBool32 manage) :
+    IContextObject(), instance(instance), physicalDevice(physicalDevice), device(device), queue(queue), deviceMemoryAllocator(deviceMemoryAllocator), descriptorSetAllocator(descriptorSetAllocator), pipelineCache(pipelineCache), pipelineCacheFilename(pipelineCacheFilename), allCreatedPipelineCaches(), pipelineCacheMutex(), manage(manage)
 {
 }
 
@@ -78,10 +78,133 @@ const IQueueSP& ContextObject::getQueue() const
     return queue;
 }
 
+const IDeviceMemoryAllocatorSP& ContextObject::getDeviceMemoryAllocator() const
+{
+    return deviceMemoryAllocator;
+}
+
+const IDescriptorSetAllocatorSP& ContextObject::getDescriptorSetAllocator() const
+{
+    return descriptorSetAllocator;
+}
+
+const IPipelineCacheSP& ContextObject::getPipelineCache() const
+{
+    return pipelineCache;
+}
+
+IPipelineCacheSP ContextObject::createPipelineCache()
+{
+    if (!device.get())
+    {
+        return IPipelineCacheSP();
+    }
+
+    IPipelineCacheSP createdPipelineCache;
+
+    {
+        std::lock_guard<std::mutex> lock(pipelineCacheMutex);
+
+        // Seed the per thread cache with the loaded one, so a warm start also benefits worker threads.
+        auto data = pipelineCache.get() ? pipelineCache->getData() : IBinaryBufferSP();
+
+        if (data.get() && data->getSize() > 0)
+        {
+            createdPipelineCache = pipelineCreateCache(device->getDevice(), 0, (uint32_t) data->getSize(), data->getData());
+        }
+    }
+
+    if (!createdPipelineCache.get())
+    {
+        createdPipelineCache = pipelineCreateCache(device->getDevice(), 0);
+    }
+
+    if (!createdPipelineCache.get())
+    {
+        return IPipelineCacheSP();
+    }
+
+    std::lock_guard<std::mutex> lock(pipelineCacheMutex);
+
+    allCreatedPipelineCaches.push_back(createdPipelineCache);
+
+    return createdPipelineCache;
+}
+
+VkBool32 ContextObject::savePipelineCache()
+{
+    std::lock_guard<std::mutex> lock(pipelineCacheMutex);
+
+    if (!pipelineCache.get() || pipelineCacheFilename.size() == 0)
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<VkPipelineCache> allSrcCaches;
+
+    for (const auto& currentPipelineCache : allCreatedPipelineCaches)
+    {
+        // Cache could already be destroyed by its thread.
+        if (currentPipelineCache->getPipelineCache())
+        {
+            allSrcCaches.push_back(currentPipelineCache->getPipelineCache());
+        }
+    }
+
+    if (allSrcCaches.size() > 0)
+    {
+        if (pipelineCache->mergePipelineCaches((uint32_t) allSrcCaches.size(), &allSrcCaches[0]) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not merge pipeline caches.");
+        }
+    }
+
+    if (!pipelineCacheSave(pipelineCacheFilename.c_str(), pipelineCache))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not save pipeline cache '%s'.", pipelineCacheFilename.c_str());
+
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
 void ContextObject::destroyDevice()
 {
 	queue.reset();
 
+	if (pipelineCache.get())
+	{
+		savePipelineCache();
+
+		for (auto& currentPipelineCache : allCreatedPipelineCaches)
+		{
+			currentPipelineCache->destroy();
+		}
+
+		allCreatedPipelineCaches.clear();
+
+		pipelineCache->destroy();
+
+		pipelineCache.reset();
+	}
+
+	// Pools have to be destroyed before the device is destroyed.
+	if (descriptorSetAllocator.get())
+	{
+		descriptorSetAllocator->destroy();
+
+		descriptorSetAllocator.reset();
+	}
+
+	// Blocks have to be freed before the device is destroyed.
+	if (deviceMemoryAllocator.get())
+	{
+		deviceMemoryAllocator->destroy();
+
+		deviceMemoryAllocator.reset();
+	}
+
     if (device.get())
     {
     	if (manage)
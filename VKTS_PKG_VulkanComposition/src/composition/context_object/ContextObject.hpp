@@ -45,12 +45,24 @@ private:
 
     IQueueSP queue;
 
+    IDeviceMemoryAllocatorSP deviceMemoryAllocator;
+
+    IDescriptorSetAllocatorSP descriptorSetAllocator;
+
+    IPipelineCacheSP pipelineCache;
+
+    std::string pipelineCacheFilename;
+
+    std::vector<IPipelineCacheSP> allCreatedPipelineCaches;
+
+    std::mutex pipelineCacheMutex;
+
     VkBool32 manage;
 
 public:
 
     ContextObject() = delete;
-    ContextObject(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const VkBool32 manage);
+    ContextObject(const IInstanceSP& instance, const IPhysicalDeviceSP& physicalDevice, const IDeviceSP& device, const IQueueSP& queue, const IDeviceMemoryAllocatorSP& deviceMemoryAllocator, const IDescriptorSetAllocatorSP& descriptorSetAllocator, const IPipelineCacheSP& pipelineCache, const std::string& pipelineCacheFilename, const VkBool32 manage);
     ContextObject(const ContextObject& other) = delete;
     ContextObject(ContextObject&& other) = delete;
     virtual ~ContextObject();
@@ -72,6 +84,16 @@ public:
 
     virtual const IQueueSP& getQueue() const override;
 
+    virtual const IDeviceMemoryAllocatorSP& getDeviceMemoryAllocator() const override;
+
+    virtual const IDescriptorSetAllocatorSP& getDescriptorSetAllocator() const override;
+
+    virtual const IPipelineCacheSP& getPipelineCache() const override;
+
+    virtual IPipelineCacheSP createPipelineCache() override;
+
+    virtual VkBool32 savePipelineCache() override;
+
     virtual void destroyDevice() override;
 
     //
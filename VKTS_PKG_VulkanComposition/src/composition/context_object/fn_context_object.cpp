@@ -37,7 +37,50 @@ IContextObjectSP VKTS_APIENTRY contextObjectCreate(const IInstanceSP& instance,
         return IContextObjectSP();
     }
 
-    auto newInstance = new ContextObject(instance, physicalDevice, device, queue, manage);
+    VkPhysicalDeviceProperties physicalDeviceProperties;
+
+    physicalDevice->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+    VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
+
+    physicalDevice->getPhysicalDeviceMemoryProperties(physicalDeviceMemoryProperties);
+
+    auto deviceMemoryAllocator = deviceMemoryAllocatorCreate(device->getDevice(), physicalDeviceMemoryProperties, physicalDeviceProperties.limits, VKTS_DEVICE_MEMORY_BLOCK_SIZE);
+
+    if (!deviceMemoryAllocator.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create device memory allocator.");
+
+        return IContextObjectSP();
+    }
+
+    auto pipelineCacheFilename = pipelineCacheGetFilename(physicalDeviceProperties);
+
+    auto pipelineCache = pipelineCacheLoad(device->getDevice(), physicalDeviceProperties, pipelineCacheFilename.c_str());
+
+    if (!pipelineCache.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create pipeline cache.");
+
+        deviceMemoryAllocator->destroy();
+
+        return IContextObjectSP();
+    }
+
+    auto descriptorSetAllocator = descriptorSetAllocatorCreate(device->getDevice(), VKTS_DESCRIPTOR_SETS_PER_POOL);
+
+    if (!descriptorSetAllocator.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create descriptor set allocator.");
+
+        pipelineCache->destroy();
+
+        deviceMemoryAllocator->destroy();
+
+        return IContextObjectSP();
+    }
+
+    auto newInstance = new ContextObject(instance, physicalDevice, device, queue, deviceMemoryAllocator, descriptorSetAllocator, pipelineCache, pipelineCacheFilename, manage);
 
     if (!newInstance)
     {
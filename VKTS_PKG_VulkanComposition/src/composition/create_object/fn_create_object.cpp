@@ -136,6 +136,11 @@ IImageObjectSP VKTS_APIENTRY createImageObject(const IAssetManagerSP& assetManag
 
 	//
 
+	if (assetManager->getImageUploadBatch().get() && !(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+	{
+		return imageObjectCreate(assetManager->getImageUploadBatch(), imageObjectName, imageData, imageCreateInfo, srcAccessMask, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
+	}
+
 	IDeviceMemorySP stageDeviceMemory;
 	IImageSP stageImage;
 	IBufferSP stageBuffer;
@@ -343,15 +348,24 @@ ITextureObjectSP VKTS_APIENTRY createTextureObject(const IAssetManagerSP& assetM
 
     VkImageSubresourceRange subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, imageData->getMipLevels(), 0, imageData->getArrayLayers()};
 
-    IDeviceMemorySP stageDeviceMemory;
-    IBufferSP stageBuffer;
-    IImageSP stageImage;
+    IImageObjectSP imageObject;
+
+    if (assetManager->getImageUploadBatch().get() && !(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+    {
+        imageObject = imageObjectCreate(assetManager->getImageUploadBatch(), imageObjectName, imageData, imageCreateInfo, srcAccessMask, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
+    }
+    else
+    {
+        IDeviceMemorySP stageDeviceMemory;
+        IBufferSP stageBuffer;
+        IImageSP stageImage;
 
-    auto imageObject = imageObjectCreate(stageImage, stageBuffer, stageDeviceMemory, assetManager->getContextObject(), assetManager->getCommandObject()->getCommandBuffer(), imageObjectName, imageData, imageCreateInfo, srcAccessMask, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
+        imageObject = imageObjectCreate(stageImage, stageBuffer, stageDeviceMemory, assetManager->getContextObject(), assetManager->getCommandObject()->getCommandBuffer(), imageObjectName, imageData, imageCreateInfo, srcAccessMask, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
 
-    assetManager->getCommandObject()->addStageImage(stageImage);
-    assetManager->getCommandObject()->addStageBuffer(stageBuffer);
-    assetManager->getCommandObject()->addStageDeviceMemory(stageDeviceMemory);
+        assetManager->getCommandObject()->addStageImage(stageImage);
+        assetManager->getCommandObject()->addStageBuffer(stageBuffer);
+        assetManager->getCommandObject()->addStageDeviceMemory(stageDeviceMemory);
+    }
 
     if (!imageObject.get())
     {
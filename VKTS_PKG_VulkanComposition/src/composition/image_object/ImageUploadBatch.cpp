@@ -0,0 +1,777 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ImageUploadBatch.hpp"
+
+namespace vkts
+{
+
+static VkDeviceSize imageUploadBatchGreatestCommonDivisor(VkDeviceSize a, VkDeviceSize b)
+{
+    while (b)
+    {
+        const VkDeviceSize temp = a % b;
+
+        a = b;
+        b = temp;
+    }
+
+    return a;
+}
+
+static VkDeviceSize imageUploadBatchLeastCommonMultiple(const VkDeviceSize a, const VkDeviceSize b)
+{
+    if (a == 0 || b == 0)
+    {
+        return a + b;
+    }
+
+    return (a / imageUploadBatchGreatestCommonDivisor(a, b)) * b;
+}
+
+static VkDeviceSize imageUploadBatchAlign(const VkDeviceSize offset, const VkDeviceSize alignment)
+{
+    return ((offset + alignment - 1) / alignment) * alignment;
+}
+
+VkBool32 ImageUploadBatch::getRingTail(VkDeviceSize& tail) const
+{
+    // Oldest submit first, current submit last.
+
+    for (uint32_t i = 1; i <= (uint32_t)allSubmits.size(); i++)
+    {
+        const auto& currentUploadSubmit = allSubmits[(currentSubmit + i) % allSubmits.size()];
+
+        if ((currentUploadSubmit.pending || currentUploadSubmit.recording) && currentUploadSubmit.ringUsed)
+        {
+            tail = currentUploadSubmit.ringBegin;
+
+            return VK_TRUE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
+VkBool32 ImageUploadBatch::allocateRing(VkDeviceSize& offset, const VkDeviceSize size, const VkDeviceSize alignment)
+{
+    const VkDeviceSize ringSize = getRingSize();
+
+    if (size == 0 || size + alignment > ringSize)
+    {
+        return VK_FALSE;
+    }
+
+    while (VK_TRUE)
+    {
+        VkDeviceSize tail = 0;
+
+        VkBool32 used = getRingTail(tail);
+
+        if (!used)
+        {
+            ringHead = 0;
+        }
+
+        VkDeviceSize start = imageUploadBatchAlign(ringHead, alignment);
+
+        VkBool32 found = VK_FALSE;
+
+        // The head never reaches the tail, so an equal head and tail always means an empty ring.
+
+        if (!used)
+        {
+            found = start + size <= ringSize;
+        }
+        else if (tail < ringHead)
+        {
+            if (start + size <= ringSize)
+            {
+                found = VK_TRUE;
+            }
+            else if (size < tail)
+            {
+                start = 0;
+
+                found = VK_TRUE;
+            }
+        }
+        else
+        {
+            found = start + size < tail;
+        }
+
+        if (found)
+        {
+            auto& currentUploadSubmit = allSubmits[currentSubmit];
+
+            if (!currentUploadSubmit.ringUsed)
+            {
+                currentUploadSubmit.ringUsed = VK_TRUE;
+                currentUploadSubmit.ringBegin = start;
+            }
+
+            offset = start;
+
+            ringHead = start + size;
+
+            return VK_TRUE;
+        }
+
+        // Ring is full, so submit the recorded copies and reuse the memory of the oldest submit.
+
+        if (allSubmits[currentSubmit].recording && allSubmits[currentSubmit].ringUsed)
+        {
+            if (!submit().get())
+            {
+                return VK_FALSE;
+            }
+
+            if (!beginSubmit())
+            {
+                return VK_FALSE;
+            }
+
+            continue;
+        }
+
+        if (!waitOldestSubmit())
+        {
+            return VK_FALSE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
+VkBool32 ImageUploadBatch::allocateStageBuffer(IBufferSP& stageBuffer, IDeviceMemorySP& stageDeviceMemory, const VkDeviceSize size)
+{
+    stageBuffer = bufferCreate(contextObject->getDevice()->getDevice(), 0, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, 0, nullptr);
+
+    if (!stageBuffer.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create buffer.");
+
+        return VK_FALSE;
+    }
+
+    VkMemoryRequirements memoryRequirements;
+
+    stageBuffer->getBufferMemoryRequirements(memoryRequirements);
+
+    stageDeviceMemory = contextObject->getDeviceMemoryAllocator()->allocate(memoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, VK_TRUE);
+
+    if (!stageDeviceMemory.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not allocate memory.");
+
+        return VK_FALSE;
+    }
+
+    if (stageBuffer->bindBufferMemory(stageDeviceMemory->getDeviceMemory(), stageDeviceMemory->getOffset()) != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not bind buffer memory.");
+
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 ImageUploadBatch::beginSubmit()
+{
+    auto& currentUploadSubmit = allSubmits[currentSubmit];
+
+    if (currentUploadSubmit.recording)
+    {
+        return VK_TRUE;
+    }
+
+    if (currentUploadSubmit.pending)
+    {
+        if (currentUploadSubmit.fence->waitForFence(UINT64_MAX) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not wait for fence.");
+
+            return VK_FALSE;
+        }
+
+        recycleSubmit(currentUploadSubmit);
+    }
+
+    if (currentUploadSubmit.transferCmdBuffer->beginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, VK_FALSE, 0, 0) != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not begin command buffer.");
+
+        return VK_FALSE;
+    }
+
+    currentUploadSubmit.recording = VK_TRUE;
+
+    return VK_TRUE;
+}
+
+VkBool32 ImageUploadBatch::waitOldestSubmit()
+{
+    for (uint32_t i = 1; i <= (uint32_t)allSubmits.size(); i++)
+    {
+        auto& currentUploadSubmit = allSubmits[(currentSubmit + i) % allSubmits.size()];
+
+        if (currentUploadSubmit.pending)
+        {
+            if (currentUploadSubmit.fence->waitForFence(UINT64_MAX) != VK_SUCCESS)
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not wait for fence.");
+
+                return VK_FALSE;
+            }
+
+            recycleSubmit(currentUploadSubmit);
+
+            return VK_TRUE;
+        }
+    }
+
+    // Nothing to wait for.
+    return VK_FALSE;
+}
+
+void ImageUploadBatch::recycleSubmit(ImageUploadSubmit& submit)
+{
+    submit.pending = VK_FALSE;
+
+    submit.ringUsed = VK_FALSE;
+    submit.ringBegin = 0;
+
+    submit.allImages.clear();
+
+    for (uint32_t i = 0; i < submit.allStageBuffers.size(); i++)
+    {
+        submit.allStageBuffers[i]->destroy();
+    }
+    submit.allStageBuffers.clear();
+
+    for (uint32_t i = 0; i < submit.allStageDeviceMemories.size(); i++)
+    {
+        submit.allStageDeviceMemories[i]->destroy();
+    }
+    submit.allStageDeviceMemories.clear();
+
+    submit.allAcquires.clear();
+
+    completeTime = timeGetRaw();
+}
+
+ImageUploadBatch::ImageUploadBatch(const IContextObjectSP& contextObject, const IQueueSP& transferQueue, const IBufferSP& ringBuffer, const IDeviceMemorySP& ringDeviceMemory, const ICommandPoolSP& transferCommandPool, const ICommandPoolSP& acquireCommandPool, const std::vector<ImageUploadSubmit>& allSubmits) :
+    IImageUploadBatch(), contextObject(contextObject), transferQueue(transferQueue), ringBuffer(ringBuffer), ringDeviceMemory(ringDeviceMemory), ringData(nullptr), ringHead(0), copyOffsetAlignment(1), transferCommandPool(transferCommandPool), acquireCommandPool(acquireCommandPool), allSubmits(allSubmits), currentSubmit(0), lastFence(), imageCount(0), uploadBytes(0), submitCount(0), startTime(0.0), completeTime(0.0)
+{
+    ringData = static_cast<uint8_t*>(ringDeviceMemory->getMemory());
+
+    VkPhysicalDeviceProperties physicalDeviceProperties;
+
+    contextObject->getPhysicalDevice()->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+    copyOffsetAlignment = glm::max(physicalDeviceProperties.limits.optimalBufferCopyOffsetAlignment, (VkDeviceSize)1);
+}
+
+ImageUploadBatch::~ImageUploadBatch()
+{
+    destroy();
+}
+
+//
+// IImageUploadBatch
+//
+
+const IContextObjectSP& ImageUploadBatch::getContextObject() const
+{
+    return contextObject;
+}
+
+const IQueueSP& ImageUploadBatch::getTransferQueue() const
+{
+    return transferQueue;
+}
+
+VkDeviceSize ImageUploadBatch::getRingSize() const
+{
+    if (!ringBuffer.get())
+    {
+        return 0;
+    }
+
+    return ringBuffer->getSize();
+}
+
+VkBool32 ImageUploadBatch::addImage(const IImageSP& image, const IImageDataSP& imageData, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange)
+{
+    if (!image.get() || !imageData.get() || !ringData || imageData->getSize() == 0)
+    {
+        return VK_FALSE;
+    }
+
+    if (startTime == 0.0)
+    {
+        startTime = timeGetRaw();
+    }
+
+    if (!beginSubmit())
+    {
+        return VK_FALSE;
+    }
+
+    // Buffer offsets have to be a multiple of four and of the texel size. Compressed blocks are at most 16 bytes.
+
+    const VkDeviceSize alignment = imageUploadBatchLeastCommonMultiple(imageUploadBatchLeastCommonMultiple(16, imageData->getBytesPerTexel()), copyOffsetAlignment);
+
+    const VkDeviceSize size = (VkDeviceSize)imageData->getSize();
+
+    VkBuffer sourceBuffer = VK_NULL_HANDLE;
+
+    VkDeviceSize sourceOffset = 0;
+
+    if (allocateRing(sourceOffset, size, alignment))
+    {
+        memcpy(ringData + sourceOffset, imageData->getData(), (size_t)size);
+
+        if (!(ringDeviceMemory->getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+        {
+            if (ringDeviceMemory->flushMappedMemoryRanges(sourceOffset, size) != VK_SUCCESS)
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not flush memory.");
+
+                return VK_FALSE;
+            }
+        }
+
+        sourceBuffer = ringBuffer->getBuffer();
+    }
+    else
+    {
+        // Image does not fit into the ring at all.
+
+        IBufferSP stageBuffer;
+        IDeviceMemorySP stageDeviceMemory;
+
+        if (!allocateStageBuffer(stageBuffer, stageDeviceMemory, size))
+        {
+            return VK_FALSE;
+        }
+
+        if (stageDeviceMemory->upload(0, 0, imageData->getData(), (uint32_t)size) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not copy data to stage buffer.");
+
+            return VK_FALSE;
+        }
+
+        sourceBuffer = stageBuffer->getBuffer();
+
+        allSubmits[currentSubmit].allStageBuffers.append(stageBuffer);
+        allSubmits[currentSubmit].allStageDeviceMemories.append(stageDeviceMemory);
+    }
+
+    //
+
+    auto& currentUploadSubmit = allSubmits[currentSubmit];
+
+    const VkCommandBuffer cmdBuffer = currentUploadSubmit.transferCmdBuffer->getCommandBuffer();
+
+    // All mip levels and layers of one image are copied with one command.
+
+    std::vector<VkBufferImageCopy> allBufferImageCopies;
+
+    for (uint32_t arrayLayer = subresourceRange.baseArrayLayer; arrayLayer < subresourceRange.baseArrayLayer + subresourceRange.layerCount && arrayLayer < imageData->getArrayLayers(); arrayLayer++)
+    {
+        for (uint32_t mipLevel = subresourceRange.baseMipLevel; mipLevel < subresourceRange.baseMipLevel + subresourceRange.levelCount && mipLevel < imageData->getMipLevels(); mipLevel++)
+        {
+            VkExtent3D currentExtent;
+            uint32_t currentOffset;
+
+            if (!imageData->getExtentAndOffset(currentExtent, currentOffset, mipLevel, arrayLayer))
+            {
+                return VK_FALSE;
+            }
+
+            VkBufferImageCopy bufferImageCopy;
+
+            bufferImageCopy.bufferOffset = sourceOffset + currentOffset;
+            bufferImageCopy.bufferRowLength = 0;	// Zero means tightly packed.
+            bufferImageCopy.bufferImageHeight = 0;
+            bufferImageCopy.imageSubresource = {subresourceRange.aspectMask, mipLevel, arrayLayer, 1};
+            bufferImageCopy.imageOffset = {0, 0, 0};
+            bufferImageCopy.imageExtent = currentExtent;
+
+            allBufferImageCopies.push_back(bufferImageCopy);
+        }
+    }
+
+    if (allBufferImageCopies.size() == 0)
+    {
+        return VK_FALSE;
+    }
+
+    image->cmdPipelineBarrier(cmdBuffer, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresourceRange);
+
+    vkCmdCopyBufferToImage(cmdBuffer, sourceBuffer, image->getImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)allBufferImageCopies.size(), &allBufferImageCopies[0]);
+
+    if (currentUploadSubmit.acquireCmdBuffer.get())
+    {
+        // Release the image, the final layout transition is done on the context queue.
+
+        VkImageMemoryBarrier imageMemoryBarrier{};
+
+        imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+
+        imageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        imageMemoryBarrier.dstAccessMask = 0;
+        imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageMemoryBarrier.srcQueueFamilyIndex = transferQueue->getQueueFamilyIndex();
+        imageMemoryBarrier.dstQueueFamilyIndex = contextObject->getQueue()->getQueueFamilyIndex();
+        imageMemoryBarrier.image = image->getImage();
+        imageMemoryBarrier.subresourceRange = subresourceRange;
+
+        currentUploadSubmit.transferCmdBuffer->cmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
+
+        currentUploadSubmit.allAcquires.push_back(ImageUploadAcquire{image, dstAccessMask, newLayout, subresourceRange});
+    }
+    else
+    {
+        image->cmdPipelineBarrier(cmdBuffer, dstAccessMask, newLayout, subresourceRange);
+    }
+
+    currentUploadSubmit.allImages.append(image);
+
+    imageCount++;
+    uploadBytes += size;
+
+    return VK_TRUE;
+}
+
+IFenceSP ImageUploadBatch::submit()
+{
+    auto& currentUploadSubmit = allSubmits[currentSubmit];
+
+    if (!currentUploadSubmit.recording)
+    {
+        return IFenceSP();
+    }
+
+    currentUploadSubmit.recording = VK_FALSE;
+
+    if (currentUploadSubmit.transferCmdBuffer->endCommandBuffer() != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not end command buffer.");
+
+        return IFenceSP();
+    }
+
+    if (currentUploadSubmit.fence->resetFence() != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not reset fence.");
+
+        return IFenceSP();
+    }
+
+    VkSubmitInfo submitInfo{};
+
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+
+    submitInfo.waitSemaphoreCount = 0;
+    submitInfo.pWaitSemaphores = nullptr;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = currentUploadSubmit.transferCmdBuffer->getCommandBuffers();
+    submitInfo.signalSemaphoreCount = 0;
+    submitInfo.pSignalSemaphores = nullptr;
+
+    if (!currentUploadSubmit.acquireCmdBuffer.get())
+    {
+        if (transferQueue->submit(1, &submitInfo, currentUploadSubmit.fence->getFence()) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit queue.");
+
+            return IFenceSP();
+        }
+
+        submitCount++;
+    }
+    else
+    {
+        VkSemaphore semaphore = currentUploadSubmit.semaphore->getSemaphore();
+
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &semaphore;
+
+        if (transferQueue->submit(1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit queue.");
+
+            return IFenceSP();
+        }
+
+        submitCount++;
+
+        // Acquire the images on the context queue and transition them to the final layout.
+
+        if (currentUploadSubmit.acquireCmdBuffer->beginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, VK_FALSE, 0, 0) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not begin command buffer.");
+
+            return IFenceSP();
+        }
+
+        const VkCommandBuffer cmdBuffer = currentUploadSubmit.acquireCmdBuffer->getCommandBuffer();
+
+        for (auto& currentAcquire : currentUploadSubmit.allAcquires)
+        {
+            VkImageMemoryBarrier imageMemoryBarrier{};
+
+            imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+
+            imageMemoryBarrier.srcAccessMask = 0;
+            imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            imageMemoryBarrier.srcQueueFamilyIndex = transferQueue->getQueueFamilyIndex();
+            imageMemoryBarrier.dstQueueFamilyIndex = contextObject->getQueue()->getQueueFamilyIndex();
+            imageMemoryBarrier.image = currentAcquire.image->getImage();
+            imageMemoryBarrier.subresourceRange = currentAcquire.subresourceRange;
+
+            currentUploadSubmit.acquireCmdBuffer->cmdPipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
+
+            currentAcquire.image->cmdPipelineBarrier(cmdBuffer, currentAcquire.dstAccessMask, currentAcquire.newLayout, currentAcquire.subresourceRange);
+        }
+
+        if (currentUploadSubmit.acquireCmdBuffer->endCommandBuffer() != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not end command buffer.");
+
+            return IFenceSP();
+        }
+
+        VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        VkSubmitInfo acquireSubmitInfo{};
+
+        acquireSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+
+        acquireSubmitInfo.waitSemaphoreCount = 1;
+        acquireSubmitInfo.pWaitSemaphores = &semaphore;
+        acquireSubmitInfo.pWaitDstStageMask = &waitDstStageMask;
+        acquireSubmitInfo.commandBufferCount = 1;
+        acquireSubmitInfo.pCommandBuffers = currentUploadSubmit.acquireCmdBuffer->getCommandBuffers();
+        acquireSubmitInfo.signalSemaphoreCount = 0;
+        acquireSubmitInfo.pSignalSemaphores = nullptr;
+
+        if (contextObject->getQueue()->submit(1, &acquireSubmitInfo, currentUploadSubmit.fence->getFence()) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit queue.");
+
+            return IFenceSP();
+        }
+
+        submitCount++;
+    }
+
+    currentUploadSubmit.pending = VK_TRUE;
+
+    lastFence = currentUploadSubmit.fence;
+
+    currentSubmit = (currentSubmit + 1) % (uint32_t)allSubmits.size();
+
+    return lastFence;
+}
+
+const IFenceSP& ImageUploadBatch::getFence() const
+{
+    return lastFence;
+}
+
+VkBool32 ImageUploadBatch::isComplete()
+{
+    VkBool32 complete = !allSubmits[currentSubmit].recording;
+
+    for (auto& currentUploadSubmit : allSubmits)
+    {
+        if (currentUploadSubmit.pending)
+        {
+            if (currentUploadSubmit.fence->getStatus() == VK_SUCCESS)
+            {
+                recycleSubmit(currentUploadSubmit);
+            }
+            else
+            {
+                complete = VK_FALSE;
+            }
+        }
+    }
+
+    return complete;
+}
+
+VkBool32 ImageUploadBatch::waitIdle()
+{
+    if (allSubmits[currentSubmit].recording)
+    {
+        if (!submit().get())
+        {
+            return VK_FALSE;
+        }
+    }
+
+    while (waitOldestSubmit())
+    {
+        // Wait for all pending submits.
+    }
+
+    for (const auto& currentUploadSubmit : allSubmits)
+    {
+        if (currentUploadSubmit.pending)
+        {
+            return VK_FALSE;
+        }
+    }
+
+    return VK_TRUE;
+}
+
+uint64_t ImageUploadBatch::getImageCount() const
+{
+    return imageCount;
+}
+
+uint64_t ImageUploadBatch::getUploadBytes() const
+{
+    return uploadBytes;
+}
+
+uint64_t ImageUploadBatch::getSubmitCount() const
+{
+    return submitCount;
+}
+
+double ImageUploadBatch::getThroughput() const
+{
+    if (uploadBytes == 0 || completeTime <= startTime)
+    {
+        return 0.0;
+    }
+
+    return ((double)uploadBytes / (1024.0 * 1024.0)) / (completeTime - startTime);
+}
+
+void ImageUploadBatch::resetCounters()
+{
+    imageCount = 0;
+    uploadBytes = 0;
+    submitCount = 0;
+
+    startTime = 0.0;
+    completeTime = 0.0;
+}
+
+//
+// IDestroyable
+//
+
+void ImageUploadBatch::destroy()
+{
+    for (auto& currentUploadSubmit : allSubmits)
+    {
+        if (currentUploadSubmit.recording)
+        {
+            currentUploadSubmit.transferCmdBuffer->endCommandBuffer();
+
+            currentUploadSubmit.recording = VK_FALSE;
+        }
+
+        if (currentUploadSubmit.pending)
+        {
+            currentUploadSubmit.fence->waitForFence(UINT64_MAX);
+        }
+
+        recycleSubmit(currentUploadSubmit);
+
+        if (currentUploadSubmit.transferCmdBuffer.get())
+        {
+            currentUploadSubmit.transferCmdBuffer->destroy();
+        }
+
+        if (currentUploadSubmit.acquireCmdBuffer.get())
+        {
+            currentUploadSubmit.acquireCmdBuffer->destroy();
+        }
+
+        if (currentUploadSubmit.semaphore.get())
+        {
+            currentUploadSubmit.semaphore->destroy();
+        }
+
+        if (currentUploadSubmit.fence.get())
+        {
+            currentUploadSubmit.fence->destroy();
+        }
+    }
+
+    allSubmits.clear();
+
+    lastFence.reset();
+
+    if (transferCommandPool.get())
+    {
+        transferCommandPool->destroy();
+
+        transferCommandPool.reset();
+    }
+
+    if (acquireCommandPool.get())
+    {
+        acquireCommandPool->destroy();
+
+        acquireCommandPool.reset();
+    }
+
+    ringData = nullptr;
+
+    if (ringBuffer.get())
+    {
+        ringBuffer->destroy();
+
+        ringBuffer.reset();
+    }
+
+    if (ringDeviceMemory.get())
+    {
+        ringDeviceMemory->unmapMemory();
+
+        ringDeviceMemory->destroy();
+
+        ringDeviceMemory.reset();
+    }
+}
+
+} /* namespace vkts */
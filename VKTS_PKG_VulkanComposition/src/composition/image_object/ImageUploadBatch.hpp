@@ -0,0 +1,167 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IMAGEUPLOADBATCH_HPP_
+#define VKTS_IMAGEUPLOADBATCH_HPP_
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+namespace vkts
+{
+
+typedef struct ImageUploadAcquire_
+{
+    IImageSP image;
+    VkAccessFlags dstAccessMask;
+    VkImageLayout newLayout;
+    VkImageSubresourceRange subresourceRange;
+} ImageUploadAcquire;
+
+typedef struct ImageUploadSubmit_
+{
+    ICommandBuffersSP transferCmdBuffer;
+
+    // Only used, if the transfer queue is of another family than the context queue.
+    ICommandBuffersSP acquireCmdBuffer;
+    ISemaphoreSP semaphore;
+
+    IFenceSP fence;
+
+    VkBool32 recording;
+    VkBool32 pending;
+
+    // Start of the ring range used by this submit.
+    VkBool32 ringUsed;
+    VkDeviceSize ringBegin;
+
+    // Kept alive, until the fence is signaled.
+    SmartPointerVector<IImageSP> allImages;
+    SmartPointerVector<IBufferSP> allStageBuffers;
+    SmartPointerVector<IDeviceMemorySP> allStageDeviceMemories;
+
+    std::vector<ImageUploadAcquire> allAcquires;
+} ImageUploadSubmit;
+
+class ImageUploadBatch: public IImageUploadBatch
+{
+
+private:
+
+    const IContextObjectSP contextObject;
+
+    const IQueueSP transferQueue;
+
+    IBufferSP ringBuffer;
+
+    IDeviceMemorySP ringDeviceMemory;
+
+    uint8_t* ringData;
+
+    VkDeviceSize ringHead;
+
+    VkDeviceSize copyOffsetAlignment;
+
+    ICommandPoolSP transferCommandPool;
+
+    ICommandPoolSP acquireCommandPool;
+
+    std::vector<ImageUploadSubmit> allSubmits;
+
+    uint32_t currentSubmit;
+
+    IFenceSP lastFence;
+
+    uint64_t imageCount;
+    uint64_t uploadBytes;
+    uint64_t submitCount;
+
+    double startTime;
+    double completeTime;
+
+    VkBool32 getRingTail(VkDeviceSize& tail) const;
+
+    VkBool32 allocateRing(VkDeviceSize& offset, const VkDeviceSize size, const VkDeviceSize alignment);
+
+    VkBool32 allocateStageBuffer(IBufferSP& stageBuffer, IDeviceMemorySP& stageDeviceMemory, const VkDeviceSize size);
+
+    VkBool32 beginSubmit();
+
+    VkBool32 waitOldestSubmit();
+
+    void recycleSubmit(ImageUploadSubmit& submit);
+
+public:
+
+    ImageUploadBatch() = delete;
+    ImageUploadBatch(const IContextObjectSP& contextObject, const IQueueSP& transferQueue, const IBufferSP& ringBuffer, const IDeviceMemorySP& ringDeviceMemory, const ICommandPoolSP& transferCommandPool, const ICommandPoolSP& acquireCommandPool, const std::vector<ImageUploadSubmit>& allSubmits);
+    ImageUploadBatch(const ImageUploadBatch& other) = delete;
+    ImageUploadBatch(ImageUploadBatch&& other) = delete;
+    virtual ~ImageUploadBatch();
+
+    ImageUploadBatch& operator =(const ImageUploadBatch& other) = delete;
+    ImageUploadBatch& operator =(ImageUploadBatch && other) = delete;
+
+    //
+    // IImageUploadBatch
+    //
+
+    virtual const IContextObjectSP& getContextObject() const override;
+
+    virtual const IQueueSP& getTransferQueue() const override;
+
+    virtual VkDeviceSize getRingSize() const override;
+
+    virtual VkBool32 addImage(const IImageSP& image, const IImageDataSP& imageData, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange) override;
+
+    virtual IFenceSP submit() override;
+
+    virtual const IFenceSP& getFence() const override;
+
+    virtual VkBool32 isComplete() override;
+
+    virtual VkBool32 waitIdle() override;
+
+    virtual uint64_t getImageCount() const override;
+
+    virtual uint64_t getUploadBytes() const override;
+
+    virtual uint64_t getSubmitCount() const override;
+
+    virtual double getThroughput() const override;
+
+    virtual void resetCounters() override;
+
+    //
+    // IDestroyable
+    //
+
+    virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_IMAGEUPLOADBATCH_HPP_ */
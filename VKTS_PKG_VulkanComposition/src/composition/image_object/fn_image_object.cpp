@@ -74,13 +74,8 @@ static VkBool32 imageObjectUpload(const IDeviceMemorySP& deviceMemory, const IIm
     return VK_TRUE;
 }
 
-static VkBool32 imageObjectPrepare(IImageSP& image, IDeviceMemorySP& deviceMemory, const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags)
+static VkBool32 imageObjectPrepare(IImageSP& image, IDeviceMemorySP& deviceMemory, const IContextObjectSP& contextObject, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkMemoryPropertyFlags memoryPropertyFlags)
 {
-    if (!cmdBuffer.get())
-    {
-        return VK_FALSE;
-    }
-
     VkResult result;
 
     //
@@ -102,10 +97,7 @@ static VkBool32 imageObjectPrepare(IImageSP& image, IDeviceMemorySP& deviceMemor
 
     //
 
-    VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
-    contextObject->getPhysicalDevice()->getPhysicalDeviceMemoryProperties(physicalDeviceMemoryProperties);
-
-    deviceMemory = deviceMemoryCreate(contextObject->getDevice()->getDevice(), memoryRequirements, physicalDeviceMemoryProperties.memoryTypeCount, physicalDeviceMemoryProperties.memoryTypes, memoryPropertyFlags);
+    deviceMemory = contextObject->getDeviceMemoryAllocator()->allocate(memoryRequirements, memoryPropertyFlags, imageCreateInfo.tiling == VK_IMAGE_TILING_LINEAR);
 
     if (!deviceMemory.get())
     {
@@ -116,7 +108,7 @@ static VkBool32 imageObjectPrepare(IImageSP& image, IDeviceMemorySP& deviceMemor
 
     //
 
-    result = vkBindImageMemory(contextObject->getDevice()->getDevice(), image->getImage(), deviceMemory->getDeviceMemory(), 0);
+    result = vkBindImageMemory(contextObject->getDevice()->getDevice(), image->getImage(), deviceMemory->getDeviceMemory(), deviceMemory->getOffset());
 
     if (result != VK_SUCCESS)
     {
@@ -125,6 +117,21 @@ static VkBool32 imageObjectPrepare(IImageSP& image, IDeviceMemorySP& deviceMemor
         return VK_FALSE;
     }
 
+    return VK_TRUE;
+}
+
+static VkBool32 imageObjectPrepare(IImageSP& image, IDeviceMemorySP& deviceMemory, const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags)
+{
+    if (!cmdBuffer.get())
+    {
+        return VK_FALSE;
+    }
+
+    if (!imageObjectPrepare(image, deviceMemory, contextObject, imageCreateInfo, srcAccessMask, memoryPropertyFlags))
+    {
+        return VK_FALSE;
+    }
+
     //
 
     image->cmdPipelineBarrier(cmdBuffer->getCommandBuffer(), dstAccessMask, newLayout, subresourceRange);
@@ -156,10 +163,7 @@ static VkBool32 imageObjectPrepare(IBufferSP& buffer, IDeviceMemorySP& deviceMem
 
     //
 
-    VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
-    contextObject->getPhysicalDevice()->getPhysicalDeviceMemoryProperties(physicalDeviceMemoryProperties);
-
-    deviceMemory = deviceMemoryCreate(contextObject->getDevice()->getDevice(), memoryRequirements, physicalDeviceMemoryProperties.memoryTypeCount, physicalDeviceMemoryProperties.memoryTypes, memoryPropertyFlags);
+    deviceMemory = contextObject->getDeviceMemoryAllocator()->allocate(memoryRequirements, memoryPropertyFlags, VK_TRUE);
 
     if (!deviceMemory.get())
     {
@@ -170,7 +174,7 @@ static VkBool32 imageObjectPrepare(IBufferSP& buffer, IDeviceMemorySP& deviceMem
 
     //
 
-    result = vkBindBufferMemory(contextObject->getDevice()->getDevice(), buffer->getBuffer(), deviceMemory->getDeviceMemory(), 0);
+    result = vkBindBufferMemory(contextObject->getDevice()->getDevice(), buffer->getBuffer(), deviceMemory->getDeviceMemory(), deviceMemory->getOffset());
 
     if (result != VK_SUCCESS)
     {
@@ -374,6 +378,73 @@ IImageObjectSP VKTS_APIENTRY imageObjectCreate(IImageSP& stageImage, IBufferSP&
     return IImageObjectSP(newInstance);
 }
 
+IImageObjectSP VKTS_APIENTRY imageObjectCreate(const IImageUploadBatchSP& imageUploadBatch, const std::string& name, const IImageDataSP& imageData, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags)
+{
+    if (!imageUploadBatch.get() || !imageData.get())
+    {
+        return IImageObjectSP();
+    }
+
+    const auto& contextObject = imageUploadBatch->getContextObject();
+
+    //
+
+    IImageSP image;
+
+    IDeviceMemorySP deviceMemory;
+
+    //
+
+    if (!imageObjectPrepare(image, deviceMemory, contextObject, imageCreateInfo, srcAccessMask, memoryPropertyFlags))
+    {
+        return IImageObjectSP();
+    }
+
+    // Layout transitions are recorded by the batch.
+
+    if (!imageUploadBatch->addImage(image, imageData, dstAccessMask, newLayout, subresourceRange))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not upload image data.");
+
+        return IImageObjectSP();
+    }
+
+    //
+
+    VkImageViewCreateInfo imageViewCreateInfo{};
+
+    imageViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+
+    imageViewCreateInfo.flags = 0;
+    imageViewCreateInfo.image = image->getImage();
+    imageViewCreateInfo.viewType = (image->getFlags() & VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT) ? VK_IMAGE_VIEW_TYPE_CUBE : VK_IMAGE_VIEW_TYPE_2D;
+    imageViewCreateInfo.format = image->getFormat();
+    imageViewCreateInfo.components = {VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY};
+    imageViewCreateInfo.subresourceRange = subresourceRange;
+
+    auto imageView = imageViewCreate(contextObject->getDevice()->getDevice(), imageViewCreateInfo.flags, imageViewCreateInfo.image, imageViewCreateInfo.viewType, imageViewCreateInfo.format, imageViewCreateInfo.components, imageViewCreateInfo.subresourceRange);
+
+    if (!imageView.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create image view.");
+
+        return IImageObjectSP();
+    }
+
+    //
+
+    auto newInstance = new ImageObject(contextObject, name, imageData, image, imageView, deviceMemory);
+
+    if (!newInstance)
+    {
+        newInstance->destroy();
+
+        return IImageObjectSP();
+    }
+
+    return IImageObjectSP(newInstance);
+}
+
 IImageObjectSP VKTS_APIENTRY imageObjectCreate(const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const std::string& name, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags)
 {
     if (!cmdBuffer.get())
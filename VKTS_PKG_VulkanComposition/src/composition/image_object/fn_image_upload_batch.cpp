@@ -0,0 +1,174 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/vulkan/composition/vkts_composition.hpp>
+
+#include "ImageUploadBatch.hpp"
+
+namespace vkts
+{
+
+IImageUploadBatchSP VKTS_APIENTRY imageUploadBatchCreate(const IContextObjectSP& contextObject, const IQueueSP& transferQueue, const VkDeviceSize ringSize)
+{
+    if (!contextObject.get() || !contextObject->getDevice().get() || !contextObject->getQueue().get() || ringSize == 0)
+    {
+        return IImageUploadBatchSP();
+    }
+
+    const VkDevice device = contextObject->getDevice()->getDevice();
+
+    const IQueueSP& queue = transferQueue.get() ? transferQueue : contextObject->getQueue();
+
+    const VkBool32 ownershipTransfer = queue->getQueueFamilyIndex() != contextObject->getQueue()->getQueueFamilyIndex();
+
+    //
+
+    auto ringBuffer = bufferCreate(device, 0, ringSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, 0, nullptr);
+
+    if (!ringBuffer.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create buffer.");
+
+        return IImageUploadBatchSP();
+    }
+
+    VkMemoryRequirements memoryRequirements;
+
+    ringBuffer->getBufferMemoryRequirements(memoryRequirements);
+
+    auto ringDeviceMemory = contextObject->getDeviceMemoryAllocator()->allocate(memoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, VK_TRUE);
+
+    if (!ringDeviceMemory.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not allocate memory.");
+
+        return IImageUploadBatchSP();
+    }
+
+    if (ringBuffer->bindBufferMemory(ringDeviceMemory->getDeviceMemory(), ringDeviceMemory->getOffset()) != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not bind buffer memory.");
+
+        return IImageUploadBatchSP();
+    }
+
+    if (ringDeviceMemory->mapMemoryPersistent(0) != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not map memory.");
+
+        return IImageUploadBatchSP();
+    }
+
+    //
+
+    auto transferCommandPool = commandPoolCreate(device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, queue->getQueueFamilyIndex());
+
+    if (!transferCommandPool.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get command pool.");
+
+        return IImageUploadBatchSP();
+    }
+
+    ICommandPoolSP acquireCommandPool;
+
+    if (ownershipTransfer)
+    {
+        acquireCommandPool = commandPoolCreate(device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, contextObject->getQueue()->getQueueFamilyIndex());
+
+        if (!acquireCommandPool.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get command pool.");
+
+            return IImageUploadBatchSP();
+        }
+    }
+
+    //
+
+    std::vector<ImageUploadSubmit> allSubmits(VKTS_IMAGE_UPLOAD_SUBMITS);
+
+    for (auto& currentUploadSubmit : allSubmits)
+    {
+        currentUploadSubmit.transferCmdBuffer = commandBuffersCreate(device, transferCommandPool->getCmdPool(), VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1);
+
+        if (!currentUploadSubmit.transferCmdBuffer.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create command buffer.");
+
+            return IImageUploadBatchSP();
+        }
+
+        if (ownershipTransfer)
+        {
+            currentUploadSubmit.acquireCmdBuffer = commandBuffersCreate(device, acquireCommandPool->getCmdPool(), VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1);
+
+            if (!currentUploadSubmit.acquireCmdBuffer.get())
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create command buffer.");
+
+                return IImageUploadBatchSP();
+            }
+
+            currentUploadSubmit.semaphore = semaphoreCreate(device, 0);
+
+            if (!currentUploadSubmit.semaphore.get())
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create semaphore.");
+
+                return IImageUploadBatchSP();
+            }
+        }
+
+        currentUploadSubmit.fence = fenceCreate(device, 0);
+
+        if (!currentUploadSubmit.fence.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create fence.");
+
+            return IImageUploadBatchSP();
+        }
+
+        currentUploadSubmit.recording = VK_FALSE;
+        currentUploadSubmit.pending = VK_FALSE;
+
+        currentUploadSubmit.ringUsed = VK_FALSE;
+        currentUploadSubmit.ringBegin = 0;
+    }
+
+    //
+
+    auto newInstance = new ImageUploadBatch(contextObject, queue, ringBuffer, ringDeviceMemory, transferCommandPool, acquireCommandPool, allSubmits);
+
+    if (!newInstance)
+    {
+        return IImageUploadBatchSP();
+    }
+
+    return IImageUploadBatchSP(newInstance);
+}
+
+}
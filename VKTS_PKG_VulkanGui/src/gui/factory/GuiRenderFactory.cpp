@@ -173,23 +173,7 @@ IRenderFontSP GuiRenderFactory::createRenderFont(const IGuiManagerSP& guiManager
 
 	//
 
-    VkDescriptorPoolSize descriptorPoolSize{};
-
-    descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    descriptorPoolSize.descriptorCount = 1;
-
-    auto descriptorPool = descriptorPoolCreate(guiManager->getContextObject()->getDevice()->getDevice(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1, 1, &descriptorPoolSize);
-
-    if (!descriptorPool.get())
-    {
-    	return IRenderFontSP();
-    }
-
-	//
-
-    auto allDescriptorSetLayouts = descriptorSetLayout->getDescriptorSetLayout();
-
-	auto descriptorSets = descriptorSetsCreate(guiManager->getContextObject()->getDevice()->getDevice(), descriptorPool->getDescriptorPool(), 1, &allDescriptorSetLayouts);
+	auto descriptorSets = guiManager->getContextObject()->getDescriptorSetAllocator()->allocate(descriptorSetLayout);
 
     if (!descriptorSets.get())
     {
@@ -356,7 +340,6 @@ IRenderFontSP GuiRenderFactory::createRenderFont(const IGuiManagerSP& guiManager
 
     renderFont->setVertexBuffer(vertexBuffer);
     renderFont->setDescriptorSetLayout(descriptorSetLayout);
-    renderFont->setDescriptorPool(descriptorPool);
     renderFont->setDescriptorSets(descriptorSets);
     renderFont->setPipelineLayout(pipelineLayout);
     renderFont->setGraphicsPipeline(graphicsPipeline);
@@ -32,7 +32,7 @@ namespace vkts
 {
 
 RenderFont::RenderFont() :
-    IRenderFont(), vertexBuffer(nullptr), descriptorSetLayout(nullptr), descriptorPool(nullptr), descriptorSets(nullptr), pipelineLayout(nullptr), graphicsPipeline(nullptr)
+    IRenderFont(), vertexBuffer(nullptr), descriptorSetLayout(nullptr), descriptorSets(nullptr), pipelineLayout(nullptr), graphicsPipeline(nullptr)
 {
 }
 
@@ -50,11 +50,6 @@ void RenderFont::setDescriptorSetLayout(const IDescriptorSetLayoutSP& descriptor
 	this->descriptorSetLayout = descriptorSetLayout;
 }
 
-void RenderFont::setDescriptorPool(const IDescriptorPoolSP& descriptorPool)
-{
-	this->descriptorPool = descriptorPool;
-}
-
 void RenderFont::setDescriptorSets(const IDescriptorSetsSP& descriptorSets)
 {
 	this->descriptorSets = descriptorSets;
@@ -230,13 +225,6 @@ void RenderFont::destroy()
 		descriptorSets = IDescriptorSetsSP(nullptr);
 	}
 
-	if (descriptorPool.get())
-	{
-		descriptorPool->destroy();
-
-		descriptorPool = IDescriptorPoolSP(nullptr);
-	}
-
 	if (descriptorSetLayout.get())
 	{
 		descriptorSetLayout->destroy();
@@ -41,8 +41,6 @@ private:
 
 	IDescriptorSetLayoutSP descriptorSetLayout;
 
-	IDescriptorPoolSP descriptorPool;
-
 	IDescriptorSetsSP descriptorSets;
 
 	IPipelineLayoutSP pipelineLayout;
@@ -64,8 +62,6 @@ public:
 
 	void setDescriptorSetLayout(const IDescriptorSetLayoutSP& descriptorSetLayout);
 
-	void setDescriptorPool(const IDescriptorPoolSP& descriptorPool);
-
 	void setDescriptorSets(const IDescriptorSetsSP& descriptorSets);
 
 	void setPipelineLayout(const IPipelineLayoutSP& pipelineLayout);
@@ -32,6 +32,9 @@
 
 #define VKTS_MIN_IMAGE_SIZE 16u
 
+// Joint palettes are much larger than node transforms, so fewer armatures share one uniform buffer.
+#define VKTS_NODES_PER_ARMATURE 16u
+
 #define VKTS_PREFILTER_VERTEX_SHADER_NAME "shader/SPIR/V/prefilter.vert.spv"
 
 #define VKTS_LAMBERT_FRAGMENT_SHADER_NAME "shader/SPIR/V/prefilter_lambert.frag.spv"
@@ -40,8 +43,13 @@
 namespace vkts
 {
 
-SceneRenderFactory::SceneRenderFactory(const IDescriptorSetLayoutSP& descriptorSetLayout, const IRenderPassSP& renderPass, const IPipelineCacheSP& pipelineCache, const VkDeviceSize bufferCount) :
-	ISceneRenderFactory(), descriptorSetLayout(descriptorSetLayout), renderPass(renderPass), pipelineCache(pipelineCache), bufferCount(bufferCount)
+uint32_t SceneRenderFactory::getArmaturesPerUniformBuffer() const
+{
+	return glm::max(nodesPerUniformBuffer / VKTS_NODES_PER_ARMATURE, 1u);
+}
+
+SceneRenderFactory::SceneRenderFactory(const IDescriptorSetLayoutSP& descriptorSetLayout, const IRenderPassSP& renderPass, const IPipelineCacheSP& pipelineCache, const VkDeviceSize bufferCount, const uint32_t nodesPerUniformBuffer) :
+	ISceneRenderFactory(), descriptorSetLayout(descriptorSetLayout), renderPass(renderPass), pipelineCache(pipelineCache), bufferCount(bufferCount), nodesPerUniformBuffer(nodesPerUniformBuffer), transformUniformBufferPool(), jointsUniformBufferPool(), uniformBufferMutex()
 {
 }
 
@@ -80,35 +88,13 @@ VkBool32 SceneRenderFactory::preparePhongMaterial(const ISceneManagerSP& sceneMa
 		return VK_FALSE;
 	}
 
-	// Create all possibilities, even when not used.
-
-	VkDescriptorPoolSize descriptorPoolSize[3]{};
-
-	descriptorPoolSize[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-	descriptorPoolSize[0].descriptorCount = VKTS_BINDING_UNIFORM_BUFFER_COUNT;
-
-	descriptorPoolSize[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-	descriptorPoolSize[1].descriptorCount = VKTS_BINDING_UNIFORM_PHONG_BINDING_COUNT + 2;
-
-	descriptorPoolSize[2].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-	descriptorPoolSize[2].descriptorCount = VKTS_BINDING_STORAGE_IMAGE_COUNT;
-
 	for (uint32_t currentBuffer = 0; currentBuffer < (uint32_t)bufferCount; currentBuffer++)
 	{
-		auto descriptorPool = descriptorPoolCreate(sceneManager->getContextObject()->getDevice()->getDevice(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1, 3, descriptorPoolSize);
-
-		if (!descriptorPool.get())
-		{
-			return VK_FALSE;
-		}
-
-		phongMaterial->getRenderMaterial(currentBuffer)->setDescriptorPool(descriptorPool);
+		phongMaterial->getRenderMaterial(currentBuffer)->setDescriptorSetAllocator(sceneManager->getContextObject()->getDescriptorSetAllocator(), descriptorSetLayout);
 
 		//
 
-		auto allDescriptorSetLayouts = descriptorSetLayout->getDescriptorSetLayout();
-
-		auto descriptorSets = descriptorSetsCreate(sceneManager->getContextObject()->getDevice()->getDevice(), descriptorPool->getDescriptorPool(), 1, &allDescriptorSetLayouts);
+		auto descriptorSets = sceneManager->getContextObject()->getDescriptorSetAllocator()->allocate(descriptorSetLayout);
 
 		if (!descriptorSets.get())
 		{
@@ -245,34 +231,13 @@ VkBool32 SceneRenderFactory::prepareBSDFMaterial(const ISceneManagerSP& sceneMan
 
 	auto bsdfMaterial = subMesh->getBSDFMaterial();
 
-	// Create all possibilities, even when not used.
-
-	VkDescriptorPoolSize descriptorPoolSize[2]{};
-
-	descriptorPoolSize[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-	descriptorPoolSize[0].descriptorCount = 5;
-
-	descriptorPoolSize[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-	descriptorPoolSize[1].descriptorCount = 18;
-
 	for (uint32_t currentBuffer = 0; currentBuffer < (uint32_t)bufferCount; currentBuffer++)
 	{
-		auto descriptorPool = descriptorPoolCreate(sceneManager->getContextObject()->getDevice()->getDevice(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1, 2, descriptorPoolSize);
-
-		if (!descriptorPool.get())
-		{
-			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create descriptor pool.");
-
-			return VK_FALSE;
-		}
-
-		bsdfMaterial->getRenderMaterial(currentBuffer)->setDescriptorPool(descriptorPool);
+		bsdfMaterial->getRenderMaterial(currentBuffer)->setDescriptorSetAllocator(sceneManager->getContextObject()->getDescriptorSetAllocator(), descriptorSetLayout);
 
 		//
 
-		const auto allDescriptorSetLayouts = descriptorSetLayout->getDescriptorSetLayout();
-
-		auto descriptorSets = descriptorSetsCreate(sceneManager->getContextObject()->getDevice()->getDevice(), bsdfMaterial->getRenderMaterial(currentBuffer)->getDescriptorPool()->getDescriptorPool(), 1, &allDescriptorSetLayouts);
+		auto descriptorSets = sceneManager->getContextObject()->getDescriptorSetAllocator()->allocate(descriptorSetLayout);
 
 		if (!descriptorSets.get())
 		{
@@ -578,6 +543,48 @@ VkBool32 SceneRenderFactory::prepareBSDFMaterial(const ISceneManagerSP& sceneMan
 
 	subMesh->setGraphicsPipeline(pipeline);
 
+	// Instanced variant, if a vertex shader reading the transform per instance is available. Skinned sub meshes use the joints of their node.
+
+	if ((vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONES) == VKTS_VERTEX_BUFFER_TYPE_BONES)
+	{
+		return VK_TRUE;
+	}
+
+	auto instanceVertexShaderModule = sceneManager->useVertexShaderModule(vertexBufferType | VKTS_VERTEX_BUFFER_TYPE_INSTANCE_TRANSFORM);
+
+	if (!instanceVertexShaderModule.get())
+	{
+		return VK_TRUE;
+	}
+
+	gp.getPipelineShaderStageCreateInfo(0).module = instanceVertexShaderModule->getShaderModule();
+
+	gp.getVertexInputBindingDescription(1).binding = VKTS_BINDING_VERTEX_BUFFER_INSTANCE;
+	gp.getVertexInputBindingDescription(1).stride = 16 * sizeof(float);
+	gp.getVertexInputBindingDescription(1).inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+	// The columns of the transform matrix follow the vertex attributes.
+	for (uint32_t column = 0; column < 4; column++)
+	{
+		location++;
+
+		gp.getVertexInputAttributeDescription(location).location = location;
+		gp.getVertexInputAttributeDescription(location).binding = VKTS_BINDING_VERTEX_BUFFER_INSTANCE;
+		gp.getVertexInputAttributeDescription(location).format = VK_FORMAT_R32G32B32A32_SFLOAT;
+		gp.getVertexInputAttributeDescription(location).offset = column * 4 * sizeof(float);
+	}
+
+	auto instancePipeline = pipelineCreateGraphics(sceneManager->getContextObject()->getDevice()->getDevice(), pipelineCache, gp.getGraphicsPipelineCreateInfo(), vertexBufferType | VKTS_VERTEX_BUFFER_TYPE_INSTANCE_TRANSFORM);
+
+	if (!instancePipeline.get())
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create instance graphics pipeline.");
+
+		return VK_FALSE;
+	}
+
+	subMesh->setInstanceGraphicsPipeline(instancePipeline);
+
 	return VK_TRUE;
 }
 
@@ -591,18 +598,44 @@ VkBool32 SceneRenderFactory::prepareTransformUniformBuffer(const ISceneManagerSP
 	// mat3 in std140 consumes three vec4 columns.
 	VkDeviceSize size = alignmentGetSizeInBytes(16 * sizeof(float) + 12 * sizeof(float), 16);
 
-    auto transformUniformBuffer = createUniformBufferObject(sceneManager->getAssetManager(), size, bufferCount);
+	if (nodesPerUniformBuffer == 0)
+	{
+	    auto transformUniformBuffer = createUniformBufferObject(sceneManager->getAssetManager(), size, bufferCount);
 
-    if (!transformUniformBuffer.get())
-    {
-        return VK_FALSE;
-    }
+	    if (!transformUniformBuffer.get())
+	    {
+	        return VK_FALSE;
+	    }
 
-    //
+	    //
 
-    node->setTransformUniformBuffer(transformUniformBuffer);
+	    node->setTransformUniformBuffer(transformUniformBuffer, 0, transformUniformBuffer->getBuffer()->getSize() / transformUniformBuffer->getBufferCount());
 
-	return VK_TRUE;
+		return VK_TRUE;
+	}
+
+	// Each buffer contains the transforms of all nodes, so one frame is written linearly.
+	VkDeviceSize stride = sceneManager->getContextObject()->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(size);
+
+	IUniformBufferPoolSP currentUniformBufferPool;
+
+	{
+		std::lock_guard<std::mutex> uniformBufferLock(uniformBufferMutex);
+
+		if (!transformUniformBufferPool.get())
+		{
+			transformUniformBufferPool = uniformBufferPoolCreate(sceneManager->getContextObject(), stride, nodesPerUniformBuffer, bufferCount);
+
+		    if (!transformUniformBufferPool.get())
+		    {
+		        return VK_FALSE;
+		    }
+		}
+
+		currentUniformBufferPool = transformUniformBufferPool;
+	}
+
+    return node->allocateTransformUniformBuffer(currentUniformBufferPool);
 }
 
 VkDeviceSize SceneRenderFactory::getTransformUniformBufferAlignmentSize(const ISceneManagerSP& sceneManager) const
@@ -614,9 +647,15 @@ VkDeviceSize SceneRenderFactory::getTransformUniformBufferAlignmentSize(const IS
 
 	auto size = alignmentGetSizeInBytes(16 * sizeof(float) + 12 * sizeof(float), 16);
 
-	//
+	auto stride = sceneManager->getContextObject()->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(size);
 
-	return sceneManager->getContextObject()->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(size);
+	if (nodesPerUniformBuffer == 0)
+	{
+		return stride;
+	}
+
+	// Stride of one buffer containing all shared nodes.
+	return sceneManager->getContextObject()->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(stride * nodesPerUniformBuffer);
 }
 
 VkBool32 SceneRenderFactory::prepareJointsUniformBuffer(const ISceneManagerSP& sceneManager, const INodeSP& node, const int32_t joints)
@@ -629,16 +668,41 @@ VkBool32 SceneRenderFactory::prepareJointsUniformBuffer(const ISceneManagerSP& s
     // mat3 in std140 consumes three vec4 columns.
 	VkDeviceSize size = alignmentGetSizeInBytes(16 * sizeof(float) * (VKTS_MAX_JOINTS + 1) + 12 * sizeof(float) * (VKTS_MAX_JOINTS + 1), 16);
 
-    auto jointsUniformBuffer = createUniformBufferObject(sceneManager->getAssetManager(), size, bufferCount);
+	if (nodesPerUniformBuffer == 0)
+	{
+	    auto jointsUniformBuffer = createUniformBufferObject(sceneManager->getAssetManager(), size, bufferCount);
 
-    if (!jointsUniformBuffer.get())
-    {
-        return VK_FALSE;
-    }
+	    if (!jointsUniformBuffer.get())
+	    {
+	        return VK_FALSE;
+	    }
 
-    node->setJointsUniformBuffer(joints, jointsUniformBuffer);
+	    node->setJointsUniformBuffer(joints, jointsUniformBuffer, 0, jointsUniformBuffer->getBuffer()->getSize() / jointsUniformBuffer->getBufferCount());
 
-	return VK_TRUE;
+		return VK_TRUE;
+	}
+
+	VkDeviceSize stride = sceneManager->getContextObject()->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(size);
+
+	IUniformBufferPoolSP currentUniformBufferPool;
+
+	{
+		std::lock_guard<std::mutex> uniformBufferLock(uniformBufferMutex);
+
+		if (!jointsUniformBufferPool.get())
+		{
+			jointsUniformBufferPool = uniformBufferPoolCreate(sceneManager->getContextObject(), stride, getArmaturesPerUniformBuffer(), bufferCount);
+
+		    if (!jointsUniformBufferPool.get())
+		    {
+		        return VK_FALSE;
+		    }
+		}
+
+		currentUniformBufferPool = jointsUniformBufferPool;
+	}
+
+    return node->allocateJointsUniformBuffer(joints, currentUniformBufferPool);
 }
 
 VkDeviceSize SceneRenderFactory::getJointsUniformBufferAlignmentSize(const ISceneManagerSP& sceneManager) const
@@ -650,9 +714,15 @@ VkDeviceSize SceneRenderFactory::getJointsUniformBufferAlignmentSize(const IScen
 
 	auto size = alignmentGetSizeInBytes(16 * sizeof(float) * (VKTS_MAX_JOINTS + 1) + 12 * sizeof(float) * (VKTS_MAX_JOINTS + 1), 16);
 
-	//
+	auto stride = sceneManager->getContextObject()->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(size);
 
-	return sceneManager->getContextObject()->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(size);
+	if (nodesPerUniformBuffer == 0)
+	{
+		return stride;
+	}
+
+	// Stride of one buffer containing all shared armatures.
+	return sceneManager->getContextObject()->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(stride * getArmaturesPerUniformBuffer());
 }
 
 SmartPointerVector<IImageDataSP> SceneRenderFactory::prefilter(const ISceneManagerSP& sceneManager, const IImageDataSP& sourceImage, const uint32_t samples, const std::string& name, const VkBool32 useLambert) const
@@ -791,22 +861,7 @@ SmartPointerVector<IImageDataSP> SceneRenderFactory::prefilter(const ISceneManag
 	}
 
 
-    VkDescriptorPoolSize descriptorPoolSize[1]{};
-
-    descriptorPoolSize[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    descriptorPoolSize[0].descriptorCount = 1;
-
-    auto descriptorPool = descriptorPoolCreate(sceneManager->getContextObject()->getDevice()->getDevice(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1, 1, descriptorPoolSize);
-
-    if (!descriptorPool.get())
-    {
-    	return SmartPointerVector<IImageDataSP>();
-    }
-
-
-	const VkDescriptorSetLayout currentDescriptorSetLayout = descriptorSetLayout->getDescriptorSetLayout();
-
-	auto descriptorSet = descriptorSetsCreate(sceneManager->getContextObject()->getDevice()->getDevice(), descriptorPool->getDescriptorPool(), 1, &currentDescriptorSetLayout);
+	auto descriptorSet = sceneManager->getContextObject()->getDescriptorSetAllocator()->allocate(descriptorSetLayout);
 
 	if (!descriptorSet.get())
 	{
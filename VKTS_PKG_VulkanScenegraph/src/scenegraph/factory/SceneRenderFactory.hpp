@@ -45,13 +45,24 @@ private:
 
     const VkDeviceSize bufferCount;
 
+    const uint32_t nodesPerUniformBuffer;
+
+    // Slots of the shared uniform buffers. Created with the first node, as the alignment depends on the device.
+    IUniformBufferPoolSP transformUniformBufferPool;
+
+    IUniformBufferPoolSP jointsUniformBufferPool;
+
+    std::mutex uniformBufferMutex;
+
+    uint32_t getArmaturesPerUniformBuffer() const;
+
     SmartPointerVector<IImageDataSP> prefilter(const ISceneManagerSP& sceneManager, const IImageDataSP& sourceImage, const uint32_t samples, const std::string& name, const VkBool32 useLambert) const;
 
 public:
 
 	SceneRenderFactory() = delete;
 
-	SceneRenderFactory(const IDescriptorSetLayoutSP& descriptorSetLayout, const IRenderPassSP& renderPass, const IPipelineCacheSP& pipelineCache, const VkDeviceSize bufferCount);
+	SceneRenderFactory(const IDescriptorSetLayoutSP& descriptorSetLayout, const IRenderPassSP& renderPass, const IPipelineCacheSP& pipelineCache, const VkDeviceSize bufferCount, const uint32_t nodesPerUniformBuffer);
 
     virtual ~SceneRenderFactory();
 
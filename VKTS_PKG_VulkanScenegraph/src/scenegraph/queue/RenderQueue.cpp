@@ -0,0 +1,477 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "RenderQueue.hpp"
+
+// Bits of the sort key. Larger identifiers share the highest value, so only the grouping gets worse.
+#define VKTS_RENDER_QUEUE_DEPTH_BITS 20
+#define VKTS_RENDER_QUEUE_PIPELINE_BITS 12
+#define VKTS_RENDER_QUEUE_VERTEX_BUFFER_BITS 14
+#define VKTS_RENDER_QUEUE_DESCRIPTOR_SET_BITS 18
+
+#define VKTS_RENDER_QUEUE_RADIX_BITS 8
+#define VKTS_RENDER_QUEUE_RADIX_PASSES (64 / VKTS_RENDER_QUEUE_RADIX_BITS)
+#define VKTS_RENDER_QUEUE_RADIX_SIZE (1 << VKTS_RENDER_QUEUE_RADIX_BITS)
+
+namespace vkts
+{
+
+uint32_t RenderQueue::getId(std::map<uint64_t, uint32_t>& allIds, const uint64_t handle, const uint32_t bits)
+{
+	auto currentId = allIds.find(handle);
+
+	if (currentId != allIds.end())
+	{
+		return currentId->second;
+	}
+
+	uint32_t id = glm::min((uint32_t)allIds.size(), (1u << bits) - 1u);
+
+	allIds[handle] = id;
+
+	return id;
+}
+
+uint32_t RenderQueue::getDepthBits(const float depth)
+{
+	// Also catches NaN.
+	if (!(depth > 0.0f))
+	{
+		return 0;
+	}
+
+	// The bits of positive floats have the same order as the values.
+	uint32_t bits;
+
+	memcpy(&bits, &depth, sizeof(uint32_t));
+
+	return bits >> (31 - VKTS_RENDER_QUEUE_DEPTH_BITS);
+}
+
+uint64_t RenderQueue::buildKey(const VkTsDrawPacket& drawPacket)
+{
+	uint64_t pipelineId = (uint64_t)getId(allPipelineIds, (uint64_t)drawPacket.pipeline, VKTS_RENDER_QUEUE_PIPELINE_BITS);
+	uint64_t vertexBufferId = (uint64_t)getId(allVertexBufferIds, (uint64_t)drawPacket.vertexBuffer, VKTS_RENDER_QUEUE_VERTEX_BUFFER_BITS);
+	// Instances have their own descriptor sets, so they are grouped by their key instead.
+	uint64_t descriptorSetId = (uint64_t)getId(allDescriptorSetIds, drawPacket.instancePipeline != VK_NULL_HANDLE ? drawPacket.instanceKey : (uint64_t)drawPacket.descriptorSet, VKTS_RENDER_QUEUE_DESCRIPTOR_SET_BITS);
+
+	uint64_t depthBits = (uint64_t)getDepthBits(drawPacket.depth);
+
+	uint64_t state = (pipelineId << (VKTS_RENDER_QUEUE_VERTEX_BUFFER_BITS + VKTS_RENDER_QUEUE_DESCRIPTOR_SET_BITS)) | (vertexBufferId << VKTS_RENDER_QUEUE_DESCRIPTOR_SET_BITS) | descriptorSetId;
+
+	if (sortMode == VKTS_RENDER_QUEUE_SORT_BACK_TO_FRONT)
+	{
+		// Far packets first, state only breaks ties.
+		uint64_t farDepthBits = ((1ull << VKTS_RENDER_QUEUE_DEPTH_BITS) - 1ull) - depthBits;
+
+		return (farDepthBits << (64 - VKTS_RENDER_QUEUE_DEPTH_BITS)) | state;
+	}
+
+	// Grouped by state, near packets first.
+	return (state << VKTS_RENDER_QUEUE_DEPTH_BITS) | depthBits;
+}
+
+VkBool32 RenderQueue::isSameInstance(const VkTsDrawPacket& drawPacket, const VkTsDrawPacket& otherDrawPacket)
+{
+	if (drawPacket.instancePipeline == VK_NULL_HANDLE || drawPacket.instanceKey == 0)
+	{
+		return VK_FALSE;
+	}
+
+	if (drawPacket.instanceKey != otherDrawPacket.instanceKey || drawPacket.instancePipeline != otherDrawPacket.instancePipeline || drawPacket.layout != otherDrawPacket.layout)
+	{
+		return VK_FALSE;
+	}
+
+	if (drawPacket.vertexBuffer != otherDrawPacket.vertexBuffer || drawPacket.indexBuffer != otherDrawPacket.indexBuffer || drawPacket.firstIndex != otherDrawPacket.firstIndex || drawPacket.indexCount != otherDrawPacket.indexCount)
+	{
+		return VK_FALSE;
+	}
+
+	// Push constants are recorded once per draw, so they have to be the same for all instances.
+
+	if (drawPacket.pushConstantRangeCount != otherDrawPacket.pushConstantRangeCount || memcmp(drawPacket.pushConstantRanges, otherDrawPacket.pushConstantRanges, sizeof(VkPushConstantRange) * drawPacket.pushConstantRangeCount) != 0)
+	{
+		return VK_FALSE;
+	}
+
+	for (uint32_t i = 0; i < drawPacket.pushConstantRangeCount; i++)
+	{
+		const VkPushConstantRange& pushConstantRange = drawPacket.pushConstantRanges[i];
+
+		if (memcmp(&drawPacket.pushConstants[pushConstantRange.offset], &otherDrawPacket.pushConstants[pushConstantRange.offset], pushConstantRange.size) != 0)
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
+
+RenderQueue::RenderQueue(const VkTsRenderQueueSort sortMode) :
+	IRenderQueue(), sortMode(sortMode), viewMatrix(1.0f), allDrawPackets(), allSortEntries(), allScratchEntries(), allPipelineIds(), allVertexBufferIds(), allDescriptorSetIds(), instanceBuffer(), instanceBufferOffset(0), allInstanceTransforms(), allInstances(), allBatchEnds()
+{
+}
+
+RenderQueue::~RenderQueue()
+{
+}
+
+//
+// IRenderQueue
+//
+
+VkTsRenderQueueSort RenderQueue::getSortMode() const
+{
+	return sortMode;
+}
+
+void RenderQueue::setSortMode(const VkTsRenderQueueSort sortMode)
+{
+	this->sortMode = sortMode;
+}
+
+const glm::mat4& RenderQueue::getViewMatrix() const
+{
+	return viewMatrix;
+}
+
+void RenderQueue::setViewMatrix(const glm::mat4& viewMatrix)
+{
+	this->viewMatrix = viewMatrix;
+}
+
+uint32_t RenderQueue::getNumberPackets() const
+{
+	return (uint32_t)allDrawPackets.size();
+}
+
+const VkTsDrawPacket& RenderQueue::getPacket(const uint32_t index) const
+{
+	return allDrawPackets[allSortEntries[index].index];
+}
+
+void RenderQueue::reset()
+{
+	allDrawPackets.clear();
+
+	allSortEntries.clear();
+
+	allPipelineIds.clear();
+	allVertexBufferIds.clear();
+	allDescriptorSetIds.clear();
+
+	instanceBuffer = IBufferObjectSP();
+	instanceBufferOffset = 0;
+
+	allInstances.clear();
+}
+
+void RenderQueue::addPacket(const VkTsDrawPacket& drawPacket)
+{
+	SortEntry sortEntry{buildKey(drawPacket), (uint32_t)allDrawPackets.size()};
+
+	allDrawPackets.push_back(drawPacket);
+
+	allDrawPackets.back().key = sortEntry.key;
+
+	allSortEntries.push_back(sortEntry);
+}
+
+void RenderQueue::sort()
+{
+	// The batches depend on the order.
+	allInstances.clear();
+
+	const uint32_t numberEntries = (uint32_t)allSortEntries.size();
+
+	if (numberEntries < 2)
+	{
+		return;
+	}
+
+	allScratchEntries.resize(numberEntries);
+
+	// Histograms of all digits in one pass.
+
+	std::vector<uint32_t> allCounts(VKTS_RENDER_QUEUE_RADIX_PASSES * VKTS_RENDER_QUEUE_RADIX_SIZE, 0);
+
+	for (uint32_t i = 0; i < numberEntries; i++)
+	{
+		uint64_t key = allSortEntries[i].key;
+
+		for (uint32_t pass = 0; pass < VKTS_RENDER_QUEUE_RADIX_PASSES; pass++)
+		{
+			allCounts[pass * VKTS_RENDER_QUEUE_RADIX_SIZE + (uint32_t)((key >> (pass * VKTS_RENDER_QUEUE_RADIX_BITS)) & (VKTS_RENDER_QUEUE_RADIX_SIZE - 1))]++;
+		}
+	}
+
+	// Least significant digit first, stable scatter.
+
+	SortEntry* source = &allSortEntries[0];
+	SortEntry* destination = &allScratchEntries[0];
+
+	for (uint32_t pass = 0; pass < VKTS_RENDER_QUEUE_RADIX_PASSES; pass++)
+	{
+		uint32_t* counts = &allCounts[pass * VKTS_RENDER_QUEUE_RADIX_SIZE];
+
+		uint32_t shift = pass * VKTS_RENDER_QUEUE_RADIX_BITS;
+
+		// All keys have the same digit, e.g. unused high identifier bits.
+		if (counts[(uint32_t)((source[0].key >> shift) & (VKTS_RENDER_QUEUE_RADIX_SIZE - 1))] == numberEntries)
+		{
+			continue;
+		}
+
+		uint32_t offset = 0;
+
+		for (uint32_t digit = 0; digit < VKTS_RENDER_QUEUE_RADIX_SIZE; digit++)
+		{
+			uint32_t count = counts[digit];
+
+			counts[digit] = offset;
+
+			offset += count;
+		}
+
+		for (uint32_t i = 0; i < numberEntries; i++)
+		{
+			destination[counts[(uint32_t)((source[i].key >> shift) & (VKTS_RENDER_QUEUE_RADIX_SIZE - 1))]++] = source[i];
+		}
+
+		std::swap(source, destination);
+	}
+
+	if (source != &allSortEntries[0])
+	{
+		allSortEntries.swap(allScratchEntries);
+	}
+}
+
+VkBool32 RenderQueue::instance(const IBufferObjectSP& instanceBuffer, const VkDeviceSize instanceBufferOffset)
+{
+	const uint32_t numberEntries = (uint32_t)allSortEntries.size();
+
+	this->instanceBuffer = IBufferObjectSP();
+	this->instanceBufferOffset = 0;
+
+	allInstances.clear();
+
+	if (!instanceBuffer.get() || !instanceBuffer->getBuffer().get())
+	{
+		return VK_FALSE;
+	}
+
+	VkDeviceSize bufferSize = instanceBuffer->getBuffer()->getSize();
+
+	uint32_t maxInstances = instanceBufferOffset < bufferSize ? (uint32_t)glm::min((bufferSize - instanceBufferOffset) / (VkDeviceSize)sizeof(glm::mat4), (VkDeviceSize)UINT32_MAX) : 0;
+
+	allInstanceTransforms.clear();
+
+	allInstances.resize(numberEntries, UINT32_MAX);
+	allBatchEnds.resize(numberEntries);
+
+	uint32_t begin = 0;
+
+	while (begin < numberEntries)
+	{
+		const VkTsDrawPacket& firstPacket = allDrawPackets[allSortEntries[begin].index];
+
+		uint32_t end = begin + 1;
+
+		while (end < numberEntries && isSameInstance(firstPacket, allDrawPackets[allSortEntries[end].index]))
+		{
+			end++;
+		}
+
+		// Single packets and batches exceeding the buffer are drawn as before.
+		if (end - begin > 1 && (uint32_t)allInstanceTransforms.size() + (end - begin) <= maxInstances)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				allInstances[i] = (uint32_t)allInstanceTransforms.size();
+				allBatchEnds[i] = end;
+
+				allInstanceTransforms.push_back(allDrawPackets[allSortEntries[i].index].transformMatrix);
+			}
+		}
+
+		begin = end;
+	}
+
+	if (allInstanceTransforms.size() > 0)
+	{
+		if (!instanceBuffer->upload((uint32_t)instanceBufferOffset, 0, &allInstanceTransforms[0], (uint32_t)(sizeof(glm::mat4) * allInstanceTransforms.size())))
+		{
+			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not upload instance transforms");
+
+			allInstances.clear();
+
+			return VK_FALSE;
+		}
+	}
+
+	this->instanceBuffer = instanceBuffer;
+	this->instanceBufferOffset = instanceBufferOffset;
+
+	return VK_TRUE;
+}
+
+void RenderQueue::record(const ICommandBuffersSP& cmdBuffer, VkTsRenderQueueStatistics& statistics, const uint32_t packetOffset, const uint32_t packetCount) const
+{
+	if (!cmdBuffer.get())
+	{
+		return;
+	}
+
+	const uint32_t numberEntries = (uint32_t)allSortEntries.size();
+
+	if (packetOffset >= numberEntries)
+	{
+		return;
+	}
+
+	const uint32_t packetLimit = packetOffset + glm::min(packetCount, numberEntries - packetOffset);
+
+	VkCommandBuffer commandBuffer = cmdBuffer->getCommandBuffer(0);
+
+	const VkBool32 instanced = instanceBuffer.get() && (uint32_t)allInstances.size() == numberEntries;
+
+	// Nothing is bound at the beginning of a range, as it might be recorded into its own command buffer.
+	const VkTsDrawPacket* lastPacket = nullptr;
+
+	VkPipeline lastPipeline = VK_NULL_HANDLE;
+
+	VkBool32 instanceBufferBound = VK_FALSE;
+
+	VkDeviceSize offsets[1] = {0};
+
+	uint32_t i = packetOffset;
+
+	while (i < packetLimit)
+	{
+		const VkTsDrawPacket& currentPacket = allDrawPackets[allSortEntries[i].index];
+
+		// A batch split by the range continues with the first instance of the range.
+
+		VkBool32 instancedDraw = VK_FALSE;
+
+		uint32_t instanceCount = 1;
+		uint32_t firstInstance = 0;
+
+		VkPipeline currentPipeline = currentPacket.pipeline;
+
+		if (instanced && allInstances[i] != UINT32_MAX)
+		{
+			instancedDraw = VK_TRUE;
+
+			instanceCount = glm::min(allBatchEnds[i], packetLimit) - i;
+			firstInstance = allInstances[i];
+
+			currentPipeline = currentPacket.instancePipeline;
+
+			if (!instanceBufferBound)
+			{
+				VkBuffer buffer = instanceBuffer->getBuffer()->getBuffer();
+
+				vkCmdBindVertexBuffers(commandBuffer, VKTS_BINDING_VERTEX_BUFFER_INSTANCE, 1, &buffer, &instanceBufferOffset);
+
+				instanceBufferBound = VK_TRUE;
+			}
+		}
+
+		if (!lastPacket || lastPipeline != currentPipeline)
+		{
+			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, currentPipeline);
+
+			statistics.pipelineBindCount++;
+		}
+		else
+		{
+			statistics.pipelineBindsAvoided++;
+		}
+
+		// Bound descriptor sets stay valid for pipelines with the same layout.
+		if (!lastPacket || lastPacket->layout != currentPacket.layout || lastPacket->descriptorSet != currentPacket.descriptorSet || lastPacket->dynamicOffsetCount != currentPacket.dynamicOffsetCount || memcmp(lastPacket->dynamicOffsets, currentPacket.dynamicOffsets, sizeof(uint32_t) * currentPacket.dynamicOffsetCount) != 0)
+		{
+			vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, currentPacket.layout, 0, 1, &currentPacket.descriptorSet, currentPacket.dynamicOffsetCount, currentPacket.dynamicOffsetCount > 0 ? currentPacket.dynamicOffsets : nullptr);
+
+			statistics.descriptorSetBindCount++;
+		}
+		else
+		{
+			statistics.descriptorSetBindsAvoided++;
+		}
+
+		if (!lastPacket || lastPacket->indexBuffer != currentPacket.indexBuffer)
+		{
+			vkCmdBindIndexBuffer(commandBuffer, currentPacket.indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+
+			statistics.indexBufferBindCount++;
+		}
+		else
+		{
+			statistics.indexBufferBindsAvoided++;
+		}
+
+		if (!lastPacket || lastPacket->vertexBuffer != currentPacket.vertexBuffer)
+		{
+			vkCmdBindVertexBuffers(commandBuffer, 0, 1, &currentPacket.vertexBuffer, offsets);
+
+			statistics.vertexBufferBindCount++;
+		}
+		else
+		{
+			statistics.vertexBufferBindsAvoided++;
+		}
+
+		// Push constants are per packet and always recorded.
+		for (uint32_t k = 0; k < currentPacket.pushConstantRangeCount; k++)
+		{
+			const VkPushConstantRange& pushConstantRange = currentPacket.pushConstantRanges[k];
+
+			vkCmdPushConstants(commandBuffer, currentPacket.layout, pushConstantRange.stageFlags, pushConstantRange.offset, pushConstantRange.size, &currentPacket.pushConstants[pushConstantRange.offset]);
+		}
+
+		vkCmdDrawIndexed(commandBuffer, currentPacket.indexCount, instanceCount, currentPacket.firstIndex, 0, firstInstance);
+
+		statistics.drawCount++;
+
+		if (instancedDraw)
+		{
+			statistics.instancedDrawCount++;
+			statistics.instanceCount += instanceCount;
+		}
+
+		lastPacket = &currentPacket;
+
+		lastPipeline = currentPipeline;
+
+		i += instanceCount;
+	}
+}
+
+} /* namespace vkts */
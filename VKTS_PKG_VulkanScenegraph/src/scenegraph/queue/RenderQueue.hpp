@@ -0,0 +1,121 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_RENDERQUEUE_HPP_
+#define VKTS_RENDERQUEUE_HPP_
+
+#include <vkts/vulkan/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+class RenderQueue: public IRenderQueue
+{
+
+private:
+
+	typedef struct SortEntry_
+	{
+		uint64_t key;
+		uint32_t index;
+	} SortEntry;
+
+	VkTsRenderQueueSort sortMode;
+
+	glm::mat4 viewMatrix;
+
+	std::vector<VkTsDrawPacket> allDrawPackets;
+
+	// Packet indices, in recording order after sorting.
+
+	std::vector<SortEntry> allSortEntries;
+	std::vector<SortEntry> allScratchEntries;
+
+	// Small identifiers of the Vulkan handles, assigned in collection order.
+
+	std::map<uint64_t, uint32_t> allPipelineIds;
+	std::map<uint64_t, uint32_t> allVertexBufferIds;
+	std::map<uint64_t, uint32_t> allDescriptorSetIds;
+
+	// Instanced draws. For each sorted packet the index of its transform in the instance buffer and the end of its batch.
+
+	IBufferObjectSP instanceBuffer;
+	VkDeviceSize instanceBufferOffset;
+
+	std::vector<glm::mat4> allInstanceTransforms;
+	std::vector<uint32_t> allInstances;
+	std::vector<uint32_t> allBatchEnds;
+
+	static uint32_t getId(std::map<uint64_t, uint32_t>& allIds, const uint64_t handle, const uint32_t bits);
+
+	static uint32_t getDepthBits(const float depth);
+
+	uint64_t buildKey(const VkTsDrawPacket& drawPacket);
+
+	static VkBool32 isSameInstance(const VkTsDrawPacket& drawPacket, const VkTsDrawPacket& otherDrawPacket);
+
+public:
+
+	RenderQueue() = delete;
+	explicit RenderQueue(const VkTsRenderQueueSort sortMode);
+	RenderQueue(const RenderQueue& other) = delete;
+	RenderQueue(RenderQueue&& other) = delete;
+    virtual ~RenderQueue();
+
+    RenderQueue& operator =(const RenderQueue& other) = delete;
+    RenderQueue& operator =(RenderQueue && other) = delete;
+
+    //
+    // IRenderQueue
+    //
+
+    virtual VkTsRenderQueueSort getSortMode() const override;
+
+    virtual void setSortMode(const VkTsRenderQueueSort sortMode) override;
+
+    virtual const glm::mat4& getViewMatrix() const override;
+
+    virtual void setViewMatrix(const glm::mat4& viewMatrix) override;
+
+    virtual uint32_t getNumberPackets() const override;
+
+    virtual const VkTsDrawPacket& getPacket(const uint32_t index) const override;
+
+    virtual void reset() override;
+
+    virtual void addPacket(const VkTsDrawPacket& drawPacket) override;
+
+    virtual void sort() override;
+
+    virtual VkBool32 instance(const IBufferObjectSP& instanceBuffer, const VkDeviceSize instanceBufferOffset = 0) override;
+
+    virtual void record(const ICommandBuffersSP& cmdBuffer, VkTsRenderQueueStatistics& statistics, const uint32_t packetOffset = 0, const uint32_t packetCount = UINT32_MAX) const override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_RENDERQUEUE_HPP_ */
@@ -29,70 +29,76 @@
 namespace vkts
 {
 
-IDescriptorSetsSP RenderMaterial::createDescriptorSetsByName(const std::string& nodeName)
+IDescriptorSetsSP RenderMaterial::createDescriptorSetsByKey(const std::string& descriptorSetsKey)
 {
-	if (!descriptorPool.get() || !descriptorSets.get())
+	if (!descriptorSetAllocator.get() || !descriptorSets.get())
 	{
 		return IDescriptorSetsSP();
 	}
 
-	if (allDescriptorSets.contains(nodeName))
+	if (allDescriptorSets.contains(descriptorSetsKey))
 	{
-		return allDescriptorSets[nodeName];
+		return allDescriptorSets[descriptorSetsKey];
 	}
 
 	//
 
-	if (this->nodeName == "")
+	if (this->descriptorSetsKey == "")
 	{
-		this->nodeName = nodeName;
+		this->descriptorSetsKey = descriptorSetsKey;
 
-		allDescriptorPools[nodeName] = descriptorPool;
-
-		allDescriptorSets[nodeName] = descriptorSets;
-
-		allBindingPresent[nodeName].clear();
+		allDescriptorSets[descriptorSetsKey] = descriptorSets;
 
 		return descriptorSets;
 	}
 
 	//
 
-	auto currentDescriptorPool = descriptorPoolCreate(descriptorPool->getDevice(), descriptorPool->getFlags(), descriptorPool->getMaxSets(), descriptorPool->getPoolSizeCount(), descriptorPool->getPoolSizes());
-
-    if (!currentDescriptorPool.get())
-    {
-        return IDescriptorSetsSP();
-    }
-
-	auto currentDescriptorSets = descriptorSetsCreate(currentDescriptorPool->getDevice(), currentDescriptorPool->getDescriptorPool(), descriptorSets->getDescriptorSetCount(), descriptorSets->getSetLayouts());
+	auto currentDescriptorSets = descriptorSetAllocator->allocate(descriptorSetLayout);
 
     if (!currentDescriptorSets.get())
     {
         return IDescriptorSetsSP();
     }
 
-    allDescriptorPools[nodeName] = currentDescriptorPool;
-
-    allDescriptorSets[nodeName] = currentDescriptorSets;
-
-    allBindingPresent[nodeName].clear();
+    allDescriptorSets[descriptorSetsKey] = currentDescriptorSets;
 
     //
 
-    return allDescriptorSets[nodeName];
+    return allDescriptorSets[descriptorSetsKey];
 }
 
 IDescriptorSetsSP RenderMaterial::getDescriptorSetsByName(const std::string& nodeName) const
 {
-	if (allDescriptorSets.contains(nodeName))
+	auto currentKey = allDescriptorSetsKeys.find(nodeName);
+
+	if (currentKey != allDescriptorSetsKeys.end() && allDescriptorSets.contains(currentKey->second))
 	{
-		return allDescriptorSets[nodeName];
+		return allDescriptorSets[currentKey->second];
 	}
 
 	return IDescriptorSetsSP();
 }
 
+uint32_t RenderMaterial::getBufferOffset(const std::string& nodeName, const uint32_t binding) const
+{
+	auto currentBufferOffsets = allBufferOffsets.find(nodeName);
+
+	if (currentBufferOffsets == allBufferOffsets.end())
+	{
+		return 0;
+	}
+
+	auto currentBufferOffset = currentBufferOffsets->second.find(binding);
+
+	if (currentBufferOffset == currentBufferOffsets->second.end())
+	{
+		return 0;
+	}
+
+	return currentBufferOffset->second;
+}
+
 void RenderMaterial::bindDescriptorSets(const ICommandBuffersSP& cmdBuffer, const VkPipelineLayout layout, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) const
 {
     if (!cmdBuffer.get())
@@ -125,7 +131,7 @@ void RenderMaterial::bindDescriptorSets(const ICommandBuffersSP& cmdBuffer, cons
 			{
 	    		localDynamicOffsetCount++;
 
-	    		localDynamicOffsets.push_back(currentOffset->second.stride * currentBuffer + currentOffset->second.offset);
+	    		localDynamicOffsets.push_back(currentOffset->second.stride * currentBuffer + currentOffset->second.offset + getBufferOffset(nodeName, currentBinding.first));
 			}
     	}
     }
@@ -134,27 +140,18 @@ void RenderMaterial::bindDescriptorSets(const ICommandBuffersSP& cmdBuffer, cons
 }
 
 RenderMaterial::RenderMaterial() :
-    IRenderMaterial(), descriptorPool(), descriptorSets(), descriptorImageInfos{}, writeDescriptorSets{}, nodeName(), allDescriptorPools(), allDescriptorSets(), allBindingPresent()
+    IRenderMaterial(), descriptorSetAllocator(), descriptorSetLayout(), descriptorSets(), descriptorImageInfos{}, writeDescriptorSets{}, descriptorSetsKey(), allDescriptorSets(), allDescriptorSetsKeys(), allBindingPresent(), allBufferOffsets()
 {
 }
 
 RenderMaterial::RenderMaterial(const RenderMaterial& other) :
-	IRenderMaterial(), descriptorPool(), descriptorSets(), descriptorImageInfos{}, writeDescriptorSets{}, nodeName(), allDescriptorPools(), allDescriptorSets(), allBindingPresent(other.allBindingPresent)
+	IRenderMaterial(), descriptorSetAllocator(other.descriptorSetAllocator), descriptorSetLayout(other.descriptorSetLayout), descriptorSets(), descriptorImageInfos{}, writeDescriptorSets{}, descriptorSetsKey(), allDescriptorSets(), allDescriptorSetsKeys(other.allDescriptorSetsKeys), allBindingPresent(other.allBindingPresent), allBufferOffsets(other.allBufferOffsets)
 {
-	if (other.descriptorPool.get())
+	if (descriptorSetAllocator.get())
 	{
-		descriptorPool = descriptorPoolCreate(other.descriptorPool->getDevice(), other.descriptorPool->getFlags(), other.descriptorPool->getMaxSets(), other.descriptorPool->getPoolSizeCount(), other.descriptorPool->getPoolSizes());
-
-		if (!descriptorPool.get())
-		{
-			destroy();
-
-			return;
-		}
-
 		if (other.descriptorSets.get())
 		{
-			descriptorSets = descriptorSetsCreate(descriptorPool->getDevice(), descriptorPool->getDescriptorPool(), other.descriptorSets->getDescriptorSetCount(), other.descriptorSets->getSetLayouts());
+			descriptorSets = descriptorSetAllocator->allocate(descriptorSetLayout);
 
 			if (!descriptorSets.get())
 			{
@@ -166,30 +163,9 @@ RenderMaterial::RenderMaterial(const RenderMaterial& other) :
 
 		//
 
-		if (other.allDescriptorPools.size() != other.allDescriptorSets.size())
+		for (uint32_t i = 0; i < other.allDescriptorSets.size(); i++)
 		{
-			destroy();
-
-			return;
-		}
-
-
-		for (uint32_t i = 0; i < other.allDescriptorPools.size(); i++)
-		{
-			auto currentDescriptorPool = descriptorPoolCreate(other.allDescriptorPools.valueAt(i)->getDevice(), other.allDescriptorPools.valueAt(i)->getFlags(), other.allDescriptorPools.valueAt(i)->getMaxSets(), other.allDescriptorPools.valueAt(i)->getPoolSizeCount(), other.allDescriptorPools.valueAt(i)->getPoolSizes());
-
-			if (!currentDescriptorPool.get())
-			{
-				destroy();
-
-				return;
-			}
-
-			allDescriptorPools[other.allDescriptorPools.keyAt(i)] = currentDescriptorPool;
-
-			//
-
-			auto currentDescriptorSets = descriptorSetsCreate(currentDescriptorPool->getDevice(), currentDescriptorPool->getDescriptorPool(), other.allDescriptorSets.valueAt(i)->getDescriptorSetCount(), other.allDescriptorSets.valueAt(i)->getSetLayouts());
+			auto currentDescriptorSets = descriptorSetAllocator->allocate(descriptorSetLayout);
 
 			if (!currentDescriptorSets.get())
 			{
@@ -208,14 +184,15 @@ RenderMaterial::~RenderMaterial()
     destroy();
 }
 
-IDescriptorPoolSP RenderMaterial::getDescriptorPool() const
+IDescriptorSetAllocatorSP RenderMaterial::getDescriptorSetAllocator() const
 {
-	return descriptorPool;
+	return descriptorSetAllocator;
 }
 
-void RenderMaterial::setDescriptorPool(const IDescriptorPoolSP& descriptorPool)
+void RenderMaterial::setDescriptorSetAllocator(const IDescriptorSetAllocatorSP& descriptorSetAllocator, const IDescriptorSetLayoutSP& descriptorSetLayout)
 {
-	this->descriptorPool = descriptorPool;
+	this->descriptorSetAllocator = descriptorSetAllocator;
+	this->descriptorSetLayout = descriptorSetLayout;
 }
 
 IDescriptorSetsSP RenderMaterial::getDescriptorSets() const
@@ -256,16 +233,33 @@ void RenderMaterial::addDescriptorImageInfo(const uint32_t colorIndex, const uin
 
 void RenderMaterial::updateDescriptorSets(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const std::string& nodeName)
 {
-    auto currentDescriptorSets = createDescriptorSetsByName(nodeName);
+	// Only the dynamic buffers differ between the nodes, so they decide, which descriptor set is used.
+	std::string currentDescriptorSetsKey = "#";
+
+    for (uint32_t i = 0; i < allWriteDescriptorSetsCount; i++)
+    {
+		if (allWriteDescriptorSets[i].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC && allWriteDescriptorSets[i].descriptorCount == 1 && allWriteDescriptorSets[i].pBufferInfo)
+		{
+			currentDescriptorSetsKey += std::to_string(allWriteDescriptorSets[i].dstBinding) + ":" + std::to_string((uint64_t)allWriteDescriptorSets[i].pBufferInfo->buffer) + ":" + std::to_string(allWriteDescriptorSets[i].pBufferInfo->range) + ";";
+		}
+    }
+
+    auto currentDescriptorSets = createDescriptorSetsByKey(currentDescriptorSetsKey);
 
     if (!currentDescriptorSets.get())
     {
         return;
     }
 
+    allDescriptorSetsKeys[nodeName] = currentDescriptorSetsKey;
+
+    allBindingPresent[nodeName].clear();
+    allBufferOffsets[nodeName].clear();
+
     //
 
     VkWriteDescriptorSet finalWriteDescriptorSets[VKTS_BINDING_UNIFORM_MATERIAL_TOTAL_BINDING_COUNT];
+    VkDescriptorBufferInfo finalDescriptorBufferInfos[VKTS_BINDING_UNIFORM_MATERIAL_TOTAL_BINDING_COUNT];
     uint32_t finalWriteDescriptorSetsCount = 0;
 
 	// Copy from parent nodes.
@@ -282,6 +276,18 @@ void RenderMaterial::updateDescriptorSets(const uint32_t allWriteDescriptorSetsC
 
     		finalWriteDescriptorSets[finalWriteDescriptorSetsCount].dstSet = currentDescriptorSets->getDescriptorSets()[0];
 
+    		// The shared descriptor set starts at the beginning of the buffer. The offset of this node is passed as part of the dynamic offset.
+    		if (allWriteDescriptorSets[i].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC && allWriteDescriptorSets[i].descriptorCount == 1 && allWriteDescriptorSets[i].pBufferInfo)
+    		{
+    			finalDescriptorBufferInfos[finalWriteDescriptorSetsCount] = *allWriteDescriptorSets[i].pBufferInfo;
+
+    			allBufferOffsets[nodeName][allWriteDescriptorSets[i].dstBinding] = (uint32_t)finalDescriptorBufferInfos[finalWriteDescriptorSetsCount].offset;
+
+    			finalDescriptorBufferInfos[finalWriteDescriptorSetsCount].offset = 0;
+
+    			finalWriteDescriptorSets[finalWriteDescriptorSetsCount].pBufferInfo = &finalDescriptorBufferInfos[finalWriteDescriptorSetsCount];
+    		}
+
 			finalWriteDescriptorSetsCount++;
 
 			if (allWriteDescriptorSets[i].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
@@ -323,6 +329,47 @@ void RenderMaterial::draw(const ICommandBuffersSP& cmdBuffer, const IGraphicsPip
     bindDescriptorSets(cmdBuffer, graphicsPipeline->getLayout(), currentBuffer, dynamicOffsetMappings, nodeName);
 }
 
+VkBool32 RenderMaterial::collect(VkTsDrawPacket& drawPacket, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) const
+{
+    auto currentDescriptorSets = getDescriptorSetsByName(nodeName);
+
+    if (!currentDescriptorSets.get())
+    {
+        return VK_FALSE;
+    }
+
+    drawPacket.descriptorSet = currentDescriptorSets->getDescriptorSets()[0];
+
+    // Same order as in bindDescriptorSets.
+
+    drawPacket.dynamicOffsetCount = 0;
+
+    const auto& currentBindingPresent = allBindingPresent.at(nodeName);
+    for (const auto& currentBinding : currentBindingPresent)
+    {
+    	if (currentBinding.second)
+    	{
+    		auto currentOffset = dynamicOffsetMappings.find(currentBinding.first);
+
+			if (currentOffset != dynamicOffsetMappings.end())
+			{
+				if (drawPacket.dynamicOffsetCount == VKTS_MAX_DRAW_DYNAMIC_OFFSETS)
+				{
+			        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Too many dynamic offsets");
+
+					return VK_FALSE;
+				}
+
+				drawPacket.dynamicOffsets[drawPacket.dynamicOffsetCount] = currentOffset->second.stride * currentBuffer + currentOffset->second.offset + getBufferOffset(nodeName, currentBinding.first);
+
+				drawPacket.dynamicOffsetCount++;
+			}
+    	}
+    }
+
+    return VK_TRUE;
+}
+
 //
 // ICloneable
 //
@@ -335,7 +382,7 @@ IRenderMaterialSP RenderMaterial::create(const VkBool32 createData) const
 	{
 		result = IRenderMaterialSP(new RenderMaterial(*this));
 
-		if (result.get() && getDescriptorPool().get() && !result->getDescriptorPool().get())
+		if (result.get() && getDescriptorSetAllocator().get() && !result->getDescriptorSetAllocator().get())
 		{
 			return IRenderMaterialSP();
 		}
@@ -363,21 +410,24 @@ void RenderMaterial::destroy()
 	    }
 	    allDescriptorSets.clear();
 
-	    for (uint32_t i = 0; i < allDescriptorPools.values().size(); i++)
+	    // Not yet assigned to a node.
+	    if (descriptorSets.get() && descriptorSetsKey == "")
 	    {
-	    	allDescriptorPools.values()[i]->destroy();
+	    	descriptorSets->destroy();
 	    }
-	    allDescriptorPools.clear();
 
+	    allDescriptorSetsKeys.clear();
 	    allBindingPresent.clear();
+	    allBufferOffsets.clear();
 
 	    memset(writeDescriptorSets, 0, sizeof(writeDescriptorSets));
 	    memset(descriptorImageInfos, 0, sizeof(descriptorImageInfos));
 
-	    nodeName = "";
+	    descriptorSetsKey = "";
 
 	    descriptorSets = IDescriptorSetsSP();
-	    descriptorPool = IDescriptorPoolSP();
+	    descriptorSetLayout = IDescriptorSetLayoutSP();
+	    descriptorSetAllocator = IDescriptorSetAllocatorSP();
 	}
 	catch(const std::exception& e)
 	{
@@ -37,19 +37,25 @@ class RenderMaterial : public IRenderMaterial
 
 protected:
 
-    IDescriptorPoolSP descriptorPool;
+    IDescriptorSetAllocatorSP descriptorSetAllocator;
+    IDescriptorSetLayoutSP descriptorSetLayout;
     IDescriptorSetsSP descriptorSets;
     VkDescriptorImageInfo descriptorImageInfos[VKTS_BINDING_UNIFORM_MATERIAL_TOTAL_BINDING_COUNT];
     VkWriteDescriptorSet writeDescriptorSets[VKTS_BINDING_UNIFORM_MATERIAL_TOTAL_BINDING_COUNT];
-    std::string nodeName;
+    std::string descriptorSetsKey;
 
-    SmartPointerMap<std::string, IDescriptorPoolSP> allDescriptorPools;
+    // Nodes using the same uniform buffers share one descriptor set, keyed by the dynamic buffers.
     SmartPointerMap<std::string, IDescriptorSetsSP> allDescriptorSets;
+    std::map<std::string, std::string> allDescriptorSetsKeys;
     std::map<std::string, std::map<uint32_t, VkBool32>> allBindingPresent;
+    // Offset of the node in each dynamic buffer, which is added to the dynamic offset.
+    std::map<std::string, std::map<uint32_t, uint32_t>> allBufferOffsets;
 
-    IDescriptorSetsSP createDescriptorSetsByName(const std::string& nodeName);
+    IDescriptorSetsSP createDescriptorSetsByKey(const std::string& descriptorSetsKey);
     IDescriptorSetsSP getDescriptorSetsByName(const std::string& nodeName) const;
 
+    uint32_t getBufferOffset(const std::string& nodeName, const uint32_t binding) const;
+
     void bindDescriptorSets(const ICommandBuffersSP& cmdBuffer, const VkPipelineLayout layout, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) const;
 
 public:
@@ -67,9 +73,9 @@ public:
     virtual IRenderMaterialSP create(const VkBool32 createData = VK_TRUE) const override;
 
 
-    virtual IDescriptorPoolSP getDescriptorPool() const override;
+    virtual IDescriptorSetAllocatorSP getDescriptorSetAllocator() const override;
 
-    virtual void setDescriptorPool(const IDescriptorPoolSP& descriptorPool) override;
+    virtual void setDescriptorSetAllocator(const IDescriptorSetAllocatorSP& descriptorSetAllocator, const IDescriptorSetLayoutSP& descriptorSetLayout) override;
 
     virtual IDescriptorSetsSP getDescriptorSets() const override;
 
@@ -82,6 +88,8 @@ public:
 
     virtual void draw(const ICommandBuffersSP& cmdBuffer, const IGraphicsPipelineSP& graphicsPipeline, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) override;
 
+    virtual VkBool32 collect(VkTsDrawPacket& drawPacket, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const std::string& nodeName) const override;
+
     //
     // IDestroyable
     //
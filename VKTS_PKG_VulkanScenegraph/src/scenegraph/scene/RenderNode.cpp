@@ -97,14 +97,14 @@ void RenderNode::updateJointDescriptorBufferInfo(const VkBuffer buffer, const Vk
     jointWriteDescriptorSet.pTexelBufferView = nullptr;
 }
 
-void RenderNode::updateTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer)
+void RenderNode::updateTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range)
 {
-	updateTransformDescriptorBufferInfo(transformUniformBuffer->getBuffer()->getBuffer(), 0, transformUniformBuffer->getBuffer()->getSize() / transformUniformBuffer->getBufferCount());
+	updateTransformDescriptorBufferInfo(transformUniformBuffer->getBuffer()->getBuffer(), offset, range);
 }
 
-void RenderNode::updateJointsUniformBuffer(const IBufferObjectSP& jointsUniformBuffer)
+void RenderNode::updateJointsUniformBuffer(const IBufferObjectSP& jointsUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range)
 {
-	updateJointDescriptorBufferInfo(jointsUniformBuffer->getBuffer()->getBuffer(), 0, jointsUniformBuffer->getBuffer()->getSize() / jointsUniformBuffer->getBufferCount());
+	updateJointDescriptorBufferInfo(jointsUniformBuffer->getBuffer()->getBuffer(), offset, range);
 }
 
 void RenderNode::updateDescriptorSets(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets)
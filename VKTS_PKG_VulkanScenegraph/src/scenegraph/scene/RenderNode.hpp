@@ -61,9 +61,9 @@ public:
 
     virtual void reset() override;
 
-    virtual void updateTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer) override;
+    virtual void updateTransformUniformBuffer(const IBufferObjectSP& transformUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range) override;
 
-    virtual void updateJointsUniformBuffer(const IBufferObjectSP& jointsUniformBuffer) override;
+    virtual void updateJointsUniformBuffer(const IBufferObjectSP& jointsUniformBuffer, const VkDeviceSize offset, const VkDeviceSize range) override;
 
     virtual void updateDescriptorSets(const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets) override;
 
@@ -38,13 +38,11 @@ RenderSubMesh::~RenderSubMesh()
 {
 }
 
-void RenderSubMesh::draw(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const std::string& nodeName)
+IGraphicsPipelineSP RenderSubMesh::getGraphicsPipeline(const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const ISubMesh& subMesh) const
 {
-	IGraphicsPipelineSP graphicsPipeline;
-
     if (subMesh.getBSDFMaterial().get())
     {
-    	graphicsPipeline = subMesh.getGraphicsPipeline();
+    	return subMesh.getGraphicsPipeline();
     }
     else if (subMesh.getPhongMaterial().get())
     {
@@ -52,18 +50,47 @@ void RenderSubMesh::draw(const ICommandBuffersSP& cmdBuffer, const SmartPointerV
 		{
 			if (allGraphicsPipelines[i]->getVertexBufferType() == subMesh.getVertexBufferType())
 			{
-				graphicsPipeline = allGraphicsPipelines[i];
-
-				break;
+				return allGraphicsPipelines[i];
 			}
 		}
+
+		return IGraphicsPipelineSP();
     }
-    else
-    {
-        logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "No material");
 
-        return;
+    logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "No material");
+
+    return IGraphicsPipelineSP();
+}
+
+IGraphicsPipelineSP RenderSubMesh::getInstanceGraphicsPipeline(const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const ISubMesh& subMesh) const
+{
+	// Skinned sub meshes depend on the joints of their node.
+	if ((subMesh.getVertexBufferType() & VKTS_VERTEX_BUFFER_TYPE_BONES) == VKTS_VERTEX_BUFFER_TYPE_BONES)
+	{
+		return IGraphicsPipelineSP();
+	}
+
+    if (subMesh.getBSDFMaterial().get())
+    {
+    	return subMesh.getInstanceGraphicsPipeline();
     }
+    else if (subMesh.getPhongMaterial().get())
+    {
+		for (uint32_t i = 0; i < allGraphicsPipelines.size(); i++)
+		{
+			if (allGraphicsPipelines[i]->getVertexBufferType() == (subMesh.getVertexBufferType() | VKTS_VERTEX_BUFFER_TYPE_INSTANCE_TRANSFORM))
+			{
+				return allGraphicsPipelines[i];
+			}
+		}
+    }
+
+    return IGraphicsPipelineSP();
+}
+
+void RenderSubMesh::draw(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const std::string& nodeName)
+{
+	IGraphicsPipelineSP graphicsPipeline = getGraphicsPipeline(allGraphicsPipelines, subMesh);
 
     //
 
@@ -148,6 +175,89 @@ void RenderSubMesh::draw(const ICommandBuffersSP& cmdBuffer, const SmartPointerV
     vkCmdDrawIndexed(cmdBuffer->getCommandBuffer(0), subMesh.getNumberIndices(), 1, 0, 0, 0);
 }
 
+void RenderSubMesh::collect(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const std::string& nodeName)
+{
+	IGraphicsPipelineSP graphicsPipeline = getGraphicsPipeline(allGraphicsPipelines, subMesh);
+
+	if (!graphicsPipeline.get())
+	{
+		return;
+	}
+
+	VkTsDrawPacket subMeshDrawPacket = drawPacket;
+
+	subMeshDrawPacket.pipeline = graphicsPipeline->getPipeline();
+	subMeshDrawPacket.layout = graphicsPipeline->getLayout();
+
+	// All nodes using this sub mesh share its material, so they only differ by their transform.
+	IGraphicsPipelineSP instanceGraphicsPipeline = getInstanceGraphicsPipeline(allGraphicsPipelines, subMesh);
+
+	if (instanceGraphicsPipeline.get() && instanceGraphicsPipeline->getLayout() == graphicsPipeline->getLayout())
+	{
+		subMeshDrawPacket.instanceKey = (uint64_t)(uintptr_t)&subMesh;
+		subMeshDrawPacket.instancePipeline = instanceGraphicsPipeline->getPipeline();
+	}
+	else
+	{
+		subMeshDrawPacket.instanceKey = 0;
+		subMeshDrawPacket.instancePipeline = VK_NULL_HANDLE;
+	}
+
+	if (subMesh.getBSDFMaterial().get())
+	{
+		if (!subMesh.getBSDFMaterial()->collectRecursive(subMeshDrawPacket, graphicsPipeline, currentBuffer, dynamicOffsetMappings, renderOverwrite, nodeName))
+		{
+			return;
+		}
+
+		// Same push constants as in draw.
+		if (subMesh.getBSDFMaterial()->isSorted() && subMesh.getBSDFMaterial()->isPacked())
+		{
+			float alphaCutoffStrength[2] = {subMesh.getBSDFMaterial()->getAlphaCutoff(), subMesh.getBSDFMaterial()->getAmbientOcclusionStrength()};
+
+			drawPacketAddPushConstants(subMeshDrawPacket, VK_SHADER_STAGE_FRAGMENT_BIT, sizeof(int32_t) + sizeof(float) + sizeof(float), sizeof(float) * 2, alphaCutoffStrength);
+
+			if ((subMesh.getBSDFMaterial()->getAttributes() & VKTS_VERTEX_BUFFER_TYPE_TEXCOORD1) == VKTS_VERTEX_BUFFER_TYPE_TEXCOORD1)
+			{
+				int32_t texCoordIndices[5];
+
+				for (uint32_t i = 0; i < 5; i++)
+				{
+					texCoordIndices[i] = subMesh.getBSDFMaterial()->getTexCoordIndex(i);
+				}
+
+				drawPacketAddPushConstants(subMeshDrawPacket, VK_SHADER_STAGE_FRAGMENT_BIT, sizeof(int32_t) + sizeof(float) + sizeof(float) + sizeof(float) + sizeof(float), sizeof(int32_t) * 5, texCoordIndices);
+			}
+		}
+	}
+
+	if (subMesh.getPhongMaterial().get())
+	{
+		if (!subMesh.getPhongMaterial()->collectRecursive(subMeshDrawPacket, graphicsPipeline, currentBuffer, dynamicOffsetMappings, renderOverwrite, nodeName))
+		{
+			return;
+		}
+	}
+
+    if (!subMesh.getIndexBuffer().get() || !subMesh.getIndexBuffer()->getBuffer().get())
+    {
+        return;
+    }
+
+    if (!subMesh.getVertexBuffer().get() || !subMesh.getVertexBuffer()->getBuffer().get())
+    {
+        return;
+    }
+
+    subMeshDrawPacket.indexBuffer = subMesh.getIndexBuffer()->getBuffer()->getBuffer();
+    subMeshDrawPacket.vertexBuffer = subMesh.getVertexBuffer()->getBuffer()->getBuffer();
+
+    subMeshDrawPacket.firstIndex = 0;
+    subMeshDrawPacket.indexCount = subMesh.getNumberIndices();
+
+    renderQueue.addPacket(subMeshDrawPacket);
+}
+
 IRenderSubMeshSP RenderSubMesh::create(const VkBool32 createData) const
 {
 	return IRenderSubMeshSP(new RenderSubMesh());
@@ -35,6 +35,12 @@ namespace vkts
 class RenderSubMesh: public IRenderSubMesh
 {
 
+private:
+
+	IGraphicsPipelineSP getGraphicsPipeline(const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const ISubMesh& subMesh) const;
+
+	IGraphicsPipelineSP getInstanceGraphicsPipeline(const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const ISubMesh& subMesh) const;
+
 public:
 
     RenderSubMesh();
@@ -49,6 +55,8 @@ public:
 
     virtual void draw(const ICommandBuffersSP& cmdBuffer, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const std::string& nodeName) override;
 
+    virtual void collect(IRenderQueue& renderQueue, const VkTsDrawPacket& drawPacket, const SmartPointerVector<IGraphicsPipelineSP>& allGraphicsPipelines, const uint32_t currentBuffer, const std::map<uint32_t, VkTsDynamicOffset>& dynamicOffsetMappings, const OverwriteDraw* renderOverwrite, const ISubMesh& subMesh, const std::string& nodeName) override;
+
 };
 
 } /* namespace vkts */
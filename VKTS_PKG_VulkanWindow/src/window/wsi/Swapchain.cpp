@@ -238,7 +238,7 @@ VkResult Swapchain::acquireNextImage(const uint64_t timeout, const VkSemaphore s
     return vkAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, &pImageIndex);
 }
 
-VkResult Swapchain::queuePresent(const VkQueue queue, const uint32_t waitSemaphoreCount, const VkSemaphore* waitSemaphores, const uint32_t swapchainCount, const VkSwapchainKHR* swapchains, const uint32_t* imageIndices, VkResult* results) const
+VkResult Swapchain::queuePresent(const IQueueSP& queue, const uint32_t waitSemaphoreCount, const VkSemaphore* waitSemaphores, const uint32_t swapchainCount, const VkSwapchainKHR* swapchains, const uint32_t* imageIndices, VkResult* results) const
 {
     VkPresentInfoKHR presentInfo{};
 
@@ -251,7 +251,12 @@ VkResult Swapchain::queuePresent(const VkQueue queue, const uint32_t waitSemapho
     presentInfo.pImageIndices = imageIndices;
     presentInfo.pResults = results;
 
-    return vkQueuePresentKHR(queue, &presentInfo);
+    if (!queue.get())
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    return queue->present(presentInfo);
 }
 
 //
@@ -110,7 +110,7 @@ public:
 
     virtual VkResult acquireNextImage(const uint64_t timeout, const VkSemaphore semaphore, const VkFence fence, uint32_t& pImageIndex) const override;
 
-    virtual VkResult queuePresent(const VkQueue queue, const uint32_t waitSemaphoreCount, const VkSemaphore* waitSemaphores, const uint32_t swapchainCount, const VkSwapchainKHR* swapchains, const uint32_t* imageIndices, VkResult* results) const override;
+    virtual VkResult queuePresent(const IQueueSP& queue, const uint32_t waitSemaphoreCount, const VkSemaphore* waitSemaphores, const uint32_t swapchainCount, const VkSwapchainKHR* swapchains, const uint32_t* imageIndices, VkResult* results) const override;
 
     //
     // IDestroyable
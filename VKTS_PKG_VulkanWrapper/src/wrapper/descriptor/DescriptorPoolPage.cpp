@@ -0,0 +1,230 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "DescriptorPoolPage.hpp"
+
+namespace vkts
+{
+
+DescriptorPoolPage::DescriptorPoolPage(const VkDevice device, const VkDescriptorPool descriptorPool, const uint32_t maxSets, const VkBool32 transient) :
+    device(device), descriptorPool(descriptorPool), maxSets(maxSets), transient(transient), allocatedCount(0), usedCount(0), allCachedDescriptorSets(), mutex()
+{
+}
+
+DescriptorPoolPage::~DescriptorPoolPage()
+{
+    destroy();
+}
+
+const VkDevice DescriptorPoolPage::getDevice() const
+{
+    return device;
+}
+
+const VkDescriptorPool DescriptorPoolPage::getDescriptorPool() const
+{
+    return descriptorPool;
+}
+
+VkBool32 DescriptorPoolPage::isTransient() const
+{
+    return transient;
+}
+
+VkBool32 DescriptorPoolPage::allocate(VkDescriptorSet& descriptorSet, VkBool32& reused, const IDescriptorSetLayoutSP& descriptorSetLayout)
+{
+    if (!descriptorSetLayout.get() || !descriptorSetLayout->getDescriptorSetLayout())
+    {
+        return VK_FALSE;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!descriptorPool)
+    {
+        return VK_FALSE;
+    }
+
+    const VkDescriptorSetLayout setLayout = descriptorSetLayout->getDescriptorSetLayout();
+
+    for (auto walker = allCachedDescriptorSets.begin(); walker != allCachedDescriptorSets.end(); walker++)
+    {
+        if (walker->setLayout == setLayout && walker->descriptorSetLayout.lock() == descriptorSetLayout)
+        {
+            descriptorSet = walker->descriptorSet;
+
+            allCachedDescriptorSets.erase(walker);
+
+            usedCount++;
+
+            reused = VK_TRUE;
+
+            return VK_TRUE;
+        }
+    }
+
+    // Make room by giving back a cached descriptor set of another layout.
+    if (allocatedCount == maxSets && allCachedDescriptorSets.size() > 0)
+    {
+        vkFreeDescriptorSets(device, descriptorPool, 1, &allCachedDescriptorSets.back().descriptorSet);
+
+        allCachedDescriptorSets.pop_back();
+
+        allocatedCount--;
+    }
+
+    if (allocatedCount == maxSets)
+    {
+        return VK_FALSE;
+    }
+
+    VkDescriptorSetAllocateInfo descriptorSetAllocateInfo{};
+
+    descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+
+    descriptorSetAllocateInfo.descriptorPool = descriptorPool;
+    descriptorSetAllocateInfo.descriptorSetCount = 1;
+    descriptorSetAllocateInfo.pSetLayouts = &setLayout;
+
+    VkResult result = vkAllocateDescriptorSets(device, &descriptorSetAllocateInfo, &descriptorSet);
+
+    if (result != VK_SUCCESS)
+    {
+        // Pool is exhausted or fragmented, so let the caller try the next page.
+        return VK_FALSE;
+    }
+
+    allocatedCount++;
+    usedCount++;
+
+    reused = VK_FALSE;
+
+    return VK_TRUE;
+}
+
+void DescriptorPoolPage::free(const VkDescriptorSet descriptorSet, const IDescriptorSetLayoutSP& descriptorSetLayout)
+{
+    if (!descriptorSet || transient)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Already released by destroying or resetting the pool.
+    if (!descriptorPool || usedCount == 0)
+    {
+        return;
+    }
+
+    usedCount--;
+
+    if (descriptorSetLayout.get() && descriptorSetLayout->getDescriptorSetLayout())
+    {
+        allCachedDescriptorSets.push_back(DescriptorSetCacheEntry{descriptorSet, descriptorSetLayout->getDescriptorSetLayout(), descriptorSetLayout});
+    }
+    else
+    {
+        vkFreeDescriptorSets(device, descriptorPool, 1, &descriptorSet);
+
+        allocatedCount--;
+    }
+}
+
+VkBool32 DescriptorPoolPage::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!descriptorPool)
+    {
+        return VK_FALSE;
+    }
+
+    VkResult result = vkResetDescriptorPool(device, descriptorPool, 0);
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not reset descriptor pool.");
+
+        return VK_FALSE;
+    }
+
+    allCachedDescriptorSets.clear();
+
+    allocatedCount = 0;
+    usedCount = 0;
+
+    return VK_TRUE;
+}
+
+uint32_t DescriptorPoolPage::getUsedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return usedCount;
+}
+
+void DescriptorPoolPage::addStatistics(VkTsDescriptorSetStatistics& statistics) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!descriptorPool)
+    {
+        return;
+    }
+
+    if (transient)
+    {
+        statistics.transientPoolCount++;
+    }
+    else
+    {
+        statistics.poolCount++;
+    }
+
+    statistics.usedSetCount += usedCount;
+    statistics.cachedSetCount += (uint32_t) allCachedDescriptorSets.size();
+}
+
+void DescriptorPoolPage::destroy()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    allCachedDescriptorSets.clear();
+
+    allocatedCount = 0;
+    usedCount = 0;
+
+    if (descriptorPool)
+    {
+        // Also frees all descriptor sets of this pool.
+        vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+
+        descriptorPool = VK_NULL_HANDLE;
+    }
+}
+
+} /* namespace vkts */
@@ -0,0 +1,125 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_DESCRIPTORPOOLPAGE_HPP_
+#define VKTS_DESCRIPTORPOOLPAGE_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+namespace vkts
+{
+
+/**
+ * Freed descriptor set, which can be handed out again for the same layout.
+ */
+typedef struct DescriptorSetCacheEntry_
+{
+    VkDescriptorSet descriptorSet;
+    VkDescriptorSetLayout setLayout;
+    // Layout handles can be recycled by the driver, so the layout has to be alive for a reuse.
+    std::weak_ptr<IDescriptorSetLayout> descriptorSetLayout;
+} DescriptorSetCacheEntry;
+
+/**
+ * One descriptor pool, shared by several descriptor sets of equal pool sizes.
+ * Transient pages are only reset as a whole.
+ */
+class DescriptorPoolPage
+{
+
+private:
+
+    const VkDevice device;
+
+    VkDescriptorPool descriptorPool;
+
+    const uint32_t maxSets;
+
+    const VkBool32 transient;
+
+    uint32_t allocatedCount;
+
+    uint32_t usedCount;
+
+    std::vector<DescriptorSetCacheEntry> allCachedDescriptorSets;
+
+    mutable std::mutex mutex;
+
+public:
+
+    DescriptorPoolPage() = delete;
+    DescriptorPoolPage(const VkDevice device, const VkDescriptorPool descriptorPool, const uint32_t maxSets, const VkBool32 transient);
+    DescriptorPoolPage(const DescriptorPoolPage& other) = delete;
+    DescriptorPoolPage(DescriptorPoolPage&& other) = delete;
+    ~DescriptorPoolPage();
+
+    DescriptorPoolPage& operator =(const DescriptorPoolPage& other) = delete;
+    DescriptorPoolPage& operator =(DescriptorPoolPage && other) = delete;
+
+    const VkDevice getDevice() const;
+
+    const VkDescriptorPool getDescriptorPool() const;
+
+    VkBool32 isTransient() const;
+
+    /**
+     * Reused is set to VK_TRUE, if the descriptor set was taken from the free list.
+     *
+     * @ThreadSafe
+     */
+    VkBool32 allocate(VkDescriptorSet& descriptorSet, VkBool32& reused, const IDescriptorSetLayoutSP& descriptorSetLayout);
+
+    /**
+     * @ThreadSafe
+     */
+    void free(const VkDescriptorSet descriptorSet, const IDescriptorSetLayoutSP& descriptorSetLayout);
+
+    /**
+     * @ThreadSafe
+     */
+    VkBool32 reset();
+
+    /**
+     * @ThreadSafe
+     */
+    uint32_t getUsedCount() const;
+
+    /**
+     * Adds the values of this page.
+     *
+     * @ThreadSafe
+     */
+    void addStatistics(VkTsDescriptorSetStatistics& statistics) const;
+
+    void destroy();
+
+};
+
+typedef std::shared_ptr<DescriptorPoolPage> DescriptorPoolPageSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_DESCRIPTORPOOLPAGE_HPP_ */
@@ -0,0 +1,337 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "DescriptorSetAllocator.hpp"
+
+#include "DescriptorSetsSuballocation.hpp"
+
+namespace vkts
+{
+
+DescriptorPoolKey DescriptorSetAllocator::createKey(const IDescriptorSetLayoutSP& descriptorSetLayout)
+{
+    std::map<uint32_t, uint32_t> allDescriptorCounts;
+
+    for (uint32_t i = 0; i < descriptorSetLayout->getBindingCount(); i++)
+    {
+        const VkDescriptorSetLayoutBinding& binding = descriptorSetLayout->getBindings()[i];
+
+        allDescriptorCounts[(uint32_t) binding.descriptorType] += binding.descriptorCount;
+    }
+
+    DescriptorPoolKey key;
+
+    for (const auto& currentDescriptorCount : allDescriptorCounts)
+    {
+        if (currentDescriptorCount.second == 0)
+        {
+            continue;
+        }
+
+        key.push_back(currentDescriptorCount.first);
+        key.push_back(currentDescriptorCount.second);
+    }
+
+    return key;
+}
+
+DescriptorPoolPageSP DescriptorSetAllocator::createPage(const DescriptorPoolKey& key, const VkBool32 transient) const
+{
+    std::vector<VkDescriptorPoolSize> allPoolSizes;
+
+    for (size_t i = 0; i + 1 < key.size(); i += 2)
+    {
+        allPoolSizes.push_back(VkDescriptorPoolSize{(VkDescriptorType) key[i], key[i + 1] * setsPerPool});
+    }
+
+    // A pool needs at least one pool size, even for a layout without bindings.
+    if (allPoolSizes.size() == 0)
+    {
+        allPoolSizes.push_back(VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1});
+    }
+
+    VkDescriptorPoolCreateInfo descriptorPoolCreateInfo{};
+
+    descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+
+    // Transient pools are only reset, so single descriptor sets are never freed.
+    descriptorPoolCreateInfo.flags = transient ? 0 : VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    descriptorPoolCreateInfo.maxSets = setsPerPool;
+    descriptorPoolCreateInfo.poolSizeCount = (uint32_t) allPoolSizes.size();
+    descriptorPoolCreateInfo.pPoolSizes = &allPoolSizes[0];
+
+    VkDescriptorPool descriptorPool;
+
+    VkResult result = vkCreateDescriptorPool(device, &descriptorPoolCreateInfo, nullptr, &descriptorPool);
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create descriptor pool.");
+
+        return DescriptorPoolPageSP();
+    }
+
+    auto newInstance = new DescriptorPoolPage(device, descriptorPool, setsPerPool, transient);
+
+    if (!newInstance)
+    {
+        vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+
+        return DescriptorPoolPageSP();
+    }
+
+    return DescriptorPoolPageSP(newInstance);
+}
+
+IDescriptorSetsSP DescriptorSetAllocator::allocate(std::vector<DescriptorPoolPageSP>& allKeyPages, const DescriptorPoolKey& key, const IDescriptorSetLayoutSP& descriptorSetLayout, const VkBool32 transient)
+{
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    VkBool32 reused = VK_FALSE;
+
+    DescriptorPoolPageSP page;
+
+    for (const auto& currentPage : allKeyPages)
+    {
+        if (currentPage->allocate(descriptorSet, reused, descriptorSetLayout))
+        {
+            page = currentPage;
+
+            break;
+        }
+    }
+
+    if (!page.get())
+    {
+        page = createPage(key, transient);
+
+        if (!page.get())
+        {
+            return IDescriptorSetsSP();
+        }
+
+        allKeyPages.push_back(page);
+
+        if (!page->allocate(descriptorSet, reused, descriptorSetLayout))
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not allocate descriptor sets.");
+
+            return IDescriptorSetsSP();
+        }
+    }
+
+    auto newInstance = new DescriptorSetsSuballocation(page, descriptorSetLayout, descriptorSet);
+
+    if (!newInstance)
+    {
+        page->free(descriptorSet, descriptorSetLayout);
+
+        return IDescriptorSetsSP();
+    }
+
+    if (transient)
+    {
+        transientAllocationCount++;
+    }
+    else
+    {
+        allocationCount++;
+
+        if (reused)
+        {
+            reuseCount++;
+        }
+    }
+
+    return IDescriptorSetsSP(newInstance);
+}
+
+DescriptorSetAllocator::DescriptorSetAllocator(const VkDevice device, const uint32_t setsPerPool) :
+    IDescriptorSetAllocator(), device(device), setsPerPool(glm::max(setsPerPool, 1u)), allPages(), allTransientPages(), allocationCount(0), reuseCount(0), transientAllocationCount(0), mutex()
+{
+}
+
+DescriptorSetAllocator::~DescriptorSetAllocator()
+{
+    destroy();
+}
+
+//
+// IDescriptorSetAllocator
+//
+
+const VkDevice DescriptorSetAllocator::getDevice() const
+{
+    return device;
+}
+
+uint32_t DescriptorSetAllocator::getSetsPerPool() const
+{
+    return setsPerPool;
+}
+
+IDescriptorSetsSP DescriptorSetAllocator::allocate(const IDescriptorSetLayoutSP& descriptorSetLayout)
+{
+    if (!descriptorSetLayout.get() || !descriptorSetLayout->getDescriptorSetLayout())
+    {
+        return IDescriptorSetsSP();
+    }
+
+    const DescriptorPoolKey key = createKey(descriptorSetLayout);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return allocate(allPages[key], key, descriptorSetLayout, VK_FALSE);
+}
+
+IDescriptorSetsSP DescriptorSetAllocator::allocateTransient(const IDescriptorSetLayoutSP& descriptorSetLayout, const uint32_t frameIndex)
+{
+    if (!descriptorSetLayout.get() || !descriptorSetLayout->getDescriptorSetLayout())
+    {
+        return IDescriptorSetsSP();
+    }
+
+    const DescriptorPoolKey key = createKey(descriptorSetLayout);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return allocate(allTransientPages[frameIndex][key], key, descriptorSetLayout, VK_TRUE);
+}
+
+VkBool32 DescriptorSetAllocator::resetTransient(const uint32_t frameIndex)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto frameWalker = allTransientPages.find(frameIndex);
+
+    if (frameWalker == allTransientPages.end())
+    {
+        return VK_TRUE;
+    }
+
+    VkBool32 result = VK_TRUE;
+
+    for (const auto& currentKeyPages : frameWalker->second)
+    {
+        for (const auto& currentPage : currentKeyPages.second)
+        {
+            if (!currentPage->reset())
+            {
+                result = VK_FALSE;
+            }
+        }
+    }
+
+    return result;
+}
+
+void DescriptorSetAllocator::getStatistics(VkTsDescriptorSetStatistics& statistics) const
+{
+    statistics = VkTsDescriptorSetStatistics{};
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (const auto& currentKeyPages : allPages)
+    {
+        for (const auto& currentPage : currentKeyPages.second)
+        {
+            currentPage->addStatistics(statistics);
+        }
+    }
+
+    for (const auto& currentFramePages : allTransientPages)
+    {
+        for (const auto& currentKeyPages : currentFramePages.second)
+        {
+            for (const auto& currentPage : currentKeyPages.second)
+            {
+                currentPage->addStatistics(statistics);
+            }
+        }
+    }
+
+    statistics.allocationCount = allocationCount;
+    statistics.reuseCount = reuseCount;
+    statistics.transientAllocationCount = transientAllocationCount;
+}
+
+void DescriptorSetAllocator::freeUnusedPools()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto& currentKeyPages : allPages)
+    {
+        auto& allKeyPages = currentKeyPages.second;
+
+        auto walker = allKeyPages.begin();
+
+        while (walker != allKeyPages.end())
+        {
+            if ((*walker)->getUsedCount() == 0)
+            {
+                (*walker)->destroy();
+
+                walker = allKeyPages.erase(walker);
+            }
+            else
+            {
+                walker++;
+            }
+        }
+    }
+}
+
+//
+// IDestroyable
+//
+
+void DescriptorSetAllocator::destroy()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Descriptor sets still referencing a page are freed with the pool.
+    for (auto& currentKeyPages : allPages)
+    {
+        for (auto& currentPage : currentKeyPages.second)
+        {
+            currentPage->destroy();
+        }
+    }
+    allPages.clear();
+
+    for (auto& currentFramePages : allTransientPages)
+    {
+        for (auto& currentKeyPages : currentFramePages.second)
+        {
+            for (auto& currentPage : currentKeyPages.second)
+            {
+                currentPage->destroy();
+            }
+        }
+    }
+    allTransientPages.clear();
+}
+
+} /* namespace vkts */
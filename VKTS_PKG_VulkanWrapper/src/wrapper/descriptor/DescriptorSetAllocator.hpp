@@ -0,0 +1,109 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_DESCRIPTORSETALLOCATOR_HPP_
+#define VKTS_DESCRIPTORSETALLOCATOR_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+#include "DescriptorPoolPage.hpp"
+
+namespace vkts
+{
+
+/**
+ * Pool sizes of one descriptor set, stored as pairs of descriptor type and count.
+ */
+typedef std::vector<uint32_t> DescriptorPoolKey;
+
+typedef std::map<DescriptorPoolKey, std::vector<DescriptorPoolPageSP>> DescriptorPoolPageMap;
+
+class DescriptorSetAllocator: public IDescriptorSetAllocator
+{
+
+private:
+
+    const VkDevice device;
+
+    const uint32_t setsPerPool;
+
+    DescriptorPoolPageMap allPages;
+
+    std::map<uint32_t, DescriptorPoolPageMap> allTransientPages;
+
+    uint64_t allocationCount;
+    uint64_t reuseCount;
+    uint64_t transientAllocationCount;
+
+    mutable std::mutex mutex;
+
+    static DescriptorPoolKey createKey(const IDescriptorSetLayoutSP& descriptorSetLayout);
+
+    DescriptorPoolPageSP createPage(const DescriptorPoolKey& key, const VkBool32 transient) const;
+
+    IDescriptorSetsSP allocate(std::vector<DescriptorPoolPageSP>& allKeyPages, const DescriptorPoolKey& key, const IDescriptorSetLayoutSP& descriptorSetLayout, const VkBool32 transient);
+
+public:
+
+    DescriptorSetAllocator() = delete;
+    DescriptorSetAllocator(const VkDevice device, const uint32_t setsPerPool);
+    DescriptorSetAllocator(const DescriptorSetAllocator& other) = delete;
+    DescriptorSetAllocator(DescriptorSetAllocator&& other) = delete;
+    virtual ~DescriptorSetAllocator();
+
+    DescriptorSetAllocator& operator =(const DescriptorSetAllocator& other) = delete;
+
+    DescriptorSetAllocator& operator =(DescriptorSetAllocator && other) = delete;
+
+    //
+    // IDescriptorSetAllocator
+    //
+
+    virtual const VkDevice getDevice() const override;
+
+    virtual uint32_t getSetsPerPool() const override;
+
+    virtual IDescriptorSetsSP allocate(const IDescriptorSetLayoutSP& descriptorSetLayout) override;
+
+    virtual IDescriptorSetsSP allocateTransient(const IDescriptorSetLayoutSP& descriptorSetLayout, const uint32_t frameIndex) override;
+
+    virtual VkBool32 resetTransient(const uint32_t frameIndex) override;
+
+    virtual void getStatistics(VkTsDescriptorSetStatistics& statistics) const override;
+
+    virtual void freeUnusedPools() override;
+
+    //
+    // IDestroyable
+    //
+
+    virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_DESCRIPTORSETALLOCATOR_HPP_ */
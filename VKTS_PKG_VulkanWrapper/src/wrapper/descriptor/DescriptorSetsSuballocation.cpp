@@ -0,0 +1,116 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "DescriptorSetsSuballocation.hpp"
+
+namespace vkts
+{
+
+DescriptorSetsSuballocation::DescriptorSetsSuballocation(const DescriptorPoolPageSP& page, const IDescriptorSetLayoutSP& descriptorSetLayout, const VkDescriptorSet descriptorSet) :
+    IDescriptorSets(), page(page), descriptorSetLayout(descriptorSetLayout), setLayout(descriptorSetLayout->getDescriptorSetLayout()), descriptorSet(descriptorSet)
+{
+}
+
+DescriptorSetsSuballocation::~DescriptorSetsSuballocation()
+{
+    destroy();
+}
+
+//
+// IDescriptorSets
+//
+
+const VkDevice DescriptorSetsSuballocation::getDevice() const
+{
+    if (!page.get())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return page->getDevice();
+}
+
+const VkDescriptorPool DescriptorSetsSuballocation::getDescriptorPool() const
+{
+    if (!page.get())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return page->getDescriptorPool();
+}
+
+uint32_t DescriptorSetsSuballocation::getDescriptorSetCount() const
+{
+    return descriptorSet ? 1 : 0;
+}
+
+const VkDescriptorSetLayout* DescriptorSetsSuballocation::getSetLayouts() const
+{
+    if (!descriptorSet)
+    {
+        return nullptr;
+    }
+
+    return &setLayout;
+}
+
+const VkDescriptorSet* DescriptorSetsSuballocation::getDescriptorSets() const
+{
+    if (!descriptorSet)
+    {
+        return nullptr;
+    }
+
+    return &descriptorSet;
+}
+
+void DescriptorSetsSuballocation::updateDescriptorSets(const uint32_t writeCount, const VkWriteDescriptorSet* descriptorWrites, const uint32_t copyCount, const VkCopyDescriptorSet* descriptorCopies) const
+{
+    vkUpdateDescriptorSets(getDevice(), writeCount, descriptorWrites, copyCount, descriptorCopies);
+}
+
+//
+// IDestroyable
+//
+
+void DescriptorSetsSuballocation::destroy()
+{
+    if (page.get())
+    {
+        page->free(descriptorSet, descriptorSetLayout);
+
+        page.reset();
+    }
+
+    descriptorSetLayout.reset();
+
+    setLayout = VK_NULL_HANDLE;
+
+    descriptorSet = VK_NULL_HANDLE;
+}
+
+} /* namespace vkts */
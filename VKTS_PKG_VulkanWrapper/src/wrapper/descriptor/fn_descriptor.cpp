@@ -26,6 +26,7 @@
 
 #include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
 #include "DescriptorPool.hpp"
+#include "DescriptorSetAllocator.hpp"
 #include "DescriptorSetLayout.hpp"
 #include "DescriptorSets.hpp"
 
@@ -161,4 +162,21 @@ IDescriptorSetsSP VKTS_APIENTRY descriptorSetsCreate(const VkDevice device, cons
     return IDescriptorSetsSP(newInstance);
 }
 
+IDescriptorSetAllocatorSP VKTS_APIENTRY descriptorSetAllocatorCreate(const VkDevice device, const uint32_t setsPerPool)
+{
+    if (!device || setsPerPool == 0)
+    {
+        return IDescriptorSetAllocatorSP();
+    }
+
+    auto newInstance = new DescriptorSetAllocator(device, setsPerPool);
+
+    if (!newInstance)
+    {
+        return IDescriptorSetAllocatorSP();
+    }
+
+    return IDescriptorSetAllocatorSP(newInstance);
+}
+
 }
@@ -30,7 +30,7 @@ namespace vkts
 {
 
 DeviceMemory::DeviceMemory(const VkDevice device, const VkMemoryAllocateInfo& memoryAllocInfo, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkMemoryPropertyFlags memoryPropertyFlags, const VkDeviceMemory deviceMemory) :
-    IDeviceMemory(), device(device), memoryAllocInfo(memoryAllocInfo), allMemoryTypes(0), memoryPropertyFlags(memoryPropertyFlags), deviceMemory(deviceMemory), data(nullptr), mapped(VK_FALSE)
+    MappableDeviceMemory(), device(device), memoryAllocInfo(memoryAllocInfo), allMemoryTypes(0), memoryPropertyFlags(memoryPropertyFlags), deviceMemory(deviceMemory)
 {
     if (memoryTypes)
     {
@@ -100,53 +100,9 @@ const VkDeviceMemory DeviceMemory::getDeviceMemory() const
     return deviceMemory;
 }
 
-VkResult DeviceMemory::mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags)
+VkDeviceSize DeviceMemory::getOffset() const
 {
-    if (!(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
-    {
-        return VK_ERROR_MEMORY_MAP_FAILED;
-    }
-
-	if (offset + size > getAllocationSize() && !VK_WHOLE_SIZE)
-	{
-		return VK_ERROR_MEMORY_MAP_FAILED;
-	}
-
-    if (mapped)
-    {
-        unmapMemory();
-    }
-
-    auto result = vkMapMemory(device, deviceMemory, offset, size, flags, &data);
-
-    if (result == VK_SUCCESS)
-    {
-        mapped = VK_TRUE;
-    }
-    else
-    {
-        data = nullptr;
-    }
-
-    return result;
-}
-
-void* DeviceMemory::getMemory()
-{
-    return data;
-}
-
-VkResult DeviceMemory::flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
-{
-	VkMappedMemoryRange mappedMemoryRange{};
-
-	mappedMemoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-
-	mappedMemoryRange.memory = deviceMemory;
-	mappedMemoryRange.offset = offset;
-	mappedMemoryRange.size = size;
-
-	return vkFlushMappedMemoryRanges(device, 1, &mappedMemoryRange);
+    return 0;
 }
 
 VkResult DeviceMemory::invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
@@ -162,42 +118,31 @@ VkResult DeviceMemory::invalidateMappedMemoryRanges(const VkDeviceSize offset, c
 	return vkInvalidateMappedMemoryRanges(device, 1, & mappedMemoryRange);
 }
 
-void DeviceMemory::unmapMemory()
-{
-    if (!(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
-    {
-        return;
-    }
-
-    if (mapped)
-    {
-        vkUnmapMemory(device, deviceMemory);
-
-        data = nullptr;
+//
+// MappableDeviceMemory
+//
 
-        mapped = VK_FALSE;
-    }
+VkResult DeviceMemory::mapRange(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags, void** rangeData)
+{
+    return vkMapMemory(device, deviceMemory, offset, size, flags, rangeData);
 }
 
-VkResult DeviceMemory::upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize)
+void DeviceMemory::unmapRange()
 {
-    auto result = mapMemory(offset, uploadDataSize, flags);
-
-    if (result != VK_SUCCESS)
-    {
-        return result;
-    }
+    vkUnmapMemory(device, deviceMemory);
+}
 
-    memcpy(data, uploadData, uploadDataSize);
+VkResult DeviceMemory::flushRange(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+	VkMappedMemoryRange mappedMemoryRange{};
 
-	if (!(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
-	{
-		result = flushMappedMemoryRanges(offset, uploadDataSize);
-	}
+	mappedMemoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
 
-    unmapMemory();
+	mappedMemoryRange.memory = deviceMemory;
+	mappedMemoryRange.offset = offset;
+	mappedMemoryRange.size = size;
 
-    return result;
+	return vkFlushMappedMemoryRanges(device, 1, &mappedMemoryRange);
 }
 
 //
@@ -208,7 +153,7 @@ void DeviceMemory::destroy()
 {
     if (deviceMemory)
     {
-        if (mapped)
+        if (isMapped())
         {
             unmapMemory();
         }
@@ -29,10 +29,12 @@
 
 #include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
 
+#include "MappableDeviceMemory.hpp"
+
 namespace vkts
 {
 
-class DeviceMemory: public IDeviceMemory
+class DeviceMemory: public MappableDeviceMemory
 {
 
 private:
@@ -47,8 +49,17 @@ private:
 
     VkDeviceMemory deviceMemory;
 
-    void* data;
-    VkBool32 mapped;
+protected:
+
+    //
+    // MappableDeviceMemory
+    //
+
+    virtual VkResult mapRange(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags, void** rangeData) override;
+
+    virtual void unmapRange() override;
+
+    virtual VkResult flushRange(const VkDeviceSize offset, const VkDeviceSize size) const override;
 
 public:
 
@@ -84,18 +95,10 @@ public:
 
     virtual const VkDeviceMemory getDeviceMemory() const override;
 
-    virtual VkResult mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags) override;
-
-    virtual void* getMemory() override;
-
-    virtual VkResult flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override;
+    virtual VkDeviceSize getOffset() const override;
 
     virtual VkResult invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override;
 
-    virtual void unmapMemory() override;
-
-    virtual VkResult upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize) override;
-
     //
     // IDestroyable
     //
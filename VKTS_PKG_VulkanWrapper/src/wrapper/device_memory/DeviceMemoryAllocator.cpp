@@ -0,0 +1,276 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "DeviceMemoryAllocator.hpp"
+
+#include "DeviceMemorySuballocation.hpp"
+
+namespace vkts
+{
+
+IDeviceMemorySP DeviceMemoryAllocator::allocateDedicated(const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags)
+{
+    auto deviceMemory = createFunction(memoryRequirements, propertyFlags);
+
+    if (!deviceMemory.get())
+    {
+        return IDeviceMemorySP();
+    }
+
+    for (auto& currentDedicatedMemory : allDedicatedMemories)
+    {
+        if (currentDedicatedMemory.expired())
+        {
+            currentDedicatedMemory = deviceMemory;
+
+            return deviceMemory;
+        }
+    }
+
+    allDedicatedMemories.push_back(deviceMemory);
+
+    return deviceMemory;
+}
+
+void DeviceMemoryAllocator::addDedicatedStatistics(VkTsDeviceMemoryStatistics& statistics, const uint32_t memoryTypeIndex) const
+{
+    for (const auto& currentDedicatedMemory : allDedicatedMemories)
+    {
+        auto deviceMemory = currentDedicatedMemory.lock();
+
+        if (!deviceMemory.get() || !deviceMemory->getDeviceMemory() || deviceMemory->getMemoryTypeIndex() != memoryTypeIndex)
+        {
+            continue;
+        }
+
+        statistics.dedicatedCount++;
+        statistics.dedicatedBytes += deviceMemory->getAllocationSize();
+    }
+}
+
+void DeviceMemoryAllocator::updateFragmentation(VkTsDeviceMemoryStatistics& statistics)
+{
+    const VkDeviceSize freeBytes = statistics.blockBytes - statistics.usedBytes;
+
+    if (freeBytes == 0)
+    {
+        statistics.fragmentation = 0.0f;
+
+        return;
+    }
+
+    statistics.fragmentation = 1.0f - (float)((double)statistics.largestFreeRange / (double)freeBytes);
+}
+
+DeviceMemoryAllocator::DeviceMemoryAllocator(const DeviceMemoryCreateFunction& createFunction, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkDeviceSize* blockSizes, const VkDeviceSize bufferImageGranularity, const VkDeviceSize nonCoherentAtomSize) :
+    IDeviceMemoryAllocator(), createFunction(createFunction), allMemoryTypes(memoryTypes, memoryTypes + memoryTypeCount), allBlockSizes(blockSizes, blockSizes + memoryTypeCount), bufferImageGranularity(glm::max(bufferImageGranularity, (VkDeviceSize)1)), nonCoherentAtomSize(glm::max(nonCoherentAtomSize, (VkDeviceSize)1)), allPools(memoryTypeCount * 2), allDedicatedMemories(), mutex()
+{
+}
+
+DeviceMemoryAllocator::~DeviceMemoryAllocator()
+{
+    destroy();
+}
+
+//
+// IDeviceMemoryAllocator
+//
+
+IDeviceMemorySP DeviceMemoryAllocator::allocate(const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags, const VkBool32 linear)
+{
+    if (memoryRequirements.size == 0)
+    {
+        return IDeviceMemorySP();
+    }
+
+    uint32_t memoryTypeIndex;
+
+    if (!deviceGetMemoryTypeIndex((uint32_t) allMemoryTypes.size(), allMemoryTypes.data(), memoryRequirements.memoryTypeBits, propertyFlags, memoryTypeIndex))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get memory type index.");
+
+        return IDeviceMemorySP();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const VkDeviceSize blockSize = allBlockSizes[memoryTypeIndex];
+
+    if (memoryRequirements.size > blockSize / 2)
+    {
+        return allocateDedicated(memoryRequirements, propertyFlags);
+    }
+
+    const VkDeviceSize alignment = glm::max(memoryRequirements.alignment, (VkDeviceSize)1);
+
+    auto& pool = allPools[memoryTypeIndex * 2 + ((!linear && bufferImageGranularity > 1) ? 1 : 0)];
+
+    VkDeviceSize offset;
+    uint32_t rangeIndex;
+
+    for (const auto& currentBlock : pool)
+    {
+        if (currentBlock->allocate(offset, rangeIndex, memoryRequirements.size, alignment))
+        {
+            return IDeviceMemorySP(new DeviceMemorySuballocation(currentBlock, memoryRequirements.size, propertyFlags, offset, rangeIndex));
+        }
+    }
+
+    //
+
+    VkMemoryRequirements blockMemoryRequirements{};
+
+    blockMemoryRequirements.size = blockSize;
+    blockMemoryRequirements.alignment = 1;
+    blockMemoryRequirements.memoryTypeBits = 1u << memoryTypeIndex;
+
+    auto deviceMemory = createFunction(blockMemoryRequirements, allMemoryTypes[memoryTypeIndex].propertyFlags);
+
+    if (!deviceMemory.get())
+    {
+        // Heap could be too fragmented or full for a whole block.
+        return allocateDedicated(memoryRequirements, propertyFlags);
+    }
+
+    auto newBlock = DeviceMemoryBlockSP(new DeviceMemoryBlock(deviceMemory, nonCoherentAtomSize));
+
+    if (!newBlock->allocate(offset, rangeIndex, memoryRequirements.size, alignment))
+    {
+        newBlock->destroy();
+
+        return allocateDedicated(memoryRequirements, propertyFlags);
+    }
+
+    pool.push_back(newBlock);
+
+    return IDeviceMemorySP(new DeviceMemorySuballocation(newBlock, memoryRequirements.size, propertyFlags, offset, rangeIndex));
+}
+
+VkBool32 DeviceMemoryAllocator::getStatistics(VkTsDeviceMemoryStatistics& statistics, const uint32_t memoryTypeIndex) const
+{
+    statistics = VkTsDeviceMemoryStatistics{};
+
+    if (memoryTypeIndex >= (uint32_t) allMemoryTypes.size())
+    {
+        return VK_FALSE;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (uint32_t poolIndex = memoryTypeIndex * 2; poolIndex < memoryTypeIndex * 2 + 2; poolIndex++)
+    {
+        for (const auto& currentBlock : allPools[poolIndex])
+        {
+            currentBlock->addStatistics(statistics);
+        }
+    }
+
+    addDedicatedStatistics(statistics, memoryTypeIndex);
+
+    updateFragmentation(statistics);
+
+    return VK_TRUE;
+}
+
+void DeviceMemoryAllocator::getStatistics(VkTsDeviceMemoryStatistics& statistics) const
+{
+    statistics = VkTsDeviceMemoryStatistics{};
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (uint32_t memoryTypeIndex = 0; memoryTypeIndex < (uint32_t) allMemoryTypes.size(); memoryTypeIndex++)
+    {
+        for (uint32_t poolIndex = memoryTypeIndex * 2; poolIndex < memoryTypeIndex * 2 + 2; poolIndex++)
+        {
+            for (const auto& currentBlock : allPools[poolIndex])
+            {
+                currentBlock->addStatistics(statistics);
+            }
+        }
+
+        addDedicatedStatistics(statistics, memoryTypeIndex);
+    }
+
+    updateFragmentation(statistics);
+}
+
+VkDeviceSize DeviceMemoryAllocator::getBlockSize(const uint32_t memoryTypeIndex) const
+{
+    if (memoryTypeIndex >= (uint32_t) allBlockSizes.size())
+    {
+        return 0;
+    }
+
+    return allBlockSizes[memoryTypeIndex];
+}
+
+void DeviceMemoryAllocator::freeUnusedBlocks()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto& currentPool : allPools)
+    {
+        auto walker = currentPool.begin();
+
+        while (walker != currentPool.end())
+        {
+            if ((*walker)->getAllocationCount() == 0)
+            {
+                (*walker)->destroy();
+
+                walker = currentPool.erase(walker);
+            }
+            else
+            {
+                walker++;
+            }
+        }
+    }
+}
+
+//
+// IDestroyable
+//
+
+void DeviceMemoryAllocator::destroy()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Device memory has to be freed before the device is destroyed, even if sub allocations are still referenced.
+    for (auto& currentPool : allPools)
+    {
+        for (auto& currentBlock : currentPool)
+        {
+            currentBlock->destroy();
+        }
+
+        currentPool.clear();
+    }
+
+    allDedicatedMemories.clear();
+}
+
+} /* namespace vkts */
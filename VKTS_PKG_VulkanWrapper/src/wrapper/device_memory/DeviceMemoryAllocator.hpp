@@ -0,0 +1,101 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_DEVICEMEMORYALLOCATOR_HPP_
+#define VKTS_DEVICEMEMORYALLOCATOR_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+#include "DeviceMemoryBlock.hpp"
+
+namespace vkts
+{
+
+class DeviceMemoryAllocator: public IDeviceMemoryAllocator
+{
+
+private:
+
+    const DeviceMemoryCreateFunction createFunction;
+
+    std::vector<VkMemoryType> allMemoryTypes;
+
+    std::vector<VkDeviceSize> allBlockSizes;
+
+    const VkDeviceSize bufferImageGranularity;
+
+    const VkDeviceSize nonCoherentAtomSize;
+
+    // Two pools per memory type, so linear and optimal resources never share a granularity page.
+    std::vector<std::vector<DeviceMemoryBlockSP>> allPools;
+
+    std::vector<std::weak_ptr<IDeviceMemory>> allDedicatedMemories;
+
+    mutable std::mutex mutex;
+
+    IDeviceMemorySP allocateDedicated(const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags);
+
+    void addDedicatedStatistics(VkTsDeviceMemoryStatistics& statistics, const uint32_t memoryTypeIndex) const;
+
+    static void updateFragmentation(VkTsDeviceMemoryStatistics& statistics);
+
+public:
+
+    DeviceMemoryAllocator() = delete;
+    DeviceMemoryAllocator(const DeviceMemoryCreateFunction& createFunction, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkDeviceSize* blockSizes, const VkDeviceSize bufferImageGranularity, const VkDeviceSize nonCoherentAtomSize);
+    DeviceMemoryAllocator(const DeviceMemoryAllocator& other) = delete;
+    DeviceMemoryAllocator(DeviceMemoryAllocator&& other) = delete;
+    virtual ~DeviceMemoryAllocator();
+
+    DeviceMemoryAllocator& operator =(const DeviceMemoryAllocator& other) = delete;
+
+    DeviceMemoryAllocator& operator =(DeviceMemoryAllocator && other) = delete;
+
+    //
+    // IDeviceMemoryAllocator
+    //
+
+    virtual IDeviceMemorySP allocate(const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags, const VkBool32 linear) override;
+
+    virtual VkBool32 getStatistics(VkTsDeviceMemoryStatistics& statistics, const uint32_t memoryTypeIndex) const override;
+
+    virtual void getStatistics(VkTsDeviceMemoryStatistics& statistics) const override;
+
+    virtual VkDeviceSize getBlockSize(const uint32_t memoryTypeIndex) const override;
+
+    virtual void freeUnusedBlocks() override;
+
+    //
+    // IDestroyable
+    //
+
+    virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_DEVICEMEMORYALLOCATOR_HPP_ */
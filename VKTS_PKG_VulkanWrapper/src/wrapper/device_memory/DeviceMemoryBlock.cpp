@@ -0,0 +1,146 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "DeviceMemoryBlock.hpp"
+
+namespace vkts
+{
+
+DeviceMemoryBlock::DeviceMemoryBlock(const IDeviceMemorySP& deviceMemory, const VkDeviceSize nonCoherentAtomSize) :
+    deviceMemory(deviceMemory), nonCoherentAtomSize(glm::max(nonCoherentAtomSize, (VkDeviceSize)1)), rangeAllocator(deviceMemory.get() ? deviceMemory->getAllocationSize() : 0), data(nullptr), mutex()
+{
+    if (this->deviceMemory.get() && (this->deviceMemory->getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+    {
+        if (this->deviceMemory->mapMemory(0, VK_WHOLE_SIZE, 0) == VK_SUCCESS)
+        {
+            data = (uint8_t*)this->deviceMemory->getMemory();
+        }
+        else
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not map memory block.");
+        }
+    }
+}
+
+DeviceMemoryBlock::~DeviceMemoryBlock()
+{
+    destroy();
+}
+
+const IDeviceMemorySP& DeviceMemoryBlock::getDeviceMemory() const
+{
+    return deviceMemory;
+}
+
+uint8_t* DeviceMemoryBlock::getData() const
+{
+    return data;
+}
+
+VkBool32 DeviceMemoryBlock::allocate(VkDeviceSize& offset, uint32_t& rangeIndex, const VkDeviceSize size, const VkDeviceSize alignment)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!deviceMemory.get())
+    {
+        return VK_FALSE;
+    }
+
+    return rangeAllocator.allocate(offset, rangeIndex, size, alignment);
+}
+
+void DeviceMemoryBlock::free(const uint32_t rangeIndex)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    rangeAllocator.free(rangeIndex);
+}
+
+uint32_t DeviceMemoryBlock::getAllocationCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return rangeAllocator.getAllocationCount();
+}
+
+VkResult DeviceMemoryBlock::flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    if (!deviceMemory.get())
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    const VkDeviceSize begin = (offset / nonCoherentAtomSize) * nonCoherentAtomSize;
+    const VkDeviceSize end = glm::min(alignmentGetSizeInBytes(offset + size, nonCoherentAtomSize), deviceMemory->getAllocationSize());
+
+    return deviceMemory->flushMappedMemoryRanges(begin, end - begin);
+}
+
+VkResult DeviceMemoryBlock::invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    if (!deviceMemory.get())
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    const VkDeviceSize begin = (offset / nonCoherentAtomSize) * nonCoherentAtomSize;
+    const VkDeviceSize end = glm::min(alignmentGetSizeInBytes(offset + size, nonCoherentAtomSize), deviceMemory->getAllocationSize());
+
+    return deviceMemory->invalidateMappedMemoryRanges(begin, end - begin);
+}
+
+void DeviceMemoryBlock::addStatistics(VkTsDeviceMemoryStatistics& statistics) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!deviceMemory.get())
+    {
+        return;
+    }
+
+    statistics.blockCount++;
+    statistics.blockBytes += rangeAllocator.getSize();
+    statistics.allocationCount += rangeAllocator.getAllocationCount();
+    statistics.usedBytes += rangeAllocator.getUsedSize();
+    statistics.freeRangeCount += rangeAllocator.getFreeRangeCount();
+    statistics.largestFreeRange = glm::max(statistics.largestFreeRange, rangeAllocator.getLargestFreeRange());
+}
+
+void DeviceMemoryBlock::destroy()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (deviceMemory.get())
+    {
+        deviceMemory->destroy();
+
+        deviceMemory.reset();
+    }
+
+    data = nullptr;
+}
+
+} /* namespace vkts */
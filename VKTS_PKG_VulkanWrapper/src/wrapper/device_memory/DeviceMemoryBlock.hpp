@@ -0,0 +1,111 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_DEVICEMEMORYBLOCK_HPP_
+#define VKTS_DEVICEMEMORYBLOCK_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+#include "DeviceMemoryRangeAllocator.hpp"
+
+namespace vkts
+{
+
+/**
+ * One device memory, shared by several sub allocations.
+ * Host visible blocks stay mapped, as a device memory can only be mapped once.
+ */
+class DeviceMemoryBlock
+{
+
+private:
+
+    IDeviceMemorySP deviceMemory;
+
+    const VkDeviceSize nonCoherentAtomSize;
+
+    DeviceMemoryRangeAllocator rangeAllocator;
+
+    uint8_t* data;
+
+    mutable std::mutex mutex;
+
+public:
+
+    DeviceMemoryBlock() = delete;
+    DeviceMemoryBlock(const IDeviceMemorySP& deviceMemory, const VkDeviceSize nonCoherentAtomSize);
+    DeviceMemoryBlock(const DeviceMemoryBlock& other) = delete;
+    DeviceMemoryBlock(DeviceMemoryBlock&& other) = delete;
+    ~DeviceMemoryBlock();
+
+    DeviceMemoryBlock& operator =(const DeviceMemoryBlock& other) = delete;
+    DeviceMemoryBlock& operator =(DeviceMemoryBlock && other) = delete;
+
+    const IDeviceMemorySP& getDeviceMemory() const;
+
+    uint8_t* getData() const;
+
+    /**
+     * @ThreadSafe
+     */
+    VkBool32 allocate(VkDeviceSize& offset, uint32_t& rangeIndex, const VkDeviceSize size, const VkDeviceSize alignment);
+
+    /**
+     * @ThreadSafe
+     */
+    void free(const uint32_t rangeIndex);
+
+    /**
+     * @ThreadSafe
+     */
+    uint32_t getAllocationCount() const;
+
+    /**
+     * Range is expanded to the non coherent atom size.
+     */
+    VkResult flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const;
+
+    /**
+     * Range is expanded to the non coherent atom size.
+     */
+    VkResult invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const;
+
+    /**
+     * Adds the values of this block.
+     *
+     * @ThreadSafe
+     */
+    void addStatistics(VkTsDeviceMemoryStatistics& statistics) const;
+
+    void destroy();
+
+};
+
+typedef std::shared_ptr<DeviceMemoryBlock> DeviceMemoryBlockSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_DEVICEMEMORYBLOCK_HPP_ */
@@ -0,0 +1,435 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "DeviceMemoryRangeAllocator.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace vkts
+{
+
+static uint32_t deviceMemoryFindFirstSet(const uint64_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+
+    _BitScanForward64(&index, value);
+
+    return (uint32_t)index;
+#else
+    return (uint32_t)__builtin_ctzll(value);
+#endif
+}
+
+static uint32_t deviceMemoryFindLastSet(const uint64_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+
+    _BitScanReverse64(&index, value);
+
+    return (uint32_t)index;
+#else
+    return 63u - (uint32_t)__builtin_clzll(value);
+#endif
+}
+
+void DeviceMemoryRangeAllocator::mapping(uint32_t& firstLevel, uint32_t& secondLevel, const VkDeviceSize size)
+{
+    // Small sizes are stored linear in the first level.
+
+    if (size < (VkDeviceSize)VKTS_DEVICE_MEMORY_SECOND_LEVEL_COUNT)
+    {
+        firstLevel = 0;
+        secondLevel = (uint32_t)size;
+
+        return;
+    }
+
+    uint32_t lastSet = deviceMemoryFindLastSet(size);
+
+    firstLevel = lastSet - VKTS_DEVICE_MEMORY_SECOND_LEVEL_LOG2 + 1;
+    secondLevel = (uint32_t)(size >> (lastSet - VKTS_DEVICE_MEMORY_SECOND_LEVEL_LOG2)) - VKTS_DEVICE_MEMORY_SECOND_LEVEL_COUNT;
+}
+
+uint32_t DeviceMemoryRangeAllocator::createRange()
+{
+    if (allUnusedRanges.size() > 0)
+    {
+        uint32_t rangeIndex = allUnusedRanges.back();
+
+        allUnusedRanges.pop_back();
+
+        return rangeIndex;
+    }
+
+    allRanges.push_back(DeviceMemoryRange{0, 0, VKTS_DEVICE_MEMORY_NO_RANGE, VKTS_DEVICE_MEMORY_NO_RANGE, VKTS_DEVICE_MEMORY_NO_RANGE, VKTS_DEVICE_MEMORY_NO_RANGE, VK_FALSE});
+
+    return (uint32_t)allRanges.size() - 1;
+}
+
+void DeviceMemoryRangeAllocator::releaseRange(const uint32_t rangeIndex)
+{
+    allRanges[rangeIndex] = DeviceMemoryRange{0, 0, VKTS_DEVICE_MEMORY_NO_RANGE, VKTS_DEVICE_MEMORY_NO_RANGE, VKTS_DEVICE_MEMORY_NO_RANGE, VKTS_DEVICE_MEMORY_NO_RANGE, VK_FALSE};
+
+    allUnusedRanges.push_back(rangeIndex);
+}
+
+void DeviceMemoryRangeAllocator::insertFree(const uint32_t rangeIndex)
+{
+    uint32_t firstLevel;
+    uint32_t secondLevel;
+
+    mapping(firstLevel, secondLevel, allRanges[rangeIndex].size);
+
+    uint32_t head = freeRanges[firstLevel][secondLevel];
+
+    allRanges[rangeIndex].free = VK_TRUE;
+    allRanges[rangeIndex].previousFree = VKTS_DEVICE_MEMORY_NO_RANGE;
+    allRanges[rangeIndex].nextFree = head;
+
+    if (head != VKTS_DEVICE_MEMORY_NO_RANGE)
+    {
+        allRanges[head].previousFree = rangeIndex;
+    }
+
+    freeRanges[firstLevel][secondLevel] = rangeIndex;
+
+    firstLevelBitmap |= (1ull << firstLevel);
+    secondLevelBitmaps[firstLevel] |= (1u << secondLevel);
+
+    freeRangeCount++;
+}
+
+void DeviceMemoryRangeAllocator::removeFree(const uint32_t rangeIndex)
+{
+    uint32_t firstLevel;
+    uint32_t secondLevel;
+
+    mapping(firstLevel, secondLevel, allRanges[rangeIndex].size);
+
+    uint32_t previousFree = allRanges[rangeIndex].previousFree;
+    uint32_t nextFree = allRanges[rangeIndex].nextFree;
+
+    if (previousFree != VKTS_DEVICE_MEMORY_NO_RANGE)
+    {
+        allRanges[previousFree].nextFree = nextFree;
+    }
+    else
+    {
+        freeRanges[firstLevel][secondLevel] = nextFree;
+
+        if (nextFree == VKTS_DEVICE_MEMORY_NO_RANGE)
+        {
+            secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+
+            if (secondLevelBitmaps[firstLevel] == 0)
+            {
+                firstLevelBitmap &= ~(1ull << firstLevel);
+            }
+        }
+    }
+
+    if (nextFree != VKTS_DEVICE_MEMORY_NO_RANGE)
+    {
+        allRanges[nextFree].previousFree = previousFree;
+    }
+
+    allRanges[rangeIndex].free = VK_FALSE;
+    allRanges[rangeIndex].previousFree = VKTS_DEVICE_MEMORY_NO_RANGE;
+    allRanges[rangeIndex].nextFree = VKTS_DEVICE_MEMORY_NO_RANGE;
+
+    freeRangeCount--;
+}
+
+uint32_t DeviceMemoryRangeAllocator::findFree(const VkDeviceSize size) const
+{
+    VkDeviceSize searchSize = size;
+
+    // Round up to the next list, so every range in the found list is large enough.
+
+    if (searchSize >= (VkDeviceSize)VKTS_DEVICE_MEMORY_SECOND_LEVEL_COUNT)
+    {
+        searchSize += (1ull << (deviceMemoryFindLastSet(searchSize) - VKTS_DEVICE_MEMORY_SECOND_LEVEL_LOG2)) - 1;
+
+        if (searchSize < size)
+        {
+            return VKTS_DEVICE_MEMORY_NO_RANGE;
+        }
+    }
+
+    uint32_t firstLevel;
+    uint32_t secondLevel;
+
+    mapping(firstLevel, secondLevel, searchSize);
+
+    uint32_t secondLevelMap = secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+
+    if (secondLevelMap == 0)
+    {
+        if (firstLevel + 1 >= VKTS_DEVICE_MEMORY_FIRST_LEVEL_COUNT)
+        {
+            return VKTS_DEVICE_MEMORY_NO_RANGE;
+        }
+
+        uint64_t firstLevelMap = firstLevelBitmap & (~0ull << (firstLevel + 1));
+
+        if (firstLevelMap == 0)
+        {
+            return VKTS_DEVICE_MEMORY_NO_RANGE;
+        }
+
+        firstLevel = deviceMemoryFindFirstSet(firstLevelMap);
+
+        secondLevelMap = secondLevelBitmaps[firstLevel];
+    }
+
+    secondLevel = deviceMemoryFindFirstSet(secondLevelMap);
+
+    return freeRanges[firstLevel][secondLevel];
+}
+
+DeviceMemoryRangeAllocator::DeviceMemoryRangeAllocator(const VkDeviceSize size) :
+    size(size), usedSize(0), allocationCount(0), freeRangeCount(0), allRanges(), allUnusedRanges(), firstLevelBitmap(0)
+{
+    for (uint32_t firstLevel = 0; firstLevel < VKTS_DEVICE_MEMORY_FIRST_LEVEL_COUNT; firstLevel++)
+    {
+        secondLevelBitmaps[firstLevel] = 0;
+
+        for (uint32_t secondLevel = 0; secondLevel < VKTS_DEVICE_MEMORY_SECOND_LEVEL_COUNT; secondLevel++)
+        {
+            freeRanges[firstLevel][secondLevel] = VKTS_DEVICE_MEMORY_NO_RANGE;
+        }
+    }
+
+    if (size > 0)
+    {
+        uint32_t rangeIndex = createRange();
+
+        allRanges[rangeIndex].offset = 0;
+        allRanges[rangeIndex].size = size;
+
+        insertFree(rangeIndex);
+    }
+}
+
+DeviceMemoryRangeAllocator::~DeviceMemoryRangeAllocator()
+{
+}
+
+VkBool32 DeviceMemoryRangeAllocator::allocate(VkDeviceSize& offset, uint32_t& rangeIndex, const VkDeviceSize size, const VkDeviceSize alignment)
+{
+    if (size == 0 || size > this->size)
+    {
+        return VK_FALSE;
+    }
+
+    const VkDeviceSize currentAlignment = glm::max(alignment, (VkDeviceSize)1);
+
+    uint32_t currentRangeIndex = findFree(size);
+
+    if (currentRangeIndex != VKTS_DEVICE_MEMORY_NO_RANGE)
+    {
+        const VkDeviceSize alignedOffset = alignmentGetSizeInBytes(allRanges[currentRangeIndex].offset, currentAlignment);
+
+        if (alignedOffset - allRanges[currentRangeIndex].offset + size > allRanges[currentRangeIndex].size)
+        {
+            currentRangeIndex = VKTS_DEVICE_MEMORY_NO_RANGE;
+        }
+    }
+
+    // Range with enough space for any alignment.
+
+    if (currentRangeIndex == VKTS_DEVICE_MEMORY_NO_RANGE && currentAlignment > 1)
+    {
+        currentRangeIndex = findFree(size + currentAlignment - 1);
+    }
+
+    if (currentRangeIndex == VKTS_DEVICE_MEMORY_NO_RANGE)
+    {
+        return VK_FALSE;
+    }
+
+    removeFree(currentRangeIndex);
+
+    //
+
+    const VkDeviceSize padding = alignmentGetSizeInBytes(allRanges[currentRangeIndex].offset, currentAlignment) - allRanges[currentRangeIndex].offset;
+
+    if (padding > 0)
+    {
+        uint32_t paddingRangeIndex = createRange();
+
+        allRanges[paddingRangeIndex].offset = allRanges[currentRangeIndex].offset;
+        allRanges[paddingRangeIndex].size = padding;
+        allRanges[paddingRangeIndex].previousPhysical = allRanges[currentRangeIndex].previousPhysical;
+        allRanges[paddingRangeIndex].nextPhysical = currentRangeIndex;
+
+        if (allRanges[currentRangeIndex].previousPhysical != VKTS_DEVICE_MEMORY_NO_RANGE)
+        {
+            allRanges[allRanges[currentRangeIndex].previousPhysical].nextPhysical = paddingRangeIndex;
+        }
+
+        allRanges[currentRangeIndex].previousPhysical = paddingRangeIndex;
+        allRanges[currentRangeIndex].offset += padding;
+        allRanges[currentRangeIndex].size -= padding;
+
+        insertFree(paddingRangeIndex);
+    }
+
+    if (allRanges[currentRangeIndex].size > size)
+    {
+        uint32_t remainingRangeIndex = createRange();
+
+        allRanges[remainingRangeIndex].offset = allRanges[currentRangeIndex].offset + size;
+        allRanges[remainingRangeIndex].size = allRanges[currentRangeIndex].size - size;
+        allRanges[remainingRangeIndex].previousPhysical = currentRangeIndex;
+        allRanges[remainingRangeIndex].nextPhysical = allRanges[currentRangeIndex].nextPhysical;
+
+        if (allRanges[currentRangeIndex].nextPhysical != VKTS_DEVICE_MEMORY_NO_RANGE)
+        {
+            allRanges[allRanges[currentRangeIndex].nextPhysical].previousPhysical = remainingRangeIndex;
+        }
+
+        allRanges[currentRangeIndex].nextPhysical = remainingRangeIndex;
+        allRanges[currentRangeIndex].size = size;
+
+        insertFree(remainingRangeIndex);
+    }
+
+    //
+
+    usedSize += size;
+
+    allocationCount++;
+
+    offset = allRanges[currentRangeIndex].offset;
+    rangeIndex = currentRangeIndex;
+
+    return VK_TRUE;
+}
+
+void DeviceMemoryRangeAllocator::free(const uint32_t rangeIndex)
+{
+    if (rangeIndex >= (uint32_t)allRanges.size() || allRanges[rangeIndex].free || allRanges[rangeIndex].size == 0)
+    {
+        return;
+    }
+
+    usedSize -= allRanges[rangeIndex].size;
+
+    allocationCount--;
+
+    // Merge with the free neighbours, so no two free ranges are next to each other.
+
+    uint32_t currentRangeIndex = rangeIndex;
+
+    uint32_t previousPhysical = allRanges[currentRangeIndex].previousPhysical;
+
+    if (previousPhysical != VKTS_DEVICE_MEMORY_NO_RANGE && allRanges[previousPhysical].free)
+    {
+        removeFree(previousPhysical);
+
+        allRanges[previousPhysical].size += allRanges[currentRangeIndex].size;
+        allRanges[previousPhysical].nextPhysical = allRanges[currentRangeIndex].nextPhysical;
+
+        if (allRanges[currentRangeIndex].nextPhysical != VKTS_DEVICE_MEMORY_NO_RANGE)
+        {
+            allRanges[allRanges[currentRangeIndex].nextPhysical].previousPhysical = previousPhysical;
+        }
+
+        releaseRange(currentRangeIndex);
+
+        currentRangeIndex = previousPhysical;
+    }
+
+    uint32_t nextPhysical = allRanges[currentRangeIndex].nextPhysical;
+
+    if (nextPhysical != VKTS_DEVICE_MEMORY_NO_RANGE && allRanges[nextPhysical].free)
+    {
+        removeFree(nextPhysical);
+
+        allRanges[currentRangeIndex].size += allRanges[nextPhysical].size;
+        allRanges[currentRangeIndex].nextPhysical = allRanges[nextPhysical].nextPhysical;
+
+        if (allRanges[nextPhysical].nextPhysical != VKTS_DEVICE_MEMORY_NO_RANGE)
+        {
+            allRanges[allRanges[nextPhysical].nextPhysical].previousPhysical = currentRangeIndex;
+        }
+
+        releaseRange(nextPhysical);
+    }
+
+    insertFree(currentRangeIndex);
+}
+
+VkDeviceSize DeviceMemoryRangeAllocator::getSize() const
+{
+    return size;
+}
+
+VkDeviceSize DeviceMemoryRangeAllocator::getUsedSize() const
+{
+    return usedSize;
+}
+
+uint32_t DeviceMemoryRangeAllocator::getAllocationCount() const
+{
+    return allocationCount;
+}
+
+uint32_t DeviceMemoryRangeAllocator::getFreeRangeCount() const
+{
+    return freeRangeCount;
+}
+
+VkDeviceSize DeviceMemoryRangeAllocator::getLargestFreeRange() const
+{
+    if (firstLevelBitmap == 0)
+    {
+        return 0;
+    }
+
+    uint32_t firstLevel = deviceMemoryFindLastSet(firstLevelBitmap);
+    uint32_t secondLevel = deviceMemoryFindLastSet(secondLevelBitmaps[firstLevel]);
+
+    VkDeviceSize largestFreeRange = 0;
+
+    uint32_t rangeIndex = freeRanges[firstLevel][secondLevel];
+
+    while (rangeIndex != VKTS_DEVICE_MEMORY_NO_RANGE)
+    {
+        largestFreeRange = glm::max(largestFreeRange, allRanges[rangeIndex].size);
+
+        rangeIndex = allRanges[rangeIndex].nextFree;
+    }
+
+    return largestFreeRange;
+}
+
+} /* namespace vkts */
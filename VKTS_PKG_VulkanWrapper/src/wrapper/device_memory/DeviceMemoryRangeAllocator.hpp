@@ -0,0 +1,123 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_DEVICEMEMORYRANGEALLOCATOR_HPP_
+#define VKTS_DEVICEMEMORYRANGEALLOCATOR_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+#define VKTS_DEVICE_MEMORY_SECOND_LEVEL_LOG2 5
+#define VKTS_DEVICE_MEMORY_SECOND_LEVEL_COUNT (1 << VKTS_DEVICE_MEMORY_SECOND_LEVEL_LOG2)
+#define VKTS_DEVICE_MEMORY_FIRST_LEVEL_COUNT 64
+
+#define VKTS_DEVICE_MEMORY_NO_RANGE 0xFFFFFFFF
+
+namespace vkts
+{
+
+/**
+ * Two level segregated fit allocator for ranges inside one device memory block.
+ * Allocating and freeing takes constant time. Bookkeeping is done outside of the managed memory,
+ * so no Vulkan call is done and the allocator can be used without a device.
+ */
+class DeviceMemoryRangeAllocator
+{
+
+private:
+
+    typedef struct DeviceMemoryRange_ {
+        VkDeviceSize offset;
+        VkDeviceSize size;
+        uint32_t previousPhysical;
+        uint32_t nextPhysical;
+        uint32_t previousFree;
+        uint32_t nextFree;
+        VkBool32 free;
+    } DeviceMemoryRange;
+
+    VkDeviceSize size;
+
+    VkDeviceSize usedSize;
+
+    uint32_t allocationCount;
+
+    uint32_t freeRangeCount;
+
+    std::vector<DeviceMemoryRange> allRanges;
+
+    std::vector<uint32_t> allUnusedRanges;
+
+    uint64_t firstLevelBitmap;
+
+    uint32_t secondLevelBitmaps[VKTS_DEVICE_MEMORY_FIRST_LEVEL_COUNT];
+
+    uint32_t freeRanges[VKTS_DEVICE_MEMORY_FIRST_LEVEL_COUNT][VKTS_DEVICE_MEMORY_SECOND_LEVEL_COUNT];
+
+    static void mapping(uint32_t& firstLevel, uint32_t& secondLevel, const VkDeviceSize size);
+
+    uint32_t createRange();
+
+    void releaseRange(const uint32_t rangeIndex);
+
+    void insertFree(const uint32_t rangeIndex);
+
+    void removeFree(const uint32_t rangeIndex);
+
+    uint32_t findFree(const VkDeviceSize size) const;
+
+public:
+
+    DeviceMemoryRangeAllocator() = delete;
+    explicit DeviceMemoryRangeAllocator(const VkDeviceSize size);
+    DeviceMemoryRangeAllocator(const DeviceMemoryRangeAllocator& other) = delete;
+    DeviceMemoryRangeAllocator(DeviceMemoryRangeAllocator&& other) = delete;
+    ~DeviceMemoryRangeAllocator();
+
+    DeviceMemoryRangeAllocator& operator =(const DeviceMemoryRangeAllocator& other) = delete;
+    DeviceMemoryRangeAllocator& operator =(DeviceMemoryRangeAllocator && other) = delete;
+
+    /**
+     * Alignment has to be a power of two. Returns VK_FALSE, if no free range is large enough.
+     */
+    VkBool32 allocate(VkDeviceSize& offset, uint32_t& rangeIndex, const VkDeviceSize size, const VkDeviceSize alignment);
+
+    void free(const uint32_t rangeIndex);
+
+    VkDeviceSize getSize() const;
+
+    VkDeviceSize getUsedSize() const;
+
+    uint32_t getAllocationCount() const;
+
+    uint32_t getFreeRangeCount() const;
+
+    VkDeviceSize getLargestFreeRange() const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_DEVICEMEMORYRANGEALLOCATOR_HPP_ */
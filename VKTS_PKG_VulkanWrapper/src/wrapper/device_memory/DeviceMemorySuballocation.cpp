@@ -0,0 +1,182 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "DeviceMemorySuballocation.hpp"
+
+namespace vkts
+{
+
+DeviceMemorySuballocation::DeviceMemorySuballocation(const DeviceMemoryBlockSP& block, const VkDeviceSize size, const VkMemoryPropertyFlags memoryPropertyFlags, const VkDeviceSize offset, const uint32_t rangeIndex) :
+    MappableDeviceMemory(), block(block), memoryAllocInfo{VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr, size, block->getDeviceMemory()->getMemoryTypeIndex()}, memoryPropertyFlags(memoryPropertyFlags), offset(offset), rangeIndex(rangeIndex)
+{
+}
+
+DeviceMemorySuballocation::~DeviceMemorySuballocation()
+{
+    destroy();
+}
+
+//
+// IDeviceMemory
+//
+
+const VkDevice DeviceMemorySuballocation::getDevice() const
+{
+    if (!block.get() || !block->getDeviceMemory().get())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return block->getDeviceMemory()->getDevice();
+}
+
+const VkMemoryAllocateInfo& DeviceMemorySuballocation::getMemoryAllocInfo() const
+{
+    return memoryAllocInfo;
+}
+
+VkDeviceSize DeviceMemorySuballocation::getAllocationSize() const
+{
+    return memoryAllocInfo.allocationSize;
+}
+
+uint32_t DeviceMemorySuballocation::getMemoryTypeIndex() const
+{
+    return memoryAllocInfo.memoryTypeIndex;
+}
+
+VkMemoryType DeviceMemorySuballocation::getMemoryType() const
+{
+    if (!getMemoryTypes())
+    {
+        return VkMemoryType{};
+    }
+
+    return getMemoryTypes()[memoryAllocInfo.memoryTypeIndex];
+}
+
+uint32_t DeviceMemorySuballocation::getMemoryTypeCount() const
+{
+    if (!block.get() || !block->getDeviceMemory().get())
+    {
+        return 0;
+    }
+
+    return block->getDeviceMemory()->getMemoryTypeCount();
+}
+
+const VkMemoryType* DeviceMemorySuballocation::getMemoryTypes() const
+{
+    if (!block.get() || !block->getDeviceMemory().get())
+    {
+        return nullptr;
+    }
+
+    return block->getDeviceMemory()->getMemoryTypes();
+}
+
+VkMemoryPropertyFlags DeviceMemorySuballocation::getMemoryPropertyFlags() const
+{
+    return memoryPropertyFlags;
+}
+
+const VkDeviceMemory DeviceMemorySuballocation::getDeviceMemory() const
+{
+    if (!block.get() || !block->getDeviceMemory().get())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return block->getDeviceMemory()->getDeviceMemory();
+}
+
+VkDeviceSize DeviceMemorySuballocation::getOffset() const
+{
+    return offset;
+}
+
+VkResult DeviceMemorySuballocation::invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    if (!block.get() || offset > getAllocationSize())
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    return block->invalidateMappedMemoryRanges(this->offset + offset, size == VK_WHOLE_SIZE ? getAllocationSize() - offset : size);
+}
+
+//
+// MappableDeviceMemory
+//
+
+VkResult DeviceMemorySuballocation::mapRange(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags, void** rangeData)
+{
+    // Block is already mapped as a whole.
+
+    if (!block.get() || !block->getData())
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    *rangeData = block->getData() + this->offset + offset;
+
+    return VK_SUCCESS;
+}
+
+void DeviceMemorySuballocation::unmapRange()
+{
+}
+
+VkResult DeviceMemorySuballocation::flushRange(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    if (!block.get() || offset > getAllocationSize())
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    return block->flushMappedMemoryRanges(this->offset + offset, size == VK_WHOLE_SIZE ? getAllocationSize() - offset : size);
+}
+
+//
+// IDestroyable
+//
+
+void DeviceMemorySuballocation::destroy()
+{
+    if (block.get())
+    {
+        if (isMapped())
+        {
+            unmapMemory();
+        }
+
+        block->free(rangeIndex);
+
+        block.reset();
+    }
+}
+
+} /* namespace vkts */
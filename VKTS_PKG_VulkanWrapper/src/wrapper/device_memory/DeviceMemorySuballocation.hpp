@@ -0,0 +1,116 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_DEVICEMEMORYSUBALLOCATION_HPP_
+#define VKTS_DEVICEMEMORYSUBALLOCATION_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+#include "DeviceMemoryBlock.hpp"
+#include "MappableDeviceMemory.hpp"
+
+namespace vkts
+{
+
+/**
+ * Range of a device memory block. Mapping does not call Vulkan, as the block is already mapped.
+ */
+class DeviceMemorySuballocation: public MappableDeviceMemory
+{
+
+private:
+
+    DeviceMemoryBlockSP block;
+
+    const VkMemoryAllocateInfo memoryAllocInfo;
+
+    const VkMemoryPropertyFlags memoryPropertyFlags;
+
+    const VkDeviceSize offset;
+
+    const uint32_t rangeIndex;
+
+protected:
+
+    //
+    // MappableDeviceMemory
+    //
+
+    virtual VkResult mapRange(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags, void** rangeData) override;
+
+    virtual void unmapRange() override;
+
+    virtual VkResult flushRange(const VkDeviceSize offset, const VkDeviceSize size) const override;
+
+public:
+
+    DeviceMemorySuballocation() = delete;
+    DeviceMemorySuballocation(const DeviceMemoryBlockSP& block, const VkDeviceSize size, const VkMemoryPropertyFlags memoryPropertyFlags, const VkDeviceSize offset, const uint32_t rangeIndex);
+    DeviceMemorySuballocation(const DeviceMemorySuballocation& other) = delete;
+    DeviceMemorySuballocation(DeviceMemorySuballocation&& other) = delete;
+    virtual ~DeviceMemorySuballocation();
+
+    DeviceMemorySuballocation& operator =(const DeviceMemorySuballocation& other) = delete;
+
+    DeviceMemorySuballocation& operator =(DeviceMemorySuballocation && other) = delete;
+
+    //
+    // IDeviceMemory
+    //
+
+    virtual const VkDevice getDevice() const override;
+
+    virtual const VkMemoryAllocateInfo& getMemoryAllocInfo() const override;
+
+    virtual VkDeviceSize getAllocationSize() const override;
+
+    virtual uint32_t getMemoryTypeIndex() const override;
+
+    virtual VkMemoryType getMemoryType() const override;
+
+    virtual uint32_t getMemoryTypeCount() const override;
+
+    virtual const VkMemoryType* getMemoryTypes() const override;
+
+    virtual VkMemoryPropertyFlags getMemoryPropertyFlags() const override;
+
+    virtual const VkDeviceMemory getDeviceMemory() const override;
+
+    virtual VkDeviceSize getOffset() const override;
+
+    virtual VkResult invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override;
+
+    //
+    // IDestroyable
+    //
+
+    virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_DEVICEMEMORYSUBALLOCATION_HPP_ */
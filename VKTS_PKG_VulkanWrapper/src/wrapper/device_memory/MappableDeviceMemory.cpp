@@ -0,0 +1,208 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "MappableDeviceMemory.hpp"
+
+namespace vkts
+{
+
+VkBool32 MappableDeviceMemory::isMapped() const
+{
+    return mapped;
+}
+
+MappableDeviceMemory::MappableDeviceMemory() :
+    IDeviceMemory(), data(nullptr), mapped(VK_FALSE), persistent(VK_FALSE), pendingFlush(VK_FALSE), uploadCount(0), uploadBytes(0), mapCount(0), flushCount(0)
+{
+}
+
+MappableDeviceMemory::~MappableDeviceMemory()
+{
+}
+
+//
+// IDeviceMemory
+//
+
+VkResult MappableDeviceMemory::mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags)
+{
+    if (!(getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    if (offset > getAllocationSize() || (size != VK_WHOLE_SIZE && offset + size > getAllocationSize()))
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    if (mapped)
+    {
+        unmapMemory();
+    }
+
+    auto result = mapRange(offset, size, flags, &data);
+
+    if (result == VK_SUCCESS)
+    {
+        mapped = VK_TRUE;
+
+        mapCount++;
+    }
+    else
+    {
+        data = nullptr;
+    }
+
+    return result;
+}
+
+void* MappableDeviceMemory::getMemory()
+{
+    return data;
+}
+
+VkResult MappableDeviceMemory::flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    flushCount++;
+
+    return flushRange(offset, size);
+}
+
+void MappableDeviceMemory::unmapMemory()
+{
+    if (mapped)
+    {
+        if (persistent)
+        {
+            flushUploads();
+
+            persistent = VK_FALSE;
+        }
+
+        unmapRange();
+
+        data = nullptr;
+
+        mapped = VK_FALSE;
+    }
+}
+
+VkResult MappableDeviceMemory::upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize)
+{
+    uploadCount++;
+    uploadBytes += uploadDataSize;
+
+    if (persistent)
+    {
+        if (offset + uploadDataSize > getAllocationSize())
+        {
+            return VK_ERROR_MEMORY_MAP_FAILED;
+        }
+
+        memcpy((uint8_t*)data + offset, uploadData, uploadDataSize);
+
+        if (!(getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+        {
+            pendingFlush = VK_TRUE;
+        }
+
+        return VK_SUCCESS;
+    }
+
+    auto result = mapMemory(offset, uploadDataSize, flags);
+
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    memcpy(data, uploadData, uploadDataSize);
+
+    if (!(getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        result = flushMappedMemoryRanges(offset, uploadDataSize);
+    }
+
+    unmapMemory();
+
+    return result;
+}
+
+VkResult MappableDeviceMemory::mapMemoryPersistent(const VkMemoryMapFlags flags)
+{
+    if (persistent)
+    {
+        return VK_SUCCESS;
+    }
+
+    auto result = mapMemory(0, VK_WHOLE_SIZE, flags);
+
+    if (result == VK_SUCCESS)
+    {
+        persistent = VK_TRUE;
+    }
+
+    return result;
+}
+
+VkBool32 MappableDeviceMemory::isMappedPersistent() const
+{
+    return persistent;
+}
+
+VkResult MappableDeviceMemory::flushUploads()
+{
+    if (!persistent || !pendingFlush.exchange(VK_FALSE))
+    {
+        return VK_SUCCESS;
+    }
+
+    // Flushing the whole memory avoids aligning the range to the non coherent atom size.
+    return flushMappedMemoryRanges(0, VK_WHOLE_SIZE);
+}
+
+uint64_t MappableDeviceMemory::getUploadCount() const
+{
+    return uploadCount;
+}
+
+uint64_t MappableDeviceMemory::getUploadBytes() const
+{
+    return uploadBytes;
+}
+
+uint64_t MappableDeviceMemory::getMapCount() const
+{
+    return mapCount;
+}
+
+uint64_t MappableDeviceMemory::getFlushCount() const
+{
+    return flushCount;
+}
+
+} /* namespace vkts */
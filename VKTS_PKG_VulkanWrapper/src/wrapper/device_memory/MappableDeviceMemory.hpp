@@ -0,0 +1,111 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_MAPPABLEDEVICEMEMORY_HPP_
+#define VKTS_MAPPABLEDEVICEMEMORY_HPP_
+
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+
+namespace vkts
+{
+
+/**
+ * Mapping, upload and counter logic shared by whole device memory and sub-allocations.
+ * Derived classes only provide how a range is mapped, unmapped and flushed.
+ */
+class MappableDeviceMemory: public IDeviceMemory
+{
+
+private:
+
+    void* data;
+    VkBool32 mapped;
+    VkBool32 persistent;
+
+    std::atomic<VkBool32> pendingFlush;
+
+    std::atomic<uint64_t> uploadCount;
+    std::atomic<uint64_t> uploadBytes;
+    std::atomic<uint64_t> mapCount;
+    mutable std::atomic<uint64_t> flushCount;
+
+protected:
+
+    /**
+     * Range is already validated against the allocation size.
+     */
+    virtual VkResult mapRange(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags, void** rangeData) = 0;
+
+    virtual void unmapRange() = 0;
+
+    virtual VkResult flushRange(const VkDeviceSize offset, const VkDeviceSize size) const = 0;
+
+    VkBool32 isMapped() const;
+
+public:
+
+    MappableDeviceMemory();
+    MappableDeviceMemory(const MappableDeviceMemory& other) = delete;
+    MappableDeviceMemory(MappableDeviceMemory&& other) = delete;
+    virtual ~MappableDeviceMemory();
+
+    MappableDeviceMemory& operator =(const MappableDeviceMemory& other) = delete;
+
+    MappableDeviceMemory& operator =(MappableDeviceMemory && other) = delete;
+
+    //
+    // IDeviceMemory
+    //
+
+    virtual VkResult mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags) override;
+
+    virtual void* getMemory() override;
+
+    virtual VkResult flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override;
+
+    virtual void unmapMemory() override;
+
+    virtual VkResult upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize) override;
+
+    virtual VkResult mapMemoryPersistent(const VkMemoryMapFlags flags) override;
+
+    virtual VkBool32 isMappedPersistent() const override;
+
+    virtual VkResult flushUploads() override;
+
+    virtual uint64_t getUploadCount() const override;
+
+    virtual uint64_t getUploadBytes() const override;
+
+    virtual uint64_t getMapCount() const override;
+
+    virtual uint64_t getFlushCount() const override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_MAPPABLEDEVICEMEMORY_HPP_ */
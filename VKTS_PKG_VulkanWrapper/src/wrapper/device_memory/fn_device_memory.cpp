@@ -26,6 +26,7 @@
 
 #include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
 #include "DeviceMemory.hpp"
+#include "DeviceMemoryAllocator.hpp"
 
 namespace vkts
 {
@@ -105,4 +106,70 @@ IDeviceMemorySP VKTS_APIENTRY deviceMemoryCreate(const VkDevice device, const Vk
     return IDeviceMemorySP(newInstance);
 }
 
+IDeviceMemoryAllocatorSP VKTS_APIENTRY deviceMemoryAllocatorCreate(const VkDevice device, const VkPhysicalDeviceMemoryProperties& physicalDeviceMemoryProperties, const VkPhysicalDeviceLimits& physicalDeviceLimits, const VkDeviceSize blockSize)
+{
+    if (!device || physicalDeviceMemoryProperties.memoryTypeCount == 0 || physicalDeviceMemoryProperties.memoryTypeCount > VK_MAX_MEMORY_TYPES || blockSize == 0)
+    {
+        return IDeviceMemoryAllocatorSP();
+    }
+
+    const uint32_t memoryTypeCount = physicalDeviceMemoryProperties.memoryTypeCount;
+    const VkMemoryType* memoryTypes = physicalDeviceMemoryProperties.memoryTypes;
+
+    VkDeviceSize blockSizes[VK_MAX_MEMORY_TYPES];
+
+    for (uint32_t i = 0; i < memoryTypeCount; i++)
+    {
+        blockSizes[i] = blockSize;
+
+        const uint32_t heapIndex = memoryTypes[i].heapIndex;
+
+        if (heapIndex < physicalDeviceMemoryProperties.memoryHeapCount && physicalDeviceMemoryProperties.memoryHeaps[heapIndex].size > 0)
+        {
+            blockSizes[i] = glm::min(blockSize, physicalDeviceMemoryProperties.memoryHeaps[heapIndex].size / 8);
+        }
+    }
+
+    // Properties are copied, as the passed structure does not outlive the allocator.
+    std::vector<VkMemoryType> allMemoryTypes(memoryTypes, memoryTypes + memoryTypeCount);
+
+    auto createFunction = [device, allMemoryTypes](const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags)
+    {
+        return deviceMemoryCreate(device, memoryRequirements, (uint32_t) allMemoryTypes.size(), allMemoryTypes.data(), propertyFlags);
+    };
+
+    auto newInstance = new DeviceMemoryAllocator(createFunction, memoryTypeCount, memoryTypes, blockSizes, physicalDeviceLimits.bufferImageGranularity, physicalDeviceLimits.nonCoherentAtomSize);
+
+    if (!newInstance)
+    {
+        return IDeviceMemoryAllocatorSP();
+    }
+
+    return IDeviceMemoryAllocatorSP(newInstance);
+}
+
+IDeviceMemoryAllocatorSP VKTS_APIENTRY deviceMemoryAllocatorCreate(const DeviceMemoryCreateFunction& createFunction, const uint32_t memoryTypeCount, const VkMemoryType* memoryTypes, const VkDeviceSize bufferImageGranularity, const VkDeviceSize nonCoherentAtomSize, const VkDeviceSize blockSize)
+{
+    if (!createFunction || memoryTypeCount == 0 || memoryTypeCount > VK_MAX_MEMORY_TYPES || !memoryTypes || blockSize == 0)
+    {
+        return IDeviceMemoryAllocatorSP();
+    }
+
+    VkDeviceSize blockSizes[VK_MAX_MEMORY_TYPES];
+
+    for (uint32_t i = 0; i < memoryTypeCount; i++)
+    {
+        blockSizes[i] = blockSize;
+    }
+
+    auto newInstance = new DeviceMemoryAllocator(createFunction, memoryTypeCount, memoryTypes, blockSizes, bufferImageGranularity, nonCoherentAtomSize);
+
+    if (!newInstance)
+    {
+        return IDeviceMemoryAllocatorSP();
+    }
+
+    return IDeviceMemoryAllocatorSP(newInstance);
+}
+
 }
@@ -82,6 +82,52 @@ const VkPipelineCache PipelineCache::getPipelineCache() const
     return pipelineCache;
 }
 
+IBinaryBufferSP PipelineCache::getData() const
+{
+    if (!pipelineCache)
+    {
+        return IBinaryBufferSP();
+    }
+
+    size_t dataSize = 0;
+
+    VkResult result = vkGetPipelineCacheData(device, pipelineCache, &dataSize, nullptr);
+
+    if (result != VK_SUCCESS || dataSize == 0)
+    {
+        return IBinaryBufferSP();
+    }
+
+    std::vector<uint8_t> data(dataSize);
+
+    // Size can only shrink between the calls, as the cache is not used in the meantime.
+    result = vkGetPipelineCacheData(device, pipelineCache, &dataSize, &data[0]);
+
+    if (result != VK_SUCCESS)
+    {
+        return IBinaryBufferSP();
+    }
+
+    data.resize(dataSize);
+
+    return binaryBufferCreate(data);
+}
+
+VkResult PipelineCache::mergePipelineCaches(const uint32_t srcCacheCount, const VkPipelineCache* srcCaches)
+{
+    if (!pipelineCache)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    if (srcCacheCount == 0)
+    {
+        return VK_SUCCESS;
+    }
+
+    return vkMergePipelineCaches(device, pipelineCache, srcCacheCount, srcCaches);
+}
+
 //
 // IDestroyable
 //
@@ -72,6 +72,10 @@ public:
 
     virtual const VkPipelineCache getPipelineCache() const override;
 
+    virtual IBinaryBufferSP getData() const override;
+
+    virtual VkResult mergePipelineCaches(const uint32_t srcCacheCount, const VkPipelineCache* srcCaches) override;
+
     //
     // IDestroyable
     //
@@ -73,6 +73,149 @@ IPipelineCacheSP VKTS_APIENTRY pipelineCreateCache(const VkDevice device, const
     return IPipelineCacheSP(newInstance);
 }
 
+VkBool32 VKTS_APIENTRY pipelineCacheIsDataValid(const VkPhysicalDeviceProperties& physicalDeviceProperties, const size_t dataSize, const void* data)
+{
+    // Length, version, vendor ID, device ID and UUID.
+    const size_t minHeaderLength = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+
+    if (!data || dataSize < minHeaderLength)
+    {
+        return VK_FALSE;
+    }
+
+    const uint8_t* header = (const uint8_t*)data;
+
+    uint32_t headerLength;
+    uint32_t headerVersion;
+    uint32_t vendorID;
+    uint32_t deviceID;
+
+    memcpy(&headerLength, &header[0], sizeof(uint32_t));
+    memcpy(&headerVersion, &header[4], sizeof(uint32_t));
+    memcpy(&vendorID, &header[8], sizeof(uint32_t));
+    memcpy(&deviceID, &header[12], sizeof(uint32_t));
+
+    if (headerLength < minHeaderLength || headerLength > dataSize)
+    {
+        return VK_FALSE;
+    }
+
+    if (headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE)
+    {
+        return VK_FALSE;
+    }
+
+    if (vendorID != physicalDeviceProperties.vendorID || deviceID != physicalDeviceProperties.deviceID)
+    {
+        return VK_FALSE;
+    }
+
+    if (memcmp(&header[16], physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
+std::string VKTS_APIENTRY pipelineCacheGetFilename(const VkPhysicalDeviceProperties& physicalDeviceProperties)
+{
+    static const char* hexDigits = "0123456789abcdef";
+
+    std::string uuid;
+
+    for (uint32_t i = 0; i < VK_UUID_SIZE; i++)
+    {
+        uuid += hexDigits[physicalDeviceProperties.pipelineCacheUUID[i] >> 4];
+        uuid += hexDigits[physicalDeviceProperties.pipelineCacheUUID[i] & 0x0F];
+    }
+
+    return "cache/pipeline_" + std::to_string(physicalDeviceProperties.vendorID) + "_" + std::to_string(physicalDeviceProperties.deviceID) + "_" + std::to_string(physicalDeviceProperties.driverVersion) + "_" + uuid + ".bin";
+}
+
+IPipelineCacheSP VKTS_APIENTRY pipelineCacheLoad(const VkDevice device, const VkPhysicalDeviceProperties& physicalDeviceProperties, const char* filename)
+{
+    if (!device || !filename)
+    {
+        return IPipelineCacheSP();
+    }
+
+    auto data = fileLoadBinary(filename);
+
+    if (data.get() && data->getSize() > 0)
+    {
+        if (pipelineCacheIsDataValid(physicalDeviceProperties, data->getSize(), data->getData()))
+        {
+            auto pipelineCache = pipelineCreateCache(device, 0, data->getSize(), data->getData());
+
+            if (pipelineCache.get())
+            {
+                return pipelineCache;
+            }
+        }
+
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Discarding pipeline cache '%s'.", filename);
+    }
+
+    return pipelineCreateCache(device, 0);
+}
+
+VkBool32 VKTS_APIENTRY pipelineCacheSave(const char* filename, const IPipelineCacheSP& pipelineCache)
+{
+    if (!filename || !pipelineCache.get())
+    {
+        return VK_FALSE;
+    }
+
+    auto data = pipelineCache->getData();
+
+    if (!data.get())
+    {
+        return VK_FALSE;
+    }
+
+    std::string fullFilename = std::string(filename);
+
+    if (!fileIsAbsolutePath(filename))
+    {
+        char directory[VKTS_MAX_BUFFER_CHARS] = "";
+
+        if (fileGetDirectory(directory, filename) && !fileCreateDirectory(directory))
+        {
+            return VK_FALSE;
+        }
+
+        fullFilename = std::string(fileGetBaseDirectory()) + fullFilename;
+    }
+
+    // Write to a temporary file first, so an interrupted save never leaves a truncated cache behind.
+    auto temporaryFilename = std::string(filename) + ".tmp";
+
+    if (!fileSaveBinary(temporaryFilename.c_str(), data))
+    {
+        return VK_FALSE;
+    }
+
+    auto fullTemporaryFilename = fullFilename + ".tmp";
+
+    if (rename(fullTemporaryFilename.c_str(), fullFilename.c_str()) == 0)
+    {
+        return VK_TRUE;
+    }
+
+    // Some platforms do not replace an existing file.
+    remove(fullFilename.c_str());
+
+    if (rename(fullTemporaryFilename.c_str(), fullFilename.c_str()) == 0)
+    {
+        return VK_TRUE;
+    }
+
+    remove(fullTemporaryFilename.c_str());
+
+    return VK_FALSE;
+}
+
 IPipelineLayoutSP VKTS_APIENTRY pipelineCreateLayout(const VkDevice device, const VkPipelineLayoutCreateFlags flags, const uint32_t setLayoutCount, const VkDescriptorSetLayout* setLayouts, const uint32_t pushConstantRangeCount, const VkPushConstantRange* pushConstantRanges)
 {
     if (!device)
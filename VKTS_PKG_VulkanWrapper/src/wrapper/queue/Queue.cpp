@@ -30,7 +30,7 @@ namespace vkts
 {
 
 Queue::Queue(const VkDevice device, const uint32_t queueFamilyIndex, const uint32_t queueIndex, const VkQueue queue) :
-    IQueue(), device(device), queueFamilyIndex(queueFamilyIndex), queueIndex(queueIndex), queue(queue)
+    IQueue(), device(device), queueFamilyIndex(queueFamilyIndex), queueIndex(queueIndex), queue(queue), queueMutex()
 {
 }
 
@@ -44,19 +44,32 @@ Queue::~Queue()
 
 VkResult Queue::submit(const uint32_t submitCount, const VkSubmitInfo* submits, const VkFence fence) const
 {
+    std::lock_guard<std::mutex> queueLock(queueMutex);
+
     return vkQueueSubmit(queue, submitCount, submits, fence);
 }
 
 VkResult Queue::waitIdle() const
 {
+    std::lock_guard<std::mutex> queueLock(queueMutex);
+
     return vkQueueWaitIdle(queue);
 }
 
 VkResult Queue::bindSparse(const uint32_t bindInfoCount, const VkBindSparseInfo* bindInfo, const VkFence fence) const
 {
+    std::lock_guard<std::mutex> queueLock(queueMutex);
+
     return vkQueueBindSparse(queue, bindInfoCount, bindInfo, fence);
 }
 
+VkResult Queue::present(const VkPresentInfoKHR& presentInfo) const
+{
+    std::lock_guard<std::mutex> queueLock(queueMutex);
+
+    return vkQueuePresentKHR(queue, &presentInfo);
+}
+
 const VkDevice Queue::getDevice() const
 {
     return device;
@@ -45,6 +45,9 @@ private:
 
     const VkQueue queue;
 
+    // Submits from the update thread and from loading tasks share the queue.
+    mutable std::mutex queueMutex;
+
 public:
 
     Queue() = delete;
@@ -67,6 +70,8 @@ public:
 
     virtual VkResult bindSparse(const uint32_t bindInfoCount, const VkBindSparseInfo* bindInfo, const VkFence fence) const override;
 
+    virtual VkResult present(const VkPresentInfoKHR& presentInfo) const override;
+
     virtual const VkDevice getDevice() const override;
 
     virtual uint32_t getQueueFamilyIndex() const override;
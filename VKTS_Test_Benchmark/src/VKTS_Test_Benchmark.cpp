@@ -0,0 +1,144 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+int main(int argc, char* argv[])
+{
+	if (!vkts::engineInit())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Could not initialize engine.");
+
+		return -1;
+	}
+
+	vkts::logSetLevel(VKTS_LOG_INFO);
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Number of processors = %u.", vkts::processorGetNumber());
+
+	VkBool32 allPassed = VK_TRUE;
+
+	//
+	// Task scheduler.
+	//
+
+	if (!benchmarkTask())
+	{
+		vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Benchmark: Task benchmark failed.");
+
+		allPassed = VK_FALSE;
+	}
+
+	//
+	// JSON decoder.
+	//
+
+	if (!benchmarkJson())
+	{
+		vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Benchmark: JSON benchmark failed.");
+
+		allPassed = VK_FALSE;
+	}
+
+	//
+	// Image prefilter.
+	//
+
+	if (!benchmarkPrefilter())
+	{
+		vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Benchmark: Prefilter benchmark failed.");
+
+		allPassed = VK_FALSE;
+	}
+
+	//
+	// Animation sampling.
+	//
+
+	if (!benchmarkAnimation())
+	{
+		vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Benchmark: Animation benchmark failed.");
+
+		allPassed = VK_FALSE;
+	}
+
+	//
+	// Frustum culling.
+	//
+
+	if (!benchmarkCulling())
+	{
+		vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Benchmark: Culling benchmark failed.");
+
+		allPassed = VK_FALSE;
+	}
+
+	//
+	// Transform matrices.
+	//
+
+	if (!benchmarkMatrix())
+	{
+		vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Benchmark: Matrix benchmark failed.");
+
+		allPassed = VK_FALSE;
+	}
+
+	//
+	// Device memory.
+	//
+
+	if (!benchmarkDeviceMemory())
+	{
+		vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Benchmark: Device memory benchmark failed.");
+
+		allPassed = VK_FALSE;
+	}
+
+	//
+	// Skeleton batch.
+	//
+
+	if (!benchmarkSkeleton())
+	{
+		vkts::logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Benchmark: Skeleton batch benchmark failed.");
+
+		allPassed = VK_FALSE;
+	}
+
+	if (!allPassed)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: At least one benchmark failed.");
+	}
+
+	//
+	// Termination.
+	//
+
+	vkts::engineTerminate();
+
+	return allPassed ? 0 : -1;
+}
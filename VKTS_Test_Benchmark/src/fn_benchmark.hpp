@@ -0,0 +1,53 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FN_BENCHMARK_HPP_
+#define FN_BENCHMARK_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+#include <vkts/math/vkts_math.hpp>
+#include <vkts/runtime/vkts_runtime.hpp>
+#include <vkts/image/vkts_image.hpp>
+#include <vkts/vulkan/wrapper/vkts_wrapper.hpp>
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+VkBool32 benchmarkTask();
+
+VkBool32 benchmarkJson();
+
+VkBool32 benchmarkPrefilter();
+
+VkBool32 benchmarkAnimation();
+
+VkBool32 benchmarkCulling();
+
+VkBool32 benchmarkMatrix();
+
+VkBool32 benchmarkDeviceMemory();
+
+VkBool32 benchmarkSkeleton();
+
+#endif /* FN_BENCHMARK_HPP_ */
@@ -0,0 +1,717 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+#define BENCHMARK_ANIMATION_FRAMES 600
+#define BENCHMARK_ANIMATION_FRAME_TIME (1.0f / 60.0f)
+#define BENCHMARK_ANIMATION_KEY_TIME (1.0f / 30.0f)
+#define BENCHMARK_ANIMATION_MAX_ERROR 0.0005f
+
+//
+// Minimal channel, as the scene factory would need a scene manager.
+//
+
+class BenchmarkChannel: public vkts::IChannel
+{
+
+private:
+
+	std::string name;
+
+	VkTsTargetTransform targetTransform;
+	VkTsTargetTransformElement targetTransformElement;
+
+	std::vector<float> allKeys;
+	std::vector<float> allValues;
+	std::vector<glm::vec4> allHandles;
+	std::vector<VkTsInterpolator> allInterpolators;
+
+	uint64_t modificationCounter;
+
+public:
+
+	BenchmarkChannel() :
+		IChannel(), name(""), targetTransform(VKTS_TARGET_TRANSFORM_TRANSLATE), targetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_X), allKeys(), allValues(), allHandles(), allInterpolators(), modificationCounter(0)
+	{
+	}
+
+	virtual ~BenchmarkChannel()
+	{
+	}
+
+	virtual const std::string& getName() const override
+	{
+		return name;
+	}
+
+	virtual void setName(const std::string& name) override
+	{
+		this->name = name;
+	}
+
+	virtual VkTsTargetTransform getTargetTransform() const override
+	{
+		return targetTransform;
+	}
+
+	virtual void setTargetTransform(VkTsTargetTransform targetTransform) override
+	{
+		this->targetTransform = targetTransform;
+
+		modificationCounter++;
+	}
+
+	virtual VkTsTargetTransformElement getTargetTransformElement() const override
+	{
+		return targetTransformElement;
+	}
+
+	virtual void setTargetTransformElement(VkTsTargetTransformElement targetTransformElement) override
+	{
+		this->targetTransformElement = targetTransformElement;
+
+		modificationCounter++;
+	}
+
+	// Entries have to be added in ascending key order.
+	virtual VkBool32 addEntry(const float key, const float value, const glm::vec4& handles, const VkTsInterpolator interpolator) override
+	{
+		if (allKeys.size() > 0 && key <= allKeys.back())
+		{
+			return VK_FALSE;
+		}
+
+		allKeys.push_back(key);
+		allValues.push_back(value);
+		allHandles.push_back(handles);
+		allInterpolators.push_back(interpolator);
+
+		modificationCounter++;
+
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 removeEntry(const float key) override
+	{
+		for (size_t index = 0; index < allKeys.size(); index++)
+		{
+			if (allKeys[index] == key)
+			{
+				allKeys.erase(allKeys.begin() + index);
+				allValues.erase(allValues.begin() + index);
+				allHandles.erase(allHandles.begin() + index);
+				allInterpolators.erase(allInterpolators.begin() + index);
+
+				modificationCounter++;
+
+				return VK_TRUE;
+			}
+		}
+
+		return VK_FALSE;
+	}
+
+	virtual uint32_t getNumberEntries() const override
+	{
+		return (uint32_t)allKeys.size();
+	}
+
+	virtual const std::vector<float>& getKeys() const override
+	{
+		return allKeys;
+	}
+
+	virtual const std::vector<float>& getValues() const override
+	{
+		return allValues;
+	}
+
+	virtual const std::vector<glm::vec4>& getHandles() const override
+	{
+		return allHandles;
+	}
+
+	virtual const std::vector<VkTsInterpolator>& getInterpolators() const override
+	{
+		return allInterpolators;
+	}
+
+	virtual uint64_t getModificationCounter() const override
+	{
+		return modificationCounter;
+	}
+
+	virtual vkts::IChannelSP clone() const override
+	{
+		return vkts::IChannelSP();
+	}
+
+	virtual void destroy() override
+	{
+		allKeys.clear();
+		allValues.clear();
+		allHandles.clear();
+		allInterpolators.clear();
+
+		modificationCounter++;
+	}
+
+};
+
+static vkts::SmartPointerVector<vkts::IChannelSP> benchmarkAnimationCreateChannels(const uint32_t channels, const uint32_t keys, const VkBool32 constantW)
+{
+	static const VkTsTargetTransform targetTransforms[3] = {VKTS_TARGET_TRANSFORM_TRANSLATE, VKTS_TARGET_TRANSFORM_ROTATE, VKTS_TARGET_TRANSFORM_SCALE};
+
+	vkts::SmartPointerVector<vkts::IChannelSP> allChannels;
+
+	for (uint32_t channel = 0; channel < channels; channel++)
+	{
+		auto currentChannel = vkts::IChannelSP(new BenchmarkChannel());
+
+		currentChannel->setTargetTransform(targetTransforms[(channel / 4) % 3]);
+		currentChannel->setTargetTransformElement((VkTsTargetTransformElement)(channel % 4));
+
+		for (uint32_t key = 0; key < keys; key++)
+		{
+			const float currentKey = (float)key * BENCHMARK_ANIMATION_KEY_TIME;
+			const float currentValue = (constantW && channel % 4 == 3) ? 1.0f : sinf((float)(key * 7 + channel * 13) * 0.1f);
+
+			currentChannel->addEntry(currentKey, currentValue, glm::vec4(currentKey - 0.1f, currentValue, currentKey + 0.1f, currentValue), VKTS_INTERPOLATOR_LINEAR);
+		}
+
+		allChannels.append(currentChannel);
+	}
+
+	return allChannels;
+}
+
+static float benchmarkAnimationGetTime(const uint32_t frame, const uint32_t node, const uint32_t keys)
+{
+	// Every node plays the animation in a loop, starting at a different time.
+
+	return fmodf((float)(frame + node * 17) * BENCHMARK_ANIMATION_FRAME_TIME, (float)(keys - 1) * BENCHMARK_ANIMATION_KEY_TIME);
+}
+
+//
+// Previous implementation, searching the keys linear, as reference.
+//
+
+static float benchmarkAnimationReference(const float key, const vkts::IChannelSP& channel)
+{
+	if (key <= channel->getKeys()[0])
+	{
+		return channel->getValues()[0];
+	}
+
+	auto lastIndex = channel->getNumberEntries() - 1;
+
+	if (key >= channel->getKeys()[lastIndex])
+	{
+		return channel->getValues()[lastIndex];
+	}
+
+	uint32_t currentIndex = 0;
+	while (currentIndex < channel->getNumberEntries())
+	{
+		if (key < channel->getKeys()[currentIndex])
+		{
+			currentIndex--;
+
+			break;
+		}
+
+		currentIndex++;
+	}
+
+	float beforeKey = channel->getKeys()[currentIndex];
+	float beforeValue = channel->getValues()[currentIndex];
+
+	float afterKey = channel->getKeys()[currentIndex + 1];
+	float afterValue = channel->getValues()[currentIndex + 1];
+
+	float deltaKey = afterKey - beforeKey;
+	if (deltaKey == 0.0f)
+	{
+		return afterValue;
+	}
+
+	return (afterValue - beforeValue) * (key - beforeKey) / deltaKey + beforeValue;
+}
+
+//
+
+static VkBool32 benchmarkAnimationModificationCheck()
+{
+	auto allChannels = benchmarkAnimationCreateChannels(4, 8, VK_FALSE);
+
+	vkts::AnimationSampler sampler;
+
+	sampler.build(allChannels);
+
+	if (!sampler.isUpToDate(allChannels))
+	{
+		return VK_FALSE;
+	}
+
+	// Target changes keep the number of entries.
+
+	allChannels[0]->setTargetTransform(VKTS_TARGET_TRANSFORM_SCALE);
+
+	if (sampler.isUpToDate(allChannels))
+	{
+		return VK_FALSE;
+	}
+
+	sampler.build(allChannels);
+
+	allChannels[1]->setTargetTransformElement(VKTS_TARGET_TRANSFORM_ELEMENT_Z);
+
+	if (sampler.isUpToDate(allChannels))
+	{
+		return VK_FALSE;
+	}
+
+	sampler.build(allChannels);
+
+	// Replacing the last entry keeps the number of entries as well.
+
+	const float key = allChannels[2]->getKeys().back();
+
+	if (!allChannels[2]->removeEntry(key) || !allChannels[2]->addEntry(key, 2.0f, glm::vec4(key - 0.1f, 2.0f, key + 0.1f, 2.0f), VKTS_INTERPOLATOR_LINEAR))
+	{
+		return VK_FALSE;
+	}
+
+	if (sampler.isUpToDate(allChannels))
+	{
+		return VK_FALSE;
+	}
+
+	sampler.build(allChannels);
+
+	return sampler.isUpToDate(allChannels) && sampler.sample(2, key) == 2.0f;
+}
+
+//
+// Rotation tracks are interpolated with one t, so they have to be resampled all together or not at all.
+//
+
+static VkBool32 benchmarkAnimationRotationCheck(const vkts::SmartPointerVector<vkts::IChannelSP>& allChannels, const VkBool32 resampled)
+{
+	vkts::AnimationSampler sampler;
+
+	sampler.setCompression(BENCHMARK_ANIMATION_KEY_TIME, BENCHMARK_ANIMATION_MAX_ERROR);
+	sampler.build(allChannels);
+
+	const float key = 10.3f * BENCHMARK_ANIMATION_KEY_TIME;
+
+	VkBool32 firstFound = VK_FALSE;
+	float firstT = 0.0f;
+
+	for (uint32_t track = 0; track < sampler.getNumberTracks(); track++)
+	{
+		if (sampler.getTargetTransform(track) != VKTS_TARGET_TRANSFORM_ROTATE)
+		{
+			continue;
+		}
+
+		const VkBool32 quantized = sampler.getTrackEncoding(track) == vkts::AnimationTrackQuantized8 || sampler.getTrackEncoding(track) == vkts::AnimationTrackQuantized16;
+
+		if (quantized != resampled)
+		{
+			return VK_FALSE;
+		}
+
+		float before;
+		float after;
+		float t = -1.0f;
+
+		if (!sampler.sampleSegment(track, key, before, after, t))
+		{
+			return VK_FALSE;
+		}
+
+		if (firstFound && t != firstT)
+		{
+			return VK_FALSE;
+		}
+
+		firstFound = VK_TRUE;
+		firstT = t;
+	}
+
+	return firstFound;
+}
+
+//
+// Compressed channels release their entries to the sampler, which gives them back on reset.
+//
+
+static VkBool32 benchmarkAnimationReleaseCheck()
+{
+	auto allChannels = benchmarkAnimationCreateChannels(12, 256, VK_TRUE);
+	auto allReferenceChannels = benchmarkAnimationCreateChannels(12, 256, VK_TRUE);
+
+	vkts::AnimationSampler sampler;
+
+	sampler.setCompression(BENCHMARK_ANIMATION_KEY_TIME, BENCHMARK_ANIMATION_MAX_ERROR);
+	sampler.build(allChannels, VK_TRUE);
+
+	if (!sampler.isUpToDate(allChannels))
+	{
+		return VK_FALSE;
+	}
+
+	uint32_t releasedChannels = 0;
+
+	for (uint32_t track = 0; track < sampler.getNumberTracks(); track++)
+	{
+		const VkBool32 released = allChannels[track]->getNumberEntries() == 0;
+
+		if (released != (sampler.getTrackEncoding(track) != vkts::AnimationTrackKeys) || sampler.getNumberEntries(track) != allReferenceChannels[track]->getNumberEntries())
+		{
+			return VK_FALSE;
+		}
+
+		if (!released)
+		{
+			continue;
+		}
+
+		releasedChannels++;
+
+		// Read back entries have to interpolate like the track, allowing for rounding of the sample keys.
+
+		auto restoredChannel = vkts::IChannelSP(new BenchmarkChannel());
+
+		if (!sampler.restoreEntries(track, restoredChannel))
+		{
+			return VK_FALSE;
+		}
+
+		for (uint32_t frame = 0; frame < 256; frame++)
+		{
+			const float key = benchmarkAnimationGetTime(frame, track, 256);
+
+			if (fabsf(vkts::interpolate(key, restoredChannel) - sampler.sample(track, key)) > BENCHMARK_ANIMATION_MAX_ERROR * 0.1f)
+			{
+				return VK_FALSE;
+			}
+		}
+	}
+
+	if (releasedChannels == 0)
+	{
+		return VK_FALSE;
+	}
+
+	// Rebuilding starts from the given back entries, so the error does not exceed the limit.
+
+	sampler.reset();
+
+	for (uint32_t track = 0; track < allChannels.size(); track++)
+	{
+		if (allChannels[track]->getNumberEntries() == 0)
+		{
+			return VK_FALSE;
+		}
+	}
+
+	sampler.build(allChannels, VK_TRUE);
+
+	for (uint32_t track = 0; track < sampler.getNumberTracks(); track++)
+	{
+		for (uint32_t frame = 0; frame < 256; frame++)
+		{
+			const float key = benchmarkAnimationGetTime(frame, track, 256);
+
+			if (fabsf(sampler.sample(track, key) - vkts::interpolate(key, allReferenceChannels[track])) > BENCHMARK_ANIMATION_MAX_ERROR * 1.001f)
+			{
+				return VK_FALSE;
+			}
+		}
+	}
+
+	return VK_TRUE;
+}
+
+static VkBool32 benchmarkAnimationRun(const uint32_t channels, const uint32_t keys, const uint32_t nodes)
+{
+	auto allChannels = benchmarkAnimationCreateChannels(channels, keys, VK_FALSE);
+
+	// Every node has its own animation and therefore own cursors.
+
+	std::unique_ptr<vkts::AnimationSampler[]> allSamplers(new vkts::AnimationSampler[nodes]);
+
+	for (uint32_t node = 0; node < nodes; node++)
+	{
+		allSamplers[node].build(allChannels);
+	}
+
+	const uint64_t samples = (uint64_t)BENCHMARK_ANIMATION_FRAMES * (uint64_t)nodes * (uint64_t)channels;
+
+	std::vector<float> allResults(samples);
+	std::vector<float> allSearchResults(samples);
+	std::vector<float> allReferenceResults(samples);
+
+	//
+
+	uint64_t index = 0;
+
+	double start = vkts::timeGetRaw();
+
+	for (uint32_t frame = 0; frame < BENCHMARK_ANIMATION_FRAMES; frame++)
+	{
+		for (uint32_t node = 0; node < nodes; node++)
+		{
+			const float currentTime = benchmarkAnimationGetTime(frame, node, keys);
+
+			for (uint32_t track = 0; track < channels; track++)
+			{
+				allResults[index++] = allSamplers[node].sample(track, currentTime);
+			}
+		}
+	}
+
+	const double seconds = vkts::timeGetRaw() - start;
+
+	//
+
+	index = 0;
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t frame = 0; frame < BENCHMARK_ANIMATION_FRAMES; frame++)
+	{
+		for (uint32_t node = 0; node < nodes; node++)
+		{
+			const float currentTime = benchmarkAnimationGetTime(frame, node, keys);
+
+			for (uint32_t channel = 0; channel < channels; channel++)
+			{
+				allSearchResults[index++] = vkts::interpolate(currentTime, allChannels[channel]);
+			}
+		}
+	}
+
+	const double searchSeconds = vkts::timeGetRaw() - start;
+
+	//
+
+	index = 0;
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t frame = 0; frame < BENCHMARK_ANIMATION_FRAMES; frame++)
+	{
+		for (uint32_t node = 0; node < nodes; node++)
+		{
+			const float currentTime = benchmarkAnimationGetTime(frame, node, keys);
+
+			for (uint32_t channel = 0; channel < channels; channel++)
+			{
+				allReferenceResults[index++] = benchmarkAnimationReference(currentTime, allChannels[channel]);
+			}
+		}
+	}
+
+	const double referenceSeconds = vkts::timeGetRaw() - start;
+
+	// Output has to be bit identical to the previous implementation.
+
+	if (memcmp(&allResults[0], &allReferenceResults[0], samples * sizeof(float)) != 0 || memcmp(&allSearchResults[0], &allReferenceResults[0], samples * sizeof(float)) != 0)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Animation samples differ for %u channels, %u keys and %u nodes.", channels, keys, nodes);
+
+		return VK_FALSE;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Animation %u channels x %u keys x %u nodes cursor samples/second = %.0f", channels, keys, nodes, (double)samples / seconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Animation %u channels x %u keys x %u nodes binary search samples/second = %.0f", channels, keys, nodes, (double)samples / searchSeconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Animation %u channels x %u keys x %u nodes reference samples/second = %.0f", channels, keys, nodes, (double)samples / referenceSeconds);
+
+	return VK_TRUE;
+}
+
+static VkBool32 benchmarkAnimationCompressionRun(const uint32_t channels, const uint32_t keys, const uint32_t nodes)
+{
+	// Translation and scale usually have a constant w, which is eliminated.
+
+	auto allChannels = benchmarkAnimationCreateChannels(channels, keys, VK_TRUE);
+
+	std::unique_ptr<vkts::AnimationSampler[]> allSamplers(new vkts::AnimationSampler[nodes]);
+	std::unique_ptr<vkts::AnimationSampler[]> allCompressedSamplers(new vkts::AnimationSampler[nodes]);
+
+	for (uint32_t node = 0; node < nodes; node++)
+	{
+		allSamplers[node].build(allChannels);
+
+		allCompressedSamplers[node].setCompression(BENCHMARK_ANIMATION_KEY_TIME, BENCHMARK_ANIMATION_MAX_ERROR);
+		allCompressedSamplers[node].build(allChannels);
+	}
+
+	// The channels keep their entries, so both samplers are used in addition to the channels.
+
+	uint64_t channelMemorySize = 0;
+
+	for (uint32_t channel = 0; channel < channels; channel++)
+	{
+		channelMemorySize += (uint64_t)allChannels[channel]->getNumberEntries() * (uint64_t)(2 * sizeof(float) + sizeof(glm::vec4) + sizeof(VkTsInterpolator));
+	}
+
+	uint32_t encodings[4] = {0, 0, 0, 0};
+
+	for (uint32_t track = 0; track < channels; track++)
+	{
+		encodings[allCompressedSamplers[0].getTrackEncoding(track)]++;
+	}
+
+	const uint64_t samples = (uint64_t)BENCHMARK_ANIMATION_FRAMES * (uint64_t)nodes * (uint64_t)channels;
+
+	std::vector<float> allResults(samples);
+	std::vector<float> allCompressedResults(samples);
+
+	//
+
+	uint64_t index = 0;
+
+	double start = vkts::timeGetRaw();
+
+	for (uint32_t frame = 0; frame < BENCHMARK_ANIMATION_FRAMES; frame++)
+	{
+		for (uint32_t node = 0; node < nodes; node++)
+		{
+			const float currentTime = benchmarkAnimationGetTime(frame, node, keys);
+
+			for (uint32_t track = 0; track < channels; track++)
+			{
+				allResults[index++] = allSamplers[node].sample(track, currentTime);
+			}
+		}
+	}
+
+	const double seconds = vkts::timeGetRaw() - start;
+
+	//
+
+	index = 0;
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t frame = 0; frame < BENCHMARK_ANIMATION_FRAMES; frame++)
+	{
+		for (uint32_t node = 0; node < nodes; node++)
+		{
+			const float currentTime = benchmarkAnimationGetTime(frame, node, keys);
+
+			for (uint32_t track = 0; track < channels; track++)
+			{
+				allCompressedResults[index++] = allCompressedSamplers[node].sample(track, currentTime);
+			}
+		}
+	}
+
+	const double compressedSeconds = vkts::timeGetRaw() - start;
+
+	// Compressed output has to stay inside the error, allowing for rounding of the decoder.
+
+	float maxError = 0.0f;
+
+	for (uint64_t i = 0; i < samples; i++)
+	{
+		maxError = glm::max(maxError, fabsf(allCompressedResults[i] - allResults[i]));
+	}
+
+	if (maxError > BENCHMARK_ANIMATION_MAX_ERROR * 1.001f)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Compressed animation error %f exceeds %f for %u channels, %u keys and %u nodes.", maxError, BENCHMARK_ANIMATION_MAX_ERROR, channels, keys, nodes);
+
+		return VK_FALSE;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Animation %u channels x %u keys memory bytes channels = %llu sampler = %llu compressed sampler = %llu", channels, keys, (unsigned long long)channelMemorySize, (unsigned long long)allSamplers[0].getMemorySize(), (unsigned long long)allCompressedSamplers[0].getMemorySize());
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Animation %u channels x %u keys tracks keys = %u constant = %u 8 bit = %u 16 bit = %u max error = %f", channels, keys, encodings[vkts::AnimationTrackKeys], encodings[vkts::AnimationTrackConstant], encodings[vkts::AnimationTrackQuantized8], encodings[vkts::AnimationTrackQuantized16], maxError);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Animation %u channels x %u keys x %u nodes uncompressed samples/second = %.0f", channels, keys, nodes, (double)samples / seconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Animation %u channels x %u keys x %u nodes compressed samples/second = %.0f", channels, keys, nodes, (double)samples / compressedSeconds);
+
+	return VK_TRUE;
+}
+
+VkBool32 benchmarkAnimation()
+{
+	// Channels, keys and nodes.
+
+	static const uint32_t configurations[5][3] = {{12, 16, 1024}, {12, 256, 256}, {12, 4096, 16}, {48, 64, 256}, {48, 1024, 64}};
+
+	if (!benchmarkAnimationModificationCheck())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Animation sampler did not detect a modified channel.");
+
+		return VK_FALSE;
+	}
+
+	// Channels 4 to 7 are rotations. After a constant interpolated entry, one of them can not be resampled anymore.
+
+	auto allRotationChannels = benchmarkAnimationCreateChannels(8, 256, VK_FALSE);
+
+	const auto& rotationChannel = allRotationChannels[5];
+
+	const float keys[2] = {rotationChannel->getKeys()[254], rotationChannel->getKeys()[255]};
+	const float values[2] = {rotationChannel->getValues()[254], rotationChannel->getValues()[255]};
+
+	if (!benchmarkAnimationRotationCheck(allRotationChannels, VK_TRUE) || !rotationChannel->removeEntry(keys[1]) || !rotationChannel->removeEntry(keys[0]) || !rotationChannel->addEntry(keys[0], values[0], glm::vec4(keys[0] - 0.1f, values[0], keys[0] + 0.1f, values[0]), VKTS_INTERPOLATOR_CONSTANT) || !rotationChannel->addEntry(keys[1], values[1], glm::vec4(keys[1] - 0.1f, values[1], keys[1] + 0.1f, values[1]), VKTS_INTERPOLATOR_LINEAR) || !benchmarkAnimationRotationCheck(allRotationChannels, VK_FALSE))
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Animation sampler mixed resampled rotation tracks with other rotation tracks.");
+
+		return VK_FALSE;
+	}
+
+	for (uint32_t i = 0; i < 5; i++)
+	{
+		if (!benchmarkAnimationRun(configurations[i][0], configurations[i][1], configurations[i][2]))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	if (!benchmarkAnimationReleaseCheck())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Animation sampler did not read back or give back released entries.");
+
+		return VK_FALSE;
+	}
+
+	for (uint32_t i = 0; i < 5; i++)
+	{
+		if (!benchmarkAnimationCompressionRun(configurations[i][0], configurations[i][1], configurations[i][2]))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
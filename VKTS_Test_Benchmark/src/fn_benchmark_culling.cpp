@@ -0,0 +1,198 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+#define BENCHMARK_CULLING_TESTS 10000000
+#define BENCHMARK_CULLING_EXTENT 100.0f
+#define BENCHMARK_CULLING_SIZE 2.0f
+
+static VkBool32 benchmarkCullingRun(const vkts::Frustum& frustum, const uint32_t volumes)
+{
+	// Same number of tests for every configuration.
+
+	const uint32_t rounds = glm::max(BENCHMARK_CULLING_TESTS / volumes, 1u);
+
+	const uint64_t tests = (uint64_t)rounds * (uint64_t)volumes;
+
+	vkts::randomSetSeed(volumes);
+
+	// Volumes as structure of arrays. The spheres enclose the boxes.
+
+	std::vector<float> allMinimumX(volumes), allMinimumY(volumes), allMinimumZ(volumes);
+	std::vector<float> allMaximumX(volumes), allMaximumY(volumes), allMaximumZ(volumes);
+	std::vector<float> allCenterX(volumes), allCenterY(volumes), allCenterZ(volumes), allRadius(volumes);
+
+	std::vector<vkts::Sphere> allSpheres(volumes);
+
+	for (uint32_t i = 0; i < volumes; i++)
+	{
+		const glm::vec3 center(vkts::randomUniform(-BENCHMARK_CULLING_EXTENT, BENCHMARK_CULLING_EXTENT), vkts::randomUniform(-BENCHMARK_CULLING_EXTENT, BENCHMARK_CULLING_EXTENT), vkts::randomUniform(-BENCHMARK_CULLING_EXTENT, BENCHMARK_CULLING_EXTENT));
+		const glm::vec3 extent(vkts::randomUniform(0.0f, BENCHMARK_CULLING_SIZE), vkts::randomUniform(0.0f, BENCHMARK_CULLING_SIZE), vkts::randomUniform(0.0f, BENCHMARK_CULLING_SIZE));
+
+		allMinimumX[i] = center.x - extent.x;
+		allMinimumY[i] = center.y - extent.y;
+		allMinimumZ[i] = center.z - extent.z;
+
+		allMaximumX[i] = center.x + extent.x;
+		allMaximumY[i] = center.y + extent.y;
+		allMaximumZ[i] = center.z + extent.z;
+
+		allCenterX[i] = center.x;
+		allCenterY[i] = center.y;
+		allCenterZ[i] = center.z;
+		allRadius[i] = glm::length(extent);
+
+		allSpheres[i] = vkts::Sphere(center.x, center.y, center.z, allRadius[i]);
+	}
+
+	const uint32_t maskSize = (volumes + 31) / 32;
+
+	std::vector<uint32_t> allSphereMasks(maskSize);
+	std::vector<uint32_t> allAabbMasks(maskSize);
+	std::vector<uint32_t> allSphereReferenceMasks(maskSize);
+	std::vector<uint32_t> allAabbReferenceMasks(maskSize);
+
+	//
+
+	uint32_t visibleSpheres = 0;
+
+	double start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		visibleSpheres = frustum.cullSpheres(&allCenterX[0], &allCenterY[0], &allCenterZ[0], &allRadius[0], volumes, &allSphereMasks[0]);
+	}
+
+	const double sphereSeconds = vkts::timeGetRaw() - start;
+
+	//
+
+	uint32_t visibleAabbs = 0;
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		visibleAabbs = frustum.cullAabbs(&allMinimumX[0], &allMinimumY[0], &allMinimumZ[0], &allMaximumX[0], &allMaximumY[0], &allMaximumZ[0], volumes, &allAabbMasks[0]);
+	}
+
+	const double aabbSeconds = vkts::timeGetRaw() - start;
+
+	// Previous implementation, testing one volume per call.
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		for (uint32_t i = 0; i < volumes; i++)
+		{
+			if (frustum.isVisible(allSpheres[i]))
+			{
+				allSphereReferenceMasks[i / 32] |= 1 << (i % 32);
+			}
+		}
+	}
+
+	const double sphereReferenceSeconds = vkts::timeGetRaw() - start;
+
+	//
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		for (uint32_t i = 0; i < volumes; i++)
+		{
+			if (frustum.isVisible(vkts::Obb(glm::vec4(allMinimumX[i], allMinimumY[i], allMinimumZ[i], 1.0f), glm::vec4(allMaximumX[i], allMaximumY[i], allMaximumZ[i], 1.0f))))
+			{
+				allAabbReferenceMasks[i / 32] |= 1 << (i % 32);
+			}
+		}
+	}
+
+	const double aabbReferenceSeconds = vkts::timeGetRaw() - start;
+
+	//
+
+	start = vkts::timeGetRaw();
+
+	uint32_t visibleMasked = 0;
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		visibleMasked = 0;
+
+		for (uint32_t i = 0; i < volumes; i++)
+		{
+			uint32_t planeMask = VKTS_FRUSTUM_PLANE_MASK_ALL;
+
+			if (frustum.isVisible(glm::vec3(allMinimumX[i], allMinimumY[i], allMinimumZ[i]), glm::vec3(allMaximumX[i], allMaximumY[i], allMaximumZ[i]), planeMask))
+			{
+				visibleMasked++;
+			}
+		}
+	}
+
+	const double aabbMaskedSeconds = vkts::timeGetRaw() - start;
+
+	// Batch results have to be identical to the previous implementation.
+
+	if (memcmp(&allSphereMasks[0], &allSphereReferenceMasks[0], maskSize * sizeof(uint32_t)) != 0 || memcmp(&allAabbMasks[0], &allAabbReferenceMasks[0], maskSize * sizeof(uint32_t)) != 0)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Culling results differ for %u volumes.", volumes);
+
+		return VK_FALSE;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Culling %u volumes visible spheres = %u aabbs = %u plane mask aabbs = %u", volumes, visibleSpheres, visibleAabbs, visibleMasked);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Culling %u volumes batch spheres tests/second = %.0f", volumes, (double)tests / sphereSeconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Culling %u volumes batch aabbs tests/second = %.0f", volumes, (double)tests / aabbSeconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Culling %u volumes reference spheres tests/second = %.0f", volumes, (double)tests / sphereReferenceSeconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Culling %u volumes reference obbs tests/second = %.0f", volumes, (double)tests / aabbReferenceSeconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Culling %u volumes reference plane mask aabbs tests/second = %.0f", volumes, (double)tests / aabbMaskedSeconds);
+
+	return VK_TRUE;
+}
+
+VkBool32 benchmarkCulling()
+{
+	// Camera in the center of the volumes.
+
+	vkts::Frustum frustum(vkts::perspectiveMat4(45.0f, 16.0f / 9.0f, 0.1f, 100.0f), vkts::lookAtMat4(0.0f, 0.0f, 0.0f, 1.0f, 0.2f, -1.0f, 0.0f, 1.0f, 0.0f));
+
+	static const uint32_t configurations[3] = {10000, 100000, 1000000};
+
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		if (!benchmarkCullingRun(frustum, configurations[i]))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
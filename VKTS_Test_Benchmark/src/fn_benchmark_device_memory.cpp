@@ -0,0 +1,458 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+#define BENCHMARK_DEVICE_MEMORY_BLOCK_SIZE (4 * 1024 * 1024)
+#define BENCHMARK_DEVICE_MEMORY_ALLOCATIONS 256
+#define BENCHMARK_DEVICE_MEMORY_SIZE 4096
+#define BENCHMARK_DEVICE_MEMORY_ALIGNMENT 256
+#define BENCHMARK_DEVICE_MEMORY_ROUNDS 1000
+
+/**
+ * Device memory backed by host memory, so the allocator can be checked without a Vulkan device.
+ */
+class BenchmarkDeviceMemory : public vkts::IDeviceMemory
+{
+
+private:
+
+	const VkMemoryAllocateInfo memoryAllocInfo;
+
+	const VkMemoryType memoryType;
+
+	std::vector<uint8_t> allBytes;
+
+	uint8_t* data;
+
+	uint64_t mapCount;
+
+	mutable uint64_t flushCount;
+
+public:
+
+	BenchmarkDeviceMemory(const VkDeviceSize size, const uint32_t memoryTypeIndex, const VkMemoryType& memoryType) :
+		IDeviceMemory(), memoryAllocInfo{VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr, size, memoryTypeIndex}, memoryType(memoryType), allBytes((size_t)size), data(nullptr), mapCount(0), flushCount(0)
+	{
+	}
+
+	virtual ~BenchmarkDeviceMemory()
+	{
+		destroy();
+	}
+
+	const uint8_t* getBytes() const
+	{
+		return allBytes.size() > 0 ? &allBytes[0] : nullptr;
+	}
+
+	virtual const VkDevice getDevice() const override
+	{
+		return VK_NULL_HANDLE;
+	}
+
+	virtual const VkMemoryAllocateInfo& getMemoryAllocInfo() const override
+	{
+		return memoryAllocInfo;
+	}
+
+	virtual VkDeviceSize getAllocationSize() const override
+	{
+		return memoryAllocInfo.allocationSize;
+	}
+
+	virtual uint32_t getMemoryTypeIndex() const override
+	{
+		return memoryAllocInfo.memoryTypeIndex;
+	}
+
+	virtual VkMemoryType getMemoryType() const override
+	{
+		return memoryType;
+	}
+
+	virtual uint32_t getMemoryTypeCount() const override
+	{
+		return 1;
+	}
+
+	virtual const VkMemoryType* getMemoryTypes() const override
+	{
+		return &memoryType;
+	}
+
+	virtual VkMemoryPropertyFlags getMemoryPropertyFlags() const override
+	{
+		return memoryType.propertyFlags;
+	}
+
+	virtual const VkDeviceMemory getDeviceMemory() const override
+	{
+		// Any unique, non null handle.
+		return allBytes.size() > 0 ? (VkDeviceMemory)(uintptr_t)&allBytes[0] : VK_NULL_HANDLE;
+	}
+
+	virtual VkDeviceSize getOffset() const override
+	{
+		return 0;
+	}
+
+	virtual VkResult mapMemory(const VkDeviceSize offset, const VkDeviceSize size, const VkMemoryMapFlags flags) override
+	{
+		if (!(memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) || offset > getAllocationSize() || allBytes.size() == 0)
+		{
+			return VK_ERROR_MEMORY_MAP_FAILED;
+		}
+
+		data = &allBytes[(size_t)offset];
+
+		mapCount++;
+
+		return VK_SUCCESS;
+	}
+
+	virtual void* getMemory() override
+	{
+		return data;
+	}
+
+	virtual VkResult flushMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override
+	{
+		flushCount++;
+
+		return VK_SUCCESS;
+	}
+
+	virtual VkResult invalidateMappedMemoryRanges(const VkDeviceSize offset, const VkDeviceSize size) const override
+	{
+		return VK_SUCCESS;
+	}
+
+	virtual void unmapMemory() override
+	{
+		data = nullptr;
+	}
+
+	virtual VkResult upload(const VkDeviceSize offset, const VkMemoryMapFlags flags, const void* uploadData, const uint32_t uploadDataSize) override
+	{
+		if (offset + uploadDataSize > getAllocationSize() || allBytes.size() == 0)
+		{
+			return VK_ERROR_MEMORY_MAP_FAILED;
+		}
+
+		memcpy(&allBytes[(size_t)offset], uploadData, uploadDataSize);
+
+		return VK_SUCCESS;
+	}
+
+	virtual VkResult mapMemoryPersistent(const VkMemoryMapFlags flags) override
+	{
+		return mapMemory(0, VK_WHOLE_SIZE, flags);
+	}
+
+	virtual VkBool32 isMappedPersistent() const override
+	{
+		return data != nullptr;
+	}
+
+	virtual VkResult flushUploads() override
+	{
+		return VK_SUCCESS;
+	}
+
+	virtual uint64_t getUploadCount() const override
+	{
+		return 0;
+	}
+
+	virtual uint64_t getUploadBytes() const override
+	{
+		return 0;
+	}
+
+	virtual uint64_t getMapCount() const override
+	{
+		return mapCount;
+	}
+
+	virtual uint64_t getFlushCount() const override
+	{
+		return flushCount;
+	}
+
+	virtual void destroy() override
+	{
+		data = nullptr;
+
+		allBytes.clear();
+		allBytes.shrink_to_fit();
+	}
+
+};
+
+typedef std::shared_ptr<BenchmarkDeviceMemory> BenchmarkDeviceMemorySP;
+
+/**
+ * Fake device, recording every created device memory.
+ */
+class BenchmarkDevice
+{
+
+public:
+
+	VkMemoryType memoryType;
+
+	std::vector<std::weak_ptr<BenchmarkDeviceMemory>> allCreatedMemories;
+
+	// Simulates a heap, which is too fragmented for another block.
+	VkBool32 failBlocks;
+
+	BenchmarkDevice() :
+		memoryType{VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 0}, allCreatedMemories(), failBlocks(VK_FALSE)
+	{
+	}
+
+	vkts::IDeviceMemorySP create(const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags)
+	{
+		if (failBlocks && memoryRequirements.size == BENCHMARK_DEVICE_MEMORY_BLOCK_SIZE)
+		{
+			return vkts::IDeviceMemorySP();
+		}
+
+		auto deviceMemory = BenchmarkDeviceMemorySP(new BenchmarkDeviceMemory(memoryRequirements.size, 0, memoryType));
+
+		allCreatedMemories.push_back(deviceMemory);
+
+		return deviceMemory;
+	}
+
+	uint32_t getLiveCount() const
+	{
+		uint32_t liveCount = 0;
+
+		for (const auto& currentMemory : allCreatedMemories)
+		{
+			auto deviceMemory = currentMemory.lock();
+
+			if (deviceMemory.get() && deviceMemory->getBytes())
+			{
+				liveCount++;
+			}
+		}
+
+		return liveCount;
+	}
+
+};
+
+#define BENCHMARK_DEVICE_MEMORY_CHECK(condition, message) \
+	if (!(condition)) \
+	{ \
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Device memory %s.", message); \
+		\
+		return VK_FALSE; \
+	}
+
+static VkBool32 benchmarkDeviceMemoryCheck(BenchmarkDevice& device, const vkts::IDeviceMemoryAllocatorSP& allocator)
+{
+	const VkMemoryRequirements memoryRequirements{BENCHMARK_DEVICE_MEMORY_SIZE, BENCHMARK_DEVICE_MEMORY_ALIGNMENT, 1};
+
+	const VkMemoryPropertyFlags propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+
+	VkTsDeviceMemoryStatistics statistics;
+
+	// Sub allocation: all allocations share one block, are aligned and do not overlap.
+
+	vkts::SmartPointerVector<vkts::IDeviceMemorySP> allDeviceMemories;
+
+	for (uint32_t i = 0; i < BENCHMARK_DEVICE_MEMORY_ALLOCATIONS; i++)
+	{
+		auto deviceMemory = allocator->allocate(memoryRequirements, propertyFlags, VK_TRUE);
+
+		BENCHMARK_DEVICE_MEMORY_CHECK(deviceMemory.get(), "sub allocation failed");
+
+		BENCHMARK_DEVICE_MEMORY_CHECK(deviceMemory->getOffset() % BENCHMARK_DEVICE_MEMORY_ALIGNMENT == 0, "sub allocation is not aligned");
+
+		BENCHMARK_DEVICE_MEMORY_CHECK(deviceMemory->getAllocationSize() == BENCHMARK_DEVICE_MEMORY_SIZE, "sub allocation has wrong size");
+
+		BENCHMARK_DEVICE_MEMORY_CHECK(allDeviceMemories.size() == 0 || deviceMemory->getDeviceMemory() == allDeviceMemories[0]->getDeviceMemory(), "sub allocation is not in the same block");
+
+		for (uint32_t k = 0; k < allDeviceMemories.size(); k++)
+		{
+			const VkDeviceSize otherOffset = allDeviceMemories[k]->getOffset();
+
+			BENCHMARK_DEVICE_MEMORY_CHECK(deviceMemory->getOffset() + BENCHMARK_DEVICE_MEMORY_SIZE <= otherOffset || otherOffset + BENCHMARK_DEVICE_MEMORY_SIZE <= deviceMemory->getOffset(), "sub allocations overlap");
+		}
+
+		allDeviceMemories.append(deviceMemory);
+	}
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(device.allCreatedMemories.size() == 1, "sub allocation created more than one block");
+
+	// Uploads land in the block at the offset of the sub allocation.
+
+	const uint32_t value = 0x12345678;
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(allDeviceMemories[1]->upload(4, 0, &value, sizeof(uint32_t)) == VK_SUCCESS, "upload failed");
+
+	auto block = device.allCreatedMemories[0].lock();
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(block.get() && memcmp(block->getBytes() + allDeviceMemories[1]->getOffset() + 4, &value, sizeof(uint32_t)) == 0, "upload is not at the sub allocation offset");
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(allDeviceMemories[1]->getUploadCount() == 1 && allDeviceMemories[1]->getUploadBytes() == sizeof(uint32_t), "upload counters are wrong");
+
+	block.reset();
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(allocator->getStatistics(statistics, 0), "statistics failed");
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.blockCount == 1 && statistics.blockBytes == BENCHMARK_DEVICE_MEMORY_BLOCK_SIZE, "statistics block values are wrong");
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.allocationCount == BENCHMARK_DEVICE_MEMORY_ALLOCATIONS && statistics.usedBytes == BENCHMARK_DEVICE_MEMORY_ALLOCATIONS * BENCHMARK_DEVICE_MEMORY_SIZE, "statistics allocation values are wrong");
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.dedicatedCount == 0 && statistics.fragmentation == 0.0f, "statistics dedicated or fragmentation values are wrong");
+
+	// Freeing every second allocation fragments the block.
+
+	for (uint32_t i = 0; i < BENCHMARK_DEVICE_MEMORY_ALLOCATIONS / 2; i++)
+	{
+		allDeviceMemories.remove(allDeviceMemories[i]);
+	}
+
+	allocator->getStatistics(statistics);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.allocationCount == BENCHMARK_DEVICE_MEMORY_ALLOCATIONS - BENCHMARK_DEVICE_MEMORY_ALLOCATIONS / 2, "statistics after free are wrong");
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.freeRangeCount > 1 && statistics.fragmentation > 0.0f, "statistics fragmentation after free is wrong");
+
+	// Dedicated fallback: more than half a block.
+
+	auto dedicatedMemory = allocator->allocate(VkMemoryRequirements{BENCHMARK_DEVICE_MEMORY_BLOCK_SIZE / 2 + 1, BENCHMARK_DEVICE_MEMORY_ALIGNMENT, 1}, propertyFlags, VK_TRUE);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(dedicatedMemory.get() && dedicatedMemory->getOffset() == 0 && dedicatedMemory->getAllocationSize() == BENCHMARK_DEVICE_MEMORY_BLOCK_SIZE / 2 + 1, "dedicated allocation is wrong");
+
+	allocator->getStatistics(statistics, 0);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.dedicatedCount == 1 && statistics.dedicatedBytes == BENCHMARK_DEVICE_MEMORY_BLOCK_SIZE / 2 + 1, "statistics dedicated values are wrong");
+
+	dedicatedMemory.reset();
+
+	allocator->getStatistics(statistics, 0);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.dedicatedCount == 0 && statistics.dedicatedBytes == 0, "statistics after dedicated free are wrong");
+
+	// Dedicated fallback: no new block can be created, as the current block is full.
+
+	device.failBlocks = VK_TRUE;
+
+	const VkMemoryRequirements halfBlockRequirements{BENCHMARK_DEVICE_MEMORY_BLOCK_SIZE / 2, BENCHMARK_DEVICE_MEMORY_ALIGNMENT, 1};
+
+	const uint32_t createdCount = (uint32_t)device.allCreatedMemories.size();
+
+	auto fillMemory = allocator->allocate(halfBlockRequirements, propertyFlags, VK_TRUE);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(fillMemory.get() && (uint32_t)device.allCreatedMemories.size() == createdCount && fillMemory->getDeviceMemory() == allDeviceMemories[0]->getDeviceMemory(), "half block allocation is not in the block");
+
+	auto fallbackMemory = allocator->allocate(halfBlockRequirements, propertyFlags, VK_TRUE);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(fallbackMemory.get() && (uint32_t)device.allCreatedMemories.size() == createdCount + 1 && fallbackMemory->getDeviceMemory() != allDeviceMemories[0]->getDeviceMemory(), "fallback for a failed block is wrong");
+
+	allocator->getStatistics(statistics, 0);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.blockCount == 1 && statistics.dedicatedCount == 1, "statistics after a failed block are wrong");
+
+	fallbackMemory.reset();
+	fillMemory.reset();
+
+	device.failBlocks = VK_FALSE;
+
+	// Unused blocks are only freed on request.
+
+	allDeviceMemories.clear();
+
+	allocator->getStatistics(statistics);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.blockCount == 1 && statistics.allocationCount == 0 && statistics.usedBytes == 0, "statistics of an unused block are wrong");
+
+	allocator->freeUnusedBlocks();
+
+	allocator->getStatistics(statistics);
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(statistics.blockCount == 0 && statistics.blockBytes == 0, "unused blocks are not freed");
+
+	BENCHMARK_DEVICE_MEMORY_CHECK(device.getLiveCount() == 0, "device memory is still alive");
+
+	return VK_TRUE;
+}
+
+VkBool32 benchmarkDeviceMemory()
+{
+	BenchmarkDevice device;
+
+	auto createFunction = [&device](const VkMemoryRequirements& memoryRequirements, const VkMemoryPropertyFlags propertyFlags)
+	{
+		return device.create(memoryRequirements, propertyFlags);
+	};
+
+	auto allocator = vkts::deviceMemoryAllocatorCreate(createFunction, 1, &device.memoryType, 1, 1, BENCHMARK_DEVICE_MEMORY_BLOCK_SIZE);
+
+	if (!allocator.get())
+	{
+		return VK_FALSE;
+	}
+
+	if (!benchmarkDeviceMemoryCheck(device, allocator))
+	{
+		allocator->destroy();
+
+		return VK_FALSE;
+	}
+
+	// Allocation and free throughput of the sub allocator.
+
+	const VkMemoryRequirements memoryRequirements{BENCHMARK_DEVICE_MEMORY_SIZE, BENCHMARK_DEVICE_MEMORY_ALIGNMENT, 1};
+
+	vkts::SmartPointerVector<vkts::IDeviceMemorySP> allDeviceMemories;
+
+	double start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < BENCHMARK_DEVICE_MEMORY_ROUNDS; round++)
+	{
+		for (uint32_t i = 0; i < BENCHMARK_DEVICE_MEMORY_ALLOCATIONS; i++)
+		{
+			allDeviceMemories.append(allocator->allocate(memoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_TRUE));
+		}
+
+		allDeviceMemories.clear();
+	}
+
+	const double seconds = vkts::timeGetRaw() - start;
+
+	allocator->destroy();
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Device memory sub allocations and frees/second = %.0f", (double)(BENCHMARK_DEVICE_MEMORY_ROUNDS * BENCHMARK_DEVICE_MEMORY_ALLOCATIONS) / seconds);
+
+	return VK_TRUE;
+}
@@ -0,0 +1,135 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+#define BENCHMARK_JSON_NODES 4096
+#define BENCHMARK_JSON_ARRAY_ELEMENTS 256
+#define BENCHMARK_JSON_RUNS 3
+
+static std::string benchmarkJsonCreateText()
+{
+	// glTF like document: Many small objects and large inline number arrays.
+
+	std::string text = "{\n   \"asset\" : {\n      \"version\" : \"2.0\",\n      \"generator\" : \"VKTS \\\"benchmark\\\"\"\n   },\n   \"nodes\" : [";
+
+	char buffer[256];
+
+	for (uint32_t node = 0; node < BENCHMARK_JSON_NODES; node++)
+	{
+		sprintf(buffer, "%s\n      {\n         \"name\" : \"Node_%u\",\n         \"mesh\" : %u,\n         \"visible\" : %s,\n         \"extras\" : null,\n         \"matrix\" : [", node > 0 ? "," : "", node, node % 7, (node % 2) ? "true" : "false");
+
+		text += buffer;
+
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			sprintf(buffer, "%s %.6f", i > 0 ? "," : "", (float)(node * 16 + i) * 0.001f - 1.0f);
+
+			text += buffer;
+		}
+
+		text += " ],\n         \"weights\" : [";
+
+		for (uint32_t i = 0; i < BENCHMARK_JSON_ARRAY_ELEMENTS; i++)
+		{
+			sprintf(buffer, "%s%d", i > 0 ? "," : "", (int32_t)(node * i) - 1000);
+
+			text += buffer;
+		}
+
+		sprintf(buffer, "],\n         \"scale\" : [ 1.5e-3, -2.25E+2, %u ]\n      }", node);
+
+		text += buffer;
+	}
+
+	text += "\n   ]\n}\n";
+
+	return text;
+}
+
+static double benchmarkJsonDecode(const std::string& text, const VkBool32 fast, std::string& encoded)
+{
+	double best = 0.0;
+
+	for (uint32_t run = 0; run < BENCHMARK_JSON_RUNS; run++)
+	{
+		const double start = vkts::timeGetRaw();
+
+		auto json = fast ? vkts::jsonDecodeFast(text) : vkts::jsonDecode(text);
+
+		const double seconds = vkts::timeGetRaw() - start;
+
+		if (!json.get())
+		{
+			return 0.0;
+		}
+
+		if (run == 0)
+		{
+			encoded = vkts::jsonEncode(json);
+		}
+
+		const double megabytesPerSecond = (double)text.length() / (1024.0 * 1024.0) / seconds;
+
+		best = glm::max(best, megabytesPerSecond);
+	}
+
+	return best;
+}
+
+VkBool32 benchmarkJson()
+{
+	const std::string text = benchmarkJsonCreateText();
+
+	std::string encoded;
+	std::string encodedFast;
+
+	const double megabytesPerSecond = benchmarkJsonDecode(text, VK_FALSE, encoded);
+
+	const double megabytesPerSecondFast = benchmarkJsonDecode(text, VK_TRUE, encodedFast);
+
+	if (megabytesPerSecond == 0.0 || megabytesPerSecondFast == 0.0)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: JSON decoding failed.");
+
+		return VK_FALSE;
+	}
+
+	// Both decoders have to produce the same values.
+
+	if (encoded.length() == 0 || encoded != encodedFast)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: JSON decoders differ.");
+
+		return VK_FALSE;
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: JSON size = %.2f MB", (double)text.length() / (1024.0 * 1024.0));
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: JSON decode MB/second = %.2f", megabytesPerSecond);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: JSON decode fast MB/second = %.2f", megabytesPerSecondFast);
+
+	return VK_TRUE;
+}
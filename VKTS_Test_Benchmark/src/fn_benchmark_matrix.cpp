@@ -0,0 +1,162 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+#define BENCHMARK_MATRIX_TRANSFORMS 10000000
+
+static VkBool32 benchmarkMatrixRun(const uint32_t transforms)
+{
+	// Same number of transforms for every configuration.
+
+	const uint32_t rounds = glm::max(BENCHMARK_MATRIX_TRANSFORMS / transforms, 1u);
+
+	const uint64_t samples = (uint64_t)rounds * (uint64_t)transforms;
+
+	vkts::randomSetSeed(transforms);
+
+	std::vector<float> allTranslateX(transforms), allTranslateY(transforms), allTranslateZ(transforms);
+	std::vector<float> allRotateX(transforms), allRotateY(transforms), allRotateZ(transforms), allRotateW(transforms);
+	std::vector<float> allScaleX(transforms), allScaleY(transforms), allScaleZ(transforms);
+
+	std::vector<glm::vec3> allTranslates(transforms);
+	std::vector<vkts::Quat> allRotates(transforms);
+	std::vector<glm::vec3> allScales(transforms);
+
+	for (uint32_t i = 0; i < transforms; i++)
+	{
+		allTranslates[i] = glm::vec3(vkts::randomUniform(-100.0f, 100.0f), vkts::randomUniform(-100.0f, 100.0f), vkts::randomUniform(-100.0f, 100.0f));
+		allRotates[i] = vkts::rotateRzRyRx(vkts::randomUniform(-180.0f, 180.0f), vkts::randomUniform(-180.0f, 180.0f), vkts::randomUniform(-180.0f, 180.0f));
+		allScales[i] = glm::vec3(vkts::randomUniform(0.5f, 2.0f), vkts::randomUniform(0.5f, 2.0f), vkts::randomUniform(0.5f, 2.0f));
+
+		allTranslateX[i] = allTranslates[i].x;
+		allTranslateY[i] = allTranslates[i].y;
+		allTranslateZ[i] = allTranslates[i].z;
+
+		allRotateX[i] = allRotates[i].x;
+		allRotateY[i] = allRotates[i].y;
+		allRotateZ[i] = allRotates[i].z;
+		allRotateW[i] = allRotates[i].w;
+
+		allScaleX[i] = allScales[i].x;
+		allScaleY[i] = allScales[i].y;
+		allScaleZ[i] = allScales[i].z;
+	}
+
+	std::vector<glm::mat4> allMatrices(transforms);
+	std::vector<glm::mat4> allReferenceMatrices(transforms);
+
+	std::vector<glm::mat3> allNormalMatrices(transforms);
+	std::vector<glm::mat3> allReferenceNormalMatrices(transforms);
+
+	//
+
+	double start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		vkts::composeMat4Batch(&allTranslateX[0], &allTranslateY[0], &allTranslateZ[0], &allRotateX[0], &allRotateY[0], &allRotateZ[0], &allRotateW[0], &allScaleX[0], &allScaleY[0], &allScaleZ[0], transforms, &allMatrices[0]);
+	}
+
+	const double composeSeconds = vkts::timeGetRaw() - start;
+
+	//
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		vkts::normalMat3Batch(&allMatrices[0], transforms, &allNormalMatrices[0]);
+	}
+
+	const double normalSeconds = vkts::timeGetRaw() - start;
+
+	// Previous implementation, as done per node.
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		for (uint32_t i = 0; i < transforms; i++)
+		{
+			allReferenceMatrices[i] = vkts::translateMat4(allTranslates[i].x, allTranslates[i].y, allTranslates[i].z) * allRotates[i].mat4() * vkts::scaleMat4(allScales[i].x, allScales[i].y, allScales[i].z);
+		}
+	}
+
+	const double composeReferenceSeconds = vkts::timeGetRaw() - start;
+
+	//
+
+	start = vkts::timeGetRaw();
+
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		for (uint32_t i = 0; i < transforms; i++)
+		{
+			allReferenceNormalMatrices[i] = glm::transpose(glm::inverse(glm::mat3(allReferenceMatrices[i])));
+		}
+	}
+
+	const double normalReferenceSeconds = vkts::timeGetRaw() - start;
+
+	// Values have to be identical to the previous implementation. Compared by value, as the sign of zero may differ.
+
+	for (uint32_t i = 0; i < transforms; i++)
+	{
+		if (allMatrices[i] != allReferenceMatrices[i] || allNormalMatrices[i] != allReferenceNormalMatrices[i])
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Matrices differ for %u transforms at %u.", transforms, i);
+
+			return VK_FALSE;
+		}
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Matrix %u transforms batch compose matrices/second = %.0f", transforms, (double)samples / composeSeconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Matrix %u transforms batch normal matrices/second = %.0f", transforms, (double)samples / normalSeconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Matrix %u transforms reference compose matrices/second = %.0f", transforms, (double)samples / composeReferenceSeconds);
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Matrix %u transforms reference normal matrices/second = %.0f", transforms, (double)samples / normalReferenceSeconds);
+
+	return VK_TRUE;
+}
+
+VkBool32 benchmarkMatrix()
+{
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Matrix processor features = 0x%08x", vkts::processorGetFeatures());
+
+	// Counts are not a multiple of eight, so all paths are used.
+
+	static const uint32_t configurations[3] = {1003, 65541, 1000007};
+
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		if (!benchmarkMatrixRun(configurations[i]))
+		{
+			return VK_FALSE;
+		}
+	}
+
+	return VK_TRUE;
+}
@@ -0,0 +1,304 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+#define BENCHMARK_PREFILTER_LENGTH 64
+#define BENCHMARK_PREFILTER_SAMPLES 32
+
+static vkts::IImageDataSP benchmarkPrefilterCreateCubeMap()
+{
+	vkts::SmartPointerVector<vkts::IImageDataSP> allFaces;
+
+	for (uint32_t side = 0; side < 6; side++)
+	{
+		auto face = vkts::imageDataCreate("benchmark_face" + std::to_string(side) + ".data", BENCHMARK_PREFILTER_LENGTH, BENCHMARK_PREFILTER_LENGTH, 1, 0.0f, 0.0f, 0.0f, 1.0f, VK_IMAGE_TYPE_2D, VK_FORMAT_R32G32B32A32_SFLOAT);
+
+		if (!face.get())
+		{
+			return vkts::IImageDataSP();
+		}
+
+		// High dynamic range content with sharp edges.
+
+		for (uint32_t y = 0; y < BENCHMARK_PREFILTER_LENGTH; y++)
+		{
+			for (uint32_t x = 0; x < BENCHMARK_PREFILTER_LENGTH; x++)
+			{
+				const float red = (float)((x * 7 + side * 13) % 17) / 16.0f;
+				const float green = sinf((float)(x + y * side) * 0.37f) * 0.5f + 0.5f;
+				const float blue = ((x / 8 + y / 8 + side) % 2) ? 12.5f : 0.125f;
+
+				face->setTexel(glm::vec4(red, green, blue, 1.0f), x, y, 0, 0, 0);
+			}
+		}
+
+		allFaces.append(face);
+	}
+
+	return vkts::imageDataMerge(allFaces, "benchmark_cube.data", 1, 6);
+}
+
+//
+// Previous, single threaded implementations as reference.
+//
+
+static glm::vec3 benchmarkPrefilterGetScanVector(const uint32_t x, const uint32_t y, const uint32_t side, const float step, const float offset)
+{
+	glm::vec3 scanVector;
+
+	switch (side)
+	{
+		case 0:
+
+			// Positive X
+			scanVector = glm::vec3(1.0f, 1.0f - offset - step * (float)y, 1.0f - offset - step * (float)x);
+
+			break;
+		case 1:
+
+			// Negative X
+			scanVector = glm::vec3(-1.0f, 1.0f - offset - step * (float)y, -1.0f + offset + step * (float)x);
+
+			break;
+		case 2:
+
+			// Positive Y
+			scanVector = glm::vec3(-1.0f + offset + step * (float)x, 1.0f, -1.0f + offset + step * (float)y);
+
+			break;
+		case 3:
+
+			// Negative Y
+			scanVector = glm::vec3(-1.0f + offset + step * (float)x, -1.0f, 1.0f - offset - step * (float)y);
+
+			break;
+		case 4:
+
+			// Positive Z
+			scanVector = glm::vec3(-1.0f + offset + step * (float)x, 1.0f - offset - step * (float)y, 1.0f);
+
+			break;
+		case 5:
+
+			// Negative Z
+			scanVector = glm::vec3(1.0f - offset - step * (float)x, 1.0f - offset - step * (float)y, -1.0f);
+
+			break;
+		default:
+
+			// Invalid
+			return glm::vec3(NAN, NAN, NAN);
+	}
+
+	return glm::normalize(scanVector);
+}
+
+static glm::vec3 benchmarkPrefilterReferenceTexel(const uint32_t type, const vkts::IImageDataSP& sourceImage, const uint32_t samples, const glm::vec3& scanVector, const glm::mat3& basis, const float roughness)
+{
+	glm::vec3 color = glm::vec3(0.0f, 0.0f, 0.0f);
+
+	float sampleDivisior = 0.0f;
+
+	for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+	{
+		glm::vec2 randomPoint = vkts::randomHammersley(sampleIndex, samples);
+
+		glm::vec3 currentColor;
+
+		if (type == 0)
+		{
+			currentColor = vkts::renderCookTorrance(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, roughness);
+		}
+		else if (type == 1)
+		{
+			currentColor = vkts::renderOrenNayar(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, scanVector, roughness);
+		}
+		else
+		{
+			currentColor = vkts::renderLambert(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis);
+		}
+
+		if (!std::isnan(currentColor.x) && !std::isnan(currentColor.y) && !std::isnan(currentColor.z))
+		{
+			color += currentColor;
+
+			sampleDivisior += 1.0f;
+		}
+	}
+
+	if (sampleDivisior > 0.0f)
+	{
+		color = color / sampleDivisior;
+	}
+
+	return color;
+}
+
+static uint64_t benchmarkPrefilterReference(const uint32_t type, const vkts::IImageDataSP& sourceImage, const uint32_t samples, const vkts::SmartPointerVector<vkts::IImageDataSP>& allImages)
+{
+	const uint32_t roughnessSamples = allImages.size() / 6;
+
+	uint64_t texels = 0;
+
+	for (uint32_t side = 0; side < 6; side++)
+	{
+		for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+		{
+			// Diffuse scans all levels with the source length.
+			const uint32_t length = (type == 0) ? sourceImage->getWidth() / (1 << roughnessSampleIndex) : sourceImage->getWidth();
+
+			const float step = 2.0f / (float)length;
+			const float offset = step * 0.5f;
+
+			const float roughness = roughnessSamples > 1 ? (float)roughnessSampleIndex / (float)(roughnessSamples - 1) : 0.0f;
+
+			const auto& targetImage = allImages[side * roughnessSamples + roughnessSampleIndex];
+
+			for (uint32_t y = 0; y < length; y++)
+			{
+				for (uint32_t x = 0; x < length; x++)
+				{
+					glm::vec3 scanVector = benchmarkPrefilterGetScanVector(x, y, side, step, offset);
+
+					glm::mat3 basis = vkts::renderGetBasis(scanVector);
+
+					targetImage->setTexel(glm::vec4(benchmarkPrefilterReferenceTexel(type, sourceImage, samples, scanVector, basis, roughness), 1.0f), x, y, 0, 0, 0);
+
+					texels++;
+				}
+			}
+		}
+	}
+
+	return texels;
+}
+
+//
+
+static VkBool32 benchmarkPrefilterCompare(const vkts::SmartPointerVector<vkts::IImageDataSP>& allImages, const vkts::SmartPointerVector<vkts::IImageDataSP>& allReferenceImages)
+{
+	if (allImages.size() != allReferenceImages.size())
+	{
+		return VK_FALSE;
+	}
+
+	for (uint32_t i = 0; i < allImages.size(); i++)
+	{
+		const auto& image = allImages[i];
+		const auto& referenceImage = allReferenceImages[i];
+
+		for (uint32_t y = 0; y < image->getHeight(); y++)
+		{
+			for (uint32_t x = 0; x < image->getWidth(); x++)
+			{
+				const glm::vec4 texel = image->getTexel(x, y, 0, 0, 0);
+				const glm::vec4 referenceTexel = referenceImage->getTexel(x, y, 0, 0, 0);
+
+				if (memcmp(&texel, &referenceTexel, sizeof(glm::vec4)) != 0)
+				{
+					vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Prefilter texel differs in image %u at %u %u.", i, x, y);
+
+					return VK_FALSE;
+				}
+			}
+		}
+	}
+
+	return VK_TRUE;
+}
+
+VkBool32 benchmarkPrefilter()
+{
+	auto sourceImage = benchmarkPrefilterCreateCubeMap();
+
+	if (!sourceImage.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Could not create cube map.");
+
+		return VK_FALSE;
+	}
+
+	static const char* typeNames[3] = {"Cook-Torrance", "Oren-Nayar", "Lambert"};
+
+	for (uint32_t type = 0; type < 3; type++)
+	{
+		double start = vkts::timeGetRaw();
+
+		vkts::SmartPointerVector<vkts::IImageDataSP> allImages;
+
+		if (type == 0)
+		{
+			allImages = vkts::imageDataPrefilterCookTorrance(sourceImage, BENCHMARK_PREFILTER_SAMPLES, "benchmark.data");
+		}
+		else if (type == 1)
+		{
+			allImages = vkts::imageDataPrefilterOrenNayar(sourceImage, BENCHMARK_PREFILTER_SAMPLES, "benchmark.data");
+		}
+		else
+		{
+			allImages = vkts::imageDataPrefilterLambert(sourceImage, BENCHMARK_PREFILTER_SAMPLES, "benchmark.data");
+		}
+
+		const double seconds = vkts::timeGetRaw() - start;
+
+		if (allImages.size() == 0)
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: %s prefiltering failed.", typeNames[type]);
+
+			return VK_FALSE;
+		}
+
+		uint64_t texels = 0;
+
+		vkts::SmartPointerVector<vkts::IImageDataSP> allReferenceImages;
+
+		for (uint32_t i = 0; i < allImages.size(); i++)
+		{
+			texels += (uint64_t)allImages[i]->getWidth() * (uint64_t)allImages[i]->getHeight();
+
+			allReferenceImages.append(vkts::imageDataCreate("reference" + std::to_string(i) + ".data", allImages[i]->getWidth(), allImages[i]->getHeight(), 1, 0.0f, 0.0f, 0.0f, 0.0f, allImages[i]->getImageType(), allImages[i]->getFormat()));
+		}
+
+		start = vkts::timeGetRaw();
+
+		benchmarkPrefilterReference(type, sourceImage, BENCHMARK_PREFILTER_SAMPLES, allReferenceImages);
+
+		const double referenceSeconds = vkts::timeGetRaw() - start;
+
+		// Output has to be bit identical to the previous implementation.
+
+		if (!benchmarkPrefilterCompare(allImages, allReferenceImages))
+		{
+			return VK_FALSE;
+		}
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: %s prefilter texels/second = %.0f", typeNames[type], (double)texels / seconds);
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: %s reference texels/second = %.0f", typeNames[type], (double)texels / referenceSeconds);
+	}
+
+	return VK_TRUE;
+}
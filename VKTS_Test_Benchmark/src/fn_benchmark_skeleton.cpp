@@ -0,0 +1,603 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+#define BENCHMARK_SKELETON_ARMATURES 6
+#define BENCHMARK_SKELETON_JOINTS 24
+#define BENCHMARK_SKELETON_BUFFER_COUNT 2
+#define BENCHMARK_SKELETON_SLOTS 4
+#define BENCHMARK_SKELETON_FRAMES 8
+
+//
+// Joints uniform buffer backed by host memory, so the palettes can be compared without a Vulkan device.
+//
+
+class BenchmarkBuffer : public vkts::IBuffer
+{
+
+private:
+
+	const VkBufferCreateInfo bufferCreateInfo;
+
+public:
+
+	BenchmarkBuffer(const VkDeviceSize size) :
+		IBuffer(), bufferCreateInfo{VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO, nullptr, 0, size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE, 0, nullptr}
+	{
+	}
+
+	virtual ~BenchmarkBuffer()
+	{
+	}
+
+	virtual const VkDevice getDevice() const override
+	{
+		return VK_NULL_HANDLE;
+	}
+
+	virtual const VkBufferCreateInfo& getBufferCreateInfo() const override
+	{
+		return bufferCreateInfo;
+	}
+
+	virtual VkBufferCreateFlags getFlags() const override
+	{
+		return bufferCreateInfo.flags;
+	}
+
+	virtual VkDeviceSize getSize() const override
+	{
+		return bufferCreateInfo.size;
+	}
+
+	virtual VkBufferUsageFlags getUsage() const override
+	{
+		return bufferCreateInfo.usage;
+	}
+
+	virtual VkSharingMode getSharingMode() const override
+	{
+		return bufferCreateInfo.sharingMode;
+	}
+
+	virtual uint32_t getQueueFamilyIndexCount() const override
+	{
+		return bufferCreateInfo.queueFamilyIndexCount;
+	}
+
+	virtual const uint32_t* getQueueFamilyIndices() const override
+	{
+		return bufferCreateInfo.pQueueFamilyIndices;
+	}
+
+	virtual const VkBuffer getBuffer() const override
+	{
+		return VK_NULL_HANDLE;
+	}
+
+	virtual VkAccessFlags getAccessMask() const override
+	{
+		return 0;
+	}
+
+	virtual void getBufferMemoryRequirements(VkMemoryRequirements& memoryRequirements) const override
+	{
+		memoryRequirements.size = bufferCreateInfo.size;
+		memoryRequirements.alignment = 1;
+		memoryRequirements.memoryTypeBits = 1;
+	}
+
+	virtual VkResult bindBufferMemory(const VkDeviceMemory mem, const VkDeviceSize memOffset) const override
+	{
+		return VK_SUCCESS;
+	}
+
+	virtual void copyBuffer(const VkCommandBuffer cmdBuffer, std::shared_ptr<IBuffer>& targetBuffer, const VkBufferCopy& bufferCopy) override
+	{
+	}
+
+	virtual void copyBufferToImage(const VkCommandBuffer cmdBuffer, std::shared_ptr<vkts::IImage>& targetImage, const VkBufferImageCopy& bufferImageCopy) override
+	{
+	}
+
+	virtual void cmdPipelineBarrier(const VkCommandBuffer cmdBuffer, const VkAccessFlags dstAccessMask) override
+	{
+	}
+
+	virtual void destroy() override
+	{
+	}
+
+};
+
+class BenchmarkBufferObject : public vkts::IBufferObject
+{
+
+private:
+
+	const vkts::IContextObjectSP contextObject;
+
+	const vkts::IBufferSP buffer;
+
+	const vkts::IBufferViewSP bufferView;
+
+	const vkts::IDeviceMemorySP deviceMemory;
+
+	mutable std::vector<uint8_t> allBytes;
+
+	mutable uint32_t uploadCount;
+
+public:
+
+	BenchmarkBufferObject(const VkDeviceSize size) :
+		IBufferObject(), contextObject(), buffer(new BenchmarkBuffer(size)), bufferView(), deviceMemory(), allBytes((size_t)size, 0), uploadCount(0)
+	{
+	}
+
+	virtual ~BenchmarkBufferObject()
+	{
+	}
+
+	const std::vector<uint8_t>& getBytes() const
+	{
+		return allBytes;
+	}
+
+	uint32_t getUploadCount() const
+	{
+		return uploadCount;
+	}
+
+	virtual VkDeviceSize getBufferCount() const override
+	{
+		return BENCHMARK_SKELETON_BUFFER_COUNT;
+	}
+
+	virtual const vkts::IContextObjectSP& getContextObject() const override
+	{
+		return contextObject;
+	}
+
+	virtual const vkts::IBufferSP& getBuffer() const override
+	{
+		return buffer;
+	}
+
+	virtual const vkts::IBufferViewSP& getBufferView() const override
+	{
+		return bufferView;
+	}
+
+	virtual const vkts::IDeviceMemorySP& getDeviceMemory() const override
+	{
+		return deviceMemory;
+	}
+
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const void* data, const uint32_t size) const override
+	{
+		if (!data || (uint64_t)offset + (uint64_t)size > (uint64_t)allBytes.size())
+		{
+			return VK_FALSE;
+		}
+
+		memcpy(&allBytes[offset], data, size);
+
+		uploadCount++;
+
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const glm::mat4& mat) const override
+	{
+		return upload(offset, flags, glm::value_ptr(mat), sizeof(float) * 16);
+	}
+
+	// Same as the buffer object: Only the relevant columns and rows.
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const glm::mat3& mat) const override
+	{
+		return upload(offset, flags, glm::value_ptr(glm::mat4(mat)), sizeof(float) * 11);
+	}
+
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const glm::mat2& mat) const override
+	{
+		return upload(offset, flags, glm::value_ptr(glm::mat4(mat)), sizeof(float) * 6);
+	}
+
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const glm::vec4& vec) const override
+	{
+		return upload(offset, flags, glm::value_ptr(vec), sizeof(float) * 4);
+	}
+
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const glm::vec3& vec) const override
+	{
+		return upload(offset, flags, glm::value_ptr(vec), sizeof(float) * 3);
+	}
+
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const glm::vec2& vec) const override
+	{
+		return upload(offset, flags, glm::value_ptr(vec), sizeof(float) * 2);
+	}
+
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const float scalar) const override
+	{
+		return upload(offset, flags, &scalar, sizeof(float));
+	}
+
+	virtual VkBool32 upload(const uint32_t offset, const VkMemoryMapFlags flags, const int32_t scalar) const override
+	{
+		return upload(offset, flags, &scalar, sizeof(int32_t));
+	}
+
+	virtual void destroy() override
+	{
+	}
+
+};
+
+typedef std::shared_ptr<BenchmarkBufferObject> BenchmarkBufferObjectSP;
+
+//
+// Scene factory without any render objects.
+//
+
+class BenchmarkSceneRenderFactory : public vkts::ISceneRenderFactory
+{
+
+public:
+
+	BenchmarkSceneRenderFactory() :
+		ISceneRenderFactory()
+	{
+	}
+
+	virtual ~BenchmarkSceneRenderFactory()
+	{
+	}
+
+	virtual VkDeviceSize getBufferCount() const override
+	{
+		return 0;
+	}
+
+	virtual vkts::IRenderNodeSP createRenderNode(const vkts::ISceneManagerSP& sceneManager) override
+	{
+		return vkts::IRenderNodeSP();
+	}
+
+	virtual vkts::IRenderSubMeshSP createRenderSubMesh(const vkts::ISceneManagerSP& sceneManager) override
+	{
+		return vkts::IRenderSubMeshSP();
+	}
+
+	virtual vkts::IRenderMaterialSP createRenderMaterial(const vkts::ISceneManagerSP& sceneManager) override
+	{
+		return vkts::IRenderMaterialSP();
+	}
+
+	virtual VkBool32 preparePhongMaterial(const vkts::ISceneManagerSP& sceneManager, const vkts::IPhongMaterialSP& phongMaterial) override
+	{
+		return VK_FALSE;
+	}
+
+	virtual VkBool32 prepareBSDFMaterial(const vkts::ISceneManagerSP& sceneManager, const vkts::ISubMeshSP& subMesh) override
+	{
+		return VK_FALSE;
+	}
+
+	virtual VkBool32 prepareTransformUniformBuffer(const vkts::ISceneManagerSP& sceneManager, const vkts::INodeSP& node) override
+	{
+		return VK_FALSE;
+	}
+
+	virtual VkDeviceSize getTransformUniformBufferAlignmentSize(const vkts::ISceneManagerSP& sceneManager) const override
+	{
+		return 0;
+	}
+
+	virtual VkBool32 prepareJointsUniformBuffer(const vkts::ISceneManagerSP& sceneManager, const vkts::INodeSP& node, const int32_t joints) override
+	{
+		return VK_FALSE;
+	}
+
+	virtual VkDeviceSize getJointsUniformBufferAlignmentSize(const vkts::ISceneManagerSP& sceneManager) const override
+	{
+		return VKTS_MAX_JOINTS_BUFFERSIZE;
+	}
+
+	virtual vkts::SmartPointerVector<vkts::IImageDataSP> prefilterLambert(const vkts::ISceneManagerSP& sceneManager, const vkts::IImageDataSP& sourceImage, const uint32_t samples, const std::string& name) const override
+	{
+		return vkts::SmartPointerVector<vkts::IImageDataSP>();
+	}
+
+	virtual vkts::SmartPointerVector<vkts::IImageDataSP> prefilterCookTorrance(const vkts::ISceneManagerSP& sceneManager, const vkts::IImageDataSP& sourceImage, const uint32_t samples, const std::string& name) const override
+	{
+		return vkts::SmartPointerVector<vkts::IImageDataSP>();
+	}
+
+};
+
+//
+// Context without task executors, so the task graph runs on the calling thread.
+//
+
+class BenchmarkUpdateThreadContext : public vkts::IUpdateThreadContext
+{
+
+public:
+
+	BenchmarkUpdateThreadContext() :
+		IUpdateThreadContext()
+	{
+	}
+
+	virtual ~BenchmarkUpdateThreadContext()
+	{
+	}
+
+	virtual int32_t getThreadIndex() const override
+	{
+		return 0;
+	}
+
+	virtual int32_t getThreadCount() const override
+	{
+		return 1;
+	}
+
+	virtual double getTotalTime() const override
+	{
+		return 0.0;
+	}
+
+	virtual double getDeltaTime() const override
+	{
+		return 0.0;
+	}
+
+	virtual double getTickTime() const override
+	{
+		return 0.0;
+	}
+
+	virtual uint64_t getTotalTicks() const override
+	{
+		return 0;
+	}
+
+	virtual uint64_t getDeltaTicks() const override
+	{
+		return 0;
+	}
+
+	virtual VkBool32 sendTask(const vkts::ITaskSP& task) const override
+	{
+		return VK_FALSE;
+	}
+
+	virtual VkBool32 receiveExecutedTask(vkts::ITaskSP& task, const VkBool32 wait) const override
+	{
+		return VK_FALSE;
+	}
+
+	virtual void resetSendTasks() const override
+	{
+	}
+
+	virtual void resetExecutedTasks() const override
+	{
+	}
+
+};
+
+#define BENCHMARK_SKELETON_CHECK(condition, message) \
+	if (!(condition)) \
+	{ \
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Skeleton %s.", message); \
+		\
+		return VK_FALSE; \
+	}
+
+static void benchmarkSkeletonSetJoint(const vkts::INodeSP& joint, const uint32_t armature, const uint32_t index, const uint32_t frame)
+{
+	const float angle = 0.1f * (float)(armature + 1) + 0.05f * (float)index + 0.2f * (float)frame;
+
+	joint->setTranslate(glm::vec3(0.1f * (float)index, 1.0f + 0.01f * (float)frame, 0.5f * (float)armature));
+	joint->setRotate(vkts::rotateRzRyRx(angle, 0.5f * angle, 0.3f));
+	joint->setScale(glm::vec3(1.0f + 0.01f * (float)index));
+}
+
+/**
+ * Armatures 0 to 3 are in adjacent slots of the first buffer, armatures 4 and 5 in not adjacent slots of the second buffer.
+ */
+static vkts::ISceneSP benchmarkSkeletonCreateScene(const vkts::ISceneFactorySP& sceneFactory, const BenchmarkBufferObjectSP allBufferObjects[2], vkts::SmartPointerVector<vkts::INodeSP>& allJoints, vkts::SmartPointerVector<vkts::INodeSP>& allAttachedNodes)
+{
+	static const uint32_t slots[BENCHMARK_SKELETON_ARMATURES][2] = {{0, 0}, {0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 0}};
+
+	vkts::ISceneManagerSP sceneManager;
+
+	auto scene = sceneFactory->createScene(sceneManager);
+
+	if (!scene.get())
+	{
+		return vkts::ISceneSP();
+	}
+
+	for (uint32_t armature = 0; armature < BENCHMARK_SKELETON_ARMATURES; armature++)
+	{
+		auto object = sceneFactory->createObject(sceneManager);
+		auto rootNode = sceneFactory->createNode(sceneManager);
+		auto armatureNode = sceneFactory->createNode(sceneManager);
+
+		if (!object.get() || !rootNode.get() || !armatureNode.get())
+		{
+			return vkts::ISceneSP();
+		}
+
+		rootNode->setTranslate(glm::vec3((float)armature, 0.0f, -1.0f));
+		rootNode->setRotate(vkts::rotateRzRyRx(0.0f, 0.25f * (float)armature, 0.0f));
+
+		armatureNode->setTranslate(glm::vec3(0.0f, 0.5f, 0.0f));
+		armatureNode->setScale(glm::vec3(1.5f));
+
+		armatureNode->setJointsUniformBuffer(BENCHMARK_SKELETON_JOINTS, allBufferObjects[slots[armature][0]], slots[armature][1] * VKTS_MAX_JOINTS_BUFFERSIZE, VKTS_MAX_JOINTS_BUFFERSIZE);
+
+		rootNode->addChildNode(armatureNode);
+
+		// Joints form a binary tree. The palette index is not the order of the joints.
+
+		vkts::SmartPointerVector<vkts::INodeSP> allArmatureJoints;
+
+		for (uint32_t index = 0; index < BENCHMARK_SKELETON_JOINTS; index++)
+		{
+			auto joint = sceneFactory->createNode(sceneManager);
+
+			if (!joint.get())
+			{
+				return vkts::ISceneSP();
+			}
+
+			joint->setJointIndex((int32_t)(BENCHMARK_SKELETON_JOINTS - 1 - index));
+			joint->setInverseBindMatrix(vkts::translateMat4(0.0f, -(float)index, 0.0f));
+
+			benchmarkSkeletonSetJoint(joint, armature, index, 0);
+
+			if (index == 0)
+			{
+				armatureNode->addChildNode(joint);
+			}
+			else
+			{
+				allArmatureJoints[(index - 1) / 2]->addChildNode(joint);
+			}
+
+			allArmatureJoints.append(joint);
+			allJoints.append(joint);
+		}
+
+		// Attached to the last joint, e.g. a weapon.
+
+		auto attachedNode = sceneFactory->createNode(sceneManager);
+
+		if (!attachedNode.get())
+		{
+			return vkts::ISceneSP();
+		}
+
+		attachedNode->setTranslate(glm::vec3(0.0f, 0.0f, 0.25f));
+
+		allArmatureJoints[BENCHMARK_SKELETON_JOINTS - 1]->addChildNode(attachedNode);
+
+		allAttachedNodes.append(attachedNode);
+
+		object->setRootNode(rootNode);
+
+		scene->addObject(object);
+	}
+
+	return scene;
+}
+
+VkBool32 benchmarkSkeleton()
+{
+	auto sceneFactory = vkts::sceneFactoryCreate(vkts::ISceneRenderFactorySP(new BenchmarkSceneRenderFactory()));
+
+	BENCHMARK_SKELETON_CHECK(sceneFactory.get(), "scene factory creation failed");
+
+	const VkDeviceSize bufferSize = BENCHMARK_SKELETON_BUFFER_COUNT * BENCHMARK_SKELETON_SLOTS * VKTS_MAX_JOINTS_BUFFERSIZE;
+
+	// Scene updated recursively by the nodes as reference and the same scene updated by the skeleton batch.
+
+	const BenchmarkBufferObjectSP allReferenceBufferObjects[2] = {BenchmarkBufferObjectSP(new BenchmarkBufferObject(bufferSize)), BenchmarkBufferObjectSP(new BenchmarkBufferObject(bufferSize))};
+	const BenchmarkBufferObjectSP allBatchBufferObjects[2] = {BenchmarkBufferObjectSP(new BenchmarkBufferObject(bufferSize)), BenchmarkBufferObjectSP(new BenchmarkBufferObject(bufferSize))};
+
+	vkts::SmartPointerVector<vkts::INodeSP> allReferenceJoints;
+	vkts::SmartPointerVector<vkts::INodeSP> allReferenceAttachedNodes;
+	vkts::SmartPointerVector<vkts::INodeSP> allBatchJoints;
+	vkts::SmartPointerVector<vkts::INodeSP> allBatchAttachedNodes;
+
+	auto referenceScene = benchmarkSkeletonCreateScene(sceneFactory, allReferenceBufferObjects, allReferenceJoints, allReferenceAttachedNodes);
+	auto batchScene = benchmarkSkeletonCreateScene(sceneFactory, allBatchBufferObjects, allBatchJoints, allBatchAttachedNodes);
+
+	BENCHMARK_SKELETON_CHECK(referenceScene.get() && batchScene.get(), "scene creation failed");
+
+	BenchmarkUpdateThreadContext updateContext;
+
+	auto skeletonBatch = vkts::skeletonBatchCreate(updateContext, batchScene, 2);
+
+	BENCHMARK_SKELETON_CHECK(skeletonBatch.get(), "batch creation failed");
+	BENCHMARK_SKELETON_CHECK(skeletonBatch->getNumberSkeletons() == BENCHMARK_SKELETON_ARMATURES && skeletonBatch->getNumberJoints() == BENCHMARK_SKELETON_ARMATURES * BENCHMARK_SKELETON_JOINTS, "batch does not contain all joints");
+
+	for (uint32_t frame = 0; frame < BENCHMARK_SKELETON_FRAMES; frame++)
+	{
+		const uint32_t currentBuffer = frame % BENCHMARK_SKELETON_BUFFER_COUNT;
+
+		// After both buffers are initialized, only the joints of the armatures 1 and 3 change.
+
+		if (frame >= BENCHMARK_SKELETON_BUFFER_COUNT)
+		{
+			for (uint32_t armature = 1; armature < BENCHMARK_SKELETON_ARMATURES - 1; armature += 2)
+			{
+				for (uint32_t index = 0; index < BENCHMARK_SKELETON_JOINTS; index += 3)
+				{
+					benchmarkSkeletonSetJoint(allReferenceJoints[armature * BENCHMARK_SKELETON_JOINTS + index], armature, index, frame);
+					benchmarkSkeletonSetJoint(allBatchJoints[armature * BENCHMARK_SKELETON_JOINTS + index], armature, index, frame);
+				}
+			}
+		}
+
+		referenceScene->updateTransformRecursive(0.0, 0, 0.0, currentBuffer);
+
+		batchScene->updateTransformRecursive(0.0, 0, 0.0, currentBuffer, &skeletonBatch->getUpdateOverwrite());
+
+		const uint32_t uploadCount = allBatchBufferObjects[0]->getUploadCount() + allBatchBufferObjects[1]->getUploadCount();
+
+		BENCHMARK_SKELETON_CHECK(skeletonBatch->updateTransform(0.0, 0, 0.0, currentBuffer), "batch update failed");
+
+		// Palette has to be bit identical to the recursive update.
+
+		for (uint32_t i = 0; i < 2; i++)
+		{
+			BENCHMARK_SKELETON_CHECK(memcmp(&allReferenceBufferObjects[i]->getBytes()[0], &allBatchBufferObjects[i]->getBytes()[0], (size_t)bufferSize) == 0, "palette differs from the recursive update");
+		}
+
+		for (uint32_t i = 0; i < allReferenceAttachedNodes.size(); i++)
+		{
+			BENCHMARK_SKELETON_CHECK(memcmp(glm::value_ptr(allReferenceAttachedNodes[i]->getTransformMatrix()), glm::value_ptr(allBatchAttachedNodes[i]->getTransformMatrix()), sizeof(glm::mat4)) == 0, "attached node differs from the recursive update");
+		}
+
+		// Adjacent slots are uploaded at once: One upload for the first buffer and two for the second at first.
+		// Using the second buffer the first time marks the first one dirty again. Later only the range from armature 1 to 3 in the first buffer.
+
+		const uint32_t batchUploadCount = allBatchBufferObjects[0]->getUploadCount() + allBatchBufferObjects[1]->getUploadCount() - uploadCount;
+
+		BENCHMARK_SKELETON_CHECK(batchUploadCount == (frame <= BENCHMARK_SKELETON_BUFFER_COUNT ? 3u : 1u), "palettes are not uploaded by one upload per adjacent slots");
+	}
+
+	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Skeleton %u armatures x %u joints palette identical to the recursive update.", BENCHMARK_SKELETON_ARMATURES, BENCHMARK_SKELETON_JOINTS);
+
+	return VK_TRUE;
+}
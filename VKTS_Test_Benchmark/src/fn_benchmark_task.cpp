@@ -0,0 +1,262 @@
+/**
+ * VKTS Examples - Examples for Vulkan using VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "fn_benchmark.hpp"
+
+#define BENCHMARK_TASK_COUNT 200000
+#define BENCHMARK_TASK_BATCH 512
+#define BENCHMARK_TASK_WORK 256
+
+#define BENCHMARK_TASK_GRAPH_RUNS 200
+#define BENCHMARK_TASK_GRAPH_ELEMENTS 65536
+#define BENCHMARK_TASK_GRAPH_GRAIN 1024
+
+class BenchmarkTask : public vkts::ITask
+{
+
+private:
+
+	volatile float result;
+
+protected:
+
+	virtual VkBool32 execute() override
+	{
+		float value = (float)getID();
+
+		for (uint32_t i = 0; i < BENCHMARK_TASK_WORK; i++)
+		{
+			value = value * 0.5f + 1.0f;
+		}
+
+		result = value;
+
+		return VK_TRUE;
+	}
+
+public:
+
+	BenchmarkTask(const uint64_t id) :
+		ITask(id), result(0.0f)
+	{
+	}
+
+	virtual ~BenchmarkTask()
+	{
+	}
+
+};
+
+class BenchmarkTaskUpdateThread : public vkts::IUpdateThread
+{
+
+private:
+
+	vkts::SmartPointerVector<vkts::ITaskSP> allTasks;
+
+	double tasksPerSecond;
+
+	double graphsPerSecond;
+
+	VkBool32 benchmarkTaskGraph(const vkts::IUpdateThreadContext& updateContext)
+	{
+		auto taskGraph = vkts::taskGraphCreate(updateContext);
+
+		if (!taskGraph.get())
+		{
+			return VK_FALSE;
+		}
+
+		// Fork: Square all elements in parallel. Join: Sum them up.
+
+		std::vector<float> allElements(BENCHMARK_TASK_GRAPH_ELEMENTS);
+
+		double sum = 0.0;
+
+		const uint32_t fill = taskGraph->addParallelFor(0, BENCHMARK_TASK_GRAPH_ELEMENTS, BENCHMARK_TASK_GRAPH_GRAIN, [&allElements](const uint32_t begin, const uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				allElements[i] = (float)(i % 16);
+			}
+
+			return VK_TRUE;
+		});
+
+		const uint32_t square = taskGraph->addParallelFor(0, BENCHMARK_TASK_GRAPH_ELEMENTS, BENCHMARK_TASK_GRAPH_GRAIN, [&allElements](const uint32_t begin, const uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				allElements[i] = allElements[i] * allElements[i];
+			}
+
+			return VK_TRUE;
+		});
+
+		const uint32_t join = taskGraph->addParallelFor(0, 1, 1, [&allElements, &sum](const uint32_t begin, const uint32_t end)
+		{
+			sum = 0.0;
+
+			for (uint32_t i = 0; i < (uint32_t)allElements.size(); i++)
+			{
+				sum += (double)allElements[i];
+			}
+
+			return VK_TRUE;
+		});
+
+		taskGraph->addDependency(fill, square);
+		taskGraph->addDependency(square, join);
+
+		const double start = vkts::timeGetRaw();
+
+		for (uint32_t i = 0; i < BENCHMARK_TASK_GRAPH_RUNS; i++)
+		{
+			if (!taskGraph->run() || !taskGraph->wait())
+			{
+				return VK_FALSE;
+			}
+
+			// Sum of squares of 0..15, repeated.
+			if (sum != (double)(1240 * (BENCHMARK_TASK_GRAPH_ELEMENTS / 16)))
+			{
+				vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Task graph result wrong.");
+
+				return VK_FALSE;
+			}
+		}
+
+		graphsPerSecond = (double)BENCHMARK_TASK_GRAPH_RUNS / (vkts::timeGetRaw() - start);
+
+		return VK_TRUE;
+	}
+
+public:
+
+	BenchmarkTaskUpdateThread() :
+		IUpdateThread(), allTasks(), tasksPerSecond(0.0), graphsPerSecond(0.0)
+	{
+		for (uint64_t i = 0; i < BENCHMARK_TASK_BATCH; i++)
+		{
+			allTasks.append(vkts::ITaskSP(new BenchmarkTask(i)));
+		}
+	}
+
+	virtual ~BenchmarkTaskUpdateThread()
+	{
+	}
+
+	double getTasksPerSecond() const
+	{
+		return tasksPerSecond;
+	}
+
+	double getGraphsPerSecond() const
+	{
+		return graphsPerSecond;
+	}
+
+	virtual VkBool32 init(const vkts::IUpdateThreadContext& updateContext) override
+	{
+		tasksPerSecond = 0.0;
+
+		graphsPerSecond = 0.0;
+
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 update(const vkts::IUpdateThreadContext& updateContext) override
+	{
+		const double start = vkts::timeGetRaw();
+
+		uint32_t executedTasks = 0;
+
+		while (executedTasks < BENCHMARK_TASK_COUNT)
+		{
+			for (uint32_t i = 0; i < allTasks.size(); i++)
+			{
+				if (!updateContext.sendTask(allTasks[i]))
+				{
+					return VK_FALSE;
+				}
+			}
+
+			for (uint32_t i = 0; i < allTasks.size(); i++)
+			{
+				vkts::ITaskSP executedTask;
+
+				if (!updateContext.receiveExecutedTask(executedTask))
+				{
+					return VK_FALSE;
+				}
+			}
+
+			executedTasks += allTasks.size();
+		}
+
+		tasksPerSecond = (double)executedTasks / (vkts::timeGetRaw() - start);
+
+		if (!benchmarkTaskGraph(updateContext))
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Benchmark: Task graph failed.");
+		}
+
+		// Benchmark done, so stop the engine.
+		return VK_FALSE;
+	}
+
+	virtual void terminate(const vkts::IUpdateThreadContext& updateContext) override
+	{
+	}
+
+};
+
+VkBool32 benchmarkTask()
+{
+	auto updateThread = std::shared_ptr<BenchmarkTaskUpdateThread>(new BenchmarkTaskUpdateThread());
+
+	if (!vkts::engineAddUpdateThread(updateThread))
+	{
+		return VK_FALSE;
+	}
+
+	const uint32_t maxExecutorCount = glm::max(vkts::processorGetNumber(), 1u);
+
+	for (uint32_t executorCount = 1; executorCount <= maxExecutorCount; executorCount *= 2)
+	{
+		vkts::engineSetTaskExecutorCount(executorCount);
+
+		if (!vkts::engineRun())
+		{
+			return VK_FALSE;
+		}
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Task executors = %u tasks/second = %.0f", executorCount, updateThread->getTasksPerSecond());
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Benchmark: Task executors = %u task graphs/second = %.1f", executorCount, updateThread->getGraphsPerSecond());
+	}
+
+	return VK_TRUE;
+}